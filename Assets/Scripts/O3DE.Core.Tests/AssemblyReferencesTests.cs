@@ -0,0 +1,78 @@
+//
+// Copyright (c) Contributors to the Open 3D Engine Project.
+// For complete copyright and license terms please see the LICENSE at the root of this distribution.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+//
+
+using System.Reflection;
+using System.Runtime.Loader;
+using O3DE.Core.HotReload;
+
+namespace O3DE.Core.Tests;
+
+/// <summary>
+/// CoralHostManager only isolates user assemblies when
+/// AssemblyReferences.ResolvesSharedCore says O3DE.Core resolves to the shared
+/// instance from a user context. Here the "core" is this test assembly, which
+/// compiles AssemblyReferences in.
+/// </summary>
+public class AssemblyReferencesTests
+{
+    // Redirects every request for the core assembly to the already-loaded instance,
+    // the way a cross-context resolver in Coral.Managed would.
+    private sealed class SharingContext : AssemblyLoadContext
+    {
+        public SharingContext(string name) : base(name, isCollectible: true) { }
+
+        protected override Assembly? Load(AssemblyName assemblyName) =>
+            assemblyName.Name == typeof(AssemblyReferences).Assembly.GetName().Name
+                ? typeof(AssemblyReferences).Assembly
+                : null;
+    }
+
+    // Loads its own copy of the core assembly from disk.
+    private sealed class CopyingContext : AssemblyLoadContext
+    {
+        public CopyingContext(string name) : base(name, isCollectible: true) { }
+
+        protected override Assembly? Load(AssemblyName assemblyName) =>
+            assemblyName.Name == typeof(AssemblyReferences).Assembly.GetName().Name
+                ? LoadFromAssemblyPath(typeof(AssemblyReferences).Assembly.Location)
+                : null;
+    }
+
+    [Fact]
+    public void ResolvesSharedCore_ContextRedirectingToSharedInstance_ReturnsOne()
+    {
+        var context = new SharingContext("O3DEUser.Sharing");
+        try
+        {
+            AssemblyReferences.ResolvesSharedCore("O3DEUser.Sharing").Should().Be(1);
+        }
+        finally
+        {
+            context.Unload();
+        }
+    }
+
+    [Fact]
+    public void ResolvesSharedCore_ContextLoadingSecondCopy_ReturnsZero()
+    {
+        var context = new CopyingContext("O3DEUser.Copying");
+        try
+        {
+            AssemblyReferences.ResolvesSharedCore("O3DEUser.Copying").Should().Be(0);
+        }
+        finally
+        {
+            context.Unload();
+        }
+    }
+
+    [Fact]
+    public void ResolvesSharedCore_UnknownContext_ReturnsZero()
+    {
+        AssemblyReferences.ResolvesSharedCore("O3DEUser.DoesNotExist").Should().Be(0);
+    }
+}
@@ -0,0 +1,169 @@
+//
+// Copyright (c) Contributors to the Open 3D Engine Project.
+// For complete copyright and license terms please see the LICENSE at the root of this distribution.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+//
+
+using System.Runtime.InteropServices;
+using System.Text;
+using System.Threading.Tasks;
+using O3DE;
+
+namespace O3DE.Core.Tests;
+
+/// <summary>
+/// Tests for the managed producer side of the native script log ring
+/// (LogQueue.TryEnqueue). The ring is allocated and initialised here exactly
+/// the way ScriptLogQueue's constructor does it, so these exercise the same
+/// slot-claim / publish protocol the native consumer relies on.
+/// </summary>
+public unsafe class LogQueueTests : IDisposable
+{
+    private const uint Capacity = 8;
+
+    private readonly LogQueueHeader* m_header;
+
+    public LogQueueTests()
+    {
+        nuint blockSize = (nuint)(sizeof(LogQueueHeader) + Capacity * sizeof(LogRecord));
+        m_header = (LogQueueHeader*)NativeMemory.AlignedAlloc(blockSize, 64);
+        NativeMemory.Clear(m_header, blockSize);
+
+        m_header->Version = LogQueueHeader.CurrentVersion;
+        m_header->Size = (uint)sizeof(LogQueueHeader);
+        m_header->Capacity = Capacity;
+        m_header->RecordSize = (uint)sizeof(LogRecord);
+        for (uint i = 0; i < Capacity; i++)
+        {
+            RecordAt(i)->Sequence = i;
+        }
+    }
+
+    public void Dispose()
+    {
+        NativeMemory.AlignedFree(m_header);
+    }
+
+    private LogRecord* RecordAt(long position)
+    {
+        byte* records = (byte*)m_header + m_header->Size;
+        return (LogRecord*)(records + (position & (Capacity - 1)) * m_header->RecordSize);
+    }
+
+    private static string MessageOf(LogRecord* record)
+    {
+        return Encoding.UTF8.GetString(record->Message, record->Length);
+    }
+
+    // Mirrors ScriptLogQueue::DrainLocked releasing a slot.
+    private void Consume(long position)
+    {
+        RecordAt(position)->Sequence = position + Capacity;
+    }
+
+    [Fact]
+    public void TryEnqueue_WritesRecordAndPublishesSlot()
+    {
+        bool queued = LogQueue.TryEnqueue(m_header, LogLevel.Warning, "hello", 42, 1234);
+
+        queued.Should().BeTrue();
+        m_header->EnqueuePos.Should().Be(1);
+
+        LogRecord* record = RecordAt(0);
+        record->Sequence.Should().Be(1, "the consumer reads a slot once its sequence is position + 1");
+        record->Level.Should().Be((uint)LogLevel.Warning);
+        record->EntityId.Should().Be(42);
+        record->TimestampUs.Should().Be(1234);
+        MessageOf(record).Should().Be("hello");
+    }
+
+    [Fact]
+    public void TryEnqueue_EncodesNonAsciiAsUtf8()
+    {
+        LogQueue.TryEnqueue(m_header, LogLevel.Info, "größe ✓", 0, 0);
+
+        LogRecord* record = RecordAt(0);
+        record->Length.Should().Be((ushort)Encoding.UTF8.GetByteCount("größe ✓"));
+        MessageOf(record).Should().Be("größe ✓");
+    }
+
+    [Fact]
+    public void TryEnqueue_WhenRingIsFull_DropsAndCountsWithoutBlocking()
+    {
+        for (int i = 0; i < Capacity; i++)
+        {
+            LogQueue.TryEnqueue(m_header, LogLevel.Info, $"m{i}", 0, 0).Should().BeTrue();
+        }
+
+        bool queued = LogQueue.TryEnqueue(m_header, LogLevel.Info, "overflow", 0, 0);
+
+        queued.Should().BeTrue("a full ring is not a reason to fall back to the synchronous path");
+        m_header->DroppedCount.Should().Be(1);
+        m_header->EnqueuePos.Should().Be(Capacity);
+    }
+
+    [Fact]
+    public void TryEnqueue_AfterConsumerReleasesSlot_ReusesIt()
+    {
+        for (int i = 0; i < Capacity; i++)
+        {
+            LogQueue.TryEnqueue(m_header, LogLevel.Info, $"m{i}", 0, 0);
+        }
+        Consume(0);
+
+        LogQueue.TryEnqueue(m_header, LogLevel.Error, "wrapped", 7, 0).Should().BeTrue();
+
+        m_header->DroppedCount.Should().Be(0);
+        LogRecord* record = RecordAt(Capacity);
+        record->Sequence.Should().Be(Capacity + 1);
+        MessageOf(record).Should().Be("wrapped");
+    }
+
+    [Fact]
+    public void TryEnqueue_MessageLongerThanSlot_ReturnsFalseWithoutClaimingSlot()
+    {
+        string tooLong = new string('x', LogRecord.MessageCapacity + 1);
+
+        LogQueue.TryEnqueue(m_header, LogLevel.Info, tooLong, 0, 0).Should().BeFalse();
+
+        m_header->EnqueuePos.Should().Be(0);
+        RecordAt(0)->Sequence.Should().Be(0);
+    }
+
+    [Fact]
+    public void TryEnqueue_MultiByteMessageThatOverflowsOnlyWhenEncoded_ReturnsFalse()
+    {
+        // Fits by UTF-16 length, not by UTF-8 byte count.
+        string tooLong = new string('é', LogRecord.MessageCapacity / 2 + 1);
+
+        LogQueue.TryEnqueue(m_header, LogLevel.Info, tooLong, 0, 0).Should().BeFalse();
+
+        m_header->EnqueuePos.Should().Be(0);
+    }
+
+    [Fact]
+    public void TryEnqueue_ConcurrentProducers_EachClaimDistinctSlots()
+    {
+        // Capacity 8, 4 producers x 2 messages: exactly fills the ring with
+        // no drops, so every slot must be published exactly once.
+        Parallel.For(0, 4, producer =>
+        {
+            for (int i = 0; i < 2; i++)
+            {
+                LogQueue.TryEnqueue(m_header, LogLevel.Info, $"p{producer}-{i}", (ulong)producer + 1, 0);
+            }
+        });
+
+        m_header->EnqueuePos.Should().Be(Capacity);
+        m_header->DroppedCount.Should().Be(0);
+
+        var messages = new HashSet<string>();
+        for (long pos = 0; pos < Capacity; pos++)
+        {
+            RecordAt(pos)->Sequence.Should().Be(pos + 1);
+            messages.Add(MessageOf(RecordAt(pos)));
+        }
+        messages.Should().HaveCount((int)Capacity);
+    }
+}
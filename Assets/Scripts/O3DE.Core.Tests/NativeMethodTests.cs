@@ -0,0 +1,83 @@
+//
+// Copyright (c) Contributors to the Open 3D Engine Project.
+// For complete copyright and license terms please see the LICENSE at the root of this distribution.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+//
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using O3DE;
+using O3DE.Reflection;
+
+namespace O3DE.Core.Tests;
+
+/// <summary>
+/// Tests for the managed half of the typed dispatch path. NativeArgument's
+/// layout has to match InteropArgument in GenericDispatcher.h byte for byte;
+/// the argument-count check has to fire before anything crosses into native
+/// code (the ReflectionInternalCalls fields are never populated here).
+/// </summary>
+public class NativeMethodTests
+{
+    [Fact]
+    public void NativeArgument_Is16Bytes()
+    {
+        Unsafe.SizeOf<NativeArgument>().Should().Be(16);
+        Marshal.SizeOf<NativeArgument>().Should().Be(16);
+    }
+
+    [Fact]
+    public unsafe void NativeArgument_VectorFieldsAreXyzwFloatsAtOffsetZero()
+    {
+        NativeArgument arg = default;
+        arg.Quaternion = new Quaternion(1f, 2f, 3f, 4f);
+
+        float* floats = (float*)&arg;
+        floats[0].Should().Be(1f);
+        floats[1].Should().Be(2f);
+        floats[2].Should().Be(3f);
+        floats[3].Should().Be(4f);
+
+        arg = default;
+        arg.Vector3 = new Vector3(5f, 6f, 7f);
+        floats[0].Should().Be(5f);
+        floats[2].Should().Be(7f);
+        floats[3].Should().Be(0f, "the unused lane stays zeroed");
+    }
+
+    [Fact]
+    public void NativeArgument_EntityIdSharesTheUInt64Slot()
+    {
+        NativeArgument arg = default;
+        arg.UInt64 = 0x1122334455667788UL;
+        arg.Int64.Should().Be(0x1122334455667788L);
+        arg.UInt32.Should().Be(0x55667788u, "little-endian low word first, as the native union reads it");
+    }
+
+    [Fact]
+    public void Invoke_WrongArgumentCount_ThrowsBeforeCrossingIntoNative()
+    {
+        var method = NativeMethod.Method("TestClass", "Add", 2);
+
+        Action act = () =>
+        {
+            Span<NativeArgument> args = stackalloc NativeArgument[1];
+            method.Invoke(args);
+        };
+
+        act.Should().Throw<ArgumentException>().WithMessage("*TestClass.Add/2 takes 2 argument(s), got 1*");
+        method.IsResolved.Should().BeFalse();
+    }
+
+    [Fact]
+    public void Setter_TakesOneArgument()
+    {
+        var setter = NativeMethod.Setter(null, "GlobalValue");
+
+        Action act = () => setter.Invoke(default);
+
+        act.Should().Throw<ArgumentException>().WithMessage("*set GlobalValue takes 1 argument(s), got 0*");
+    }
+}
@@ -0,0 +1,131 @@
+//
+// Copyright (c) Contributors to the Open 3D Engine Project.
+// For complete copyright and license terms please see the LICENSE at the root of this distribution.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+//
+
+using System;
+using System.Threading;
+using O3DE;
+using O3DE.Reflection;
+
+namespace O3DE.Core.Tests;
+
+/// <summary>
+/// Tests for the [ParallelUpdate] thread context: writes made inside a
+/// partition are buffered until ApplyDeferredWrites, applied in partition
+/// order whatever order the workers ran in, and main-thread-only calls
+/// throw inside a partition.
+/// </summary>
+public class ParallelUpdateTests
+{
+    public ParallelUpdateTests()
+    {
+        InternalCalls.TransformWrites.Clear();
+        ParallelUpdate.EndPartition();
+    }
+
+    [Fact]
+    public void Defer_OutsidePartition_ReturnsFalse()
+    {
+        ParallelUpdate.IsActive.Should().BeFalse();
+        ParallelUpdate.DeferWorldPosition(1, Vector3.Zero).Should().BeFalse();
+    }
+
+    [Fact]
+    public void Defer_InsidePartition_IsAppliedOnlyByApplyDeferredWrites()
+    {
+        ParallelUpdate.Prepare(1);
+        ParallelUpdate.BeginPartition(0);
+        ParallelUpdate.IsActive.Should().BeTrue();
+        ParallelUpdate.DeferWorldPosition(7, Vector3.Zero).Should().BeTrue();
+        ParallelUpdate.DeferLocalUniformScale(7, 2f).Should().BeTrue();
+        ParallelUpdate.EndPartition();
+
+        InternalCalls.TransformWrites.Should().BeEmpty();
+
+        ParallelUpdate.ApplyDeferredWrites().Should().Be(2);
+        InternalCalls.TransformWrites.Should().Equal(
+            ("Transform_SetWorldPosition", 7UL),
+            ("Transform_SetLocalUniformScale", 7UL));
+
+        ParallelUpdate.ApplyDeferredWrites().Should().Be(0);
+    }
+
+    [Fact]
+    public void ApplyDeferredWrites_UsesPartitionOrder_NotCompletionOrder()
+    {
+        ParallelUpdate.Prepare(2);
+
+        // Partition 1 finishes first.
+        var second = new Thread(() =>
+        {
+            ParallelUpdate.BeginPartition(1);
+            ParallelUpdate.DeferLocalPosition(20, Vector3.Zero);
+            ParallelUpdate.EndPartition();
+        });
+        second.Start();
+        second.Join();
+
+        var first = new Thread(() =>
+        {
+            ParallelUpdate.BeginPartition(0);
+            ParallelUpdate.DeferWorldRotation(10, Quaternion.Identity);
+            ParallelUpdate.EndPartition();
+        });
+        first.Start();
+        first.Join();
+
+        ParallelUpdate.IsActive.Should().BeFalse("partitions are per thread");
+        ParallelUpdate.ApplyDeferredWrites().Should().Be(2);
+        InternalCalls.TransformWrites.Should().Equal(
+            ("Transform_SetWorldRotation", 10UL),
+            ("Transform_SetLocalPosition", 20UL));
+    }
+
+    [Fact]
+    public void Prepare_DropsWritesLeftFromAnUnappliedFrame()
+    {
+        ParallelUpdate.Prepare(1);
+        ParallelUpdate.BeginPartition(0);
+        ParallelUpdate.DeferLocalScale(3, Vector3.Zero);
+        ParallelUpdate.EndPartition();
+
+        ParallelUpdate.Prepare(1);
+        ParallelUpdate.ApplyDeferredWrites().Should().Be(0);
+    }
+
+    [Fact]
+    public void BeginPartition_OutOfRange_Throws()
+    {
+        ParallelUpdate.Prepare(1);
+        var act = () => ParallelUpdate.BeginPartition(1);
+        act.Should().Throw<ArgumentOutOfRangeException>();
+    }
+
+    [Fact]
+    public void MainThreadOnlyCalls_ThrowInsidePartition()
+    {
+        InternalCalls.ValidEntities.Add(5);
+        var entity = new Entity(5);
+
+        ParallelUpdate.Prepare(1);
+        ParallelUpdate.BeginPartition(0);
+        try
+        {
+            var destroy = () => entity.Destroy();
+            destroy.Should().Throw<InvalidOperationException>().WithMessage("*Entity.Destroy*");
+
+            var broadcast = () => NativeReflection.BroadcastEBusEvent("TickBus", "OnTick");
+            broadcast.Should().Throw<InvalidOperationException>();
+        }
+        finally
+        {
+            ParallelUpdate.EndPartition();
+        }
+
+        var outside = () => entity.Destroy();
+        outside.Should().NotThrow();
+    }
+}
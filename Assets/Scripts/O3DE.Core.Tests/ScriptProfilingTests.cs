@@ -0,0 +1,46 @@
+//
+// Copyright (c) Contributors to the Open 3D Engine Project.
+// For complete copyright and license terms please see the LICENSE at the root of this distribution.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+//
+
+using System;
+using O3DE;
+
+namespace O3DE.Core.Tests;
+
+/// <summary>
+/// The native ScriptProfiler calls the sampler through the raw address
+/// GetAllocatedBytesSampler hands out; calling it the same way here checks
+/// the signature it assumes (no arguments, 64-bit count of this thread's
+/// allocations).
+/// </summary>
+public class ScriptProfilingTests
+{
+    [Fact]
+    public unsafe void Sampler_ReportsThisThreadsAllocations()
+    {
+        long address = ScriptProfiling.GetAllocatedBytesSampler();
+        address.Should().NotBe(0);
+
+        var sampler = (delegate* unmanaged<long>)address;
+        long before = sampler();
+        var allocated = new byte[64 * 1024];
+        long after = sampler();
+
+        GC.KeepAlive(allocated);
+        (after - before).Should().BeGreaterOrEqualTo(allocated.Length);
+    }
+
+    [Fact]
+    public void CollectionCount_FollowsTheRuntime()
+    {
+        int before = ScriptProfiling.GetCollectionCount(0);
+        GC.Collect(0, GCCollectionMode.Forced, blocking: true);
+
+        ScriptProfiling.GetCollectionCount(0).Should().BeGreaterThan(before);
+        ScriptProfiling.GetCollectionCount(-1).Should().Be(0);
+        ScriptProfiling.GetCollectionCount(GC.MaxGeneration + 1).Should().Be(0);
+    }
+}
@@ -35,6 +35,12 @@ namespace O3DE
         public static void Log_Warning(string message) => WarningLogs.Add(message);
         public static void Log_Error(string message) => ErrorLogs.Add(message);
 
+        // Left null, as in a host with no native ScriptLogQueue running:
+        // Debug.cs then sends every message through the synchronous Log_*
+        // methods above, which is what the Debug tests assert against.
+        // LogQueueTests drives the ring producer directly instead.
+        internal static unsafe delegate* unmanaged<LogQueueHeader*> Log_GetQueue;
+
         // ------------------------------------------------------------
         // Entity hierarchy fixture - lets tests set up parent/child
         // relationships and validity without a live Coral host. Keyed by
@@ -53,6 +59,7 @@ namespace O3DE
         internal static NativeString Entity_GetName(ulong entityId) => string.Empty;
         internal static void Entity_SetName(ulong entityId, NativeString name) { }
         internal static Bool32 Entity_IsActive(ulong entityId) => ValidEntities.Contains(entityId);
+        internal static Bool32 Entity_AreScriptsReady(ulong entityId) => ValidEntities.Contains(entityId);
         internal static void Entity_Activate(ulong entityId) { }
         internal static void Entity_Deactivate(ulong entityId) { }
         internal static void Entity_Destroy(ulong entityId) { }
@@ -79,6 +86,21 @@ namespace O3DE
             return Entity.InvalidId;
         }
 
+        // ------------------------------------------------------------
+        // Transform writes, recorded in call order as (call, entity) so
+        // the ParallelUpdate tests can check what was applied and when.
+        // Only those tests write here, so Reset() (run concurrently by the
+        // other test classes) leaves it alone.
+        // ------------------------------------------------------------
+        internal static readonly List<(string Call, ulong EntityId)> TransformWrites = new();
+
+        internal static void Transform_SetWorldPosition(ulong entityId, Vector3 value) => TransformWrites.Add((nameof(Transform_SetWorldPosition), entityId));
+        internal static void Transform_SetLocalPosition(ulong entityId, Vector3 value) => TransformWrites.Add((nameof(Transform_SetLocalPosition), entityId));
+        internal static void Transform_SetWorldRotation(ulong entityId, Quaternion value) => TransformWrites.Add((nameof(Transform_SetWorldRotation), entityId));
+        internal static void Transform_SetWorldRotationEuler(ulong entityId, Vector3 value) => TransformWrites.Add((nameof(Transform_SetWorldRotationEuler), entityId));
+        internal static void Transform_SetLocalScale(ulong entityId, Vector3 value) => TransformWrites.Add((nameof(Transform_SetLocalScale), entityId));
+        internal static void Transform_SetLocalUniformScale(ulong entityId, float value) => TransformWrites.Add((nameof(Transform_SetLocalUniformScale), entityId));
+
         internal static unsafe int Entity_GetChildren(ulong entityId, ulong* outBuffer, int bufferCapacity)
         {
             GetChildrenCallCount++;
@@ -0,0 +1,51 @@
+//
+// Copyright (c) Contributors to the Open 3D Engine Project.
+// For complete copyright and license terms please see the LICENSE at the root of this distribution.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+//
+
+using O3DE;
+
+namespace O3DE.Core.Tests;
+
+/// <summary>
+/// The native tick scheduler reads a class's interval once, through
+/// ScriptComponent.GetUpdateInterval: 0 keeps it updating every frame,
+/// anything else time-slices it.
+/// </summary>
+public class UpdateIntervalTests
+{
+    private class EveryFrame { }
+
+    [UpdateInterval(4)]
+    private class EveryFourth { }
+
+    [UpdateInterval]
+    private class Deferrable { }
+
+    [UpdateInterval(-3)]
+    private class Negative { }
+
+    private class DerivedFromEveryFourth : EveryFourth { }
+
+    [Fact]
+    public void GetFrames_WithoutAttribute_IsZero()
+    {
+        UpdateIntervalAttribute.GetFrames(typeof(EveryFrame)).Should().Be(0);
+    }
+
+    [Fact]
+    public void GetFrames_ReturnsTheInterval_ClampedToOne()
+    {
+        UpdateIntervalAttribute.GetFrames(typeof(EveryFourth)).Should().Be(4);
+        UpdateIntervalAttribute.GetFrames(typeof(Deferrable)).Should().Be(1);
+        UpdateIntervalAttribute.GetFrames(typeof(Negative)).Should().Be(1);
+    }
+
+    [Fact]
+    public void GetFrames_IsInherited()
+    {
+        UpdateIntervalAttribute.GetFrames(typeof(DerivedFromEveryFourth)).Should().Be(4);
+    }
+}
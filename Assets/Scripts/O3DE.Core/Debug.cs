@@ -15,10 +15,41 @@ namespace O3DE
 {
     /// <summary>
     /// Debug logging utilities for O3DE scripting.
-    /// Messages are forwarded to the O3DE logging system.
+    /// Messages are forwarded to the O3DE logging system asynchronously: they
+    /// are queued on a native ring and printed by a background thread, so
+    /// output may trail the call by a few milliseconds.
     /// </summary>
     public static class Debug
     {
+        /// <summary>
+        /// Single sink for every overload below. Queues the message on the
+        /// native log ring, attributed to the entity whose script is running on
+        /// this thread; falls back to the synchronous internal calls when no
+        /// ring is available or the message is too long for a ring slot.
+        /// </summary>
+        internal static void Write(LogLevel level, string message)
+        {
+            Write(level, message, LogQueue.CurrentEntityId);
+        }
+
+        internal static void Write(LogLevel level, string message, ulong entityId)
+        {
+            if (LogQueue.TryEnqueue(level, message, entityId))
+            {
+                return;
+            }
+
+            unsafe
+            {
+                switch (level)
+                {
+                    case LogLevel.Error: InternalCalls.Log_Error(message); break;
+                    case LogLevel.Warning: InternalCalls.Log_Warning(message); break;
+                    default: InternalCalls.Log_Info(message); break;
+                }
+            }
+        }
+
         /// <summary>
         /// Formats <paramref name="format"/> with <paramref name="args"/>, falling back to a
         /// diagnostic-safe string if formatting itself throws (e.g. a mismatched placeholder
@@ -27,7 +58,7 @@ namespace O3DE
         /// </summary>
         /// <param name="format">The format string</param>
         /// <param name="args">The format arguments</param>
-        private static string SafeFormat(string format, object[] args)
+        internal static string SafeFormat(string format, object[] args)
         {
             try
             {
@@ -45,7 +76,7 @@ namespace O3DE
         /// <param name="message">The message to log</param>
         public static void Log(string message)
         {
-            unsafe { InternalCalls.Log_Info(message ?? "null"); }
+            Write(LogLevel.Info, message ?? "null");
         }
 
         /// <summary>
@@ -54,7 +85,7 @@ namespace O3DE
         /// <param name="obj">The object to log (ToString() will be called)</param>
         public static void Log(object? obj)
         {
-            unsafe { InternalCalls.Log_Info(obj?.ToString() ?? "null"); }
+            Write(LogLevel.Info, obj?.ToString() ?? "null");
         }
 
         /// <summary>
@@ -64,7 +95,7 @@ namespace O3DE
         /// <param name="args">The format arguments</param>
         public static void Log(string format, params object[] args)
         {
-            unsafe { InternalCalls.Log_Info(SafeFormat(format, args)); }
+            Write(LogLevel.Info, SafeFormat(format, args));
         }
 
         /// <summary>
@@ -73,7 +104,7 @@ namespace O3DE
         /// <param name="message">The warning message</param>
         public static void LogWarning(string message)
         {
-            unsafe { InternalCalls.Log_Warning(message ?? "null"); }
+            Write(LogLevel.Warning, message ?? "null");
         }
 
         /// <summary>
@@ -82,7 +113,7 @@ namespace O3DE
         /// <param name="obj">The object to log (ToString() will be called)</param>
         public static void LogWarning(object? obj)
         {
-            unsafe { InternalCalls.Log_Warning(obj?.ToString() ?? "null"); }
+            Write(LogLevel.Warning, obj?.ToString() ?? "null");
         }
 
         /// <summary>
@@ -92,7 +123,7 @@ namespace O3DE
         /// <param name="args">The format arguments</param>
         public static void LogWarning(string format, params object[] args)
         {
-            unsafe { InternalCalls.Log_Warning(SafeFormat(format, args)); }
+            Write(LogLevel.Warning, SafeFormat(format, args));
         }
 
         /// <summary>
@@ -101,7 +132,7 @@ namespace O3DE
         /// <param name="message">The error message</param>
         public static void LogError(string message)
         {
-            unsafe { InternalCalls.Log_Error(message ?? "null"); }
+            Write(LogLevel.Error, message ?? "null");
         }
 
         /// <summary>
@@ -110,7 +141,7 @@ namespace O3DE
         /// <param name="obj">The object to log (ToString() will be called)</param>
         public static void LogError(object? obj)
         {
-            unsafe { InternalCalls.Log_Error(obj?.ToString() ?? "null"); }
+            Write(LogLevel.Error, obj?.ToString() ?? "null");
         }
 
         /// <summary>
@@ -120,7 +151,7 @@ namespace O3DE
         /// <param name="args">The format arguments</param>
         public static void LogError(string format, params object[] args)
         {
-            unsafe { InternalCalls.Log_Error(SafeFormat(format, args)); }
+            Write(LogLevel.Error, SafeFormat(format, args));
         }
 
         /// <summary>
@@ -131,22 +162,19 @@ namespace O3DE
         {
             if (exception == null)
             {
-                unsafe { InternalCalls.Log_Error("null exception"); }
+                Write(LogLevel.Error, "null exception");
                 return;
             }
 
-            unsafe
+            Write(LogLevel.Error, $"Exception: {exception.GetType().Name}: {exception.Message}");
+            if (!string.IsNullOrEmpty(exception.StackTrace))
             {
-                InternalCalls.Log_Error($"Exception: {exception.GetType().Name}: {exception.Message}");
-                if (!string.IsNullOrEmpty(exception.StackTrace))
-                {
-                    InternalCalls.Log_Error($"Stack Trace:\n{exception.StackTrace}");
-                }
+                Write(LogLevel.Error, $"Stack Trace:\n{exception.StackTrace}");
             }
 
             if (exception.InnerException != null)
             {
-                unsafe { InternalCalls.Log_Error("--- Inner Exception ---"); }
+                Write(LogLevel.Error, "--- Inner Exception ---");
                 LogException(exception.InnerException);
             }
         }
@@ -165,7 +193,7 @@ namespace O3DE
                 string assertMessage = string.IsNullOrEmpty(message)
                     ? "Assertion failed!"
                     : $"Assertion failed: {message}";
-                unsafe { InternalCalls.Log_Error(assertMessage); }
+                Write(LogLevel.Error, assertMessage);
 
 #if DEBUG || O3DE_DEBUG
                 // In debug builds, also throw to help catch issues
@@ -188,7 +216,7 @@ namespace O3DE
             [CallerMemberName] string callerMemberName = "")
         {
             string fileName = System.IO.Path.GetFileName(callerFilePath);
-            unsafe { InternalCalls.Log_Info($"[{fileName}:{callerLineNumber} {callerMemberName}] {message}"); }
+            Write(LogLevel.Info, $"[{fileName}:{callerLineNumber} {callerMemberName}] {message}");
         }
 
         /// <summary>
@@ -199,7 +227,7 @@ namespace O3DE
         [Conditional("O3DE_DEBUG")]
         public static void LogDebug(string message)
         {
-            unsafe { InternalCalls.Log_Info($"[DEBUG] {message}"); }
+            Write(LogLevel.Info, $"[DEBUG] {message}");
         }
 
         /// <summary>
@@ -211,7 +239,7 @@ namespace O3DE
         [Conditional("O3DE_DEBUG")]
         public static void LogDebug(string format, params object[] args)
         {
-            unsafe { InternalCalls.Log_Info($"[DEBUG] {SafeFormat(format, args)}"); }
+            Write(LogLevel.Info, $"[DEBUG] {SafeFormat(format, args)}");
         }
     }
 }
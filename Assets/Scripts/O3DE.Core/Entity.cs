@@ -86,6 +86,7 @@ namespace O3DE
             }
             set
             {
+                ParallelUpdate.ThrowIfActive("Entity.Name (set)");
                 if (IsValid)
                     unsafe { InternalCalls.Entity_SetName(m_id, value ?? string.Empty); }
             }
@@ -104,6 +105,23 @@ namespace O3DE
             }
         }
 
+        /// <summary>
+        /// Gets whether every C# script on this entity has run its
+        /// <c>OnCreate</c>. Scripts can be started a few frames after their
+        /// entity activates when the activation frame budget is set; poll
+        /// this before relying on another entity's script. True for an
+        /// entity without scripts.
+        /// </summary>
+        public bool AreScriptsReady
+        {
+            get
+            {
+                if (!IsValid)
+                    return false;
+                unsafe { return InternalCalls.Entity_AreScriptsReady(m_id); }
+            }
+        }
+
         /// <summary>
         /// Gets the Transform component of this entity.
         /// This is cached for performance.
@@ -126,6 +144,7 @@ namespace O3DE
         /// </summary>
         public void Activate()
         {
+            ParallelUpdate.ThrowIfActive("Entity.Activate");
             if (IsValid)
             {
                 unsafe { InternalCalls.Entity_Activate(m_id); }
@@ -137,6 +156,7 @@ namespace O3DE
         /// </summary>
         public void Deactivate()
         {
+            ParallelUpdate.ThrowIfActive("Entity.Deactivate");
             if (IsValid)
             {
                 unsafe { InternalCalls.Entity_Deactivate(m_id); }
@@ -148,6 +168,7 @@ namespace O3DE
         /// </summary>
         public void Destroy()
         {
+            ParallelUpdate.ThrowIfActive("Entity.Destroy");
             if (IsValid)
             {
                 unsafe { InternalCalls.Entity_Destroy(m_id); }
@@ -7,9 +7,12 @@
  */
 
 using System;
+using System.Buffers.Binary;
 using System.Collections.Generic;
 using System.Globalization;
 using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Text;
 
 namespace O3DE
 {
@@ -452,6 +455,376 @@ namespace O3DE
         }
     }
 
+    /// <summary>
+    /// Typed binary form of a script's exposed-property values. Must match
+    /// ExposedPropertyBlock.h on the C++ side:
+    /// <code>
+    ///   Header   { u32 magic; u16 version; u16 count; u32 layoutHash; u32 size; }
+    ///   count x  { u32 nameHash; u8 type; u8 reserved; u16 payloadSize; payload[payloadSize] }
+    /// </code>
+    /// Little-endian. nameHash is FNV-1a over the member name's UTF-8 bytes;
+    /// layoutHash is FNV-1a over each entry's (nameHash, type) in order.
+    /// </summary>
+    public static class ExposedPropertyBlock
+    {
+        public const uint Magic = 0x31425045; // "EPB1"
+        public const ushort CurrentVersion = 1;
+        public const int HeaderSize = 16;
+        public const int EntryHeaderSize = 8;
+
+        public enum ValueType : byte
+        {
+            Invalid = 0,
+            Bool,
+            Byte,
+            SByte,
+            Int16,
+            UInt16,
+            Int32,
+            UInt32,
+            Int64,
+            UInt64,
+            Float,
+            Double,
+            String,
+        }
+
+        private const uint FnvOffsetBasis = 2166136261u;
+        private const uint FnvPrime = 16777619u;
+
+        internal static uint Fnv1a(uint hash, ReadOnlySpan<byte> bytes)
+        {
+            foreach (byte b in bytes)
+            {
+                hash ^= b;
+                hash *= FnvPrime;
+            }
+            return hash;
+        }
+
+        /// <summary>FNV-1a over the UTF-8 bytes of <paramref name="name"/>.</summary>
+        public static uint HashName(string name)
+        {
+            return Fnv1a(FnvOffsetBasis, Encoding.UTF8.GetBytes(name));
+        }
+
+        internal static uint StartLayoutHash() => FnvOffsetBasis;
+
+        internal static uint AddToLayoutHash(uint layoutHash, uint nameHash, ValueType type)
+        {
+            Span<byte> bytes = stackalloc byte[5];
+            BinaryPrimitives.WriteUInt32LittleEndian(bytes, nameHash);
+            bytes[4] = (byte)type;
+            return Fnv1a(layoutHash, bytes);
+        }
+
+        public static ValueType ValueTypeFor(Type t)
+        {
+            if (t == typeof(bool))   return ValueType.Bool;
+            if (t == typeof(byte))   return ValueType.Byte;
+            if (t == typeof(sbyte))  return ValueType.SByte;
+            if (t == typeof(short))  return ValueType.Int16;
+            if (t == typeof(ushort)) return ValueType.UInt16;
+            if (t == typeof(int))    return ValueType.Int32;
+            if (t == typeof(uint))   return ValueType.UInt32;
+            if (t == typeof(long))   return ValueType.Int64;
+            if (t == typeof(ulong))  return ValueType.UInt64;
+            if (t == typeof(float))  return ValueType.Float;
+            if (t == typeof(double)) return ValueType.Double;
+            if (t == typeof(string)) return ValueType.String;
+            return ValueType.Invalid;
+        }
+
+        internal static object? Decode(ValueType type, ReadOnlySpan<byte> payload)
+        {
+            return type switch
+            {
+                ValueType.Bool   => payload[0] != 0,
+                ValueType.Byte   => payload[0],
+                ValueType.SByte  => (sbyte)payload[0],
+                ValueType.Int16  => BinaryPrimitives.ReadInt16LittleEndian(payload),
+                ValueType.UInt16 => BinaryPrimitives.ReadUInt16LittleEndian(payload),
+                ValueType.Int32  => BinaryPrimitives.ReadInt32LittleEndian(payload),
+                ValueType.UInt32 => BinaryPrimitives.ReadUInt32LittleEndian(payload),
+                ValueType.Int64  => BinaryPrimitives.ReadInt64LittleEndian(payload),
+                ValueType.UInt64 => BinaryPrimitives.ReadUInt64LittleEndian(payload),
+                ValueType.Float  => BinaryPrimitives.ReadSingleLittleEndian(payload),
+                ValueType.Double => BinaryPrimitives.ReadDoubleLittleEndian(payload),
+                ValueType.String => Encoding.UTF8.GetString(payload),
+                _ => throw new FormatException($"Unsupported exposed-property value type {type}."),
+            };
+        }
+
+        internal static int PayloadSize(ValueType type)
+        {
+            return type switch
+            {
+                ValueType.Bool or ValueType.Byte or ValueType.SByte => 1,
+                ValueType.Int16 or ValueType.UInt16 => 2,
+                ValueType.Int32 or ValueType.UInt32 or ValueType.Float => 4,
+                ValueType.Int64 or ValueType.UInt64 or ValueType.Double => 8,
+                _ => -1, // variable (String) or unsupported
+            };
+        }
+
+        internal static void Encode(List<byte> output, ValueType type, object? value)
+        {
+            Span<byte> scratch = stackalloc byte[8];
+            switch (type)
+            {
+                case ValueType.Bool:   scratch[0] = (bool)value! ? (byte)1 : (byte)0; break;
+                case ValueType.Byte:   scratch[0] = (byte)value!; break;
+                case ValueType.SByte:  scratch[0] = (byte)(sbyte)value!; break;
+                case ValueType.Int16:  BinaryPrimitives.WriteInt16LittleEndian(scratch, (short)value!); break;
+                case ValueType.UInt16: BinaryPrimitives.WriteUInt16LittleEndian(scratch, (ushort)value!); break;
+                case ValueType.Int32:  BinaryPrimitives.WriteInt32LittleEndian(scratch, (int)value!); break;
+                case ValueType.UInt32: BinaryPrimitives.WriteUInt32LittleEndian(scratch, (uint)value!); break;
+                case ValueType.Int64:  BinaryPrimitives.WriteInt64LittleEndian(scratch, (long)value!); break;
+                case ValueType.UInt64: BinaryPrimitives.WriteUInt64LittleEndian(scratch, (ulong)value!); break;
+                case ValueType.Float:  BinaryPrimitives.WriteSingleLittleEndian(scratch, (float)value!); break;
+                case ValueType.Double: BinaryPrimitives.WriteDoubleLittleEndian(scratch, (double)value!); break;
+                case ValueType.String:
+                    output.AddRange(Encoding.UTF8.GetBytes((string?)value ?? string.Empty));
+                    return;
+                default:
+                    throw new ArgumentOutOfRangeException(nameof(type));
+            }
+            for (int i = 0; i < PayloadSize(type); i++)
+            {
+                output.Add(scratch[i]);
+            }
+        }
+    }
+
+    public static partial class ExposedPropertyHelpers
+    {
+        // Per script type: exposed members by name hash, plus one resolved
+        // apply plan per distinct block layout seen for that type. Keyed
+        // weakly so a collectible user assembly can still unload on hot
+        // reload.
+        private sealed class BlockApplier
+        {
+            public readonly Dictionary<uint, ExposedMember> MembersByNameHash = new();
+            public readonly Dictionary<uint, PlanSlot[]> PlansByLayout = new();
+        }
+
+        private readonly struct PlanSlot
+        {
+            public readonly uint NameHash;
+            public readonly ExposedPropertyBlock.ValueType Type;
+            public readonly ExposedMember? Member; // null: member no longer exists, entry is ignored
+            public readonly bool TypeMismatch;
+
+            public PlanSlot(uint nameHash, ExposedPropertyBlock.ValueType type, ExposedMember? member, bool typeMismatch)
+            {
+                NameHash = nameHash;
+                Type = type;
+                Member = member;
+                TypeMismatch = typeMismatch;
+            }
+        }
+
+        private static readonly ConditionalWeakTable<Type, BlockApplier> s_blockAppliers = new();
+
+        private static BlockApplier GetBlockApplier(object instance)
+        {
+            return s_blockAppliers.GetValue(instance.GetType(), _ =>
+            {
+                var applier = new BlockApplier();
+                foreach (var member in Enumerate(instance))
+                {
+                    applier.MembersByNameHash[ExposedPropertyBlock.HashName(member.Name)] = member;
+                }
+                return applier;
+            });
+        }
+
+        /// <summary>
+        /// Apply a typed exposed-property block (see <see cref="ExposedPropertyBlock"/>)
+        /// to <paramref name="instance"/>. No string parsing or conversion:
+        /// each entry is a fixed-size read assigned to the member resolved for
+        /// its slot, and that resolution is done once per (script type, block
+        /// layout).
+        ///
+        /// Entries naming a member the type no longer has are ignored, as in
+        /// <see cref="Apply"/>, and so are entries for a member whose type
+        /// has no block encoding (an enum, say). Returns the number of
+        /// entries that could not be applied because the member's type
+        /// changed or the setter threw, or -1 if the block is malformed; the caller should then fall back to
+        /// the string map.
+        /// </summary>
+        public static int ApplyBlock(object instance, ReadOnlySpan<byte> block, Action<string>? errorLogger = null)
+        {
+            if (instance is null)
+            {
+                return 0;
+            }
+
+            var log = errorLogger ?? Debug.LogError;
+            if (block.Length < ExposedPropertyBlock.HeaderSize
+                || BinaryPrimitives.ReadUInt32LittleEndian(block) != ExposedPropertyBlock.Magic
+                || BinaryPrimitives.ReadUInt16LittleEndian(block.Slice(4)) != ExposedPropertyBlock.CurrentVersion
+                || BinaryPrimitives.ReadUInt32LittleEndian(block.Slice(12)) != (uint)block.Length)
+            {
+                log($"[ExposedProperty] Ignoring malformed property block for {instance.GetType().FullName}.");
+                return -1;
+            }
+
+            int count = BinaryPrimitives.ReadUInt16LittleEndian(block.Slice(6));
+            uint layoutHash = BinaryPrimitives.ReadUInt32LittleEndian(block.Slice(8));
+
+            var applier = GetBlockApplier(instance);
+            PlanSlot[]? plan;
+            lock (applier)
+            {
+                applier.PlansByLayout.TryGetValue(layoutHash, out plan);
+            }
+            plan = plan != null && plan.Length == count ? plan : null;
+
+            // The cached plan is shared with concurrent applies of the same
+            // layout: never written in place. The first slot that doesn't
+            // match copies it and the copy is published once complete.
+            bool cachedPlan = plan != null;
+            var resolved = plan ?? new PlanSlot[count];
+            int failures = 0;
+            int offset = ExposedPropertyBlock.HeaderSize;
+
+            for (int i = 0; i < count; i++)
+            {
+                if (offset + ExposedPropertyBlock.EntryHeaderSize > block.Length)
+                {
+                    log($"[ExposedProperty] Truncated property block for {instance.GetType().FullName}.");
+                    return -1;
+                }
+
+                uint nameHash = BinaryPrimitives.ReadUInt32LittleEndian(block.Slice(offset));
+                var type = (ExposedPropertyBlock.ValueType)block[offset + 4];
+                int payloadSize = BinaryPrimitives.ReadUInt16LittleEndian(block.Slice(offset + 6));
+                offset += ExposedPropertyBlock.EntryHeaderSize;
+
+                int expectedSize = ExposedPropertyBlock.PayloadSize(type);
+                if (offset + payloadSize > block.Length
+                    || (expectedSize >= 0 && payloadSize != expectedSize)
+                    || (expectedSize < 0 && type != ExposedPropertyBlock.ValueType.String))
+                {
+                    log($"[ExposedProperty] Malformed entry {i} in property block for {instance.GetType().FullName}.");
+                    return -1;
+                }
+                var payload = block.Slice(offset, payloadSize);
+                offset += payloadSize;
+
+                // A cached plan is trusted only while each slot still matches
+                // the entry in front of it; anything else re-resolves.
+                if (!cachedPlan || resolved[i].NameHash != nameHash || resolved[i].Type != type)
+                {
+                    if (cachedPlan)
+                    {
+                        resolved = (PlanSlot[])resolved.Clone();
+                        cachedPlan = false;
+                    }
+
+                    ExposedMember? member = applier.MembersByNameHash.TryGetValue(nameHash, out var found) ? found : null;
+                    var memberType = member.HasValue ? ExposedPropertyBlock.ValueTypeFor(member.Value.MemberType) : ExposedPropertyBlock.ValueType.Invalid;
+                    if (memberType == ExposedPropertyBlock.ValueType.Invalid)
+                    {
+                        member = null; // No block encoding: skipped like a missing member
+                    }
+                    resolved[i] = new PlanSlot(nameHash, type, member, member.HasValue && memberType != type);
+                }
+
+                var slot = resolved[i];
+                if (!slot.Member.HasValue)
+                {
+                    continue;
+                }
+                if (slot.TypeMismatch)
+                {
+                    failures++;
+                    continue;
+                }
+
+                try
+                {
+                    slot.Member.Value.SetValue(instance, ExposedPropertyBlock.Decode(type, payload));
+                }
+                catch (Exception ex)
+                {
+                    failures++;
+                    log($"[ExposedProperty] Failed to apply '{slot.Member.Value.Name}' on {instance.GetType().FullName}: {ex.Message}");
+                }
+            }
+
+            if (!cachedPlan)
+            {
+                lock (applier)
+                {
+                    applier.PlansByLayout[layoutHash] = resolved;
+                }
+            }
+            return failures;
+        }
+
+        /// <summary>
+        /// Encode the current values of <paramref name="instance"/>'s exposed
+        /// members into a block in the same format the C++ side builds.
+        /// Members whose type has no block encoding are skipped.
+        /// </summary>
+        public static byte[] EncodeBlock(object instance)
+        {
+            var output = new List<byte>(64);
+            for (int i = 0; i < ExposedPropertyBlock.HeaderSize; i++)
+            {
+                output.Add(0);
+            }
+
+            uint layoutHash = ExposedPropertyBlock.StartLayoutHash();
+            int count = 0;
+            Span<byte> entryHeader = stackalloc byte[ExposedPropertyBlock.EntryHeaderSize];
+
+            if (instance != null)
+            {
+                foreach (var member in Enumerate(instance))
+                {
+                    var type = ExposedPropertyBlock.ValueTypeFor(member.MemberType);
+                    if (type == ExposedPropertyBlock.ValueType.Invalid)
+                    {
+                        continue;
+                    }
+
+                    uint nameHash = ExposedPropertyBlock.HashName(member.Name);
+                    int headerAt = output.Count;
+                    output.AddRange(new byte[ExposedPropertyBlock.EntryHeaderSize]);
+                    ExposedPropertyBlock.Encode(output, type, member.GetValue(instance));
+                    int payloadSize = output.Count - headerAt - ExposedPropertyBlock.EntryHeaderSize;
+                    if (payloadSize > ushort.MaxValue)
+                    {
+                        throw new InvalidOperationException($"Exposed property '{member.Name}' is too large for a property block.");
+                    }
+
+                    BinaryPrimitives.WriteUInt32LittleEndian(entryHeader, nameHash);
+                    entryHeader[4] = (byte)type;
+                    entryHeader[5] = 0;
+                    BinaryPrimitives.WriteUInt16LittleEndian(entryHeader.Slice(6), (ushort)payloadSize);
+                    for (int b = 0; b < entryHeader.Length; b++)
+                    {
+                        output[headerAt + b] = entryHeader[b];
+                    }
+
+                    layoutHash = ExposedPropertyBlock.AddToLayoutHash(layoutHash, nameHash, type);
+                    count++;
+                }
+            }
+
+            var result = output.ToArray();
+            BinaryPrimitives.WriteUInt32LittleEndian(result, ExposedPropertyBlock.Magic);
+            BinaryPrimitives.WriteUInt16LittleEndian(result.AsSpan(4), ExposedPropertyBlock.CurrentVersion);
+            BinaryPrimitives.WriteUInt16LittleEndian(result.AsSpan(6), (ushort)count);
+            BinaryPrimitives.WriteUInt32LittleEndian(result.AsSpan(8), layoutHash);
+            BinaryPrimitives.WriteUInt32LittleEndian(result.AsSpan(12), (uint)result.Length);
+            return result;
+        }
+    }
+
     /// <summary>
     /// One discovered exposed member - either a field or an auto-property.
     /// Abstracts over MemberInfo so callers don't have to special-case.
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+using System.Linq;
+using System.Runtime.Loader;
+
+namespace O3DE.Core.HotReload
+{
+    /// <summary>
+    /// Reference information the native host needs to reload user assemblies
+    /// selectively. Each user assembly lives in its own load context, and when
+    /// one is reloaded every assembly referencing it has to be reloaded too;
+    /// CoralHostManager asks here which assemblies that is.
+    /// </summary>
+    public static class AssemblyReferences
+    {
+        /// <summary>
+        /// Simple names of the assemblies referenced by <paramref name="assemblyName"/>
+        /// in the load context named <paramref name="contextName"/>, joined with ';'.
+        /// Empty if the context or assembly is not found.
+        /// </summary>
+        public static string GetReferencedAssemblyNames(string contextName, string assemblyName)
+        {
+            foreach (var context in AssemblyLoadContext.All)
+            {
+                if (!string.Equals(context.Name, contextName, StringComparison.Ordinal))
+                {
+                    continue;
+                }
+
+                foreach (var assembly in context.Assemblies)
+                {
+                    if (!string.Equals(assembly.GetName().Name, assemblyName, StringComparison.Ordinal))
+                    {
+                        continue;
+                    }
+
+                    return string.Join(";", assembly.GetReferencedAssemblies()
+                        .Select(reference => reference.Name)
+                        .Where(name => !string.IsNullOrEmpty(name)));
+                }
+            }
+
+            return string.Empty;
+        }
+
+        /// <summary>
+        /// 1 if resolving O3DE.Core from the load context named
+        /// <paramref name="contextName"/> yields this very O3DE.Core instance.
+        /// User assemblies can only live in their own contexts when it does:
+        /// a second copy would give them a different ScriptComponent type.
+        /// 0 if the context is not found, resolution fails, or it loads another
+        /// copy. An int rather than a bool so it crosses Coral's interop as-is.
+        /// </summary>
+        public static int ResolvesSharedCore(string contextName)
+        {
+            var core = typeof(AssemblyReferences).Assembly;
+            foreach (var context in AssemblyLoadContext.All)
+            {
+                if (!string.Equals(context.Name, contextName, StringComparison.Ordinal))
+                {
+                    continue;
+                }
+
+                try
+                {
+                    return ReferenceEquals(context.LoadFromAssemblyName(core.GetName()), core) ? 1 : 0;
+                }
+                catch (Exception)
+                {
+                    return 0;
+                }
+            }
+
+            return 0;
+        }
+    }
+}
@@ -0,0 +1,554 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.Linq.Expressions;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace O3DE.Core.HotReload
+{
+    /// <summary>
+    /// Compact binary snapshot of a script instance's field state. The C++
+    /// <c>CSharpScriptComponent</c> takes one before the script's assembly is
+    /// unloaded for a hot reload, holds the bytes natively across the unload,
+    /// and applies them to the re-created instance - so nothing from the old
+    /// load context has to survive the reload.
+    ///
+    /// Layout (little-endian):
+    /// <code>
+    ///   Header   { u32 magic; u16 version; u16 count; u32 layoutHash; u32 size; }
+    ///   count x  { u32 nameHash; u8 kind; u8 flags; u16 payloadSize; u32 typeHash; payload[payloadSize] }
+    /// </code>
+    /// <c>kind</c> is an <see cref="ExposedPropertyBlock.ValueType"/> for
+    /// primitives and strings, or <see cref="Kind.Enum"/> /
+    /// <see cref="Kind.Unmanaged"/>. <c>typeHash</c> identifies the field
+    /// type (full name, plus the field layout for unmanaged structs);
+    /// <c>layoutHash</c> covers every entry's (nameHash, kind, typeHash).
+    ///
+    /// Captured: instance fields of primitive, string, enum and unmanaged
+    /// struct type (Vector3, Quaternion, ...), declared on the script type and
+    /// its bases below the caller's stop type. Readonly, const and
+    /// <see cref="NonSerializedAttribute"/> fields are skipped; auto-property
+    /// backing fields are included. Reference-typed state (lists, other
+    /// objects) is not preserved - <c>OnCreate</c> rebuilds it.
+    ///
+    /// Matching entries to the new type's fields (by name and type) happens
+    /// once per (type, layoutHash); every other instance of the type reuses
+    /// that plan. Each field is read and written through a typed accessor
+    /// compiled once per type, so per instance there is no reflection and no
+    /// boxing of the values. Only class instances are supported.
+    /// </summary>
+    public static class ScriptStateSnapshot
+    {
+        public const uint Magic = 0x31545353; // "SST1"
+        public const ushort CurrentVersion = 1;
+        public const int HeaderSize = 16;
+        public const int EntryHeaderSize = 12;
+
+        /// <summary>Entry kinds beyond the <see cref="ExposedPropertyBlock.ValueType"/> range.</summary>
+        public enum Kind : byte
+        {
+            Enum = 64,      // payload: 8-byte underlying value
+            Unmanaged = 65, // payload: raw struct bytes
+        }
+
+        private const byte FlagNull = 0x1;
+
+        private sealed class FieldSlot
+        {
+            public FieldInfo Field = null!;
+            public uint NameHash;
+            public byte Kind;
+            public uint TypeHash;
+            public int RawSize;
+            public FieldAccessor Access = null!;
+        }
+
+        // Per script type: the capturable fields in capture order, the same
+        // by (nameHash, typeHash) for restore, and one restore plan per
+        // snapshot layout seen. Weakly keyed so a collectible user assembly
+        // can still unload.
+        private sealed class TypeState
+        {
+            public FieldSlot[] Fields = Array.Empty<FieldSlot>();
+            public readonly Dictionary<uint, FieldSlot> FieldsByNameHash = new();
+            public readonly Dictionary<uint, FieldSlot?[]> PlansByLayout = new();
+            public int PlansResolved;
+        }
+
+        private static readonly ConditionalWeakTable<Type, TypeState> s_types = new();
+
+        /// <summary>
+        /// Encode <paramref name="instance"/>'s capturable fields. Fields
+        /// declared on <paramref name="stopAt"/> and its bases are left out
+        /// (O3DE passes <c>ScriptComponent</c>, whose fields belong to the
+        /// native binding). A given type must always be used with the same
+        /// <paramref name="stopAt"/>.
+        /// </summary>
+        public static byte[] Capture(object instance, Type? stopAt = null)
+        {
+            var state = GetTypeState(instance.GetType(), stopAt);
+            var output = new List<byte>(HeaderSize + state.Fields.Length * (EntryHeaderSize + 8));
+            for (int i = 0; i < HeaderSize; i++)
+            {
+                output.Add(0);
+            }
+
+            uint layoutHash = ExposedPropertyBlock.StartLayoutHash();
+            int count = 0;
+            Span<byte> entryHeader = stackalloc byte[EntryHeaderSize];
+
+            foreach (var slot in state.Fields)
+            {
+                int headerAt = output.Count;
+                for (int i = 0; i < EntryHeaderSize; i++)
+                {
+                    output.Add(0);
+                }
+
+                byte flags = slot.Access.Write(instance, output) ? (byte)0 : FlagNull;
+
+                int payloadSize = output.Count - headerAt - EntryHeaderSize;
+                if (payloadSize > ushort.MaxValue)
+                {
+                    // Too large for an entry (a huge string): not preserved.
+                    output.RemoveRange(headerAt, output.Count - headerAt);
+                    continue;
+                }
+
+                BinaryPrimitives.WriteUInt32LittleEndian(entryHeader, slot.NameHash);
+                entryHeader[4] = slot.Kind;
+                entryHeader[5] = flags;
+                BinaryPrimitives.WriteUInt16LittleEndian(entryHeader.Slice(6), (ushort)payloadSize);
+                BinaryPrimitives.WriteUInt32LittleEndian(entryHeader.Slice(8), slot.TypeHash);
+                for (int b = 0; b < EntryHeaderSize; b++)
+                {
+                    output[headerAt + b] = entryHeader[b];
+                }
+
+                layoutHash = AddToLayoutHash(layoutHash, slot.NameHash, slot.Kind, slot.TypeHash);
+                count++;
+            }
+
+            var result = output.ToArray();
+            BinaryPrimitives.WriteUInt32LittleEndian(result, Magic);
+            BinaryPrimitives.WriteUInt16LittleEndian(result.AsSpan(4), CurrentVersion);
+            BinaryPrimitives.WriteUInt16LittleEndian(result.AsSpan(6), (ushort)count);
+            BinaryPrimitives.WriteUInt32LittleEndian(result.AsSpan(8), layoutHash);
+            BinaryPrimitives.WriteUInt32LittleEndian(result.AsSpan(12), (uint)result.Length);
+            return result;
+        }
+
+        /// <summary>
+        /// Apply a snapshot taken by <see cref="Capture"/> - typically of the
+        /// previous version of the type - to <paramref name="instance"/>.
+        /// Entries whose field no longer exists are ignored; fields the
+        /// snapshot doesn't mention keep their current value. Returns the
+        /// number of entries whose field still exists but changed type (left
+        /// untouched), or -1 if the snapshot is malformed.
+        /// </summary>
+        public static int Restore(object instance, ReadOnlySpan<byte> snapshot, Type? stopAt = null)
+        {
+            if (snapshot.Length < HeaderSize
+                || BinaryPrimitives.ReadUInt32LittleEndian(snapshot) != Magic
+                || BinaryPrimitives.ReadUInt16LittleEndian(snapshot.Slice(4)) != CurrentVersion
+                || BinaryPrimitives.ReadUInt32LittleEndian(snapshot.Slice(12)) != (uint)snapshot.Length)
+            {
+                return -1;
+            }
+
+            int count = BinaryPrimitives.ReadUInt16LittleEndian(snapshot.Slice(6));
+            uint layoutHash = BinaryPrimitives.ReadUInt32LittleEndian(snapshot.Slice(8));
+
+            var state = GetTypeState(instance.GetType(), stopAt);
+            FieldSlot?[]? plan;
+            lock (state)
+            {
+                state.PlansByLayout.TryGetValue(layoutHash, out plan);
+            }
+            bool cachedPlan = plan != null && plan.Length == count;
+            var resolved = cachedPlan ? plan! : new FieldSlot?[count];
+
+            int mismatches = 0;
+            int offset = HeaderSize;
+            for (int i = 0; i < count; i++)
+            {
+                if (offset + EntryHeaderSize > snapshot.Length)
+                {
+                    return -1;
+                }
+
+                uint nameHash = BinaryPrimitives.ReadUInt32LittleEndian(snapshot.Slice(offset));
+                byte kind = snapshot[offset + 4];
+                byte flags = snapshot[offset + 5];
+                int payloadSize = BinaryPrimitives.ReadUInt16LittleEndian(snapshot.Slice(offset + 6));
+                uint typeHash = BinaryPrimitives.ReadUInt32LittleEndian(snapshot.Slice(offset + 8));
+                offset += EntryHeaderSize;
+                if (offset + payloadSize > snapshot.Length)
+                {
+                    return -1;
+                }
+                var payload = snapshot.Slice(offset, payloadSize);
+                offset += payloadSize;
+
+                if (!cachedPlan)
+                {
+                    resolved[i] = state.FieldsByNameHash.TryGetValue(nameHash, out var candidate) ? candidate : null;
+                }
+
+                var slot = resolved[i];
+                if (slot == null)
+                {
+                    continue; // field removed
+                }
+                if (slot.Kind != kind || slot.TypeHash != typeHash)
+                {
+                    mismatches++;
+                    continue;
+                }
+
+                bool isNull = (flags & FlagNull) != 0;
+                if (!isNull)
+                {
+                    if (kind == (byte)Kind.Enum)
+                    {
+                        if (payloadSize != 8)
+                        {
+                            return -1;
+                        }
+                    }
+                    else if (kind == (byte)Kind.Unmanaged)
+                    {
+                        if (payloadSize != slot.RawSize)
+                        {
+                            mismatches++;
+                            continue;
+                        }
+                    }
+                    else
+                    {
+                        var valueType = (ExposedPropertyBlock.ValueType)kind;
+                        int expected = ExposedPropertyBlock.PayloadSize(valueType);
+                        if (expected >= 0 ? payloadSize != expected : valueType != ExposedPropertyBlock.ValueType.String)
+                        {
+                            return -1;
+                        }
+                    }
+                }
+
+                slot.Access.Read(instance, payload, isNull);
+            }
+
+            if (!cachedPlan)
+            {
+                lock (state)
+                {
+                    state.PlansByLayout[layoutHash] = resolved;
+                    state.PlansResolved++;
+                }
+            }
+            return mismatches;
+        }
+
+        /// <summary>
+        /// How many restore plans have been resolved for
+        /// <paramref name="type"/>; a restore that reuses a cached plan
+        /// doesn't count. For tests.
+        /// </summary>
+        internal static int ResolvedPlanCount(Type type, Type? stopAt = null)
+        {
+            var state = GetTypeState(type, stopAt);
+            lock (state)
+            {
+                return state.PlansResolved;
+            }
+        }
+
+        private static uint AddToLayoutHash(uint layoutHash, uint nameHash, byte kind, uint typeHash)
+        {
+            Span<byte> bytes = stackalloc byte[9];
+            BinaryPrimitives.WriteUInt32LittleEndian(bytes, nameHash);
+            bytes[4] = kind;
+            BinaryPrimitives.WriteUInt32LittleEndian(bytes.Slice(5), typeHash);
+            return ExposedPropertyBlock.Fnv1a(layoutHash, bytes);
+        }
+
+        private static uint HashTypeIdentity(Type type, bool includeLayout)
+        {
+            var identity = new StringBuilder(type.FullName ?? type.Name);
+            if (includeLayout)
+            {
+                // A struct whose fields were reordered or retyped keeps its
+                // name and maybe its size, but its bytes no longer line up.
+                foreach (var field in type.GetFields(BindingFlags.Instance | BindingFlags.Public | BindingFlags.NonPublic))
+                {
+                    identity.Append(';').Append(field.FieldType.FullName).Append(' ').Append(field.Name);
+                }
+            }
+            return ExposedPropertyBlock.HashName(identity.ToString());
+        }
+
+        private static TypeState GetTypeState(Type type, Type? stopAt)
+        {
+            return s_types.GetValue(type, t =>
+            {
+                var state = new TypeState();
+                if (t.IsValueType)
+                {
+                    return state; // accessors assign through a reference to the instance
+                }
+
+                var fields = new List<FieldSlot>();
+                for (var current = t; current != null && current != stopAt && current != typeof(object); current = current.BaseType)
+                {
+                    var declared = current.GetFields(
+                        BindingFlags.Instance | BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.DeclaredOnly);
+                    foreach (var field in declared)
+                    {
+                        if (field.IsInitOnly || field.IsLiteral || field.IsNotSerialized)
+                        {
+                            continue;
+                        }
+
+                        var slot = CreateSlot(field);
+                        if (slot == null || state.FieldsByNameHash.ContainsKey(slot.NameHash))
+                        {
+                            continue; // unsupported type, or shadowed by a derived field of the same name
+                        }
+                        state.FieldsByNameHash[slot.NameHash] = slot;
+                        fields.Add(slot);
+                    }
+                }
+                state.Fields = fields.ToArray();
+                return state;
+            });
+        }
+
+        private static FieldSlot? CreateSlot(FieldInfo field)
+        {
+            var fieldType = field.FieldType;
+            var slot = new FieldSlot
+            {
+                Field = field,
+                NameHash = ExposedPropertyBlock.HashName(field.Name),
+            };
+
+            var valueType = ExposedPropertyBlock.ValueTypeFor(fieldType);
+            if (valueType == ExposedPropertyBlock.ValueType.String)
+            {
+                slot.Kind = (byte)valueType;
+                slot.TypeHash = HashTypeIdentity(fieldType, includeLayout: false);
+                slot.Access = new StringAccessor(field);
+                return slot;
+            }
+
+            if (valueType != ExposedPropertyBlock.ValueType.Invalid)
+            {
+                // Every other block value type is a primitive whose payload is
+                // its little-endian bytes.
+                slot.Kind = (byte)valueType;
+                slot.TypeHash = HashTypeIdentity(fieldType, includeLayout: false);
+                slot.Access = CreateAccessor(typeof(UnmanagedAccessor<>), field);
+                return slot;
+            }
+
+            if (fieldType.IsEnum)
+            {
+                slot.Kind = (byte)Kind.Enum;
+                slot.TypeHash = HashTypeIdentity(fieldType, includeLayout: false);
+                slot.Access = CreateAccessor(typeof(EnumAccessor<>), field);
+                return slot;
+            }
+
+            if (fieldType.IsValueType && !fieldType.IsPrimitive && !fieldType.IsGenericTypeDefinition && IsUnmanaged(fieldType))
+            {
+                slot.Kind = (byte)Kind.Unmanaged;
+                slot.TypeHash = HashTypeIdentity(fieldType, includeLayout: true);
+                slot.Access = CreateAccessor(typeof(UnmanagedAccessor<>), field);
+                slot.RawSize = slot.Access.Size;
+                return slot;
+            }
+
+            return null;
+        }
+
+        private static FieldAccessor CreateAccessor(Type accessorDefinition, FieldInfo field)
+        {
+            var accessorType = accessorDefinition.MakeGenericType(field.FieldType);
+            return (FieldAccessor)Activator.CreateInstance(accessorType, field)!;
+        }
+
+        private static readonly MethodInfo s_containsReferences =
+            typeof(RuntimeHelpers).GetMethod(nameof(RuntimeHelpers.IsReferenceOrContainsReferences))!;
+
+        private static bool IsUnmanaged(Type type)
+        {
+            return !(bool)s_containsReferences.MakeGenericMethod(type).Invoke(null, null)!;
+        }
+
+        // Reads and writes one field's payload without reflection: the field
+        // access is compiled once, when the type's slots are built.
+        private abstract class FieldAccessor
+        {
+            /// <summary>Fixed payload size, or -1 if it varies.</summary>
+            public virtual int Size => -1;
+
+            /// <summary>Append the field's payload; false (nothing appended) if it's null.</summary>
+            public abstract bool Write(object instance, List<byte> output);
+
+            /// <summary>Set the field from a payload whose size was already checked.</summary>
+            public abstract void Read(object instance, ReadOnlySpan<byte> payload, bool isNull);
+
+            protected static Func<object, T> CompileGetter<T>(FieldInfo field)
+            {
+                var instance = Expression.Parameter(typeof(object), "instance");
+                var access = Expression.Field(Expression.Convert(instance, field.DeclaringType!), field);
+                return Expression.Lambda<Func<object, T>>(access, instance).Compile();
+            }
+
+            protected static Action<object, T> CompileSetter<T>(FieldInfo field)
+            {
+                var instance = Expression.Parameter(typeof(object), "instance");
+                var value = Expression.Parameter(typeof(T), "value");
+                var assign = Expression.Assign(Expression.Field(Expression.Convert(instance, field.DeclaringType!), field), value);
+                return Expression.Lambda<Action<object, T>>(assign, instance, value).Compile();
+            }
+        }
+
+        // Primitives and unmanaged structs: the payload is the value's bytes,
+        // little-endian for primitives.
+        private sealed class UnmanagedAccessor<T> : FieldAccessor where T : unmanaged
+        {
+            private readonly Func<object, T> m_get;
+            private readonly Action<object, T> m_set;
+            private readonly bool m_swapBytes = !BitConverter.IsLittleEndian && typeof(T).IsPrimitive;
+
+            public UnmanagedAccessor(FieldInfo field)
+            {
+                m_get = CompileGetter<T>(field);
+                m_set = CompileSetter<T>(field);
+            }
+
+            public override int Size => Unsafe.SizeOf<T>();
+
+            public override bool Write(object instance, List<byte> output)
+            {
+                T value = m_get(instance);
+                var bytes = MemoryMarshal.AsBytes(MemoryMarshal.CreateSpan(ref value, 1));
+                if (m_swapBytes)
+                {
+                    bytes.Reverse();
+                }
+                output.AddRange(bytes);
+                return true;
+            }
+
+            public override void Read(object instance, ReadOnlySpan<byte> payload, bool isNull)
+            {
+                if (isNull)
+                {
+                    m_set(instance, default);
+                    return;
+                }
+
+                T value = MemoryMarshal.Read<T>(payload);
+                if (m_swapBytes)
+                {
+                    MemoryMarshal.AsBytes(MemoryMarshal.CreateSpan(ref value, 1)).Reverse();
+                }
+                m_set(instance, value);
+            }
+        }
+
+        // Enums: the payload is the underlying value widened to 8 bytes
+        // (sign-extended for signed underlying types), so a change of
+        // underlying type between versions still restores.
+        private sealed class EnumAccessor<T> : FieldAccessor where T : unmanaged, Enum
+        {
+            private readonly Func<object, T> m_get;
+            private readonly Action<object, T> m_set;
+            private readonly bool m_unsigned;
+
+            public EnumAccessor(FieldInfo field)
+            {
+                m_get = CompileGetter<T>(field);
+                m_set = CompileSetter<T>(field);
+                var underlying = Enum.GetUnderlyingType(typeof(T));
+                m_unsigned = underlying == typeof(byte) || underlying == typeof(ushort)
+                    || underlying == typeof(uint) || underlying == typeof(ulong);
+            }
+
+            public override bool Write(object instance, List<byte> output)
+            {
+                T value = m_get(instance);
+                long widened = Unsafe.SizeOf<T>() switch
+                {
+                    1 => m_unsigned ? Unsafe.As<T, byte>(ref value) : Unsafe.As<T, sbyte>(ref value),
+                    2 => m_unsigned ? Unsafe.As<T, ushort>(ref value) : Unsafe.As<T, short>(ref value),
+                    4 => m_unsigned ? Unsafe.As<T, uint>(ref value) : Unsafe.As<T, int>(ref value),
+                    _ => Unsafe.As<T, long>(ref value),
+                };
+
+                Span<byte> payload = stackalloc byte[8];
+                BinaryPrimitives.WriteInt64LittleEndian(payload, widened);
+                output.AddRange(payload);
+                return true;
+            }
+
+            public override void Read(object instance, ReadOnlySpan<byte> payload, bool isNull)
+            {
+                T value = default;
+                if (!isNull)
+                {
+                    long bits = BinaryPrimitives.ReadInt64LittleEndian(payload);
+                    switch (Unsafe.SizeOf<T>())
+                    {
+                        case 1: Unsafe.As<T, byte>(ref value) = (byte)bits; break;
+                        case 2: Unsafe.As<T, ushort>(ref value) = (ushort)bits; break;
+                        case 4: Unsafe.As<T, uint>(ref value) = (uint)bits; break;
+                        default: Unsafe.As<T, long>(ref value) = bits; break;
+                    }
+                }
+                m_set(instance, value);
+            }
+        }
+
+        private sealed class StringAccessor : FieldAccessor
+        {
+            private readonly Func<object, string?> m_get;
+            private readonly Action<object, string?> m_set;
+
+            public StringAccessor(FieldInfo field)
+            {
+                m_get = CompileGetter<string?>(field);
+                m_set = CompileSetter<string?>(field);
+            }
+
+            public override bool Write(object instance, List<byte> output)
+            {
+                string? value = m_get(instance);
+                if (value == null)
+                {
+                    return false;
+                }
+                output.AddRange(Encoding.UTF8.GetBytes(value));
+                return true;
+            }
+
+            public override void Read(object instance, ReadOnlySpan<byte> payload, bool isNull)
+            {
+                m_set(instance, isNull ? null : Encoding.UTF8.GetString(payload));
+            }
+        }
+    }
+}
@@ -7,6 +7,7 @@
  */
 
 using System;
+using System.Runtime.InteropServices;
 
 namespace O3DE
 {
@@ -82,6 +83,47 @@ namespace O3DE
         Middle = 2,
     }
 
+    /// <summary>
+    /// Built-in virtual axes. Values must match InteropInputSnapshot::Axis in FrameSnapshot.h.
+    /// Prefer <see cref="Input.GetAxis(InputAxis)"/> over the string overload in hot paths.
+    /// </summary>
+    public enum InputAxis
+    {
+        Horizontal = 0,
+        Vertical = 1,
+        MouseX = 2,
+        MouseY = 3,
+    }
+
+    /// <summary>
+    /// Per-frame input block captured natively once per tick by FrameSnapshotPublisher.
+    /// Must match the layout of InteropInputSnapshot in FrameSnapshot.h.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    internal unsafe struct InputSnapshot
+    {
+        public const uint CurrentVersion = 1;
+        public const int KeyCodeCount = 85;
+        public const int MouseButtonCount = 3;
+        public const int AxisCount = 4;
+
+        public uint Version;
+        public uint Size;
+        public ulong FrameIndex;
+
+        public fixed ulong KeysDown[2];
+        public fixed ulong KeysPrevious[2];
+        public uint ButtonsDown;
+        public uint ButtonsPrevious;
+
+        public float MouseX;
+        public float MouseY;
+        public float MouseDeltaX;
+        public float MouseDeltaY;
+
+        public fixed float Axes[AxisCount];
+    }
+
     /// <summary>
     /// Provides access to the O3DE input system from C#.
     ///
@@ -97,6 +139,56 @@ namespace O3DE
     /// </summary>
     public static class Input
     {
+        // ============================================================
+        // Native snapshot
+        // ============================================================
+
+        // Address of the native input block. It lives in static native
+        // storage, so it is resolved once per O3DE.Core load and then read
+        // directly - no interop transition per query. Stays null if the host
+        // doesn't publish a block (or its layout doesn't match), in which
+        // case every query falls back to the per-call internal calls.
+        private static unsafe InputSnapshot* s_snapshot;
+        private static bool s_snapshotResolved;
+
+        private static unsafe InputSnapshot* Snapshot
+        {
+            get
+            {
+                if (!s_snapshotResolved)
+                {
+                    s_snapshotResolved = true;
+                    InputSnapshot* block = InternalCalls.Input_GetSnapshot != null
+                        ? InternalCalls.Input_GetSnapshot()
+                        : null;
+
+                    if (block != null
+                        && block->Version == InputSnapshot.CurrentVersion
+                        && block->Size == (uint)sizeof(InputSnapshot))
+                    {
+                        s_snapshot = block;
+                    }
+                    else if (block != null)
+                    {
+                        Debug.LogWarning(
+                            $"Input: native snapshot layout mismatch (version {block->Version}, size {block->Size}); "
+                            + "falling back to per-call queries. Rebuild O3DE.Core against the current gem.");
+                    }
+                }
+                return s_snapshot;
+            }
+        }
+
+        private static unsafe bool TestKey(ulong* bits, int key)
+        {
+            return (uint)key < InputSnapshot.KeyCodeCount && (bits[key >> 6] & (1UL << (key & 63))) != 0;
+        }
+
+        private static bool TestButton(uint bits, int button)
+        {
+            return (uint)button < InputSnapshot.MouseButtonCount && (bits & (1u << button)) != 0;
+        }
+
         // ============================================================
         // Keyboard
         // ============================================================
@@ -106,7 +198,15 @@ namespace O3DE
         /// </summary>
         public static bool IsKeyDown(KeyCode key)
         {
-            unsafe { return InternalCalls.Input_IsKeyDown((int)key); }
+            unsafe
+            {
+                InputSnapshot* s = Snapshot;
+                if (s != null)
+                {
+                    return TestKey(s->KeysDown, (int)key);
+                }
+                return InternalCalls.Input_IsKeyDown((int)key);
+            }
         }
 
         /// <summary>
@@ -114,7 +214,15 @@ namespace O3DE
         /// </summary>
         public static bool IsKeyPressed(KeyCode key)
         {
-            unsafe { return InternalCalls.Input_IsKeyPressed((int)key); }
+            unsafe
+            {
+                InputSnapshot* s = Snapshot;
+                if (s != null)
+                {
+                    return TestKey(s->KeysDown, (int)key) && !TestKey(s->KeysPrevious, (int)key);
+                }
+                return InternalCalls.Input_IsKeyPressed((int)key);
+            }
         }
 
         /// <summary>
@@ -122,7 +230,15 @@ namespace O3DE
         /// </summary>
         public static bool IsKeyReleased(KeyCode key)
         {
-            unsafe { return InternalCalls.Input_IsKeyReleased((int)key); }
+            unsafe
+            {
+                InputSnapshot* s = Snapshot;
+                if (s != null)
+                {
+                    return !TestKey(s->KeysDown, (int)key) && TestKey(s->KeysPrevious, (int)key);
+                }
+                return InternalCalls.Input_IsKeyReleased((int)key);
+            }
         }
 
         // ============================================================
@@ -134,7 +250,15 @@ namespace O3DE
         /// </summary>
         public static bool IsMouseButtonDown(MouseButton button)
         {
-            unsafe { return InternalCalls.Input_IsMouseButtonDown((int)button); }
+            unsafe
+            {
+                InputSnapshot* s = Snapshot;
+                if (s != null)
+                {
+                    return TestButton(s->ButtonsDown, (int)button);
+                }
+                return InternalCalls.Input_IsMouseButtonDown((int)button);
+            }
         }
 
         /// <summary>
@@ -142,7 +266,15 @@ namespace O3DE
         /// </summary>
         public static bool IsMouseButtonPressed(MouseButton button)
         {
-            unsafe { return InternalCalls.Input_IsMouseButtonPressed((int)button); }
+            unsafe
+            {
+                InputSnapshot* s = Snapshot;
+                if (s != null)
+                {
+                    return TestButton(s->ButtonsDown, (int)button) && !TestButton(s->ButtonsPrevious, (int)button);
+                }
+                return InternalCalls.Input_IsMouseButtonPressed((int)button);
+            }
         }
 
         /// <summary>
@@ -150,7 +282,15 @@ namespace O3DE
         /// </summary>
         public static bool IsMouseButtonReleased(MouseButton button)
         {
-            unsafe { return InternalCalls.Input_IsMouseButtonReleased((int)button); }
+            unsafe
+            {
+                InputSnapshot* s = Snapshot;
+                if (s != null)
+                {
+                    return !TestButton(s->ButtonsDown, (int)button) && TestButton(s->ButtonsPrevious, (int)button);
+                }
+                return InternalCalls.Input_IsMouseButtonReleased((int)button);
+            }
         }
 
         // ============================================================
@@ -163,7 +303,18 @@ namespace O3DE
         /// </summary>
         public static Vector3 MousePosition
         {
-            get { unsafe { return InternalCalls.Input_GetMousePosition(); } }
+            get
+            {
+                unsafe
+                {
+                    InputSnapshot* s = Snapshot;
+                    if (s != null)
+                    {
+                        return new Vector3(s->MouseX, s->MouseY, 0.0f);
+                    }
+                    return InternalCalls.Input_GetMousePosition();
+                }
+            }
         }
 
         /// <summary>
@@ -172,7 +323,18 @@ namespace O3DE
         /// </summary>
         public static Vector3 MouseDelta
         {
-            get { unsafe { return InternalCalls.Input_GetMouseDelta(); } }
+            get
+            {
+                unsafe
+                {
+                    InputSnapshot* s = Snapshot;
+                    if (s != null)
+                    {
+                        return new Vector3(s->MouseDeltaX, s->MouseDeltaY, 0.0f);
+                    }
+                    return InternalCalls.Input_GetMouseDelta();
+                }
+            }
         }
 
         // ============================================================
@@ -192,7 +354,50 @@ namespace O3DE
         /// <returns>The axis value, typically in the range -1 to 1</returns>
         public static float GetAxis(string axisName)
         {
-            unsafe { return InternalCalls.Input_GetAxis(axisName); }
+            if (TryGetAxisId(axisName, out InputAxis axis))
+            {
+                return GetAxis(axis);
+            }
+            return 0.0f;
+        }
+
+        /// <summary>
+        /// Gets the value of a built-in virtual axis by id. Cheaper than the
+        /// string overload: no name lookup, just a read from the frame snapshot.
+        /// </summary>
+        /// <param name="axis">The axis to read</param>
+        /// <returns>The axis value, typically in the range -1 to 1</returns>
+        public static float GetAxis(InputAxis axis)
+        {
+            unsafe
+            {
+                InputSnapshot* s = Snapshot;
+                if (s != null)
+                {
+                    return (uint)axis < InputSnapshot.AxisCount ? s->Axes[(int)axis] : 0.0f;
+                }
+                return InternalCalls.Input_GetAxis(axis.ToString());
+            }
+        }
+
+        /// <summary>
+        /// Resolves a virtual axis name to its id. Scripts that poll an axis
+        /// by name every frame can resolve it once and call
+        /// <see cref="GetAxis(InputAxis)"/> instead.
+        /// </summary>
+        /// <param name="axisName">The name of the axis</param>
+        /// <param name="axis">The resolved axis id</param>
+        /// <returns>True if the name is a known axis</returns>
+        public static bool TryGetAxisId(string axisName, out InputAxis axis)
+        {
+            switch (axisName)
+            {
+                case "Horizontal": axis = InputAxis.Horizontal; return true;
+                case "Vertical": axis = InputAxis.Vertical; return true;
+                case "MouseX": axis = InputAxis.MouseX; return true;
+                case "MouseY": axis = InputAxis.MouseY; return true;
+                default: axis = default; return false;
+            }
         }
     }
 }
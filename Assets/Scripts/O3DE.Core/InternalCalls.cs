@@ -31,6 +31,11 @@ namespace O3DE
         internal static delegate* unmanaged<NativeString, void> Log_Warning;
         internal static delegate* unmanaged<NativeString, void> Log_Error;
 
+        // Returns the native ScriptLogQueue ring (or null). LogQueue.cs writes
+        // records into it directly; the three calls above are the synchronous
+        // fallback.
+        internal static delegate* unmanaged<LogQueueHeader*> Log_GetQueue;
+
         // ============================================================
         // Entity Functions
         // ============================================================
@@ -46,6 +51,7 @@ namespace O3DE
         internal static delegate* unmanaged<ulong, int> Entity_GetChildCount;
         internal static delegate* unmanaged<ulong, int, ulong> Entity_GetChildAtIndex;
         internal static delegate* unmanaged<ulong, ulong*, int, int> Entity_GetChildren;
+        internal static delegate* unmanaged<ulong, Bool32> Entity_AreScriptsReady;
 
         // ============================================================
         // Transform Functions
@@ -83,6 +89,11 @@ namespace O3DE
         internal static delegate* unmanaged<Vector3> Input_GetMouseDelta;
         internal static delegate* unmanaged<NativeString, float> Input_GetAxis;
 
+        // Returns the stable address of the native per-frame input block
+        // (FrameSnapshotPublisher). Fetched once by Input.cs; every query
+        // after that is a plain memory read.
+        internal static delegate* unmanaged<InputSnapshot*> Input_GetSnapshot;
+
         // ============================================================
         // Time Functions
         // ============================================================
@@ -93,6 +104,10 @@ namespace O3DE
         internal static delegate* unmanaged<float, void> Time_SetTimeScale;
         internal static delegate* unmanaged<ulong> Time_GetFrameCount;
 
+        // Returns the stable address of the native per-frame time block
+        // (FrameSnapshotPublisher). Fetched once by Time.cs.
+        internal static delegate* unmanaged<TimeSnapshot*> Time_GetSnapshot;
+
         // ============================================================
         // Physics Functions
         // ============================================================
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+using System.Buffers;
+using System.Runtime.InteropServices;
+using System.Text.Unicode;
+using System.Threading;
+
+namespace O3DE
+{
+    /// <summary>
+    /// Severity of a queued log record. Values must match the level field
+    /// ScriptLogQueue::Emit switches on.
+    /// </summary>
+    internal enum LogLevel : uint
+    {
+        Info = 0,
+        Warning = 1,
+        Error = 2,
+    }
+
+    /// <summary>
+    /// Header of the native log ring. Must match InteropLogQueueHeader in ScriptLogQueue.h.
+    /// </summary>
+    [StructLayout(LayoutKind.Explicit, Size = 192)]
+    internal struct LogQueueHeader
+    {
+        public const uint CurrentVersion = 1;
+
+        [FieldOffset(0)] public uint Version;
+        [FieldOffset(4)] public uint Size;
+        [FieldOffset(8)] public uint Capacity;
+        [FieldOffset(12)] public uint RecordSize;
+
+        // Own cache lines, written by every producer
+        [FieldOffset(64)] public long EnqueuePos;
+        [FieldOffset(128)] public long DroppedCount;
+    }
+
+    /// <summary>
+    /// One slot of the native log ring. Must match InteropLogRecord in ScriptLogQueue.h.
+    /// </summary>
+    [StructLayout(LayoutKind.Explicit, Size = RecordSize)]
+    internal unsafe struct LogRecord
+    {
+        public const int RecordSize = 512;
+        public const int MessageCapacity = RecordSize - 32;
+
+        [FieldOffset(0)] public long Sequence;
+        [FieldOffset(8)] public uint Level;
+        [FieldOffset(12)] public ushort Length;
+        [FieldOffset(14)] public ushort Reserved;
+        [FieldOffset(16)] public ulong EntityId;
+        [FieldOffset(24)] public ulong TimestampUs;
+        [FieldOffset(32)] public fixed byte Message[MessageCapacity];
+    }
+
+    /// <summary>
+    /// Producer side of the native ScriptLogQueue. Debug.cs hands messages
+    /// here first; they are encoded straight into the shared ring and drained
+    /// into the AZ logger by a native background thread, so logging costs no
+    /// interop transition.
+    /// </summary>
+    internal static unsafe class LogQueue
+    {
+        private static LogQueueHeader* s_header;
+        private static bool s_headerResolved;
+
+        /// <summary>
+        /// Entity the current thread is running script code for. Set by
+        /// ScriptComponent.Tick so plain Debug.Log calls made from OnUpdate
+        /// are attributed to (and rate-limited per) the right entity.
+        /// </summary>
+        [ThreadStatic]
+        internal static ulong CurrentEntityId;
+
+        private static LogQueueHeader* Header
+        {
+            get
+            {
+                if (!s_headerResolved)
+                {
+                    s_headerResolved = true;
+                    LogQueueHeader* header = InternalCalls.Log_GetQueue != null
+                        ? InternalCalls.Log_GetQueue()
+                        : null;
+
+                    // A mismatched block is ignored silently: reporting it
+                    // would go through the very path being resolved.
+                    if (header != null
+                        && header->Version == LogQueueHeader.CurrentVersion
+                        && header->Size == (uint)sizeof(LogQueueHeader)
+                        && header->RecordSize == (uint)sizeof(LogRecord))
+                    {
+                        s_header = header;
+                    }
+                }
+                return s_header;
+            }
+        }
+
+        /// <summary>
+        /// Queue a message on the active native ring. Returns false if the
+        /// caller must log synchronously instead: no ring is available, or the
+        /// message doesn't fit in a slot. A full ring is not a failure - the
+        /// record is dropped and counted, and the native side reports it.
+        /// </summary>
+        internal static bool TryEnqueue(LogLevel level, string message, ulong entityId)
+        {
+            LogQueueHeader* header = Header;
+            return header != null && TryEnqueue(header, level, message, entityId, CurrentTimestampUs());
+        }
+
+        /// <summary>
+        /// Lock-free multi-producer enqueue onto <paramref name="header"/>.
+        /// Split out from the resolved-ring overload so it can be exercised
+        /// against a managed-allocated ring.
+        /// </summary>
+        internal static bool TryEnqueue(LogQueueHeader* header, LogLevel level, string message, ulong entityId, ulong timestampUs)
+        {
+            // Every UTF-16 code unit needs at least one UTF-8 byte, so this
+            // rejects most oversized messages before encoding anything.
+            if (message.Length > LogRecord.MessageCapacity)
+            {
+                return false;
+            }
+
+            // Encode before claiming a slot so a message that turns out too
+            // long never leaves a claimed-but-unpublished slot behind.
+            byte* encoded = stackalloc byte[LogRecord.MessageCapacity];
+            OperationStatus status = Utf8.FromUtf16(
+                message, new Span<byte>(encoded, LogRecord.MessageCapacity), out _, out int written);
+            if (status != OperationStatus.Done)
+            {
+                return false;
+            }
+
+            long mask = header->Capacity - 1;
+            byte* records = (byte*)header + header->Size;
+
+            LogRecord* record;
+            long pos = Volatile.Read(ref header->EnqueuePos);
+            for (;;)
+            {
+                record = (LogRecord*)(records + (pos & mask) * header->RecordSize);
+                long diff = Volatile.Read(ref record->Sequence) - pos;
+                if (diff == 0)
+                {
+                    long observed = Interlocked.CompareExchange(ref header->EnqueuePos, pos + 1, pos);
+                    if (observed == pos)
+                    {
+                        break;
+                    }
+                    pos = observed;
+                }
+                else if (diff < 0)
+                {
+                    // Consumer hasn't released this slot yet: the ring is full.
+                    Interlocked.Increment(ref header->DroppedCount);
+                    return true;
+                }
+                else
+                {
+                    // Another producer claimed this position; catch up.
+                    pos = Volatile.Read(ref header->EnqueuePos);
+                }
+            }
+
+            record->Level = (uint)level;
+            record->Length = (ushort)written;
+            record->Reserved = 0;
+            record->EntityId = entityId;
+            record->TimestampUs = timestampUs;
+            Buffer.MemoryCopy(encoded, record->Message, LogRecord.MessageCapacity, written);
+
+            // Publish: the consumer only reads a slot once it sees pos + 1.
+            Volatile.Write(ref record->Sequence, pos + 1);
+            return true;
+        }
+
+        private static ulong CurrentTimestampUs()
+        {
+            return (ulong)(DateTime.UtcNow.Ticks - DateTime.UnixEpoch.Ticks) / (TimeSpan.TicksPerMillisecond / 1000);
+        }
+    }
+}
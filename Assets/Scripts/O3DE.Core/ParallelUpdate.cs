@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+using System.Collections.Generic;
+
+namespace O3DE
+{
+    /// <summary>
+    /// Thread context of the <see cref="ParallelUpdateAttribute"/> batch,
+    /// driven by the native <c>ParallelScriptUpdater</c>.
+    ///
+    /// Per frame, on the main thread, native code calls <see cref="Prepare"/>
+    /// with the number of partitions. Each job worker wraps its slice of
+    /// instances in <see cref="BeginPartition"/> / <see cref="EndPartition"/>.
+    /// Once every job is done, <see cref="ApplyDeferredWrites"/> runs on the
+    /// main thread.
+    ///
+    /// Inside a partition, transform writes go to that partition's command
+    /// buffer. Calls that aren't safe off the main thread throw. The native
+    /// side enforces the same rule for every internal call (its
+    /// <c>InternalCallGuard</c>): one not on its worker-safe list is refused
+    /// and disables the script, so generated bindings and anything without
+    /// a <see cref="ThrowIfActive"/> check are covered too. Buffers are
+    /// applied in partition order and, within a partition, in the order they
+    /// were written. The result doesn't depend on which worker ran first.
+    /// </summary>
+    public static class ParallelUpdate
+    {
+        private enum WriteKind : byte
+        {
+            WorldPosition,
+            LocalPosition,
+            WorldRotation,
+            WorldRotationEuler,
+            LocalScale,
+            LocalUniformScale,
+        }
+
+        private struct DeferredWrite
+        {
+            public ulong EntityId;
+            public WriteKind Kind;
+            public Vector3 Vector;
+            public Quaternion Rotation;
+            public float Scalar;
+        }
+
+        private static List<DeferredWrite>[] s_partitions = Array.Empty<List<DeferredWrite>>();
+        private static int s_partitionCount;
+
+        [ThreadStatic]
+        private static List<DeferredWrite>? t_current;
+
+        /// <summary>
+        /// True while this thread runs a <see cref="ParallelUpdateAttribute"/>
+        /// partition.
+        /// </summary>
+        public static bool IsActive => t_current != null;
+
+        /// <summary>
+        /// Main thread, before the jobs start: make room for
+        /// <paramref name="partitionCount"/> empty command buffers.
+        /// </summary>
+        public static void Prepare(int partitionCount)
+        {
+            partitionCount = Math.Max(partitionCount, 0);
+            if (s_partitions.Length < partitionCount)
+            {
+                int oldLength = s_partitions.Length;
+                Array.Resize(ref s_partitions, partitionCount);
+                for (int i = oldLength; i < partitionCount; i++)
+                {
+                    s_partitions[i] = new List<DeferredWrite>();
+                }
+            }
+
+            for (int i = 0; i < partitionCount; i++)
+            {
+                s_partitions[i].Clear();
+            }
+            s_partitionCount = partitionCount;
+        }
+
+        /// <summary>
+        /// Job worker: route this thread's writes into partition
+        /// <paramref name="partition"/>'s command buffer until <see cref="EndPartition"/>.
+        /// </summary>
+        public static void BeginPartition(int partition)
+        {
+            if ((uint)partition >= (uint)s_partitionCount)
+            {
+                throw new ArgumentOutOfRangeException(nameof(partition));
+            }
+            t_current = s_partitions[partition];
+        }
+
+        /// <summary>
+        /// Job worker: leave the partition opened by <see cref="BeginPartition"/>.
+        /// </summary>
+        public static void EndPartition()
+        {
+            t_current = null;
+        }
+
+        /// <summary>
+        /// Main thread, after every job finished: apply the buffered writes.
+        /// Returns how many were applied.
+        /// </summary>
+        public static int ApplyDeferredWrites()
+        {
+            int applied = 0;
+            for (int p = 0; p < s_partitionCount; p++)
+            {
+                List<DeferredWrite> writes = s_partitions[p];
+                foreach (DeferredWrite write in writes)
+                {
+                    Apply(write);
+                }
+                applied += writes.Count;
+                writes.Clear();
+            }
+            s_partitionCount = 0;
+            return applied;
+        }
+
+        /// <summary>
+        /// Throw if called from a parallel update. For engine operations
+        /// that can't be buffered or run off the main thread; gives a
+        /// clearer error than the native guard, which refuses them anyway.
+        /// </summary>
+        internal static void ThrowIfActive(string operation)
+        {
+            if (t_current != null)
+            {
+                throw new InvalidOperationException(
+                    $"{operation} is not allowed in a [ParallelUpdate] update; do it from OnCreate, a main-thread callback or a script without [ParallelUpdate].");
+            }
+        }
+
+        internal static bool DeferWorldPosition(ulong entityId, Vector3 value) => Defer(entityId, WriteKind.WorldPosition, value);
+        internal static bool DeferLocalPosition(ulong entityId, Vector3 value) => Defer(entityId, WriteKind.LocalPosition, value);
+        internal static bool DeferWorldRotationEuler(ulong entityId, Vector3 value) => Defer(entityId, WriteKind.WorldRotationEuler, value);
+        internal static bool DeferLocalScale(ulong entityId, Vector3 value) => Defer(entityId, WriteKind.LocalScale, value);
+
+        internal static bool DeferWorldRotation(ulong entityId, Quaternion value)
+        {
+            List<DeferredWrite>? buffer = t_current;
+            if (buffer == null)
+            {
+                return false;
+            }
+            buffer.Add(new DeferredWrite { EntityId = entityId, Kind = WriteKind.WorldRotation, Rotation = value });
+            return true;
+        }
+
+        internal static bool DeferLocalUniformScale(ulong entityId, float value)
+        {
+            List<DeferredWrite>? buffer = t_current;
+            if (buffer == null)
+            {
+                return false;
+            }
+            buffer.Add(new DeferredWrite { EntityId = entityId, Kind = WriteKind.LocalUniformScale, Scalar = value });
+            return true;
+        }
+
+        private static bool Defer(ulong entityId, WriteKind kind, Vector3 value)
+        {
+            List<DeferredWrite>? buffer = t_current;
+            if (buffer == null)
+            {
+                return false;
+            }
+            buffer.Add(new DeferredWrite { EntityId = entityId, Kind = kind, Vector = value });
+            return true;
+        }
+
+        private static unsafe void Apply(in DeferredWrite write)
+        {
+            switch (write.Kind)
+            {
+                case WriteKind.WorldPosition: InternalCalls.Transform_SetWorldPosition(write.EntityId, write.Vector); break;
+                case WriteKind.LocalPosition: InternalCalls.Transform_SetLocalPosition(write.EntityId, write.Vector); break;
+                case WriteKind.WorldRotation: InternalCalls.Transform_SetWorldRotation(write.EntityId, write.Rotation); break;
+                case WriteKind.WorldRotationEuler: InternalCalls.Transform_SetWorldRotationEuler(write.EntityId, write.Vector); break;
+                case WriteKind.LocalScale: InternalCalls.Transform_SetLocalScale(write.EntityId, write.Vector); break;
+                case WriteKind.LocalUniformScale: InternalCalls.Transform_SetLocalUniformScale(write.EntityId, write.Scalar); break;
+            }
+        }
+    }
+}
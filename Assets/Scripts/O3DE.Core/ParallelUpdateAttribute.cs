@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+
+namespace O3DE
+{
+    /// <summary>
+    /// Marks a <see cref="ScriptComponent"/> subclass whose <c>OnUpdate</c>
+    /// may run on a job worker thread, concurrently with other instances.
+    ///
+    /// The native host ticks every instance of such classes in one batch,
+    /// split across the engine's job workers, instead of one main-thread
+    /// call per entity. While it runs, the script may only:
+    /// <list type="bullet">
+    /// <item>touch its own fields, and read (not write) shared state;</item>
+    /// <item>read transforms, entity validity, <see cref="Time"/> and <see cref="Input"/>;</item>
+    /// <item>write transforms - the writes are buffered and applied on the
+    /// main thread once every parallel script has ticked, so reads within
+    /// the same update still see the old values;</item>
+    /// <item>log through <see cref="Debug"/>.</item>
+    /// </list>
+    /// Everything else with an engine side effect (activating or destroying
+    /// entities, re-parenting, raycasts, EBus calls through
+    /// <c>NativeReflection</c>) throws <see cref="InvalidOperationException"/>
+    /// there; see <see cref="ParallelUpdate"/>. Any other internal call,
+    /// generated bindings included, is refused natively and disables the
+    /// script as if it had thrown. Scheduled
+    /// <c>Invoke</c>/<c>InvokeRepeating</c> callbacks run under the same
+    /// rules. <c>OnCreate</c>, <c>OnDestroy</c> and the other callbacks stay
+    /// on the main thread.
+    ///
+    /// Example:
+    /// <code>
+    /// [ParallelUpdate]
+    /// public class Bobbing : ScriptComponent
+    /// {
+    ///     private float m_time;
+    ///
+    ///     public override void OnUpdate(float deltaTime)
+    ///     {
+    ///         m_time += deltaTime;
+    ///         Transform.LocalPosition = new Vector3(0f, 0f, MathF.Sin(m_time));
+    ///     }
+    /// }
+    /// </code>
+    /// </summary>
+    [AttributeUsage(AttributeTargets.Class, Inherited = true, AllowMultiple = false)]
+    public sealed class ParallelUpdateAttribute : Attribute
+    {
+    }
+}
@@ -33,6 +33,8 @@ namespace O3DE
         /// <returns>A RaycastHit containing information about what was hit, or a hit with Hit=false if nothing was hit</returns>
         public static RaycastHit Raycast(Vector3 origin, Vector3 direction, float maxDistance = DefaultMaxDistance)
         {
+            ParallelUpdate.ThrowIfActive("Physics.Raycast");
+
             // Normalize the direction
             direction = direction.Normalized;
             unsafe { return InternalCalls.Physics_Raycast(origin, direction, maxDistance); }
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+
+namespace O3DE
+{
+    /// <summary>
+    /// Opts a <see cref="ScriptComponent"/> subclass into instance pooling.
+    ///
+    /// Scripts on frequently spawned and despawned entities (projectiles,
+    /// VFX) otherwise get a new managed instance on every activation and
+    /// drop it on every deactivation. With this attribute, a deactivated
+    /// instance is reset through <see cref="ScriptComponent.OnReset"/> and
+    /// parked in a per-class pool on the native side. The next activation of
+    /// the same class, on any entity, reuses it instead of constructing a new one.
+    ///
+    /// A reused instance is not constructed again: field initialisers and
+    /// the constructor don't run. Exposed properties are re-applied before
+    /// <c>OnCreate</c>, but any other per-activation state has to be
+    /// restored in <see cref="ScriptComponent.OnReset"/>.
+    ///
+    /// Example:
+    /// <code>
+    /// [PooledScript(MaxInstances = 256)]
+    /// public class Projectile : ScriptComponent
+    /// {
+    ///     private float m_age;
+    ///
+    ///     protected override void OnReset()
+    ///     {
+    ///         m_age = 0f;
+    ///     }
+    /// }
+    /// </code>
+    /// </summary>
+    [AttributeUsage(AttributeTargets.Class, Inherited = true, AllowMultiple = false)]
+    public sealed class PooledScriptAttribute : Attribute
+    {
+        /// <summary>
+        /// Most instances of the class kept parked at once; further
+        /// deactivated instances are released as usual. The native side may
+        /// cap this further (/O3DE/O3DESharp/Pooling/MaxInstancesPerType).
+        /// </summary>
+        public int MaxInstances { get; set; } = 32;
+    }
+}
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace O3DE.Reflection
+{
+    /// <summary>
+    /// One argument or return slot of the typed dispatch path. Which field is
+    /// live follows from the resolved method's signature.
+    /// Must match InteropArgument in GenericDispatcher.h.
+    /// </summary>
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    public struct NativeArgument
+    {
+        [FieldOffset(0)] public bool Bool;
+        [FieldOffset(0)] public sbyte Int8;
+        [FieldOffset(0)] public short Int16;
+        [FieldOffset(0)] public int Int32;
+        [FieldOffset(0)] public long Int64;
+        [FieldOffset(0)] public byte UInt8;
+        [FieldOffset(0)] public ushort UInt16;
+        [FieldOffset(0)] public uint UInt32;
+        /// <summary>Also carries AZ::EntityId.</summary>
+        [FieldOffset(0)] public ulong UInt64;
+        [FieldOffset(0)] public float Float;
+        [FieldOffset(0)] public double Double;
+        [FieldOffset(0)] public Vector2 Vector2;
+        [FieldOffset(0)] public Vector3 Vector3;
+        [FieldOffset(0)] public Quaternion Quaternion;
+    }
+
+    /// <summary>
+    /// What a NativeMethod resolves to. Must match InteropMemberKind in GenericDispatcher.h.
+    /// </summary>
+    public enum NativeMemberKind
+    {
+        Method = 0,
+        PropertyGetter = 1,
+        PropertySetter = 2,
+    }
+
+    /// <summary>
+    /// Outcome of a typed invoke. Must match InteropInvokeStatus in GenericDispatcher.h.
+    /// </summary>
+    internal enum NativeInvokeStatus
+    {
+        Ok = 0,
+        StaleHandle = 1,
+        InvalidInstance = 2,
+        ArgumentMismatch = 3,
+        CallFailed = 4,
+    }
+
+    /// <summary>
+    /// A BehaviorContext method or property accessor resolved once and then
+    /// called by handle. Generated wrappers keep one per member in a static
+    /// field and pass arguments as a stackalloc'd <see cref="NativeArgument"/>
+    /// span, so a call does no boxing, no <c>params object[]</c> allocation,
+    /// no JSON and no name lookup - unlike <see cref="NativeReflection"/>'s
+    /// string-keyed entry points.
+    ///
+    /// Only signatures whose arguments and result fit a NativeArgument
+    /// resolve (primitives, EntityId, Vector2/3, Quaternion); anything else
+    /// stays on the JSON path. The handle is re-resolved if the native
+    /// dispatcher was restarted since it was cached.
+    /// </summary>
+    public sealed class NativeMethod
+    {
+        private readonly string _className;
+        private readonly string _memberName;
+        private readonly int _argumentCount;
+        private readonly NativeMemberKind _kind;
+        private long _handle;
+
+        private NativeMethod(string? className, string memberName, int argumentCount, NativeMemberKind kind)
+        {
+            _className = className ?? string.Empty;
+            _memberName = memberName ?? throw new ArgumentNullException(nameof(memberName));
+            _argumentCount = argumentCount;
+            _kind = kind;
+        }
+
+        /// <summary>
+        /// A reflected method, picked among overloads by argument count.
+        /// </summary>
+        /// <param name="className">Reflected class, or null for a global method</param>
+        /// <param name="methodName">Reflected method name</param>
+        /// <param name="argumentCount">Arguments, not counting the instance</param>
+        public static NativeMethod Method(string? className, string methodName, int argumentCount) =>
+            new(className, methodName, argumentCount, NativeMemberKind.Method);
+
+        /// <summary>
+        /// A reflected property's getter.
+        /// </summary>
+        /// <param name="className">Reflected class, or null for a global property</param>
+        public static NativeMethod Getter(string? className, string propertyName) =>
+            new(className, propertyName, 0, NativeMemberKind.PropertyGetter);
+
+        /// <summary>
+        /// A reflected property's setter.
+        /// </summary>
+        /// <param name="className">Reflected class, or null for a global property</param>
+        public static NativeMethod Setter(string? className, string propertyName) =>
+            new(className, propertyName, 1, NativeMemberKind.PropertySetter);
+
+        /// <summary>
+        /// Whether a native handle is cached.
+        /// </summary>
+        public bool IsResolved => _handle != 0;
+
+        /// <summary>
+        /// Call a static method, global method or global property accessor.
+        /// </summary>
+        /// <returns>The result slot; default for void</returns>
+        public NativeArgument Invoke(ReadOnlySpan<NativeArgument> arguments) => InvokeCore(0, arguments);
+
+        /// <summary>
+        /// Call an instance method or property accessor on a native object.
+        /// </summary>
+        /// <returns>The result slot; default for void</returns>
+        public NativeArgument Invoke(NativeObject instance, ReadOnlySpan<NativeArgument> arguments)
+        {
+            if (instance == null)
+            {
+                throw new ArgumentNullException(nameof(instance));
+            }
+            if (instance.IsDisposed)
+            {
+                throw new ObjectDisposedException(nameof(NativeObject));
+            }
+            return InvokeCore(instance.Handle, arguments);
+        }
+
+        private unsafe NativeArgument InvokeCore(long instanceHandle, ReadOnlySpan<NativeArgument> arguments)
+        {
+            ParallelUpdate.ThrowIfActive("NativeMethod.Invoke");
+            if (arguments.Length != _argumentCount)
+            {
+                throw new ArgumentException(
+                    $"{Describe()} takes {_argumentCount} argument(s), got {arguments.Length}.", nameof(arguments));
+            }
+
+            long handle = _handle != 0 ? _handle : Resolve();
+            NativeArgument result = default;
+            NativeInvokeStatus status;
+            fixed (NativeArgument* args = arguments)
+            {
+                status = (NativeInvokeStatus)ReflectionInternalCalls.Reflection_InvokeResolved(
+                    handle, instanceHandle, args, arguments.Length, &result);
+                if (status == NativeInvokeStatus.StaleHandle)
+                {
+                    _handle = 0;
+                    handle = Resolve();
+                    status = (NativeInvokeStatus)ReflectionInternalCalls.Reflection_InvokeResolved(
+                        handle, instanceHandle, args, arguments.Length, &result);
+                }
+            }
+
+            return status switch
+            {
+                NativeInvokeStatus.Ok => result,
+                NativeInvokeStatus.InvalidInstance => throw new InvalidOperationException(
+                    $"{Describe()}: native object handle {instanceHandle} is not valid."),
+                NativeInvokeStatus.CallFailed => throw new InvalidOperationException(
+                    $"{Describe()}: BehaviorMethod call failed."),
+                _ => throw new InvalidOperationException($"{Describe()}: typed dispatch returned {status}."),
+            };
+        }
+
+        private unsafe long Resolve()
+        {
+            long handle = ReflectionInternalCalls.Reflection_ResolveMethod(
+                _className, _memberName, _argumentCount, (int)_kind);
+            if (handle == 0)
+            {
+                throw new MissingMethodException(
+                    $"{Describe()} is not reflected with a typed-dispatch signature (see the native log for why).");
+            }
+            _handle = handle;
+            return handle;
+        }
+
+        private string Describe()
+        {
+            string member = _className.Length == 0 ? _memberName : $"{_className}.{_memberName}";
+            return _kind switch
+            {
+                NativeMemberKind.PropertyGetter => $"get {member}",
+                NativeMemberKind.PropertySetter => $"set {member}",
+                _ => $"{member}/{_argumentCount}",
+            };
+        }
+    }
+}
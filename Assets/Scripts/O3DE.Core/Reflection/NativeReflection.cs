@@ -38,6 +38,11 @@ namespace O3DE.Reflection
         internal static delegate* unmanaged<NativeString, NativeString, long, NativeString, NativeString> Reflection_InvokeInstanceMethod;
         internal static delegate* unmanaged<NativeString, NativeString, NativeString> Reflection_InvokeGlobalMethod;
 
+        // Typed dispatch (see NativeMethod). ResolveMethod returns an opaque
+        // handle or 0; InvokeResolved returns a NativeInvokeStatus.
+        internal static delegate* unmanaged<NativeString, NativeString, int, int, long> Reflection_ResolveMethod;
+        internal static delegate* unmanaged<long, long, NativeArgument*, int, NativeArgument*, int> Reflection_InvokeResolved;
+
         // Property access
         internal static delegate* unmanaged<NativeString, NativeString, long, NativeString> Reflection_GetProperty;
         internal static delegate* unmanaged<NativeString, NativeString, long, NativeString, Bool32> Reflection_SetProperty;
@@ -335,6 +340,7 @@ namespace O3DE.Reflection
         /// <returns>The result if the event has a return value</returns>
         public static object? BroadcastEBusEvent(string busName, string eventName, params object[] args)
         {
+            ParallelUpdate.ThrowIfActive("NativeReflection.BroadcastEBusEvent");
             string argsJson = SerializeArguments(args);
             string resultJson;
             unsafe { resultJson = ReflectionInternalCalls.Reflection_BroadcastEBusEvent(busName, eventName, argsJson); }
@@ -422,6 +428,7 @@ namespace O3DE.Reflection
         /// <returns>The result if the event has a return value</returns>
         public static object? SendEBusEvent(string busName, string eventName, ulong entityId, params object[] args)
         {
+            ParallelUpdate.ThrowIfActive("NativeReflection.SendEBusEvent");
             string argsJson = SerializeArguments(args);
             string resultJson;
             unsafe { resultJson = ReflectionInternalCalls.Reflection_SendEBusEvent(busName, eventName, (long)entityId, argsJson); }
@@ -453,6 +460,7 @@ namespace O3DE.Reflection
         /// <returns>A NativeObject wrapper for the created instance</returns>
         public static NativeObject CreateInstance(string className, params object[] constructorArgs)
         {
+            ParallelUpdate.ThrowIfActive("NativeReflection.CreateInstance");
             string argsJson = SerializeArguments(constructorArgs);
             long handle;
             unsafe { handle = ReflectionInternalCalls.Reflection_CreateInstance(className, argsJson); }
@@ -471,6 +479,7 @@ namespace O3DE.Reflection
         /// <param name="instance">The object to destroy</param>
         public static void DestroyInstance(NativeObject instance)
         {
+            ParallelUpdate.ThrowIfActive("NativeReflection.DestroyInstance");
             if (instance != null && instance.IsValid)
             {
                 unsafe { ReflectionInternalCalls.Reflection_DestroyInstance(instance.TypeName, instance.Handle); }
@@ -65,6 +65,24 @@ namespace O3DE
         /// </summary>
         private Transform? m_transform;
 
+        /// <summary>
+        /// Registers the new instance with an open <see cref="ScriptInstanceBatch"/>
+        /// (a no-op outside one).
+        /// </summary>
+        protected ScriptComponent()
+        {
+            ScriptInstanceBatch.Track(this);
+        }
+
+        /// <summary>
+        /// Set by <see cref="ScriptInstanceBatch.Complete"/>; the single-instance
+        /// path writes <see cref="m_entityId"/> from native code directly.
+        /// </summary>
+        internal void BindEntity(ulong entityId)
+        {
+            m_entityId = entityId;
+        }
+
         #region Properties
 
         /// <summary>
@@ -157,6 +175,17 @@ namespace O3DE
         {
         }
 
+        /// <summary>
+        /// Called, after <see cref="OnDestroy"/>, when an instance of a
+        /// <see cref="PooledScriptAttribute"/> class is parked for reuse. Put
+        /// the fields back to the state a freshly constructed instance would
+        /// have; the next <see cref="OnCreate"/> may be for a different entity.
+        /// Scheduled invocations and the entity binding are reset already.
+        /// </summary>
+        protected virtual void OnReset()
+        {
+        }
+
         #endregion
 
         #region Utility Methods
@@ -168,7 +197,7 @@ namespace O3DE
         /// <param name="message">The message to log</param>
         protected void Log(string message)
         {
-            Debug.Log(message);
+            Debug.Write(LogLevel.Info, message ?? "null", m_entityId);
         }
 
         /// <summary>
@@ -178,7 +207,7 @@ namespace O3DE
         /// <param name="args">The format arguments</param>
         protected void Log(string format, params object[] args)
         {
-            Debug.Log(format, args);
+            Debug.Write(LogLevel.Info, Debug.SafeFormat(format, args), m_entityId);
         }
 
         /// <summary>
@@ -187,7 +216,7 @@ namespace O3DE
         /// <param name="message">The warning message</param>
         protected void LogWarning(string message)
         {
-            Debug.LogWarning(message);
+            Debug.Write(LogLevel.Warning, message ?? "null", m_entityId);
         }
 
         /// <summary>
@@ -196,7 +225,7 @@ namespace O3DE
         /// <param name="message">The error message</param>
         protected void LogError(string message)
         {
-            Debug.LogError(message);
+            Debug.Write(LogLevel.Error, message ?? "null", m_entityId);
         }
 
         /// <summary>
@@ -315,6 +344,129 @@ namespace O3DE
             ExposedPropertyHelpers.ApplyFromJson(this, valuesJson);
         }
 
+        /// <summary>
+        /// Typed counterpart of <see cref="ApplyExposedProperties"/>: apply a
+        /// native-built exposed-property block (see
+        /// <see cref="ExposedPropertyBlock"/>) of <paramref name="length"/>
+        /// bytes at <paramref name="data"/>. The block is only read during the
+        /// call. Returns 0 when every entry applied; otherwise the C++ side
+        /// falls back to <see cref="ApplyExposedProperties"/>.
+        /// </summary>
+        public unsafe int ApplyExposedPropertyBlock(IntPtr data, int length)
+        {
+            if (data == IntPtr.Zero || length <= 0)
+            {
+                return -1;
+            }
+            return ExposedPropertyHelpers.ApplyBlock(this, new ReadOnlySpan<byte>((void*)data, length));
+        }
+
+        /// <summary>
+        /// Hot-reload state capture, invoked by the C++ <c>CSharpScriptComponent</c>
+        /// before this instance's assembly is unloaded: writes a
+        /// <see cref="O3DE.Core.HotReload.ScriptStateSnapshot"/> of the
+        /// script's fields to <paramref name="buffer"/>. Returns the snapshot
+        /// size; when that exceeds <paramref name="capacity"/> nothing was
+        /// written and the caller retries with a larger buffer. -1 on failure.
+        /// </summary>
+        public unsafe int WriteReloadState(IntPtr buffer, int capacity)
+        {
+            try
+            {
+                byte[] snapshot = O3DE.Core.HotReload.ScriptStateSnapshot.Capture(this, typeof(ScriptComponent));
+                if (snapshot.Length <= capacity && buffer != IntPtr.Zero)
+                {
+                    snapshot.CopyTo(new Span<byte>((void*)buffer, capacity));
+                }
+                return snapshot.Length;
+            }
+            catch (Exception ex)
+            {
+                Debug.LogWarning($"[HotReload] Could not capture state of {GetType().FullName}: {ex.Message}");
+                return -1;
+            }
+        }
+
+        /// <summary>
+        /// Counterpart of <see cref="WriteReloadState"/>, invoked on the
+        /// re-created instance after <c>OnCreate</c>. Returns the number of
+        /// fields left at their new values because their type changed, or -1
+        /// if the snapshot couldn't be applied.
+        /// </summary>
+        public unsafe int ReadReloadState(IntPtr data, int length)
+        {
+            if (data == IntPtr.Zero || length <= 0)
+            {
+                return -1;
+            }
+
+            try
+            {
+                return O3DE.Core.HotReload.ScriptStateSnapshot.Restore(
+                    this, new ReadOnlySpan<byte>((void*)data, length), typeof(ScriptComponent));
+            }
+            catch (Exception ex)
+            {
+                Debug.LogWarning($"[HotReload] Could not restore state of {GetType().FullName}: {ex.Message}");
+                return -1;
+            }
+        }
+
+        /// <summary>
+        /// Pool capacity for this script's class: <see cref="PooledScriptAttribute.MaxInstances"/>,
+        /// or 0 when the class isn't pooled. Queried once per class by the
+        /// native instance pool.
+        /// </summary>
+        public int GetPoolCapacity()
+        {
+            var attribute = (PooledScriptAttribute?)Attribute.GetCustomAttribute(GetType(), typeof(PooledScriptAttribute));
+            return attribute == null ? 0 : Math.Max(0, attribute.MaxInstances);
+        }
+
+        /// <summary>
+        /// Whether this script's class is marked <see cref="ParallelUpdateAttribute"/>.
+        /// Queried once per class by the native parallel updater.
+        /// </summary>
+        public bool IsParallelUpdate()
+        {
+            return Attribute.IsDefined(GetType(), typeof(ParallelUpdateAttribute));
+        }
+
+        /// <summary>
+        /// Frames between updates for a <see cref="UpdateIntervalAttribute"/>
+        /// class, or 0 when it updates every frame. Queried once per class by
+        /// the native tick scheduler.
+        /// </summary>
+        public int GetUpdateInterval()
+        {
+            return UpdateIntervalAttribute.GetFrames(GetType());
+        }
+
+        /// <summary>
+        /// Prepare this instance to be parked in the native instance pool:
+        /// drop scheduled invocations and the entity binding, then run
+        /// <see cref="OnReset"/>. Returns false if <see cref="OnReset"/>
+        /// threw, in which case the instance is released instead of reused.
+        /// </summary>
+        public bool ResetForPool()
+        {
+            m_scheduledActions?.Clear();
+            m_entityId = 0;
+            m_entity = null;
+            m_transform = null;
+
+            try
+            {
+                OnReset();
+                return true;
+            }
+            catch (Exception ex)
+            {
+                Debug.LogWarning($"[Pool] {GetType().FullName}.OnReset threw; instance discarded: {ex.Message}");
+                return false;
+            }
+        }
+
         /// <summary>
         /// Return a JSON-encoded array describing every
         /// <see cref="ExposedPropertyAttribute"/>-decorated member on this
@@ -338,14 +490,25 @@ namespace O3DE
         /// <param name="deltaTime">Seconds since the last tick.</param>
         public void Tick(float deltaTime)
         {
-            OnUpdate(deltaTime);
+            // Attribute plain Debug.Log calls made during this tick to our
+            // entity (per-entity log counters and rate limiting).
+            ulong previousLogEntity = LogQueue.CurrentEntityId;
+            LogQueue.CurrentEntityId = m_entityId;
+            try
+            {
+                OnUpdate(deltaTime);
 
-            // Cheap early-out: skip the inner loop entirely when nothing is
-            // scheduled. m_scheduledActions stays null for scripts that never
-            // call Invoke / InvokeRepeating, which is the common case.
-            if (m_scheduledActions != null && m_scheduledActions.Count > 0)
+                // Cheap early-out: skip the inner loop entirely when nothing is
+                // scheduled. m_scheduledActions stays null for scripts that never
+                // call Invoke / InvokeRepeating, which is the common case.
+                if (m_scheduledActions != null && m_scheduledActions.Count > 0)
+                {
+                    ProcessPendingInvocations(deltaTime);
+                }
+            }
+            finally
             {
-                ProcessPendingInvocations(deltaTime);
+                LogQueue.CurrentEntityId = previousLogEntity;
             }
         }
 
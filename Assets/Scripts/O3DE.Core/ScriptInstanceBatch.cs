@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+using System.Collections.Generic;
+
+namespace O3DE
+{
+    /// <summary>
+    /// Bulk initialisation of script instances, used by the C++
+    /// <c>CSharpScriptComponent</c> when it re-creates every affected script
+    /// after a hot reload.
+    ///
+    /// Native code opens a batch with <see cref="Begin"/>, constructs the
+    /// instances of one script type back to back, then hands every entity id
+    /// and exposed-property block over in a single <see cref="Complete"/> call
+    /// instead of two managed transitions per instance. Instances are paired
+    /// with their entries by construction order: each <see cref="ScriptComponent"/>
+    /// constructor registers itself with the open batch.
+    ///
+    /// The batch is per thread, so instances constructed elsewhere in the
+    /// meantime (e.g. the editor's schema precompute worker) never join it.
+    /// </summary>
+    public static class ScriptInstanceBatch
+    {
+        [ThreadStatic]
+        private static List<ScriptComponent>? s_pending;
+
+        [ThreadStatic]
+        private static bool s_open;
+
+        /// <summary>
+        /// Start collecting newly constructed script instances on this thread.
+        /// </summary>
+        public static void Begin()
+        {
+            (s_pending ??= new List<ScriptComponent>()).Clear();
+            s_open = true;
+        }
+
+        internal static void Track(ScriptComponent instance)
+        {
+            if (s_open)
+            {
+                s_pending!.Add(instance);
+            }
+        }
+
+        /// <summary>
+        /// Close the batch and initialise its instances. The arrays hold
+        /// <paramref name="count"/> entries in construction order: the entity
+        /// id (<c>ulong</c>), an exposed-property block pointer (<c>IntPtr</c>,
+        /// may be zero) and its length (<c>int</c>). For each entry
+        /// <paramref name="results"/> (<c>int</c>) receives the
+        /// <see cref="ScriptComponent.ApplyExposedPropertyBlock"/> result, or
+        /// -1 when no block was given or applying it threw.
+        ///
+        /// Returns the number of instances initialised, or -1 without touching
+        /// any of them when the batch doesn't line up with
+        /// <paramref name="count"/> (a constructor created further script
+        /// instances, say); the caller then initialises them one by one.
+        /// </summary>
+        public static unsafe int Complete(IntPtr entityIds, IntPtr blocks, IntPtr blockLengths, IntPtr results, int count)
+        {
+            s_open = false;
+            List<ScriptComponent>? pending = s_pending;
+            if (pending == null || pending.Count != count || count < 0)
+            {
+                pending?.Clear();
+                return -1;
+            }
+
+            var ids = new ReadOnlySpan<ulong>((void*)entityIds, count);
+            var blockPtrs = new ReadOnlySpan<IntPtr>((void*)blocks, count);
+            var lengths = new ReadOnlySpan<int>((void*)blockLengths, count);
+            var outResults = new Span<int>((void*)results, count);
+
+            for (int i = 0; i < count; i++)
+            {
+                ScriptComponent instance = pending[i];
+                instance.BindEntity(ids[i]);
+
+                int result = -1;
+                if (blockPtrs[i] != IntPtr.Zero)
+                {
+                    try
+                    {
+                        result = instance.ApplyExposedPropertyBlock(blockPtrs[i], lengths[i]);
+                    }
+                    catch (Exception)
+                    {
+                        result = -1;
+                    }
+                }
+                outResults[i] = result;
+            }
+
+            pending.Clear();
+            return count;
+        }
+    }
+}
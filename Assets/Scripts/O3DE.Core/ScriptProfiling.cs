@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace O3DE
+{
+    /// <summary>
+    /// Managed half of the native ScriptProfiler's allocation accounting.
+    ///
+    /// The profiler samples <see cref="GC.GetAllocatedBytesForCurrentThread"/>
+    /// around every script dispatch, on whichever thread runs it. Going
+    /// through Coral's method invoke for each sample would cost more than
+    /// many of the dispatches being measured, so native code asks once for a
+    /// function pointer and calls it directly from then on.
+    /// </summary>
+    public static unsafe class ScriptProfiling
+    {
+        /// <summary>
+        /// Address of the unmanaged-callable sampler, as a <c>long</c> so Coral
+        /// can return it. Called by the native ScriptProfiler on the main thread.
+        /// </summary>
+        public static long GetAllocatedBytesSampler()
+        {
+            delegate* unmanaged<long> sampler = &GetAllocatedBytes;
+            return (long)sampler;
+        }
+
+        /// <summary>
+        /// Collections of the given generation since the runtime started
+        /// (<see cref="GC.CollectionCount"/>), for native reports. A negative
+        /// or too-large generation counts as 0 collections.
+        /// </summary>
+        public static int GetCollectionCount(int generation)
+        {
+            return generation >= 0 && generation <= GC.MaxGeneration ? GC.CollectionCount(generation) : 0;
+        }
+
+        [UnmanagedCallersOnly]
+        private static long GetAllocatedBytes() => GC.GetAllocatedBytesForCurrentThread();
+    }
+}
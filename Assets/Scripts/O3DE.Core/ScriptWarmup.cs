@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+using System.Collections.Generic;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Runtime.Loader;
+
+namespace O3DE
+{
+    /// <summary>
+    /// JIT warm-up for script classes, called by the native
+    /// <c>O3DESharpSystemComponent</c> on the boot worker once an
+    /// asynchronous boot has loaded the assemblies.
+    ///
+    /// Without it the first frame that activates a script pays for compiling
+    /// its constructor, <c>OnCreate</c> and <c>OnUpdate</c>, plus the
+    /// <see cref="ScriptComponent"/> entry points native code calls, which
+    /// shows up as a hitch on the first frame of play.
+    /// <see cref="RuntimeHelpers.PrepareMethod(RuntimeMethodHandle)"/>
+    /// compiles them ahead of time without running anything.
+    /// </summary>
+    public static class ScriptWarmup
+    {
+        private static readonly HashSet<string> s_lifecycleMethods = new(StringComparer.Ordinal)
+        {
+            nameof(ScriptComponent.OnCreate),
+            nameof(ScriptComponent.OnUpdate),
+            nameof(ScriptComponent.OnDestroy),
+            nameof(ScriptComponent.OnTransformChanged),
+            nameof(ScriptComponent.OnEnable),
+            nameof(ScriptComponent.OnDisable),
+        };
+
+        // ScriptComponent / batch members native code invokes on every instance.
+        private static readonly (Type Type, string Name)[] s_nativeEntryPoints =
+        {
+            (typeof(ScriptComponent), nameof(ScriptComponent.Tick)),
+            (typeof(ScriptComponent), nameof(ScriptComponent.ApplyExposedPropertyBlock)),
+            (typeof(ScriptComponent), nameof(ScriptComponent.ApplyExposedProperties)),
+            (typeof(ScriptComponent), "BindEntity"),
+            (typeof(ScriptComponent), "ProcessPendingInvocations"),
+            (typeof(ScriptInstanceBatch), nameof(ScriptInstanceBatch.Begin)),
+            (typeof(ScriptInstanceBatch), nameof(ScriptInstanceBatch.Complete)),
+        };
+
+        /// <summary>
+        /// Compile the constructors and lifecycle methods of every concrete
+        /// <see cref="ScriptComponent"/> subclass in O3DE.Core and the named
+        /// assemblies, plus the native entry points. Returns the number of
+        /// methods prepared. Methods that can't be prepared are skipped.
+        /// </summary>
+        /// <param name="assemblyNames">
+        /// Semicolon-separated simple names of the user assemblies the host
+        /// loaded. Everything else in the process (the framework, Coral) is
+        /// never scanned.
+        /// </param>
+        public static int PrepareScriptTypes(string assemblyNames)
+        {
+            int prepared = 0;
+
+            var scriptAssemblies = new HashSet<string>(
+                assemblyNames.Split(';', StringSplitOptions.RemoveEmptyEntries | StringSplitOptions.TrimEntries),
+                StringComparer.Ordinal);
+            var coreAssembly = typeof(ScriptComponent).Assembly;
+
+            const BindingFlags AnyMember = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Static | BindingFlags.Instance;
+            foreach (var (type, name) in s_nativeEntryPoints)
+            {
+                foreach (var method in type.GetMember(name, MemberTypes.Method, AnyMember))
+                {
+                    prepared += Prepare((MethodBase)method);
+                }
+            }
+
+            const BindingFlags Declared = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance | BindingFlags.DeclaredOnly;
+            foreach (var context in AssemblyLoadContext.All)
+            {
+                foreach (var assembly in context.Assemblies)
+                {
+                    if (assembly != coreAssembly && !scriptAssemblies.Contains(assembly.GetName().Name ?? string.Empty))
+                    {
+                        continue;
+                    }
+
+                    foreach (var type in GetLoadableTypes(assembly))
+                    {
+                        if (type.IsAbstract || type.ContainsGenericParameters || !type.IsSubclassOf(typeof(ScriptComponent)))
+                        {
+                            continue;
+                        }
+
+                        foreach (var constructor in type.GetConstructors(Declared))
+                        {
+                            prepared += Prepare(constructor);
+                        }
+
+                        foreach (var method in type.GetMethods(Declared))
+                        {
+                            if (s_lifecycleMethods.Contains(method.Name))
+                            {
+                                prepared += Prepare(method);
+                            }
+                        }
+                    }
+                }
+            }
+
+            return prepared;
+        }
+
+        private static IEnumerable<Type> GetLoadableTypes(Assembly assembly)
+        {
+            if (assembly.IsDynamic)
+            {
+                return Array.Empty<Type>();
+            }
+
+            try
+            {
+                return assembly.GetTypes();
+            }
+            catch (ReflectionTypeLoadException ex)
+            {
+                var loaded = new List<Type>();
+                foreach (var type in ex.Types)
+                {
+                    if (type != null)
+                    {
+                        loaded.Add(type);
+                    }
+                }
+                return loaded;
+            }
+        }
+
+        private static int Prepare(MethodBase method)
+        {
+            if (method.IsAbstract || method.ContainsGenericParameters)
+            {
+                return 0;
+            }
+
+            try
+            {
+                RuntimeHelpers.PrepareMethod(method.MethodHandle);
+                return 1;
+            }
+            catch (Exception)
+            {
+                return 0;
+            }
+        }
+    }
+}
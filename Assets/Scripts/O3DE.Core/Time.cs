@@ -7,16 +7,77 @@
  */
 
 using System;
+using System.Runtime.InteropServices;
 using Coral.Managed.Interop;
 
 namespace O3DE
 {
+    /// <summary>
+    /// Per-frame timing block published natively once per tick by FrameSnapshotPublisher.
+    /// Must match the layout of InteropTimeSnapshot in FrameSnapshot.h.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct TimeSnapshot
+    {
+        public const uint CurrentVersion = 1;
+
+        public uint Version;
+        public uint Size;
+        public ulong FrameIndex;
+        public double TotalTime;
+
+        public float DeltaTime;
+        public float UnscaledDeltaTime;
+        public float TimeScale;
+        public float FixedDeltaTime;
+        public float FixedStepAlpha;
+        public uint Reserved;
+    }
+
     /// <summary>
     /// Provides access to time-related functionality in O3DE.
     /// All time values are in seconds unless otherwise specified.
     /// </summary>
     public static class Time
     {
+        #region Native snapshot
+
+        // Address of the native time block; resolved once per O3DE.Core load,
+        // see Input.Snapshot for the same pattern. Null means fall back to the
+        // per-call internal calls.
+        private static unsafe TimeSnapshot* s_snapshot;
+        private static bool s_snapshotResolved;
+
+        private static unsafe TimeSnapshot* Snapshot
+        {
+            get
+            {
+                if (!s_snapshotResolved)
+                {
+                    s_snapshotResolved = true;
+                    TimeSnapshot* block = InternalCalls.Time_GetSnapshot != null
+                        ? InternalCalls.Time_GetSnapshot()
+                        : null;
+
+                    if (block != null
+                        && block->Version == TimeSnapshot.CurrentVersion
+                        && block->Size == (uint)sizeof(TimeSnapshot))
+                    {
+                        s_snapshot = block;
+                    }
+                    else if (block != null)
+                    {
+                        Debug.LogWarning(
+                            $"Time: native snapshot layout mismatch (version {block->Version}, size {block->Size}); "
+                            + "falling back to per-call queries. Rebuild O3DE.Core against the current gem.");
+                    }
+                }
+                return s_snapshot;
+            }
+        }
+
+        #endregion
+
         #region Properties
 
         /// <summary>
@@ -25,7 +86,14 @@ namespace O3DE
         /// </summary>
         public static float DeltaTime
         {
-            get { unsafe { return InternalCalls.Time_GetDeltaTime(); } }
+            get
+            {
+                unsafe
+                {
+                    TimeSnapshot* s = Snapshot;
+                    return s != null ? s->DeltaTime : InternalCalls.Time_GetDeltaTime();
+                }
+            }
         }
 
         /// <summary>
@@ -33,7 +101,30 @@ namespace O3DE
         /// </summary>
         public static float TotalTime
         {
-            get { unsafe { return InternalCalls.Time_GetTotalTime(); } }
+            get
+            {
+                unsafe
+                {
+                    TimeSnapshot* s = Snapshot;
+                    return s != null ? (float)s->TotalTime : InternalCalls.Time_GetTotalTime();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets the total time in seconds since the application started, at double precision.
+        /// Prefer this over <see cref="TotalTime"/> for long-running sessions.
+        /// </summary>
+        public static double TotalTimeAsDouble
+        {
+            get
+            {
+                unsafe
+                {
+                    TimeSnapshot* s = Snapshot;
+                    return s != null ? s->TotalTime : InternalCalls.Time_GetTotalTime();
+                }
+            }
         }
 
         /// <summary>
@@ -43,16 +134,61 @@ namespace O3DE
         /// </summary>
         public static float TimeScale
         {
-            get { unsafe { return InternalCalls.Time_GetTimeScale(); } }
+            get
+            {
+                unsafe
+                {
+                    TimeSnapshot* s = Snapshot;
+                    return s != null ? s->TimeScale : InternalCalls.Time_GetTimeScale();
+                }
+            }
             set { unsafe { InternalCalls.Time_SetTimeScale(value); } }
         }
 
         /// <summary>
-        /// Gets the current frame count since the application started.
+        /// Gets the number of frames ticked since the scripting system started.
         /// </summary>
         public static ulong FrameCount
         {
-            get { unsafe { return InternalCalls.Time_GetFrameCount(); } }
+            get
+            {
+                unsafe
+                {
+                    TimeSnapshot* s = Snapshot;
+                    return s != null ? s->FrameIndex : InternalCalls.Time_GetFrameCount();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets the physics fixed timestep in seconds, or 0 if no physics system is active.
+        /// </summary>
+        public static float FixedDeltaTime
+        {
+            get
+            {
+                unsafe
+                {
+                    TimeSnapshot* s = Snapshot;
+                    return s != null ? s->FixedDeltaTime : 0f;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets how far the current frame lies between the previous and next fixed
+        /// physics step (0 to 1). Use it to interpolate visuals against fixed-step state.
+        /// </summary>
+        public static float FixedStepAlpha
+        {
+            get
+            {
+                unsafe
+                {
+                    TimeSnapshot* s = Snapshot;
+                    return s != null ? s->FixedStepAlpha : 0f;
+                }
+            }
         }
 
         /// <summary>
@@ -65,7 +201,17 @@ namespace O3DE
         /// Gets the unscaled delta time (not affected by TimeScale).
         /// Use this for UI and other elements that shouldn't be affected by time scale.
         /// </summary>
-        public static float UnscaledDeltaTime => DeltaTime;
+        public static float UnscaledDeltaTime
+        {
+            get
+            {
+                unsafe
+                {
+                    TimeSnapshot* s = Snapshot;
+                    return s != null ? s->UnscaledDeltaTime : DeltaTime;
+                }
+            }
+        }
 
         /// <summary>
         /// Gets the frames per second based on the current delta time.
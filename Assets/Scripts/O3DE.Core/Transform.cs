@@ -78,7 +78,7 @@ namespace O3DE
             }
             set
             {
-                if (IsValid)
+                if (IsValid && !ParallelUpdate.DeferWorldPosition(m_entity.Id, value))
                     unsafe { InternalCalls.Transform_SetWorldPosition(m_entity.Id, value); }
             }
         }
@@ -96,7 +96,7 @@ namespace O3DE
             }
             set
             {
-                if (IsValid)
+                if (IsValid && !ParallelUpdate.DeferLocalPosition(m_entity.Id, value))
                     unsafe { InternalCalls.Transform_SetLocalPosition(m_entity.Id, value); }
             }
         }
@@ -118,7 +118,7 @@ namespace O3DE
             }
             set
             {
-                if (IsValid)
+                if (IsValid && !ParallelUpdate.DeferWorldRotation(m_entity.Id, value))
                     unsafe { InternalCalls.Transform_SetWorldRotation(m_entity.Id, value); }
             }
         }
@@ -136,7 +136,7 @@ namespace O3DE
             }
             set
             {
-                if (IsValid)
+                if (IsValid && !ParallelUpdate.DeferWorldRotationEuler(m_entity.Id, value))
                     unsafe { InternalCalls.Transform_SetWorldRotationEuler(m_entity.Id, value); }
             }
         }
@@ -165,7 +165,7 @@ namespace O3DE
             }
             set
             {
-                if (IsValid)
+                if (IsValid && !ParallelUpdate.DeferLocalScale(m_entity.Id, value))
                     unsafe { InternalCalls.Transform_SetLocalScale(m_entity.Id, value); }
             }
         }
@@ -184,7 +184,7 @@ namespace O3DE
             }
             set
             {
-                if (IsValid)
+                if (IsValid && !ParallelUpdate.DeferLocalUniformScale(m_entity.Id, value))
                     unsafe { InternalCalls.Transform_SetLocalUniformScale(m_entity.Id, value); }
             }
         }
@@ -272,6 +272,7 @@ namespace O3DE
         /// <param name="parent">The new parent entity, or null to unparent</param>
         public void SetParent(Entity? parent)
         {
+            ParallelUpdate.ThrowIfActive("Transform.SetParent");
             if (!IsValid)
                 return;
 
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+
+namespace O3DE
+{
+    /// <summary>
+    /// Opts a <see cref="ScriptComponent"/> subclass into time-sliced updates.
+    ///
+    /// Instead of every frame, <c>OnUpdate</c> runs once every
+    /// <see cref="Frames"/> frames, with the instances of the class spread
+    /// evenly over those frames. When the frame's script budget
+    /// (/O3DE/O3DESharp/Scheduler/FrameBudgetMs) is already spent, due
+    /// instances are pushed back to the next frame, round-robin, so the
+    /// ones skipped go first then. Either way the <c>deltaTime</c> passed
+    /// in is the whole time since the instance's previous update.
+    ///
+    /// Meant for work that doesn't have to happen every frame: AI decisions,
+    /// proximity checks, UI refreshes. Scripts without the attribute always
+    /// update every frame, ahead of any time-sliced ones. Classes that are
+    /// also <see cref="ParallelUpdateAttribute"/> update in parallel every
+    /// frame and ignore this attribute.
+    ///
+    /// Example:
+    /// <code>
+    /// [UpdateInterval(4)]
+    /// public class TargetSelector : ScriptComponent
+    /// {
+    ///     public override void OnUpdate(float deltaTime)
+    ///     {
+    ///         // Runs on one frame in four; deltaTime covers all four.
+    ///     }
+    /// }
+    /// </code>
+    /// </summary>
+    [AttributeUsage(AttributeTargets.Class, Inherited = true, AllowMultiple = false)]
+    public sealed class UpdateIntervalAttribute : Attribute
+    {
+        /// <param name="frames">Frames between updates; values below 1 mean every frame</param>
+        public UpdateIntervalAttribute(int frames = 1)
+        {
+            Frames = Math.Max(1, frames);
+        }
+
+        /// <summary>
+        /// Frames between updates when the budget allows. 1 updates every
+        /// frame, but still lets the scheduler defer the update when over budget.
+        /// </summary>
+        public int Frames { get; }
+
+        /// <summary>
+        /// The interval of <paramref name="scriptType"/>, or 0 when it isn't time-sliced.
+        /// </summary>
+        public static int GetFrames(Type scriptType)
+        {
+            var attribute = (UpdateIntervalAttribute?)GetCustomAttribute(scriptType, typeof(UpdateIntervalAttribute));
+            return attribute?.Frames ?? 0;
+        }
+    }
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using O3DE;
+using O3DE.Reflection;
+
+namespace O3DESharp.Benchmarks
+{
+    /// <summary>
+    /// Broadcasts a reflected EBus event with a result every frame, through
+    /// the JSON dispatch path generated wrappers fall back to.
+    /// TickRequestBus is reflected by AzCore, so it exists in any host.
+    /// </summary>
+    public class EBusPinger : ScriptComponent
+    {
+        /// <summary>What the last broadcast returned</summary>
+        public float LastDeltaTime { get; private set; }
+
+        public override void OnUpdate(float deltaTime)
+        {
+            LastDeltaTime = NativeReflection.BroadcastResultEBusEvent<float>("TickRequestBus", "GetTickDeltaTime");
+        }
+    }
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+using O3DE;
+
+namespace O3DESharp.Benchmarks
+{
+    /// <summary>
+    /// <see cref="TransformWriter"/> as a [ParallelUpdate] script: ticked in
+    /// job batches, with the writes buffered and applied on the main thread.
+    /// </summary>
+    [ParallelUpdate]
+    public class ParallelTransformWriter : ScriptComponent
+    {
+        private float m_time;
+
+        public override void OnUpdate(float deltaTime)
+        {
+            m_time += deltaTime;
+            Transform.LocalPosition = new Vector3(0f, 0f, MathF.Sin(m_time));
+        }
+    }
+}
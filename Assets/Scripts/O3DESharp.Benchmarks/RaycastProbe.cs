@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using O3DE;
+
+namespace O3DESharp.Benchmarks
+{
+    /// <summary>
+    /// Casts a short ray down from its position every frame, the way a
+    /// ground check does.
+    /// </summary>
+    public class RaycastProbe : ScriptComponent
+    {
+        private const float ProbeDistance = 2.0f;
+
+        /// <summary>Frames on which the probe hit something; keeps the result observable</summary>
+        public int Hits { get; private set; }
+
+        public override void OnUpdate(float deltaTime)
+        {
+            if (Physics.RaycastCheck(Transform.Position + Vector3.Up, Vector3.Down, ProbeDistance))
+            {
+                ++Hits;
+            }
+        }
+    }
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+using O3DE;
+
+namespace O3DESharp.Benchmarks
+{
+    /// <summary>
+    /// Reads and writes its world position every frame: one transform get
+    /// and one set through the internal calls, on the main thread.
+    /// </summary>
+    public class TransformWriter : ScriptComponent
+    {
+        private Vector3 m_origin;
+        private float m_time;
+
+        public override void OnCreate()
+        {
+            m_origin = Transform.Position;
+        }
+
+        public override void OnUpdate(float deltaTime)
+        {
+            m_time += deltaTime;
+            Vector3 position = Transform.Position;
+            position.Z = m_origin.Z + MathF.Sin(m_time);
+            Transform.Position = position;
+        }
+    }
+}
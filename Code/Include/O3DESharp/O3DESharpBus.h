@@ -38,6 +38,14 @@ namespace O3DESharp
          */
         virtual AZStd::string GetCoralHostStatus() const { return "Not implemented"; }
 
+        /**
+         * Check if the host is still being brought up on the boot worker
+         * (/O3DE/O3DESharp/Boot/Async). Script components activating in the
+         * meantime wait for O3DESharpNotifications::OnCoralHostReady.
+         * @return true between activation and the host becoming ready
+         */
+        virtual bool IsCoralHostBooting() const { return false; }
+
         // ============================================================
         // Assembly Management
         // ============================================================
@@ -55,6 +63,15 @@ namespace O3DESharp
          */
         virtual bool ReloadUserAssemblies() { return false; }
 
+        /**
+         * Reload only the given user assemblies (full paths) and whatever
+         * references them. Used by the editor's assembly watcher, which
+         * already knows which files actually changed. An empty list behaves
+         * like ReloadUserAssemblies.
+         * @return true if the reload was successful
+         */
+        virtual bool ReloadChangedUserAssemblies([[maybe_unused]] const AZStd::vector<AZStd::string>& changedAssemblyPaths) { return false; }
+
         /**
          * Check if hot-reload is enabled
          * @return true if hot-reload is enabled
@@ -90,10 +107,23 @@ namespace O3DESharp
          *
          * Caveat: the implementation constructs a temporary managed instance
          * of the class to snapshot its default values. Script ctors with
-         * side-effects (event subscriptions, log spam, etc.) will run.
+         * side-effects (event subscriptions, log spam, etc.) will run - once
+         * per class per assembly load, since the result is cached until the
+         * next user-assembly reload.
          */
         virtual AZStd::string GetExposedPropertySchemaJson([[maybe_unused]] const AZStd::string& fullTypeName) const { return "[]"; }
 
+        /**
+         * Compute and cache the exposed-property schema of each named class
+         * on a background thread, so later GetExposedPropertySchemaJson calls
+         * (inspector refreshes, runtime property blocks) don't construct a
+         * managed instance on the caller's thread. Returns immediately.
+         * Does nothing unless /O3DE/O3DESharp/PrecomputeExposedPropertySchemas
+         * is on: the constructors then run on that thread, limited to the
+         * internal calls a [ParallelUpdate] script may use.
+         */
+        virtual void PrecomputeExposedPropertySchemas([[maybe_unused]] const AZStd::vector<AZStd::string>& fullTypeNames) {}
+
         // ============================================================
         // Configuration
         // ============================================================
@@ -138,4 +168,37 @@ namespace O3DESharp
     using O3DESharpRequestBus = AZ::EBus<O3DESharpRequests, O3DESharpBusTraits>;
     using O3DESharpInterface = AZ::Interface<O3DESharpRequests>;
 
+    /**
+     * O3DESharpNotifications - Lifecycle notifications of the C# scripting system
+     */
+    class O3DESharpNotifications
+        : public AZ::EBusTraits
+    {
+    public:
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        virtual ~O3DESharpNotifications() = default;
+
+        /**
+         * Fired on the main thread once an asynchronous boot has finished:
+         * the host is registered, internal calls are bound and script
+         * types can be resolved. Not fired for a synchronous boot, where the
+         * host is ready before any script component activates. Also fired
+         * when the boot failed, so waiters stop waiting; check
+         * IsCoralHostInitialized.
+         */
+        virtual void OnCoralHostReady() {}
+
+        /**
+         * Fired on the main thread when the script activation queue has
+         * created every script it was holding back to stay within the
+         * per-frame budget (e.g. the end of a level load spread over several
+         * frames). Not fired when nothing was queued.
+         */
+        virtual void OnScriptActivationQueueDrained() {}
+    };
+
+    using O3DESharpNotificationBus = AZ::EBus<O3DESharpNotifications>;
+
 } // namespace O3DESharp
\ No newline at end of file
@@ -24,15 +24,18 @@ namespace O3DESharp
      * in <c>m_scriptInstance</c> with the same problem. The first call into
      * either after the reload would dereference freed memory.
      *
-     * Coral can't easily separate the contexts (per the comment in
-     * <c>CoralHostManager::Initialize</c>: Coral uses MemoryMappedFile which
-     * locks DLLs, and cross-context type resolution is not in this Coral
-     * version), so this bus is the alternative: every script component
-     * tears down its managed state on <c>OnBeforeUserAssemblyReload</c>
-     * and rebuilds it on <c>OnAfterUserAssemblyReload</c>. The notification
-     * order matches Coral's lifecycle - "before" fires before
+     * Every script component tears down its managed state on
+     * <c>OnBeforeUserAssemblyReload</c> and rebuilds it on
+     * <c>OnAfterUserAssemblyReload</c>. The notification order matches
+     * Coral's lifecycle - "before" fires before
      * <c>UnloadAssemblyLoadContext</c>, "after" fires after the new context
      * + assemblies are ready and internal calls are re-registered.
+     *
+     * User assemblies now have contexts of their own, and a reload may
+     * unload only some of them. Between the two notifications,
+     * <c>ICoralHostManager::IsUserTypeReloading</c> says whether a given
+     * script type is affected; handles to unaffected types stay valid and
+     * need not be released.
      */
     class O3DESharpHotReloadNotifications
         : public AZ::EBusTraits
@@ -46,18 +49,27 @@ namespace O3DESharp
         /**
          * Fired before the Coral assembly context is unloaded. Handlers must
          * release any <c>Coral::ManagedObject</c> / <c>Coral::Type*</c> /
-         * <c>Coral::ManagedAssembly*</c> they cached - those handles all
-         * become dangling pointers the instant the context unload runs.
+         * <c>Coral::ManagedAssembly*</c> they cached for a reloading type -
+         * those handles all become dangling pointers the instant the context
+         * unload runs.
          */
         virtual void OnBeforeUserAssemblyReload() {}
 
         /**
-         * Fired after the new context is up, O3DE.Core has been reloaded,
-         * internal calls have been re-registered, and the user assemblies
-         * have been re-loaded. Handlers can safely re-resolve types and
+         * Fired after the new contexts are up and the changed user assemblies
+         * have been re-loaded (plus O3DE.Core, with internal calls
+         * re-registered, if it changed too). Handlers can safely re-resolve types and
          * reconstruct their managed state.
          */
         virtual void OnAfterUserAssemblyReload() {}
+
+        /**
+         * Fired right after <c>OnAfterUserAssemblyReload</c> has reached every
+         * handler. Work that should see all handlers' post-reload state at
+         * once goes here - <c>CSharpScriptComponent</c> queues its rebuild in
+         * OnAfter and re-creates every queued script instance in one batch here.
+         */
+        virtual void OnUserAssemblyReloadCompleted() {}
     };
 
     using O3DESharpHotReloadNotificationBus = AZ::EBus<O3DESharpHotReloadNotifications>;
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/string/string.h>
+
+namespace O3DESharp
+{
+    /**
+     * Per-entity queries on the <c>CSharpScriptComponent</c>s of an entity.
+     *
+     * With an activation frame budget configured
+     * (<c>/O3DE/O3DESharp/Activation/FrameBudgetMs</c>) a script component can
+     * be active while its managed instance is still waiting in the activation
+     * queue. Gameplay that depends on another entity's script asks here, or
+     * waits for <c>O3DESharpScriptNotifications::OnScriptReady</c>.
+     *
+     * Addressed by <c>AZ::EntityId</c>; every script component on the entity
+     * is a handler.
+     */
+    class O3DESharpScriptRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        using BusIdType = AZ::EntityId;
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+
+        virtual ~O3DESharpScriptRequests() = default;
+
+        /// Fully qualified name of the script class this component runs.
+        virtual const AZStd::string& GetScriptClassName() const = 0;
+
+        /// True once the managed instance exists and its OnCreate has run.
+        virtual bool IsScriptReady() const = 0;
+    };
+
+    using O3DESharpScriptRequestBus = AZ::EBus<O3DESharpScriptRequests>;
+
+    /**
+     * Whether every script component on <paramref name="entityId"/> is
+     * ready. True for an entity without script components.
+     */
+    inline bool AreEntityScriptsReady(AZ::EntityId entityId)
+    {
+        bool ready = true;
+        O3DESharpScriptRequestBus::EnumerateHandlersId(entityId,
+            [&ready](O3DESharpScriptRequests* handler)
+            {
+                ready = handler->IsScriptReady();
+                return ready;
+            });
+        return ready;
+    }
+
+    /**
+     * Per-entity script lifecycle events, addressed by <c>AZ::EntityId</c>.
+     */
+    class O3DESharpScriptNotifications
+        : public AZ::EBusTraits
+    {
+    public:
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        using BusIdType = AZ::EntityId;
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+
+        virtual ~O3DESharpScriptNotifications() = default;
+
+        /**
+         * A script on this entity finished OnCreate - on activation, after
+         * leaving the activation queue, or when re-created by a hot reload.
+         * Not sent for scripts that were ready before the handler connected;
+         * check <c>O3DESharpScriptRequests::IsScriptReady</c> first.
+         */
+        virtual void OnScriptReady([[maybe_unused]] const AZStd::string& scriptClassName) {}
+    };
+
+    using O3DESharpScriptNotificationBus = AZ::EBus<O3DESharpScriptNotifications>;
+} // namespace O3DESharp
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ */
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace O3DESharp
+{
+    /**
+     * Managed -> native traffic over one frame, as recorded by the interop
+     * profiler. All zero unless the gem was built with
+     * O3DESHARP_INTEROP_PROFILER and o3desharp_InteropProfiler is on.
+     */
+    struct InteropFrameStats
+    {
+        AZ::u64 calls = 0;                  // Internal calls made during the frame, all threads
+        AZ::u64 totalNs = 0;                // Time spent inside them. A call that re-enters managed
+                                            // code and makes further internal calls counts that twice.
+        AZ::u64 bytes = 0;                  // Arguments and results passed by value, plus string payloads
+        const char* topBinding = nullptr;   // Internal call with the most time this frame, null if none
+                                            // ran. Points at a string literal; safe to keep.
+        AZ::u64 topBindingCalls = 0;
+        AZ::u64 topBindingNs = 0;
+    };
+
+    /**
+     * What one script class or one entity's scripts cost, as accounted by
+     * the script profiler. Time is wall time inside the managed call
+     * (lifecycle dispatches and managed EBus handler events); bytes are
+     * managed allocations made on the calling thread meanwhile.
+     */
+    struct ScriptCostStats
+    {
+        AZStd::string name;                 // Script class, "EBus <bus>" for managed handlers, or entity name
+        AZ::u64 entityId = 0;               // Per-entity rows only
+        AZ::u32 instances = 0;              // Active script components counted in the row
+        AZ::u64 lastFrameCalls = 0;
+        AZ::u64 lastFrameNs = 0;
+        AZ::u64 lastFrameBytes = 0;
+        double averageNs = 0.0;             // Per frame, rolling average over the last ~second of frames
+        double averageBytes = 0.0;
+        AZ::u64 peakNs = 0;                 // Worst single frame since the row appeared or was reset
+        AZ::u64 totalCalls = 0;
+        AZ::u64 totalNs = 0;
+        AZ::u64 totalBytes = 0;
+    };
+
+    /**
+     * A script whose updates keep going over the per-tick limit of the
+     * script tick scheduler (/O3DE/O3DESharp/Scheduler/OverrunMs, or the
+     * frame budget when that isn't set).
+     */
+    struct ScriptOverrunStats
+    {
+        AZStd::string name;                 // Script class
+        AZStd::string entityName;
+        AZ::u64 entityId = 0;
+        AZ::u32 overruns = 0;               // Updates over the limit among the script's last 64
+        AZ::u64 lastNs = 0;                 // The update that got it flagged
+        AZ::u64 limitNs = 0;
+    };
+
+    /**
+     * Main-thread script update time over one frame against the scheduler's
+     * budget. Only sent while /O3DE/O3DESharp/Scheduler/FrameBudgetMs (or
+     * o3desharp_ScriptFrameBudgetMs) is set.
+     */
+    struct ScriptBudgetFrameStats
+    {
+        AZ::u64 budgetNs = 0;
+        AZ::u64 scriptNs = 0;               // Every script update this frame, [ParallelUpdate] batches included
+        AZ::u32 slicedUpdates = 0;          // [UpdateInterval] scripts updated this frame
+        AZ::u32 deferredUpdates = 0;        // [UpdateInterval] scripts due but pushed to the next frame
+        AZ::u64 overBudgetFrames = 0;       // Frames over budget since the scheduler started
+    };
+
+    /**
+     * Per-frame performance rollups from the scripting runtime. Broadcast
+     * from the main thread at the end of the tick; nothing is computed
+     * while the bus has no handlers.
+     */
+    class O3DESharpStatsNotifications
+        : public AZ::EBusTraits
+    {
+    public:
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        virtual ~O3DESharpStatsNotifications() = default;
+
+        /**
+         * Internal-call counts and timings for the frame that just ticked.
+         * Not fired while the interop profiler is off.
+         */
+        virtual void OnInteropFrameStats([[maybe_unused]] const InteropFrameStats& stats) {}
+
+        /// Script update time against the frame budget, after the time-sliced scripts have run
+        virtual void OnScriptBudgetFrameStats([[maybe_unused]] const ScriptBudgetFrameStats& stats) {}
+
+        /**
+         * A script has overrun often enough to be flagged. Sent once, when
+         * the flag is raised, from the main thread right after the update;
+         * the flag clears after 64 updates in a row within the limit.
+         */
+        virtual void OnScriptOverrun([[maybe_unused]] const ScriptOverrunStats& stats) {}
+    };
+
+    using O3DESharpStatsNotificationBus = AZ::EBus<O3DESharpStatsNotifications>;
+
+    /**
+     * Queries against the script cost table kept by the script profiler
+     * (o3desharp_ScriptCosts prints the same data). Main thread only.
+     */
+    class O3DESharpStatsRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        virtual ~O3DESharpStatsRequests() = default;
+
+        /**
+         * Whether lifecycle dispatches are being timed and their allocations
+         * counted (o3desharp_ScriptAccounting, or
+         * /O3DE/O3DESharp/Profiling/ScriptAccounting at startup)
+         */
+        virtual bool IsScriptCostAccountingEnabled() const { return false; }
+        virtual void SetScriptCostAccountingEnabled([[maybe_unused]] bool enabled) {}
+
+        /// One row per script class, unsorted
+        virtual AZStd::vector<ScriptCostStats> GetScriptTypeCosts() const { return {}; }
+
+        /// One row per entity with an active script component, unsorted
+        virtual AZStd::vector<ScriptCostStats> GetScriptEntityCosts() const { return {}; }
+
+        /// Zero the averages, peaks and totals of every row
+        virtual void ResetScriptCosts() {}
+    };
+
+    using O3DESharpStatsRequestBus = AZ::EBus<O3DESharpStatsRequests>;
+} // namespace O3DESharp
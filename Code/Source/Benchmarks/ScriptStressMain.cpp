@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// O3DESharp.ScriptStress - ticks N scripted entities headless and reports
+// what the per-component tick path costs.
+//
+//   O3DESharp.ScriptStress --coral <dir> --core <O3DE.Core.dll> --assembly <scripts.dll>
+//       [--entities N] [--frames M] [--warmup W] [--scripts A,B,...] [--max-p99-ms X]
+//
+// Starts the Coral host the way O3DESharpSystemComponent does in a game,
+// minus the RPI, then gives each of N entities a TransformComponent and a
+// CSharpScriptComponent running one of the scripts in turn (by default the
+// ones in Assets/Scripts/O3DESharp.Benchmarks: transform writes on the main
+// thread and from [ParallelUpdate] batches, raycasts, EBus broadcasts).
+// After W warm-up frames it ticks M more and prints frame time percentiles,
+// the script profiler's per-class cost and the managed GC collections over
+// the measured frames. With --max-p99-ms the exit code is 3 when the 99th
+// percentile frame goes over it; CTest runs it that way.
+//
+// There's no physics scene here, so raycasts measure the interop round
+// trip and the native early-out, not the query.
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/StringFunc/StringFunc.h>
+
+#include <AzFramework/Application/Application.h>
+#include <AzFramework/Components/TransformComponent.h>
+
+#include <Clients/O3DESharpSystemComponent.h>
+#include <O3DESharp/O3DESharpBus.h>
+#include <O3DESharp/O3DESharpStatsBus.h>
+#include <Scripting/CoralHostManager.h>
+#include <Scripting/CSharpScriptComponent.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace O3DESharp
+{
+    namespace
+    {
+        constexpr const char* DefaultScripts =
+            "O3DESharp.Benchmarks.TransformWriter,O3DESharp.Benchmarks.ParallelTransformWriter,"
+            "O3DESharp.Benchmarks.RaycastProbe,O3DESharp.Benchmarks.EBusPinger";
+
+        struct StressOptions
+        {
+            const char* coralDirectory = nullptr;
+            const char* coreAssemblyPath = nullptr;
+            const char* scriptAssemblyPath = nullptr;
+            const char* scripts = DefaultScripts;
+            AZ::u32 entities = 1000;
+            AZ::u32 frames = 600;
+            AZ::u32 warmupFrames = 60;
+            double maxP99Ms = 0.0;              // 0 = report only
+        };
+
+        struct GcCounts
+        {
+            int collections[3] = {};            // Generations 0-2
+        };
+
+        GcCounts SampleGcCounts()
+        {
+            GcCounts counts;
+            ICoralHostManager* hostManager = CoralHostManagerInterface::Get();
+            if (hostManager == nullptr || !hostManager->IsInitialized())
+            {
+                return counts;
+            }
+            if (Coral::Type* profilingType = hostManager->GetCoreType("O3DE.ScriptProfiling"))
+            {
+                try
+                {
+                    for (int32_t generation = 0; generation < 3; ++generation)
+                    {
+                        counts.collections[generation] = profilingType->InvokeStaticMethod<int32_t>("GetCollectionCount", generation);
+                    }
+                }
+                catch (...)
+                {
+                    counts = {};
+                }
+            }
+            return counts;
+        }
+
+        double Percentile(const AZStd::vector<double>& sorted, double fraction)
+        {
+            if (sorted.empty())
+            {
+                return 0.0;
+            }
+            const size_t index = static_cast<size_t>(fraction * static_cast<double>(sorted.size() - 1) + 0.5);
+            return sorted[AZStd::min(index, sorted.size() - 1)];
+        }
+
+        void PrintScriptCosts(AZ::u32 frames)
+        {
+            AZStd::vector<ScriptCostStats> rows;
+            O3DESharpStatsRequestBus::BroadcastResult(rows, &O3DESharpStatsRequests::GetScriptTypeCosts);
+            AZStd::sort(rows.begin(), rows.end(),
+                [](const ScriptCostStats& a, const ScriptCostStats& b)
+                {
+                    return a.totalNs > b.totalNs;
+                });
+
+            printf("%-44s %9s %12s %12s %10s %12s\n", "script", "instances", "calls/frame", "us/frame", "ns/call", "bytes/frame");
+            for (const ScriptCostStats& row : rows)
+            {
+                const double perFrame = frames > 0 ? 1.0 / frames : 0.0;
+                printf("%-44s %9u %12.1f %12.1f %10.1f %12.1f\n",
+                    row.name.c_str(),
+                    row.instances,
+                    static_cast<double>(row.totalCalls) * perFrame,
+                    static_cast<double>(row.totalNs) * perFrame / 1.0e3,
+                    row.totalCalls > 0 ? static_cast<double>(row.totalNs) / static_cast<double>(row.totalCalls) : 0.0,
+                    static_cast<double>(row.totalBytes) * perFrame);
+            }
+        }
+
+        int RunStress(AzFramework::Application& application, const StressOptions& options)
+        {
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+            {
+                settingsRegistry->Set("/O3DE/O3DESharp/CoralDirectory", AZStd::string_view(options.coralDirectory));
+                settingsRegistry->Set("/O3DE/O3DESharp/CoreApiAssemblyPath", AZStd::string_view(options.coreAssemblyPath));
+                settingsRegistry->Set("/O3DE/O3DESharp/UserAssemblyPath", AZStd::string_view(options.scriptAssemblyPath));
+                settingsRegistry->Set("/O3DE/O3DESharp/Deploy/Enabled", false);
+                settingsRegistry->Set("/O3DE/O3DESharp/Profiling/ScriptAccounting", true);
+            }
+
+            auto systemEntity = AZStd::make_unique<AZ::Entity>("O3DESharp");
+            systemEntity->CreateComponent<O3DESharpSystemComponent>();
+            systemEntity->Init();
+            systemEntity->Activate();
+
+            bool hostReady = false;
+            O3DESharpRequestBus::BroadcastResult(hostReady, &O3DESharpRequests::IsCoralHostInitialized);
+            if (!hostReady)
+            {
+                AZStd::string status;
+                O3DESharpRequestBus::BroadcastResult(status, &O3DESharpRequests::GetCoralHostStatus);
+                fprintf(stderr, "Coral host didn't start: %s\n", status.c_str());
+                systemEntity->Deactivate();
+                return 2;
+            }
+
+            AZStd::vector<AZStd::string> scripts;
+            AZ::StringFunc::Tokenize(options.scripts, scripts, ',');
+            if (scripts.empty())
+            {
+                fprintf(stderr, "no scripts to run\n");
+                systemEntity->Deactivate();
+                return 1;
+            }
+
+            // A square grid, one unit apart, so positions and ray origins differ per entity
+            const AZ::u32 side = AZStd::max(1u, static_cast<AZ::u32>(std::sqrt(static_cast<double>(options.entities))));
+            AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+            AZStd::vector<CSharpScriptComponent*> scriptComponents;
+            entities.reserve(options.entities);
+            scriptComponents.reserve(options.entities);
+
+            const auto spawnStart = AZStd::chrono::steady_clock::now();
+            for (AZ::u32 i = 0; i < options.entities; ++i)
+            {
+                auto entity = AZStd::make_unique<AZ::Entity>(AZStd::string::format("Stress %u", i).c_str());
+                entity->CreateComponent<AzFramework::TransformComponent>();
+
+                CSharpScriptComponentConfig config;
+                config.m_scriptClassName = scripts[i % scripts.size()];
+                scriptComponents.push_back(entity->CreateComponent<CSharpScriptComponent>(config));
+
+                entity->Init();
+                entity->Activate();
+                AZ::TransformBus::Event(entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation,
+                    AZ::Vector3(static_cast<float>(i % side), static_cast<float>(i / side), 0.0f));
+                entities.push_back(AZStd::move(entity));
+            }
+            const double spawnMs = AZStd::chrono::duration<double, AZStd::milli>(AZStd::chrono::steady_clock::now() - spawnStart).count();
+
+            // Activation may be spread over frames by a budget; warm-up covers it
+            for (AZ::u32 frame = 0; frame < options.warmupFrames; ++frame)
+            {
+                application.Tick();
+            }
+
+            const size_t invalid = AZStd::count_if(scriptComponents.begin(), scriptComponents.end(),
+                [](const CSharpScriptComponent* component)
+                {
+                    return !component->IsScriptValid();
+                });
+
+            O3DESharpStatsRequestBus::Broadcast(&O3DESharpStatsRequests::ResetScriptCosts);
+            const GcCounts gcBefore = SampleGcCounts();
+
+            AZStd::vector<double> frameMs;
+            frameMs.reserve(options.frames);
+            for (AZ::u32 frame = 0; frame < options.frames; ++frame)
+            {
+                const auto start = AZStd::chrono::steady_clock::now();
+                application.Tick();
+                frameMs.push_back(AZStd::chrono::duration<double, AZStd::milli>(AZStd::chrono::steady_clock::now() - start).count());
+            }
+
+            const GcCounts gcAfter = SampleGcCounts();
+
+            double totalMs = 0.0;
+            for (double ms : frameMs)
+            {
+                totalMs += ms;
+            }
+            AZStd::vector<double> sorted = frameMs;
+            AZStd::sort(sorted.begin(), sorted.end());
+            const double p99 = Percentile(sorted, 0.99);
+
+            printf("entities: %u (%zu scripts failed to start), spawned in %.1f ms\n", options.entities, invalid, spawnMs);
+            printf("frames: %u measured after %u warm-up\n", options.frames, options.warmupFrames);
+            printf("frame ms: mean %.3f  p50 %.3f  p90 %.3f  p99 %.3f  max %.3f\n",
+                frameMs.empty() ? 0.0 : totalMs / frameMs.size(),
+                Percentile(sorted, 0.5),
+                Percentile(sorted, 0.9),
+                p99,
+                sorted.empty() ? 0.0 : sorted.back());
+            printf("gc collections: gen0 %d  gen1 %d  gen2 %d\n",
+                gcAfter.collections[0] - gcBefore.collections[0],
+                gcAfter.collections[1] - gcBefore.collections[1],
+                gcAfter.collections[2] - gcBefore.collections[2]);
+            PrintScriptCosts(options.frames);
+
+            for (auto& entity : entities)
+            {
+                entity->Deactivate();
+            }
+            entities.clear();
+            systemEntity->Deactivate();
+
+            if (invalid != 0)
+            {
+                fprintf(stderr, "%zu of %u scripts didn't start\n", invalid, options.entities);
+                return 2;
+            }
+            if (options.maxP99Ms > 0.0 && p99 > options.maxP99Ms)
+            {
+                fprintf(stderr, "p99 frame time %.3f ms is over the %.3f ms limit\n", p99, options.maxP99Ms);
+                return 3;
+            }
+            return 0;
+        }
+
+        int PrintUsage()
+        {
+            fprintf(stderr,
+                "usage: O3DESharp.ScriptStress --coral <dir> --core <O3DE.Core.dll> --assembly <scripts.dll>\n"
+                "           [--entities N] [--frames M] [--warmup W] [--scripts A,B,...] [--max-p99-ms X]\n");
+            return 1;
+        }
+    }
+} // namespace O3DESharp
+
+int main(int argc, char** argv)
+{
+    using namespace O3DESharp;
+
+    StressOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--coral") == 0 && hasValue)
+        {
+            options.coralDirectory = argv[++i];
+        }
+        else if (strcmp(argv[i], "--core") == 0 && hasValue)
+        {
+            options.coreAssemblyPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--assembly") == 0 && hasValue)
+        {
+            options.scriptAssemblyPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--scripts") == 0 && hasValue)
+        {
+            options.scripts = argv[++i];
+        }
+        else if (strcmp(argv[i], "--entities") == 0 && hasValue)
+        {
+            options.entities = AZStd::max(1, atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--frames") == 0 && hasValue)
+        {
+            options.frames = AZStd::max(1, atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--warmup") == 0 && hasValue)
+        {
+            options.warmupFrames = AZStd::max(0, atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--max-p99-ms") == 0 && hasValue)
+        {
+            options.maxP99Ms = atof(argv[++i]);
+        }
+        else
+        {
+            return PrintUsage();
+        }
+    }
+    if (options.coralDirectory == nullptr || options.coreAssemblyPath == nullptr || options.scriptAssemblyPath == nullptr)
+    {
+        return PrintUsage();
+    }
+
+    // Our options aren't the engine's; keep them off its command line
+    int appArgc = 1;
+    char** appArgv = argv;
+    AzFramework::Application application(&appArgc, &appArgv);
+    AZ::ComponentApplication::Descriptor descriptor;
+    AZ::ComponentApplication::StartupParameters startupParameters;
+    startupParameters.m_loadSettingsRegistry = false;
+    application.Start(descriptor, startupParameters);
+
+    // The gem module isn't loaded; only these two are needed
+    application.RegisterComponentDescriptor(O3DESharpSystemComponent::CreateDescriptor());
+    application.RegisterComponentDescriptor(CSharpScriptComponent::CreateDescriptor());
+
+    const int exitCode = RunStress(application, options);
+
+    application.Stop();
+    return exitCode;
+}
@@ -18,15 +18,29 @@
 #include <AzCore/Utils/Utils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/set.h>
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
+#include <string>
 
 #include <Atom/RPI.Public/FeatureProcessorFactory.h>
 
 #include <Render/O3DESharpFeatureProcessor.h>
 #include <Scripting/CoralHostManager.h>
+#include <Scripting/FrameSnapshot.h>
+#include <Scripting/InternalCallGuard.h>
+#include <Scripting/InteropProfiler.h>
+#include <Scripting/ParallelScriptUpdater.h>
+#include <Scripting/ScriptActivationQueue.h>
 #include <Scripting/ScriptBindings.h>
+#include <Scripting/ScriptLogQueue.h>
+#include <Scripting/ScriptProfiler.h>
+#include <Scripting/ScriptTickScheduler.h>
 #include <Scripting/CSharpScriptComponent.h>
 #include <Scripting/Reflection/BehaviorContextReflector.h>
 #include <Scripting/Reflection/GenericDispatcher.h>
@@ -69,11 +83,13 @@ namespace O3DESharp
 
     void O3DESharpSystemComponent::GetRequiredServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& required)
     {
-        required.push_back(AZ_CRC_CE("RPISystem"));
     }
 
     void O3DESharpSystemComponent::GetDependentServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& dependent)
     {
+        // Only the feature processor needs the RPI; headless hosts
+        // (O3DESharp.ScriptStress, servers) run scripts without it.
+        dependent.push_back(AZ_CRC_CE("RPISystem"));
     }
 
     O3DESharpSystemComponent::O3DESharpSystemComponent()
@@ -100,45 +116,165 @@ namespace O3DESharp
         // Create the reflection system components
         m_reflector = AZStd::make_unique<BehaviorContextReflector>();
         m_dispatcher = AZStd::make_unique<GenericDispatcher>();
+
+        m_frameSnapshotPublisher = AZStd::make_unique<FrameSnapshotPublisher>();
+        m_activationQueue = AZStd::make_unique<ScriptActivationQueue>();
+        m_parallelUpdater = AZStd::make_unique<ParallelScriptUpdater>();
+        m_tickScheduler = AZStd::make_unique<ScriptTickScheduler>();
+        m_logQueue = AZStd::make_unique<ScriptLogQueue>();
+        m_interopProfiler = AZStd::make_unique<InteropProfiler>();
+        m_scriptProfiler = AZStd::make_unique<ScriptProfiler>();
     }
 
     void O3DESharpSystemComponent::Activate()
     {
         O3DESharpRequestBus::Handler::BusConnect();
         ReflectionDataExportRequestBus::Handler::BusConnect();
+        O3DESharpHotReloadNotificationBus::Handler::BusConnect();
 
         // Register the feature processor for rendering support
-        AZ::RPI::FeatureProcessorFactory::Get()->RegisterFeatureProcessor<O3DESharpFeatureProcessor>();
-
-        // Auto-deploy the latest Coral.Managed and O3DE.Core DLLs before init.
-        // This walks the build tree to pick the freshest output; it's a dev-time
-        // convenience and has no useful effect in shipping builds where Build/
-        // and _deps/ do not exist on the customer's machine. It also tries to
-        // write into <ProjectPath>/Bin/Scripts/ which is typically read-only on
-        // installed games. Guard it out of Release / monolithic builds.
+        if (auto* featureProcessorFactory = AZ::RPI::FeatureProcessorFactory::Get())
+        {
+            featureProcessorFactory->RegisterFeatureProcessor<O3DESharpFeatureProcessor>();
+        }
+
+        bool asyncBoot = false;
+        double activationBudgetMs = 0.0;
+        bool parallelUseJobs = true;
+        AZ::u64 parallelMinPerJob = ParallelScriptUpdater::DefaultMinInstancesPerJob;
+        bool scriptAccounting = false;
+        double schedulerBudgetMs = 0.0;
+        double schedulerOverrunMs = 0.0;
+        AZ::u64 overrunsToFlag = ScriptTickScheduler::DefaultOverrunsToFlag;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(asyncBoot, "/O3DE/O3DESharp/Boot/Async");
+            settingsRegistry->Get(m_prepareScriptMethods, "/O3DE/O3DESharp/Boot/PrepareScriptMethods");
+            settingsRegistry->Get(activationBudgetMs, "/O3DE/O3DESharp/Activation/FrameBudgetMs");
+            settingsRegistry->Get(parallelUseJobs, "/O3DE/O3DESharp/ParallelUpdate/UseJobs");
+            settingsRegistry->Get(parallelMinPerJob, "/O3DE/O3DESharp/ParallelUpdate/MinInstancesPerJob");
+            settingsRegistry->Get(scriptAccounting, "/O3DE/O3DESharp/Profiling/ScriptAccounting");
+            settingsRegistry->Get(schedulerBudgetMs, "/O3DE/O3DESharp/Scheduler/FrameBudgetMs");
+            settingsRegistry->Get(schedulerOverrunMs, "/O3DE/O3DESharp/Scheduler/OverrunMs");
+            settingsRegistry->Get(overrunsToFlag, "/O3DE/O3DESharp/Scheduler/OverrunsToFlag");
+        }
+
+        // Script components register with it as they activate
+        m_scriptProfiler->Connect(scriptAccounting);
+
+        // [ParallelUpdate] scripts register with it as they're created
+        m_parallelUpdater->Connect(parallelUseJobs, static_cast<AZ::u32>(AZStd::min<AZ::u64>(parallelMinPerJob, 0xFFFFFFFFu)));
+
+        // [UpdateInterval] scripts register with it after the parallel updater declines them
+        m_tickScheduler->Connect(
+            static_cast<AZ::u64>(AZStd::max(schedulerBudgetMs, 0.0) * 1.0e6),
+            static_cast<AZ::u64>(AZStd::max(schedulerOverrunMs, 0.0) * 1.0e6),
+            static_cast<AZ::u32>(AZStd::min<AZ::u64>(overrunsToFlag, 0xFFFFFFFFu)));
+
+        // Before any script component activates: with a budget, scripts
+        // beyond it in a frame are started on later frames.
+        m_activationQueue->Connect(AZStd::chrono::microseconds(static_cast<AZ::s64>(AZStd::max(activationBudgetMs, 0.0) * 1000.0)));
+
+        // Start the script log consumer before the host so the first
+        // Debug.Log (possibly from a static constructor during load) finds
+        // the queue. Debug.cs resolves it once and never re-checks.
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            AZ::u64 rateLimit = ScriptLogQueue::DefaultMaxMessagesPerEntityPerSecond;
+            settingsRegistry->Get(rateLimit, "/O3DE/O3DESharp/Logging/MaxMessagesPerEntityPerSecond");
+            m_logQueue->SetMaxMessagesPerEntityPerSecond(static_cast<AZ::u32>(rateLimit));
+
+            // Precompute runs script constructors on a worker thread; projects
+            // whose constructors touch main-thread-only state can turn it off.
+            settingsRegistry->Get(m_precomputeSchemas, "/O3DE/O3DESharp/PrecomputeExposedPropertySchemas");
+        }
+        m_logQueue->Start();
+
+        if (asyncBoot && m_coralHostManager)
+        {
+            // Deployment, host start-up and assembly loading move to a
+            // worker; the engine keeps booting and script components that
+            // activate meanwhile wait for OnCoralHostReady.
+            StartAsyncBoot();
+        }
+        else
+        {
+            // Auto-deploy the latest Coral.Managed and O3DE.Core DLLs before init.
+            // This walks the build tree to pick the freshest output; it's a dev-time
+            // convenience and has no useful effect in shipping builds where Build/
+            // and _deps/ do not exist on the customer's machine. It also tries to
+            // write into <ProjectPath>/Bin/Scripts/ which is typically read-only on
+            // installed games. Guard it out of Release / monolithic builds.
 #if !defined(AZ_RELEASE_BUILD) && !defined(AZ_MONOLITHIC_BUILD)
-        DeployLatestManagedAssemblies();
+            DeployLatestManagedAssemblies();
 #endif
 
-        // Initialize the Coral .NET host
-        InitializeCoralHost();
+            // Initialize the Coral .NET host
+            InitializeCoralHost();
+        }
 
         // Initialize the BehaviorContext reflection system
         InitializeReflectionSystem();
 
-        AZLOG_INFO("O3DESharpSystemComponent: Activated - C# scripting is ready");
+        // Start publishing the per-frame blocks managed code reads without
+        // an interop transition (Input.cs).
+        m_frameSnapshotPublisher->Connect();
+
+        // Per-frame internal-call rollup for O3DESharpStatsNotificationBus;
+        // idle unless o3desharp_InteropProfiler is on and someone listens.
+        m_interopProfiler->Connect();
+
+        if (m_bootInProgress)
+        {
+            AZLOG_INFO("O3DESharpSystemComponent: Activated - C# host starting in the background");
+        }
+        else
+        {
+            AZLOG_INFO("O3DESharpSystemComponent: Activated - C# scripting is ready");
+        }
     }
 
     void O3DESharpSystemComponent::Deactivate()
     {
+        // An unfinished boot can't be interrupted mid-way through the
+        // runtime's start-up; wait for it, then shut down what it built.
+        AZ::TickBus::Handler::BusDisconnect();
+        if (m_bootThread.joinable())
+        {
+            m_bootThread.join();
+        }
+        m_bootInProgress = false;
+
+        m_frameSnapshotPublisher->Disconnect();
+        m_activationQueue->Disconnect();
+        m_parallelUpdater->Disconnect();
+        m_tickScheduler->Disconnect();
+        m_interopProfiler->Disconnect();
+        m_scriptProfiler->Disconnect();
+
         // Shutdown reflection system
         ShutdownReflectionSystem();
 
+        // Before the host goes away - the worker is inside managed code
+        StopSchemaPrecompute();
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_schemaCacheMutex);
+            m_schemaCache.clear();
+            ++m_schemaCacheGeneration;
+        }
+
         // Shutdown Coral host
         ShutdownCoralHost();
 
-        AZ::RPI::FeatureProcessorFactory::Get()->UnregisterFeatureProcessor<O3DESharpFeatureProcessor>();
+        // After the host so anything logged during managed shutdown is drained
+        m_logQueue->Stop();
 
+        if (auto* featureProcessorFactory = AZ::RPI::FeatureProcessorFactory::Get())
+        {
+            featureProcessorFactory->UnregisterFeatureProcessor<O3DESharpFeatureProcessor>();
+        }
+
+        O3DESharpHotReloadNotificationBus::Handler::BusDisconnect();
         ReflectionDataExportRequestBus::Handler::BusDisconnect();
         O3DESharpRequestBus::Handler::BusDisconnect();
 
@@ -151,7 +287,12 @@ namespace O3DESharp
 
     bool O3DESharpSystemComponent::IsCoralHostInitialized() const
     {
-        return m_coralHostManager && m_coralHostManager->IsInitialized();
+        return !m_bootInProgress && m_coralHostManager && m_coralHostManager->IsInitialized();
+    }
+
+    bool O3DESharpSystemComponent::IsCoralHostBooting() const
+    {
+        return m_bootInProgress;
     }
 
     AZStd::string O3DESharpSystemComponent::GetCoralHostStatus() const
@@ -160,6 +301,10 @@ namespace O3DESharp
         {
             return "Host manager not created";
         }
+        if (m_bootInProgress)
+        {
+            return "Starting in the background";
+        }
         if (!m_coralHostManager->IsInitialized())
         {
             return "Not initialized";
@@ -169,7 +314,7 @@ namespace O3DESharp
 
     bool O3DESharpSystemComponent::LoadAssembly(const AZStd::string& assemblyPath)
     {
-        if (!m_coralHostManager || !m_coralHostManager->IsInitialized())
+        if (!IsCoralHostInitialized())
         {
             AZLOG_ERROR("O3DESharpSystemComponent: Cannot load assembly - host not initialized");
             return false;
@@ -181,18 +326,27 @@ namespace O3DESharp
 
     bool O3DESharpSystemComponent::ReloadUserAssemblies()
     {
-        if (!m_coralHostManager || !m_coralHostManager->IsInitialized())
+        return ReloadChangedUserAssemblies({});
+    }
+
+    bool O3DESharpSystemComponent::ReloadChangedUserAssemblies(const AZStd::vector<AZStd::string>& changedAssemblyPaths)
+    {
+        if (!IsCoralHostInitialized())
         {
             AZLOG_ERROR("O3DESharpSystemComponent: Cannot reload - host not initialized");
             return false;
         }
 
-        bool success = m_coralHostManager->ReloadUserAssemblies();
+        bool success = m_coralHostManager->ReloadChangedUserAssemblies(changedAssemblyPaths);
 
         if (success)
         {
-            // Re-register script bindings against the freshly-loaded core assembly.
-            RegisterScriptBindings();
+            // Re-register script bindings if O3DE.Core was reloaded too. A
+            // partial reload leaves it (and its internal calls) in place.
+            if (m_coralHostManager->LastReloadIncludedCore())
+            {
+                RegisterScriptBindings();
+            }
 
             // Re-reflect the BehaviorContext. Any gem that registered new types
             // since startup is now visible to NativeReflection, and any
@@ -212,105 +366,276 @@ namespace O3DESharp
 
     bool O3DESharpSystemComponent::TypeExists(const AZStd::string& fullTypeName) const
     {
-        if (!m_coralHostManager || !m_coralHostManager->IsInitialized())
+        if (!IsCoralHostInitialized())
         {
             return false;
         }
 
-        // Check in user assembly first, then core
-        Coral::Type* type = m_coralHostManager->GetUserType(fullTypeName);
-        if (!type)
-        {
-            type = m_coralHostManager->GetCoreType(fullTypeName);
-        }
-        return type != nullptr;
+        // User assemblies first, then core; misses are cached by the host
+        return m_coralHostManager->ResolveScriptType(fullTypeName).IsValid();
     }
 
-    AZStd::string O3DESharpSystemComponent::GetExposedPropertySchemaJson(const AZStd::string& fullTypeName) const
+    namespace
     {
         // Empty array is the safe "no schema available" signal - the inspector
         // falls back to the generic name/value map editor when it sees this.
-        constexpr const char* kEmpty = "[]";
+        constexpr const char* EmptySchemaJson = "[]";
 
-        if (!m_coralHostManager || !m_coralHostManager->IsInitialized() || fullTypeName.empty())
+        AZStd::string QueryExposedPropertySchemaJson(Coral::Type& scriptType, const AZStd::string& fullTypeName)
         {
-            return kEmpty;
+            // Create a transient managed instance and call its (non-virtual)
+            // GetExposedPropertySchemaJson() instance method. We match the
+            // proven ApplyExposedProperties / OnCreate dispatch pattern rather
+            // than reaching into Coral::Type for a static-method invocation
+            // helper that may or may not be wired up.
+            //
+            // Documented caveat: script default ctors with side-effects (event
+            // subscriptions, log spam) WILL run - once per class per assembly
+            // load, since callers cache the result - which matches Unity's
+            // familiar behavior for editor-time component introspection.
+            //
+            // Only touches the Coral type, never CoralHostManager's caches, so
+            // it is safe to call from the schema precompute thread.
+            Coral::ManagedObject instance = scriptType.CreateInstance();
+            if (!instance.IsValid())
+            {
+                AZ_Warning(
+                    "O3DESharp", false,
+                    "GetExposedPropertySchemaJson: failed to construct transient instance of '%s'",
+                    fullTypeName.c_str());
+                return EmptySchemaJson;
+            }
+
+            AZStd::string result = EmptySchemaJson;
+            try
+            {
+                Coral::String managed = instance.InvokeMethod<Coral::String>("GetExposedPropertySchemaJson");
+                // Coral::String stores UCChar* (wchar_t* on Windows -> UTF-16,
+                // char* on Linux/Mac -> UTF-8). The previous implementation cast
+                // managed.Data() to (const char*) and assigned it as if it were a
+                // C string, which on Windows reads UTF-16 bytes as ASCII and
+                // stops at the first 0x00 byte. For a JSON like "[{\"name\":..."
+                // that's exactly one byte ('['), producing the confusing
+                // "JSON: [" warning the inspector reported.
+                //
+                // The Coral::String::operator std::string() conversion calls
+                // StringHelper::ConvertWideToUtf8 internally, handling both
+                // platforms correctly. Use it instead.
+                if (managed.Data() != nullptr)
+                {
+                    std::string utf8 = static_cast<std::string>(managed);
+                    result = AZStd::string(utf8.c_str(), utf8.size());
+                }
+                // Intentionally not calling Coral::String::Free: the returned
+                // string is owned by the managed heap and reclaimed by the .NET
+                // GC. Explicitly freeing it here risked a double-free with
+                // older Coral builds. If a future Coral release requires
+                // explicit release, swap this for the documented Free / Drop
+                // call - it's the only resource concern in this method.
+            }
+            catch ([[maybe_unused]] const std::exception& ex)
+            {
+                AZ_Warning(
+                    "O3DESharp", false,
+                    "GetExposedPropertySchemaJson('%s') threw: %s",
+                    fullTypeName.c_str(), ex.what());
+            }
+            catch (...)
+            {
+                AZ_Warning(
+                    "O3DESharp", false,
+                    "GetExposedPropertySchemaJson('%s') threw (non-std exception)",
+                    fullTypeName.c_str());
+            }
+
+            instance.Destroy();
+            return result;
         }
+    } // namespace
 
-        Coral::Type* scriptType = m_coralHostManager->GetUserType(fullTypeName);
-        if (scriptType == nullptr)
+    AZStd::string O3DESharpSystemComponent::GetExposedPropertySchemaJson(const AZStd::string& fullTypeName) const
+    {
+        if (!IsCoralHostInitialized() || fullTypeName.empty())
         {
-            scriptType = m_coralHostManager->GetCoreType(fullTypeName);
+            return EmptySchemaJson;
         }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_schemaCacheMutex);
+            auto it = m_schemaCache.find(fullTypeName);
+            if (it != m_schemaCache.end())
+            {
+                return it->second;
+            }
+        }
+
+        Coral::Type* scriptType = m_coralHostManager->GetType(m_coralHostManager->ResolveScriptType(fullTypeName));
         if (scriptType == nullptr)
         {
-            return kEmpty;
+            // Not cached: the name may be mid-typing in the inspector, and a
+            // type that appears later only does so through a reload anyway.
+            return EmptySchemaJson;
         }
 
-        // Create a transient managed instance and call its (non-virtual)
-        // GetExposedPropertySchemaJson() instance method. We match the
-        // proven ApplyExposedProperties / OnCreate dispatch pattern rather
-        // than reaching into Coral::Type for a static-method invocation
-        // helper that may or may not be wired up.
-        //
-        // Documented caveat: script default ctors with side-effects (event
-        // subscriptions, log spam) WILL run once per inspector refresh -
-        // this matches Unity's familiar behavior for editor-time component
-        // introspection.
-        Coral::ManagedObject instance = scriptType->CreateInstance();
-        if (!instance.IsValid())
+        // A failed construction is cached too - retrying it on every
+        // inspector refresh would just repeat the same warning.
+        AZStd::string result = QueryExposedPropertySchemaJson(*scriptType, fullTypeName);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_schemaCacheMutex);
+        m_schemaCache.insert_or_assign(fullTypeName, result);
+        return result;
+    }
+
+    void O3DESharpSystemComponent::PrecomputeExposedPropertySchemas(const AZStd::vector<AZStd::string>& fullTypeNames)
+    {
+        if (m_precomputeSchemas)
         {
-            AZ_Warning(
-                "O3DESharp", false,
-                "GetExposedPropertySchemaJson: failed to construct transient instance of '%s'",
-                fullTypeName.c_str());
-            return kEmpty;
+            StartSchemaPrecompute(fullTypeNames);
         }
+    }
 
-        AZStd::string result = kEmpty;
-        try
+    void O3DESharpSystemComponent::StartSchemaPrecompute(const AZStd::vector<AZStd::string>& fullTypeNames)
+    {
+        if (!IsCoralHostInitialized())
         {
-            Coral::String managed = instance.InvokeMethod<Coral::String>("GetExposedPropertySchemaJson");
-            // Coral::String stores UCChar* (wchar_t* on Windows -> UTF-16,
-            // char* on Linux/Mac -> UTF-8). The previous implementation cast
-            // managed.Data() to (const char*) and assigned it as if it were a
-            // C string, which on Windows reads UTF-16 bytes as ASCII and
-            // stops at the first 0x00 byte. For a JSON like "[{\"name\":..."
-            // that's exactly one byte ('['), producing the confusing
-            // "JSON: [" warning the inspector reported.
-            //
-            // The Coral::String::operator std::string() conversion calls
-            // StringHelper::ConvertWideToUtf8 internally, handling both
-            // platforms correctly. Use it instead.
-            if (managed.Data() != nullptr)
+            return;
+        }
+
+        // One precompute at a time; a new request supersedes the old one.
+        StopSchemaPrecompute();
+
+        AZStd::vector<AZStd::pair<AZStd::string, Coral::Type*>> pending;
+        AZ::u64 generation = 0;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_schemaCacheMutex);
+            generation = m_schemaCacheGeneration;
+            for (const AZStd::string& fullTypeName : fullTypeNames)
             {
-                std::string utf8 = static_cast<std::string>(managed);
-                result = AZStd::string(utf8.c_str(), utf8.size());
+                if (!fullTypeName.empty() && m_schemaCache.find(fullTypeName) == m_schemaCache.end())
+                {
+                    pending.emplace_back(fullTypeName, nullptr);
+                }
             }
-            // Intentionally not calling Coral::String::Free: the returned
-            // string is owned by the managed heap and reclaimed by the .NET
-            // GC. Explicitly freeing it here risked a double-free with
-            // older Coral builds. If a future Coral release requires
-            // explicit release, swap this for the documented Free / Drop
-            // call - it's the only resource concern in this method.
         }
-        catch ([[maybe_unused]] const std::exception& ex)
+
+        for (auto& [fullTypeName, type] : pending)
         {
-            AZ_Warning(
-                "O3DESharp", false,
-                "GetExposedPropertySchemaJson('%s') threw: %s",
-                fullTypeName.c_str(), ex.what());
+            type = m_coralHostManager->GetType(m_coralHostManager->ResolveScriptType(fullTypeName));
         }
-        catch (...)
+        AZStd::erase_if(pending, [](const auto& entry) { return entry.second == nullptr; });
+        if (pending.empty())
         {
-            AZ_Warning(
-                "O3DESharp", false,
-                "GetExposedPropertySchemaJson('%s') threw (non-std exception)",
-                fullTypeName.c_str());
+            return;
         }
 
-        instance.Destroy();
-        return result;
+        m_cancelSchemaPrecompute.store(false);
+
+        AZStd::thread_desc desc;
+        desc.m_name = "O3DESharp Schema Precompute";
+        m_schemaPrecomputeThread = AZStd::thread(desc,
+            [this, generation, pending = AZStd::move(pending)]()
+            {
+                // The query runs the script's constructor and field
+                // initialisers off the main thread. Hold them to the same
+                // internal calls a [ParallelUpdate] script gets; anything else
+                // is refused and the class is left to the main thread.
+                InternalCallGuard::SetInParallelPartition(true);
+
+                size_t cached = 0;
+                for (const auto& [fullTypeName, type] : pending)
+                {
+                    if (m_cancelSchemaPrecompute.load())
+                    {
+                        break;
+                    }
+
+                    AZStd::string schema = QueryExposedPropertySchemaJson(*type, fullTypeName);
+
+                    AZStd::string refusedCall;
+                    if (InternalCallGuard::TakeRefusedCall(refusedCall))
+                    {
+                        AZ_Warning("O3DESharp", false,
+                            "Schema precompute: '%s' calls %s while constructed, which needs the main thread; "
+                            "its schema is built on first use instead",
+                            fullTypeName.c_str(), refusedCall.c_str());
+                        continue;
+                    }
+
+                    AZStd::lock_guard<AZStd::mutex> lock(m_schemaCacheMutex);
+                    if (generation != m_schemaCacheGeneration)
+                    {
+                        break;
+                    }
+                    // emplace: an on-demand query on the main thread may have
+                    // landed first, and either result is equally current.
+                    m_schemaCache.emplace(fullTypeName, AZStd::move(schema));
+                    ++cached;
+                }
+
+                InternalCallGuard::SetInParallelPartition(false);
+
+                // Check what the cache actually holds now, so a precompute
+                // that silently did nothing shows up in the log.
+                AZStd::vector<AZStd::string> missing;
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_schemaCacheMutex);
+                    for (const auto& entry : pending)
+                    {
+                        if (m_schemaCache.find(entry.first) == m_schemaCache.end())
+                        {
+                            missing.push_back(entry.first);
+                        }
+                    }
+                }
+                AZLOG_INFO("O3DESharpSystemComponent: Precomputed %zu of %zu exposed-property schema(s)", cached, pending.size());
+                if (!missing.empty() && !m_cancelSchemaPrecompute.load())
+                {
+                    AZLOG_WARN("O3DESharpSystemComponent: %zu script class(es) still have no cached schema, first: '%s'",
+                        missing.size(), missing.front().c_str());
+                }
+            });
+    }
+
+    void O3DESharpSystemComponent::StopSchemaPrecompute()
+    {
+        m_cancelSchemaPrecompute.store(true);
+        if (m_schemaPrecomputeThread.joinable())
+        {
+            m_schemaPrecomputeThread.join();
+        }
+    }
+
+    void O3DESharpSystemComponent::OnBeforeUserAssemblyReload()
+    {
+        // The worker holds Coral::Type pointers into the context that is
+        // about to be unloaded.
+        StopSchemaPrecompute();
+
+        // Drop the classes this reload unloads (a partial reload keeps the
+        // rest valid) and remember them, so OnAfter can re-warm exactly those
+        // against the new assemblies.
+        AZStd::lock_guard<AZStd::mutex> lock(m_schemaCacheMutex);
+        m_schemaWarmSet.clear();
+        for (auto it = m_schemaCache.begin(); it != m_schemaCache.end();)
+        {
+            if (m_coralHostManager && !m_coralHostManager->IsUserTypeReloading(it->first))
+            {
+                ++it;
+                continue;
+            }
+            m_schemaWarmSet.push_back(it->first);
+            it = m_schemaCache.erase(it);
+        }
+        ++m_schemaCacheGeneration;
+    }
+
+    void O3DESharpSystemComponent::OnAfterUserAssemblyReload()
+    {
+        if (m_precomputeSchemas && !m_schemaWarmSet.empty())
+        {
+            StartSchemaPrecompute(m_schemaWarmSet);
+        }
+        m_schemaWarmSet.clear();
     }
 
     AZStd::vector<AZStd::string> O3DESharpSystemComponent::GetAvailableScriptTypes() const
@@ -522,6 +847,184 @@ namespace O3DESharp
         return bestPath;
     }
 
+    namespace
+    {
+        // Deployment manifest: where the previous boot found each deployed file
+        // and what it looked like, so the next boot can check those few files
+        // instead of walking the whole build tree again.
+        struct DeployManifestEntry
+        {
+            std::string fileName;           // deployed file name, e.g. "O3DE.Core.dll"
+            std::filesystem::path source;   // where it was deployed from
+            AZ::u64 size = 0;
+            AZ::s64 modTime = 0;            // file_time_type ticks
+            AZ::u64 contentHash = 0;        // FNV-1a of the contents
+        };
+
+        struct DeployManifest
+        {
+            AZ::u64 searchKey = 0;          // hash of the search locations it was built for
+            AZStd::vector<DeployManifestEntry> entries;
+
+            const DeployManifestEntry* Find(const char* fileName) const
+            {
+                for (const DeployManifestEntry& entry : entries)
+                {
+                    if (entry.fileName == fileName)
+                    {
+                        return &entry;
+                    }
+                }
+                return nullptr;
+            }
+        };
+
+        constexpr const char* DeployManifestHeader = "O3DESharpDeployManifest";
+        constexpr AZ::u32 DeployManifestVersion = 1;
+
+        AZ::u64 Fnv1a(AZ::u64 hash, const void* data, size_t length)
+        {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < length; ++i)
+            {
+                hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+            }
+            return hash;
+        }
+
+        // The search locations a manifest was built for; a different set (new
+        // engine path, moved build tree) invalidates it.
+        AZ::u64 HashSearchLocations(
+            const AZStd::vector<std::filesystem::path>& searchDirs,
+            const AZStd::vector<std::filesystem::path>& searchRoots)
+        {
+            AZ::u64 hash = Fnv1a(0xcbf29ce484222325ull, &DeployManifestVersion, sizeof(DeployManifestVersion));
+            for (const auto* list : { &searchDirs, &searchRoots })
+            {
+                for (const auto& path : *list)
+                {
+                    const std::string text = path.generic_string();
+                    hash = Fnv1a(hash, text.data(), text.size() + 1);
+                }
+                hash = Fnv1a(hash, "|", 1);
+            }
+            return hash;
+        }
+
+        bool StatFile(const std::filesystem::path& path, AZ::u64& size, AZ::s64& modTime)
+        {
+            std::error_code ec;
+            size = static_cast<AZ::u64>(std::filesystem::file_size(path, ec));
+            if (ec)
+            {
+                return false;
+            }
+            modTime = static_cast<AZ::s64>(std::filesystem::last_write_time(path, ec).time_since_epoch().count());
+            return !ec;
+        }
+
+        bool HashFile(const std::filesystem::path& path, AZ::u64& hash)
+        {
+            std::ifstream stream(path, std::ios::binary);
+            if (!stream)
+            {
+                return false;
+            }
+
+            hash = 0xcbf29ce484222325ull;
+            char buffer[64 * 1024];
+            while (stream.read(buffer, sizeof(buffer)) || stream.gcount() > 0)
+            {
+                hash = Fnv1a(hash, buffer, static_cast<size_t>(stream.gcount()));
+            }
+            return true;
+        }
+
+        // One line per entry, source path last so it may contain the separator.
+        std::string SerializeDeployManifest(const DeployManifest& manifest)
+        {
+            std::string text = std::string(DeployManifestHeader) + " " + std::to_string(DeployManifestVersion) + " "
+                + std::to_string(manifest.searchKey) + "\n";
+            for (const DeployManifestEntry& entry : manifest.entries)
+            {
+                text += entry.fileName + "|" + std::to_string(entry.size) + "|" + std::to_string(entry.modTime) + "|"
+                    + std::to_string(entry.contentHash) + "|" + entry.source.generic_string() + "\n";
+            }
+            return text;
+        }
+
+        bool ReadDeployManifest(const std::filesystem::path& path, DeployManifest& manifest, std::string& rawText)
+        {
+            std::ifstream stream(path, std::ios::binary);
+            if (!stream)
+            {
+                return false;
+            }
+            rawText.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+
+            size_t lineStart = 0;
+            bool headerRead = false;
+            while (lineStart < rawText.size())
+            {
+                size_t lineEnd = rawText.find('\n', lineStart);
+                if (lineEnd == std::string::npos)
+                {
+                    lineEnd = rawText.size();
+                }
+                const std::string line = rawText.substr(lineStart, lineEnd - lineStart);
+                lineStart = lineEnd + 1;
+
+                if (!headerRead)
+                {
+                    unsigned version = 0;
+                    unsigned long long searchKey = 0;
+                    char header[32] = {};
+                    if (sscanf(line.c_str(), "%31s %u %llu", header, &version, &searchKey) != 3
+                        || strcmp(header, DeployManifestHeader) != 0 || version != DeployManifestVersion)
+                    {
+                        return false;
+                    }
+                    manifest.searchKey = searchKey;
+                    headerRead = true;
+                    continue;
+                }
+
+                size_t fields[4];
+                size_t position = 0;
+                for (size_t& field : fields)
+                {
+                    field = line.find('|', position);
+                    if (field == std::string::npos)
+                    {
+                        return false;
+                    }
+                    position = field + 1;
+                }
+
+                DeployManifestEntry entry;
+                entry.fileName = line.substr(0, fields[0]);
+                entry.size = strtoull(line.c_str() + fields[0] + 1, nullptr, 10);
+                entry.modTime = strtoll(line.c_str() + fields[1] + 1, nullptr, 10);
+                entry.contentHash = strtoull(line.c_str() + fields[2] + 1, nullptr, 10);
+                entry.source = std::filesystem::path(line.substr(fields[3] + 1));
+                manifest.entries.push_back(AZStd::move(entry));
+            }
+            return headerRead;
+        }
+    } // namespace
+
+    // Whether |dest| is at least as new as |src| and the same size: what
+    // DeployIfNewer leaves behind when it has nothing to copy.
+    static bool IsDeployed(const std::filesystem::path& src, const std::filesystem::path& dest)
+    {
+        AZ::u64 srcSize = 0;
+        AZ::u64 destSize = 0;
+        AZ::s64 srcTime = 0;
+        AZ::s64 destTime = 0;
+        return StatFile(src, srcSize, srcTime) && StatFile(dest, destSize, destTime)
+            && srcSize == destSize && destTime >= srcTime;
+    }
+
     // Copy |src| to |dest| only when src is newer or dest doesn't exist.
     static bool DeployIfNewer(const std::filesystem::path& src, const std::filesystem::path& dest)
     {
@@ -571,6 +1074,19 @@ namespace O3DESharp
     {
         namespace fs = std::filesystem;
 
+        // Hosts that point CoralDirectory / CoreApiAssemblyPath at build
+        // outputs directly have nothing to deploy, and may have no project
+        // to deploy into.
+        bool deployEnabled = true;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(deployEnabled, "/O3DE/O3DESharp/Deploy/Enabled");
+        }
+        if (!deployEnabled)
+        {
+            return;
+        }
+
         AZ::IO::FixedMaxPath projectPath = AZ::Utils::GetProjectPath();
         AZ::IO::FixedMaxPath engineRoot  = AZ::Utils::GetEnginePath();
         AZ::IO::FixedMaxPath exeDir      = AZ::Utils::GetExecutableDirectory();
@@ -611,19 +1127,98 @@ namespace O3DESharp
         fs::path deployDir = fs::path(projectPath.c_str()) / "Bin" / "Scripts";
         fs::path coralDeployDir = deployDir / "Coral";
 
+        // The manifest from the previous boot says where each DLL came from.
+        // While that file still exists, the newest of it and the flat
+        // directories wins and the recursive walk is skipped; a missing
+        // source, a changed set of search locations or
+        // /O3DE/O3DESharp/Deploy/ForceFullScan falls back to the full scan.
+        bool forceFullScan = false;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(forceFullScan, "/O3DE/O3DESharp/Deploy/ForceFullScan");
+        }
+
+        const fs::path manifestPath = deployDir / "O3DESharpDeploy.manifest";
+        DeployManifest previous;
+        std::string previousText;
+        const AZ::u64 searchKey = HashSearchLocations(directDirs, rglobRoots);
+        const bool manifestValid = !forceFullScan
+            && ReadDeployManifest(manifestPath, previous, previousText)
+            && previous.searchKey == searchKey;
+
+        DeployManifest updated;
+        updated.searchKey = searchKey;
+        size_t fullScans = 0;
+
+        auto locate = [&](const char* fileName) -> fs::path
+        {
+            const DeployManifestEntry* entry = manifestValid ? previous.Find(fileName) : nullptr;
+            AZ::u64 size = 0;
+            AZ::s64 modTime = 0;
+            if (entry != nullptr && StatFile(entry->source, size, modTime))
+            {
+                AZStd::vector<fs::path> dirs = directDirs;
+                dirs.push_back(entry->source.parent_path());
+                return FindNewestFile(fileName, dirs, {});
+            }
+            ++fullScans;
+            return FindNewestFile(fileName, directDirs, rglobRoots);
+        };
+
+        // DeployIfNewer, except that a source whose contents match what was
+        // deployed last time (rebuilt but identical) isn't copied again.
+        // Records the source in the updated manifest once dest holds it; a
+        // failed copy (a locked DLL, say) keeps the previous entry, so the
+        // next boot sees a changed source and tries again.
+        auto deploy = [&](const char* fileName, const fs::path& src, const fs::path& dest) -> bool
+        {
+            DeployManifestEntry entry;
+            entry.fileName = fileName;
+            entry.source = src;
+            if (!StatFile(src, entry.size, entry.modTime))
+            {
+                return false;
+            }
+
+            const DeployManifestEntry* last = manifestValid ? previous.Find(fileName) : nullptr;
+            bool unchanged = false;
+            if (last != nullptr && last->source == src && last->size == entry.size && last->modTime == entry.modTime)
+            {
+                entry.contentHash = last->contentHash;
+                unchanged = true;
+            }
+            else if (HashFile(src, entry.contentHash))
+            {
+                unchanged = last != nullptr && last->size == entry.size && last->contentHash == entry.contentHash;
+            }
+
+            std::error_code ec;
+            const bool current = unchanged && fs::exists(dest, ec);
+            const bool deployed = !current && DeployIfNewer(src, dest);
+            if (current || deployed || IsDeployed(src, dest))
+            {
+                updated.entries.push_back(AZStd::move(entry));
+            }
+            else if (last != nullptr)
+            {
+                updated.entries.push_back(*last);
+            }
+            return deployed;
+        };
+
         // ----- Coral.Managed -----
         {
-            fs::path newestDll = FindNewestFile("Coral.Managed.dll", directDirs, rglobRoots);
+            fs::path newestDll = locate("Coral.Managed.dll");
             if (!newestDll.empty())
             {
-                bool deployed = DeployIfNewer(newestDll, coralDeployDir / "Coral.Managed.dll");
+                bool deployed = deploy("Coral.Managed.dll", newestDll, coralDeployDir / "Coral.Managed.dll");
                 // Also copy companion files from the same directory
                 fs::path srcDir = newestDll.parent_path();
                 for (const char* companion : {"Coral.Managed.runtimeconfig.json", "Coral.Managed.deps.json"})
                 {
                     fs::path companionSrc = srcDir / companion;
                     if (fs::exists(companionSrc))
-                        DeployIfNewer(companionSrc, coralDeployDir / companion);
+                        deploy(companion, companionSrc, coralDeployDir / companion);
                 }
                 if (deployed)
                     AZLOG_INFO("O3DESharp: Deployed latest Coral.Managed from %s", newestDll.string().c_str());
@@ -632,18 +1227,38 @@ namespace O3DESharp
 
         // ----- O3DE.Core -----
         {
-            fs::path newestDll = FindNewestFile("O3DE.Core.dll", directDirs, rglobRoots);
+            fs::path newestDll = locate("O3DE.Core.dll");
             if (!newestDll.empty())
             {
-                bool deployed = DeployIfNewer(newestDll, deployDir / "O3DE.Core.dll");
+                bool deployed = deploy("O3DE.Core.dll", newestDll, deployDir / "O3DE.Core.dll");
                 // Companion deps.json
                 fs::path depsSrc = newestDll.parent_path() / "O3DE.Core.deps.json";
                 if (fs::exists(depsSrc))
-                    DeployIfNewer(depsSrc, deployDir / "O3DE.Core.deps.json");
+                    deploy("O3DE.Core.deps.json", depsSrc, deployDir / "O3DE.Core.deps.json");
                 if (deployed)
                     AZLOG_INFO("O3DESharp: Deployed latest O3DE.Core from %s", newestDll.string().c_str());
             }
         }
+
+        if (fullScans > 0 && !rglobRoots.empty())
+        {
+            AZLOG_INFO("O3DESharp: Deployment manifest %s; scanned the build tree for %zu assembl%s",
+                manifestValid ? "incomplete" : "missing or stale", fullScans, fullScans == 1 ? "y" : "ies");
+        }
+
+        // Rewrite only on change; this runs on every boot.
+        const std::string updatedText = SerializeDeployManifest(updated);
+        if (!updated.entries.empty() && updatedText != previousText)
+        {
+            std::error_code ec;
+            fs::create_directories(deployDir, ec);
+            std::ofstream stream(manifestPath, std::ios::binary | std::ios::trunc);
+            stream << updatedText;
+            if (!stream)
+            {
+                AZLOG_WARN("O3DESharp: Could not write deployment manifest %s", manifestPath.string().c_str());
+            }
+        }
     }
 
     void O3DESharpSystemComponent::InitializeCoralHost()
@@ -654,6 +1269,102 @@ namespace O3DESharp
             return;
         }
 
+        const CoralHostConfig config = BuildCoralHostConfig();
+        // No PrepareScriptMethods here: on the main thread the warm-up would
+        // cost the same JIT time it saves later. Only the async boot does it.
+        const CoralHostStatus status = m_coralHostManager->Initialize(config);
+        CompleteCoralHostInitialization(status);
+    }
+
+    void O3DESharpSystemComponent::StartAsyncBoot()
+    {
+        CoralHostConfig config = BuildCoralHostConfig();
+
+        m_bootInProgress = true;
+        m_bootFinished.store(false);
+
+        AZStd::thread_desc desc;
+        desc.m_name = "O3DESharp Boot";
+        m_bootThread = AZStd::thread(desc,
+            [this, config = AZStd::move(config)]()
+            {
+                const auto start = AZStd::chrono::steady_clock::now();
+
+                // See Activate for why deployment is dev-only.
+#if !defined(AZ_RELEASE_BUILD) && !defined(AZ_MONOLITHIC_BUILD)
+                DeployLatestManagedAssemblies();
+#endif
+
+                m_bootStatus = m_coralHostManager->Initialize(config);
+                if (m_bootStatus == CoralHostStatus::Success && m_prepareScriptMethods)
+                {
+                    PrepareScriptMethods();
+                }
+
+                const auto elapsed = AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(
+                    AZStd::chrono::steady_clock::now() - start);
+                AZLOG_INFO("O3DESharpSystemComponent: Background boot finished in %lld ms",
+                    static_cast<long long>(elapsed.count()));
+
+                m_bootFinished.store(true);
+            });
+
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void O3DESharpSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (m_bootFinished.load())
+        {
+            FinishAsyncBoot();
+        }
+    }
+
+    void O3DESharpSystemComponent::FinishAsyncBoot()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        if (m_bootThread.joinable())
+        {
+            m_bootThread.join();
+        }
+        m_bootInProgress = false;
+
+        CompleteCoralHostInitialization(m_bootStatus);
+
+        // Components that activated during the boot create their instances now.
+        O3DESharpNotificationBus::Broadcast(&O3DESharpNotifications::OnCoralHostReady);
+    }
+
+    void O3DESharpSystemComponent::PrepareScriptMethods()
+    {
+        Coral::Type* warmupType = m_coralHostManager->GetCoreType("O3DE.ScriptWarmup");
+        if (warmupType == nullptr)
+        {
+            return; // O3DE.Core predates ScriptWarmup
+        }
+
+        // Only O3DE.Core and these get scanned, not every assembly in the process
+        AZStd::string assemblyNames;
+        for (const AZStd::string& name : m_coralHostManager->GetUserAssemblyNames())
+        {
+            assemblyNames += name;
+            assemblyNames += ';';
+        }
+
+        try
+        {
+            Coral::ScopedString assemblyNamesStr = Coral::String::New(assemblyNames);
+            const AZ::s32 prepared = warmupType->InvokeStaticMethod<AZ::s32>("PrepareScriptTypes", assemblyNamesStr);
+            AZLOG_INFO("O3DESharpSystemComponent: Pre-compiled %d script method(s)", prepared);
+        }
+        catch (...)
+        {
+            AZLOG_WARN("O3DESharpSystemComponent: Script method warm-up failed; methods compile on first call");
+        }
+    }
+
+    CoralHostConfig O3DESharpSystemComponent::BuildCoralHostConfig()
+    {
         // Build the configuration for Coral
         CoralHostConfig config;
 
@@ -762,6 +1473,21 @@ namespace O3DESharp
 #endif
         m_hotReloadEnabled = config.enableHotReload;
 
+        // Each user assembly in its own context, so a reload only unloads
+        // what changed. Opt-in: needs Coral.Managed's cross-context resolver.
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(config.isolateUserAssemblies, "/O3DE/O3DESharp/HotReload/IsolateUserAssemblies");
+
+            // [PooledScript] instance reuse and its per-class ceiling.
+            settingsRegistry->Get(config.enableInstancePooling, "/O3DE/O3DESharp/Pooling/Enabled");
+            AZ::u64 maxPooled = config.maxPooledInstancesPerType;
+            if (settingsRegistry->Get(maxPooled, "/O3DE/O3DESharp/Pooling/MaxInstancesPerType"))
+            {
+                config.maxPooledInstancesPerType = static_cast<AZ::u32>(AZStd::min<AZ::u64>(maxPooled, 0x7FFFFFFFu));
+            }
+        }
+
         AZLOG_INFO("O3DESharpSystemComponent: Initializing Coral .NET Host");
         AZLOG_INFO("  Coral Directory: %s", config.coralDirectory.c_str());
         AZLOG_INFO("  Core API Assembly: %s", config.coreApiAssemblyPath.c_str());
@@ -772,9 +1498,11 @@ namespace O3DESharp
         }
         AZLOG_INFO("  Hot Reload: %s", config.enableHotReload ? "Enabled" : "Disabled");
 
-        // Initialize the Coral host
-        CoralHostStatus status = m_coralHostManager->Initialize(config);
+        return config;
+    }
 
+    void O3DESharpSystemComponent::CompleteCoralHostInitialization(CoralHostStatus status)
+    {
         switch (status)
         {
         case CoralHostStatus::Success:
@@ -785,6 +1513,14 @@ namespace O3DESharp
             
             // Register internal calls (C++ functions exposed to C#)
             RegisterScriptBindings();
+
+            // Warm every loaded script class's schema before the first
+            // inspector refresh or property block asks for one on the main
+            // thread
+            if (m_precomputeSchemas)
+            {
+                StartSchemaPrecompute(m_coralHostManager->GetUserScriptTypeNames());
+            }
             break;
 
         case CoralHostStatus::CoralManagedNotFound:
@@ -836,7 +1572,7 @@ namespace O3DESharp
 
     void O3DESharpSystemComponent::RegisterScriptBindings()
     {
-        if (!m_coralHostManager || !m_coralHostManager->IsInitialized())
+        if (!IsCoralHostInitialized())
         {
             AZLOG_ERROR("O3DESharpSystemComponent: Cannot register bindings - host not initialized");
             return;
@@ -10,15 +10,29 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <O3DESharp/O3DESharpBus.h>
+#include <O3DESharp/O3DESharpHotReloadBus.h>
 #include <Scripting/Reflection/ReflectionDataExporter.h>
 
 namespace O3DESharp
 {
     class CoralHostManager;
+    struct CoralHostConfig;
+    enum class CoralHostStatus;
     class BehaviorContextReflector;
     class GenericDispatcher;
+    class FrameSnapshotPublisher;
+    class ScriptActivationQueue;
+    class ParallelScriptUpdater;
+    class ScriptTickScheduler;
+    class InteropProfiler;
+    class ScriptProfiler;
+    class ScriptLogQueue;
 
     /**
      * O3DESharpSystemComponent - Core system component for C# scripting support
@@ -34,11 +48,51 @@ namespace O3DESharp
      * - /O3DE/O3DESharp/CoralDirectory: Path to Coral.Managed.dll
      * - /O3DE/O3DESharp/CoreApiAssemblyPath: Path to O3DE.Core.dll
      * - /O3DE/O3DESharp/UserAssemblyPath: Path to the user's game scripts DLL
+     * - /O3DE/O3DESharp/PrecomputeExposedPropertySchemas: Warm the schema cache
+     *   on a worker thread once the host loads and after a reload. Runs script
+     *   constructors off the main thread, held to the worker-safe internal
+     *   calls (default false)
+     * - /O3DE/O3DESharp/HotReload/IsolateUserAssemblies: Load each user assembly
+     *   into its own context so a reload only touches what changed; needs a
+     *   Coral.Managed that resolves O3DE.Core across contexts, checked at start-up
+     *   with an error and a shared-context fallback if missing (default false)
+     * - /O3DE/O3DESharp/Boot/Async: Deploy, start the host and load assemblies on
+     *   a worker thread while the engine keeps booting (default false)
+     * - /O3DE/O3DESharp/Boot/PrepareScriptMethods: JIT the script classes'
+     *   lifecycle methods on the boot thread rather than on first call; only
+     *   applies with Boot/Async (default true)
+     * - /O3DE/O3DESharp/Deploy/Enabled: Copy the newest managed DLLs into
+     *   <ProjectPath>/Bin/Scripts before starting the host (default true)
+     * - /O3DE/O3DESharp/Deploy/ForceFullScan: Ignore the deployment manifest and
+     *   search the whole build tree for the managed DLLs (default false)
+     * - /O3DE/O3DESharp/Pooling/Enabled: Reuse instances of [PooledScript]
+     *   classes across activations (default true)
+     * - /O3DE/O3DESharp/Pooling/MaxInstancesPerType: Upper bound on any class's
+     *   [PooledScript] MaxInstances (default 256)
+     * - /O3DE/O3DESharp/Activation/FrameBudgetMs: Time per frame spent starting
+     *   scripts; the rest wait for later frames, nearest the camera first
+     *   (default 0 = no limit)
+     * - /O3DE/O3DESharp/ParallelUpdate/UseJobs: Tick [ParallelUpdate] scripts on
+     *   job workers; false keeps them on the main thread (default true)
+     * - /O3DE/O3DESharp/ParallelUpdate/MinInstancesPerJob: Smallest batch of
+     *   [ParallelUpdate] scripts given its own job (default 32)
+     * - /O3DE/O3DESharp/Profiling/ScriptAccounting: Time every script dispatch
+     *   and count its managed allocations from startup; o3desharp_ScriptAccounting
+     *   toggles it at runtime (default false)
+     * - /O3DE/O3DESharp/Scheduler/FrameBudgetMs: Main-thread script time per
+     *   frame before [UpdateInterval] scripts are pushed to later frames;
+     *   o3desharp_ScriptFrameBudgetMs changes it at runtime (default 0 = no limit)
+     * - /O3DE/O3DESharp/Scheduler/OverrunMs: Single script update time that
+     *   counts as an overrun (default 0 = the frame budget)
+     * - /O3DE/O3DESharp/Scheduler/OverrunsToFlag: Overruns among a script's
+     *   last 64 updates that flag it (default 5)
      */
     class O3DESharpSystemComponent
         : public AZ::Component
         , protected O3DESharpRequestBus::Handler
         , protected ReflectionDataExportRequestBus::Handler
+        , protected O3DESharpHotReloadNotificationBus::Handler
+        , protected AZ::TickBus::Handler
     {
     public:
         AZ_COMPONENT_DECL(O3DESharpSystemComponent);
@@ -57,13 +111,16 @@ namespace O3DESharp
         ////////////////////////////////////////////////////////////////////////
         // O3DESharpRequestBus interface implementation
         bool IsCoralHostInitialized() const override;
+        bool IsCoralHostBooting() const override;
         AZStd::string GetCoralHostStatus() const override;
         bool LoadAssembly(const AZStd::string& assemblyPath) override;
         bool ReloadUserAssemblies() override;
+        bool ReloadChangedUserAssemblies(const AZStd::vector<AZStd::string>& changedAssemblyPaths) override;
         bool IsHotReloadEnabled() const override;
         bool TypeExists(const AZStd::string& fullTypeName) const override;
         AZStd::vector<AZStd::string> GetAvailableScriptTypes() const override;
         AZStd::string GetExposedPropertySchemaJson(const AZStd::string& fullTypeName) const override;
+        void PrecomputeExposedPropertySchemas(const AZStd::vector<AZStd::string>& fullTypeNames) override;
         AZStd::string GetCoralDirectory() const override;
         AZStd::string GetCoreAssemblyPath() const override;
         AZStd::string GetUserAssemblyPath() const override;
@@ -79,6 +136,17 @@ namespace O3DESharp
         AZStd::vector<AZStd::string> GetReflectedCategories() override;
         ////////////////////////////////////////////////////////////////////////
 
+        ////////////////////////////////////////////////////////////////////////
+        // O3DESharpHotReloadNotificationBus - drop / re-warm the schema cache
+        void OnBeforeUserAssemblyReload() override;
+        void OnAfterUserAssemblyReload() override;
+        ////////////////////////////////////////////////////////////////////////
+
+        ////////////////////////////////////////////////////////////////////////
+        // AZ::TickBus - polls for the end of an asynchronous boot
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        ////////////////////////////////////////////////////////////////////////
+
         ////////////////////////////////////////////////////////////////////////
         // AZ::Component interface implementation
         void Init() override;
@@ -93,11 +161,42 @@ namespace O3DESharp
          */
         void InitializeCoralHost();
 
+        /**
+         * Read the host configuration (assembly paths, hot reload) from the
+         * Settings Registry. Main thread; also caches the paths reported by
+         * GetCoralDirectory and friends.
+         */
+        CoralHostConfig BuildCoralHostConfig();
+
+        /**
+         * Main-thread half of host initialization: report the status and, on
+         * success, register CoralHostManagerInterface and the script bindings.
+         */
+        void CompleteCoralHostInitialization(CoralHostStatus status);
+
+        /**
+         * Asynchronous boot: run deployment, host initialization and
+         * PrepareScriptMethods on m_bootThread. OnTick finishes the boot on
+         * the main thread (FinishAsyncBoot) once the worker is done.
+         */
+        void StartAsyncBoot();
+        void FinishAsyncBoot();
+
+        /**
+         * Have O3DE.ScriptWarmup JIT the constructor and lifecycle methods
+         * of every script class in O3DE.Core and the loaded user assemblies,
+         * so the first frame doesn't pay for it. Async boot only; runs on
+         * m_bootThread.
+         */
+        void PrepareScriptMethods();
+
         /**
          * Scan known build-output / staging directories for the newest copies
          * of Coral.Managed.dll and O3DE.Core.dll and deploy them to the
          * project's Bin/Scripts directory so the Coral host can find them.
-         * Called automatically before InitializeCoralHost().
+         * Where they came from is kept in Bin/Scripts/O3DESharpDeploy.manifest;
+         * while those sources still exist the recursive build-tree walk is
+         * skipped. Called automatically before InitializeCoralHost().
          */
         void DeployLatestManagedAssemblies();
 
@@ -135,6 +234,20 @@ namespace O3DESharp
          */
         void AutoExportReflectionData();
 
+        /**
+         * Resolve each name to its Coral type on the calling thread (the host's
+         * type caches are not thread-safe), then construct-and-query the
+         * uncached ones on m_schemaPrecomputeThread under InternalCallGuard.
+         * A class whose constructor was refused a call isn't cached.
+         */
+        void StartSchemaPrecompute(const AZStd::vector<AZStd::string>& fullTypeNames);
+
+        /**
+         * Cancel and join any running precompute. Must run before the
+         * assembly context is unloaded or the host shuts down.
+         */
+        void StopSchemaPrecompute();
+
     private:
         // The Coral host manager instance - manages .NET runtime lifecycle
         AZStd::unique_ptr<CoralHostManager> m_coralHostManager;
@@ -145,11 +258,59 @@ namespace O3DESharp
         // The generic dispatcher - enables dynamic method invocation from C#
         AZStd::unique_ptr<GenericDispatcher> m_dispatcher;
 
+        // Captures per-frame input and time state into the blocks Input.cs / Time.cs read directly
+        AZStd::unique_ptr<FrameSnapshotPublisher> m_frameSnapshotPublisher;
+
+        // Spreads script creation over frames when a frame budget is set
+        AZStd::unique_ptr<ScriptActivationQueue> m_activationQueue;
+
+        // Ticks [ParallelUpdate] scripts on job workers
+        AZStd::unique_ptr<ParallelScriptUpdater> m_parallelUpdater;
+
+        // Frame budget, time-sliced [UpdateInterval] scripts and the overrun watchdog
+        AZStd::unique_ptr<ScriptTickScheduler> m_tickScheduler;
+
+        // Broadcasts the interop profiler's per-frame totals
+        AZStd::unique_ptr<InteropProfiler> m_interopProfiler;
+
+        // Per-script CPU time and allocation table
+        AZStd::unique_ptr<ScriptProfiler> m_scriptProfiler;
+
+        // Asynchronous sink for Debug.Log; runs for the whole activation so
+        // managed code finds it on its first log call
+        AZStd::unique_ptr<ScriptLogQueue> m_logQueue;
+
+        // Exposed-property schema JSON per script class. Computing one means
+        // constructing a throwaway managed instance, and the inspector asks
+        // on every refresh, so results are kept until user assemblies reload.
+        // m_schemaCacheGeneration is bumped on every clear so a precompute
+        // that started before the clear can't repopulate stale entries.
+        mutable AZStd::mutex m_schemaCacheMutex;
+        mutable AZStd::unordered_map<AZStd::string, AZStd::string> m_schemaCache;
+        AZ::u64 m_schemaCacheGeneration = 0;
+
+        // Classes cached before a reload, re-warmed once it completes
+        AZStd::vector<AZStd::string> m_schemaWarmSet;
+
+        AZStd::thread m_schemaPrecomputeThread;
+        AZStd::atomic_bool m_cancelSchemaPrecompute{ false };
+        bool m_precomputeSchemas = false;
+
         // Cached configuration values
         AZStd::string m_coralDirectory;
         AZStd::string m_coreAssemblyPath;
         AZStd::string m_userAssemblyPath;
         bool m_hotReloadEnabled = false;
+
+        // Asynchronous boot. m_bootInProgress is main-thread state: set when
+        // the worker starts, cleared by FinishAsyncBoot; while it is set the
+        // host counts as not initialized. The worker publishes
+        // m_bootStatus before setting m_bootFinished.
+        AZStd::thread m_bootThread;
+        AZStd::atomic_bool m_bootFinished{ false };
+        CoralHostStatus m_bootStatus{};
+        bool m_bootInProgress = false;
+        bool m_prepareScriptMethods = true;
     };
 
-} // namespace O3DESharp
\ No newline at end of file
+} // namespace O3DESharp
\ No newline at end of file
@@ -8,6 +8,12 @@
 
 #include "CSharpScriptComponent.h"
 #include "CoralHostManager.h"
+#include "ExposedPropertyBlock.h"
+#include "InternalCallGuard.h"
+#include "ParallelScriptUpdater.h"
+#include "ScriptActivationQueue.h"
+#include "ScriptProfiler.h"
+#include "ScriptTickScheduler.h"
 
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -15,6 +21,8 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
 
 #include <cstdlib> // _putenv_s / setenv for the Phase 17b debugger-wait gate
 
@@ -35,10 +43,12 @@ namespace O3DESharp
             }
 
             serializeContext->Class<CSharpScriptComponentConfig, AZ::ComponentConfig>()
-                ->Version(2) // bumped: added m_exposedPropertyValues
+                ->Version(4) // bumped: added m_activateImmediately
                 ->Field("ScriptClassName", &CSharpScriptComponentConfig::m_scriptClassName)
                 ->Field("AssemblyPath", &CSharpScriptComponentConfig::m_assemblyPath)
                 ->Field("ExposedProperties", &CSharpScriptComponentConfig::m_exposedPropertyValues)
+                ->Field("ExposedPropertyBlock", &CSharpScriptComponentConfig::m_exposedPropertyBlock)
+                ->Field("ActivateImmediately", &CSharpScriptComponentConfig::m_activateImmediately)
                 ;
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -60,6 +70,9 @@ namespace O3DESharp
                         "Edit name->value entries here; they are applied to the managed "
                         "instance before OnCreate.")
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &CSharpScriptComponentConfig::m_activateImmediately,
+                        "Activate Immediately",
+                        "Start the script on activation even when the frame's activation budget is spent")
                     ;
             }
         }
@@ -69,6 +82,20 @@ namespace O3DESharp
     // CSharpScriptComponent
     // ============================================================
 
+    namespace
+    {
+        // Components whose instance was torn down for a reload, queued by
+        // OnAfterUserAssemblyReload and re-created together by
+        // OnUserAssemblyReloadCompleted. Main thread only, like the
+        // notifications themselves. Swapped out rather than cleared when
+        // drained, so no allocation outlives the reload.
+        AZStd::vector<CSharpScriptComponent*> s_pendingRecreation;
+
+        // Components activated while the host was still booting on its
+        // worker; created together by OnCoralHostReady.
+        AZStd::vector<CSharpScriptComponent*> s_pendingActivation;
+    } // namespace
+
     void CSharpScriptComponent::Reflect(AZ::ReflectContext* context)
     {
         CSharpScriptComponentConfig::Reflect(context);
@@ -108,6 +135,7 @@ namespace O3DESharp
                     ->Attribute(AZ::Script::Attributes::Module, "scripting")
                     ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
                     ->Method("IsScriptValid", &CSharpScriptComponent::IsScriptValid)
+                    ->Method("IsScriptReady", &CSharpScriptComponent::IsScriptReady)
                     ->Method("ReloadScript", &CSharpScriptComponent::ReloadScript)
                     ;
             }
@@ -166,9 +194,17 @@ namespace O3DESharp
             m_config.m_scriptClassName.c_str(),
             GetEntity() ? GetEntity()->GetName().c_str() : "Unknown");
 
-        // Destroy current instance
+        // Destroy current instance; a queued activation is superseded
         DestroyScriptInstance();
         m_disabledByException = false; // re-arm for the new instance
+        if (m_activationQueued)
+        {
+            if (ScriptActivationQueue* queue = ScriptActivationQueue::GetActive())
+            {
+                queue->Remove(*this);
+            }
+            m_activationQueued = false;
+        }
 
         // Create new instance
         if (CreateScriptInstance())
@@ -179,6 +215,7 @@ namespace O3DESharp
                 SetEntityIdOnScript();
                 PushExposedPropertiesToScript();
                 SafeInvokeMethod("OnCreate");
+                MarkScriptReady();
             }
         }
     }
@@ -201,58 +238,31 @@ namespace O3DESharp
             m_config.m_scriptClassName.c_str(),
             GetEntity() ? GetEntity()->GetName().c_str() : "Unknown");
 
-        // Create the managed script instance
-        if (CreateScriptInstance())
+        // Host still booting asynchronously: the instance is created, with
+        // entity id, exposed properties and OnCreate, in one batch with the
+        // other early components once it's ready. The buses below connect
+        // now; until then there's simply no instance to dispatch to.
+        bool hostBooting = false;
+        O3DESharpRequestBus::BroadcastResult(hostBooting, &O3DESharpRequests::IsCoralHostBooting);
+        O3DESharpScriptRequestBus::Handler::BusConnect(GetEntityId());
+        if (ScriptProfiler* profiler = ScriptProfiler::GetActive())
+        {
+            profiler->Register(*this);
+        }
+        if (hostBooting)
         {
-            // Pass entity ID to the script
-            SetEntityIdOnScript();
-
-            // ===========================================================
-            // Debugger attach is non-blocking. (Was: Phase 17b/17d wait-
-            // for-debugger gate that called O3DE.Debugger.WaitForAttachIfRequested
-            // here, blocking the editor main thread for up to 120s.)
-            //
-            // Rationale for removing the block:
-            //   - The editor freezing for 120s on every Game Mode entry
-            //     was confusing UX. Users hitting Ctrl+G with the auto-
-            //     attach IDE already launched but not yet attached saw the
-            //     editor go non-responsive with no indication of progress.
-            //   - The blocking call was implicitly enabled whenever
-            //     AutoAttachOnPlay was set (the previous "implicit default"
-            //     followed auto-attach), so configuring the seamless flow
-            //     also configured the freeze. Most users didn't realize
-            //     these were coupled.
-            //   - There is no way to "stop a managed script for debugger
-            //     attach" without also stopping the editor; scripts run on
-            //     the editor main thread. So if you genuinely want a break
-            //     in OnCreate, the user-facing path below is more honest
-            //     (you're explicitly choosing to block).
-            //
-            // The supported paths for debugging at script-create time:
-            //   1. ATTACH FIRST, THEN ENTER GAME MODE.
-            //      Attach your IDE to Editor.exe before pressing Ctrl+G.
-            //      OnCreate runs with the debugger already live so any
-            //      breakpoint in OnCreate binds and hits.
-            //   2. RELOAD SCRIPTS AFTER ATTACHING.
-            //      If you forgot step 1, hit Tools > C# Scripting > Reload
-            //      Scripts after the attach completes. That re-runs OnCreate
-            //      under the now-attached debugger.
-            //   3. EXPLICIT IN-SCRIPT BLOCK.
-            //      Add  O3DE.Debugger.WaitForAttach(TimeSpan.FromSeconds(30))
-            //      to the top of your OnCreate. This WILL block the editor
-            //      main thread - that's intentional because YOU asked for
-            //      it in YOUR script; that's a different proposition from
-            //      the gem silently blocking on every Activate.
-            //
-            // We do NOT call WaitForAttachIfRequested here anymore.
-            // ===========================================================
-
-            // Push editor-configured [ExposedProperty] values into the managed
-            // instance BEFORE OnCreate runs so user OnCreate code sees them.
-            PushExposedPropertiesToScript();
-
-            // Call OnCreate on the managed instance
-            SafeInvokeMethod("OnCreate");
+            s_pendingActivation.push_back(this);
+            O3DESharpNotificationBus::Handler::BusConnect();
+        }
+        // Within this frame's activation budget: create the managed script
+        // instance now. Otherwise it's started by the queue on a later frame.
+        else if (ScriptActivationQueue* queue = ScriptActivationQueue::GetActive())
+        {
+            m_activationQueued = !queue->StartOrEnqueue(*this, m_config.m_activateImmediately);
+        }
+        else
+        {
+            StartScript();
         }
 
         // Connect to tick bus to call OnUpdate
@@ -278,6 +288,102 @@ namespace O3DESharp
         m_isActivating = false;
     }
 
+    void CSharpScriptComponent::StartScript()
+    {
+        m_activationQueued = false;
+        if (!CreateScriptInstance())
+        {
+            return;
+        }
+
+        // Pass entity ID to the script
+        SetEntityIdOnScript();
+
+        // ===========================================================
+        // Debugger attach is non-blocking. (Was: Phase 17b/17d wait-
+        // for-debugger gate that called O3DE.Debugger.WaitForAttachIfRequested
+        // here, blocking the editor main thread for up to 120s.)
+        //
+        // Rationale for removing the block:
+        //   - The editor freezing for 120s on every Game Mode entry
+        //     was confusing UX. Users hitting Ctrl+G with the auto-
+        //     attach IDE already launched but not yet attached saw the
+        //     editor go non-responsive with no indication of progress.
+        //   - The blocking call was implicitly enabled whenever
+        //     AutoAttachOnPlay was set (the previous "implicit default"
+        //     followed auto-attach), so configuring the seamless flow
+        //     also configured the freeze. Most users didn't realize
+        //     these were coupled.
+        //   - There is no way to "stop a managed script for debugger
+        //     attach" without also stopping the editor; scripts run on
+        //     the editor main thread. So if you genuinely want a break
+        //     in OnCreate, the user-facing path below is more honest
+        //     (you're explicitly choosing to block).
+        //
+        // The supported paths for debugging at script-create time:
+        //   1. ATTACH FIRST, THEN ENTER GAME MODE.
+        //      Attach your IDE to Editor.exe before pressing Ctrl+G.
+        //      OnCreate runs with the debugger already live so any
+        //      breakpoint in OnCreate binds and hits.
+        //   2. RELOAD SCRIPTS AFTER ATTACHING.
+        //      If you forgot step 1, hit Tools > C# Scripting > Reload
+        //      Scripts after the attach completes. That re-runs OnCreate
+        //      under the now-attached debugger.
+        //   3. EXPLICIT IN-SCRIPT BLOCK.
+        //      Add  O3DE.Debugger.WaitForAttach(TimeSpan.FromSeconds(30))
+        //      to the top of your OnCreate. This WILL block the editor
+        //      main thread - that's intentional because YOU asked for
+        //      it in YOUR script; that's a different proposition from
+        //      the gem silently blocking on every Activate.
+        //
+        // We do NOT call WaitForAttachIfRequested here anymore.
+        // ===========================================================
+
+        // Push editor-configured [ExposedProperty] values into the managed
+        // instance BEFORE OnCreate runs so user OnCreate code sees them.
+        PushExposedPropertiesToScript();
+
+        // Call OnCreate on the managed instance
+        SafeInvokeMethod("OnCreate");
+        MarkScriptReady();
+    }
+
+    void CSharpScriptComponent::MarkScriptReady()
+    {
+        if (m_disabledByException || !m_scriptInstance.IsValid())
+        {
+            return;
+        }
+
+        // [ParallelUpdate] classes are ticked in batches on job workers,
+        // [UpdateInterval] ones time-sliced by the scheduler
+        bool parallel = false;
+        if (ParallelScriptUpdater* updater = ParallelScriptUpdater::GetActive())
+        {
+            parallel = updater->Register(*this, m_scriptType, m_scriptInstance);
+        }
+        if (!parallel)
+        {
+            if (ScriptTickScheduler* scheduler = ScriptTickScheduler::GetActive())
+            {
+                scheduler->Register(*this, m_scriptType, m_scriptInstance);
+            }
+        }
+
+        m_scriptReady = true;
+        O3DESharpScriptNotificationBus::Event(GetEntityId(), &O3DESharpScriptNotifications::OnScriptReady, m_config.m_scriptClassName);
+    }
+
+    const AZStd::string& CSharpScriptComponent::GetScriptClassName() const
+    {
+        return m_config.m_scriptClassName;
+    }
+
+    bool CSharpScriptComponent::IsScriptReady() const
+    {
+        return m_scriptReady;
+    }
+
     void CSharpScriptComponent::Deactivate()
     {
         AZLOG_INFO("CSharpScriptComponent: Deactivating script '%s' on entity '%s'",
@@ -290,12 +396,43 @@ namespace O3DESharp
         AZ::TransformNotificationBus::Handler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
 
+        // Deactivated between the reload notifications: don't get re-created.
+        s_pendingRecreation.erase(
+            AZStd::remove(s_pendingRecreation.begin(), s_pendingRecreation.end(), this), s_pendingRecreation.end());
+        s_pendingActivation.erase(
+            AZStd::remove(s_pendingActivation.begin(), s_pendingActivation.end(), this), s_pendingActivation.end());
+        O3DESharpNotificationBus::Handler::BusDisconnect();
+        O3DESharpScriptRequestBus::Handler::BusDisconnect();
+        if (m_activationQueued)
+        {
+            if (ScriptActivationQueue* queue = ScriptActivationQueue::GetActive())
+            {
+                queue->Remove(*this);
+            }
+            m_activationQueued = false;
+        }
+        m_keptAcrossReload = false;
+        AZStd::vector<AZ::u8>().swap(m_reloadState);
+
         // Call OnDestroy before destroying the instance. Use the safe wrapper so
         // a throwing OnDestroy doesn't tear down the rest of the gem shutdown.
         SafeInvokeMethod("OnDestroy");
 
-        // Destroy the managed instance
+        // [PooledScript] classes park the instance for the next activation
+        // instead of releasing it. One that threw stays out of the pool.
+        ICoralHostManager* hostManager = CoralHostManagerInterface::Get();
+        if (!m_disabledByException && m_scriptInstance.IsValid() && hostManager && hostManager->IsInitialized())
+        {
+            hostManager->ReleaseToPool(m_scriptType, m_scriptInstance);
+        }
+
+        // Destroy the managed instance (no-op if the pool took it)
         DestroyScriptInstance();
+
+        if (ScriptProfiler* profiler = ScriptProfiler::GetActive())
+        {
+            profiler->Unregister(*this);
+        }
     }
 
     void CSharpScriptComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
@@ -305,13 +442,27 @@ namespace O3DESharp
             return;
         }
 
+        // Ticked by the ParallelScriptUpdater or ScriptTickScheduler instead
+        if (m_parallelSlot >= 0 || m_scheduleSlot >= 0)
+        {
+            return;
+        }
+
         if (m_scriptInstance.IsValid() && m_scriptInitialized)
         {
             // Single managed transition per frame: ScriptComponent.Tick(dt) calls
             // OnUpdate then ProcessPendingInvocations on the managed side. This
             // replaces the previous pair of InvokeMethod calls (one of which
             // was unconditional even when no actions were scheduled).
-            SafeInvokeMethod("Tick", deltaTime);
+            // The scheduler times it against the frame budget when one is set.
+            if (ScriptTickScheduler* scheduler = ScriptTickScheduler::GetActive())
+            {
+                scheduler->RunUpdate(*this, deltaTime);
+            }
+            else
+            {
+                SafeInvokeMethod("Tick", deltaTime);
+            }
         }
     }
 
@@ -342,6 +493,9 @@ namespace O3DESharp
             return;
         }
 
+        AZ_PROFILE_SCOPE(O3DESharp, "%s.%s", m_config.m_scriptClassName.c_str(), methodName);
+        InteropTraceScope trace(InteropTraceKind::NativeToManaged, GetTraceScope(), methodName);
+        ScriptCostScope cost(m_cost);
         try
         {
             m_scriptInstance.InvokeMethod(methodName);
@@ -363,6 +517,9 @@ namespace O3DESharp
             return;
         }
 
+        AZ_PROFILE_SCOPE(O3DESharp, "%s.%s", m_config.m_scriptClassName.c_str(), methodName);
+        InteropTraceScope trace(InteropTraceKind::NativeToManaged, GetTraceScope(), methodName);
+        ScriptCostScope cost(m_cost);
         try
         {
             m_scriptInstance.InvokeMethod(methodName, deltaTime);
@@ -388,6 +545,40 @@ namespace O3DESharp
             return;
         }
 
+        // Fast path: hand the typed block over as-is. Blocks come from the
+        // editor export (BuildGameEntity) or, for data saved before blocks
+        // existed, are built here once per distinct value map and cached.
+        if (!ExposedPropertyBlock::IsValid(m_config.m_exposedPropertyBlock))
+        {
+            ExposedPropertyBlock::GetOrBuildForScript(
+                m_config.m_scriptClassName, m_config.m_exposedPropertyValues, m_config.m_exposedPropertyBlock);
+        }
+
+        if (ExposedPropertyBlock::IsValid(m_config.m_exposedPropertyBlock))
+        {
+            AZ::s32 unapplied = -1;
+            try
+            {
+                const void* blockData = m_config.m_exposedPropertyBlock.data();
+                const AZ::s32 blockSize = static_cast<AZ::s32>(m_config.m_exposedPropertyBlock.size());
+                unapplied = m_scriptInstance.InvokeMethod<AZ::s32>("ApplyExposedPropertyBlock", blockData, blockSize);
+            }
+            catch (...)
+            {
+                unapplied = -1;
+            }
+
+            if (unapplied == 0)
+            {
+                return;
+            }
+
+            // The block no longer matches the script's members (recompiled
+            // since it was built). Drop it and let the string path below
+            // apply - and report - every value from scratch.
+            m_config.m_exposedPropertyBlock.clear();
+        }
+
         // Build a flat { "name": "value", ... } JSON object. The values are
         // already strings (the config map is string->string) so we just need
         // to handle JSON escaping. Keep the encoder small / inline rather than
@@ -455,20 +646,119 @@ namespace O3DESharp
         }
     }
 
+    void CSharpScriptComponent::CaptureReloadState()
+    {
+        m_reloadState.clear();
+        if (m_disabledByException || !m_scriptInstance.IsValid())
+        {
+            return;
+        }
+
+        // Most scripts fit the first buffer; otherwise the returned size is
+        // exact and the second call succeeds.
+        constexpr AZ::s32 InitialCapacity = 256;
+        try
+        {
+            m_reloadState.resize(InitialCapacity);
+            AZ::s32 size = m_scriptInstance.InvokeMethod<AZ::s32>(
+                "WriteReloadState", static_cast<void*>(m_reloadState.data()), InitialCapacity);
+            if (size > InitialCapacity)
+            {
+                m_reloadState.resize(size);
+                const AZ::s32 capacity = size;
+                size = m_scriptInstance.InvokeMethod<AZ::s32>(
+                    "WriteReloadState", static_cast<void*>(m_reloadState.data()), capacity);
+                if (size > capacity)
+                {
+                    size = -1;
+                }
+            }
+
+            if (size <= 0)
+            {
+                m_reloadState.clear();
+                return;
+            }
+            m_reloadState.resize(size);
+        }
+        catch (...)
+        {
+            // Older O3DE.Core without WriteReloadState, or the script threw:
+            // the instance simply starts from its defaults.
+            m_reloadState.clear();
+        }
+    }
+
+    void CSharpScriptComponent::RestoreReloadState()
+    {
+        if (m_reloadState.empty() || m_disabledByException || !m_scriptInstance.IsValid())
+        {
+            return;
+        }
+
+        AZ::s32 mismatched = -1;
+        try
+        {
+            const void* data = m_reloadState.data();
+            const AZ::s32 size = static_cast<AZ::s32>(m_reloadState.size());
+            mismatched = m_scriptInstance.InvokeMethod<AZ::s32>("ReadReloadState", data, size);
+        }
+        catch (...)
+        {
+            mismatched = -1;
+        }
+
+        AZ_Warning("CSharpScriptComponent", mismatched == 0,
+            "Entity '%s' (script '%s'): %s",
+            GetEntity() ? GetEntity()->GetName().c_str() : "Unknown",
+            m_config.m_scriptClassName.c_str(),
+            mismatched < 0 ? "state from before the reload could not be restored"
+                           : "some fields changed type in the reload and keep their new values");
+
+        AZStd::vector<AZ::u8>().swap(m_reloadState);
+    }
+
     void CSharpScriptComponent::OnBeforeUserAssemblyReload()
     {
-        // The Coral context is about to be unloaded; m_scriptType and
-        // m_scriptInstance will be dangling pointers in a moment. Tear them
+        // A partial reload only unloads the changed assemblies (and whatever
+        // references them). If ours isn't one of them, the instance and type
+        // stay valid - keep running without an OnDestroy/OnCreate cycle.
+        ICoralHostManager* hostManager = CoralHostManagerInterface::Get();
+        if (m_scriptType.IsValid() && hostManager != nullptr
+            && !hostManager->IsUserTypeReloading(m_config.m_scriptClassName))
+        {
+            m_keptAcrossReload = true;
+            return;
+        }
+
+        // Still in the activation queue: there's no instance yet, and the
+        // queue resolves the class by name when its turn comes.
+        if (m_activationQueued)
+        {
+            m_keptAcrossReload = true;
+            return;
+        }
+
+        // The Coral context is about to be unloaded; m_scriptInstance will be
+        // a dangling handle in a moment (m_scriptType just goes stale). Tear them
         // down BEFORE that happens. Calling OnDestroy is intentional - it
         // mirrors what Deactivate does, giving user code a chance to clean
         // up state, but we use the safe wrapper so an exception inside
-        // OnDestroy doesn't prevent the rest of the teardown.
+        // OnDestroy doesn't prevent the rest of the teardown. The field
+        // snapshot is taken first, while the state is still what the script
+        // was running with.
         if (m_scriptInstance.IsValid())
         {
+            CaptureReloadState();
             SafeInvokeMethod("OnDestroy");
         }
         DestroyScriptInstance();
 
+        // Exposed members may change with the new assembly; rebuild the
+        // typed block from the string values against the new schema.
+        m_config.m_exposedPropertyBlock.clear();
+        ExposedPropertyBlock::ClearCache();
+
         // Detach from TickBus so we don't try to dispatch into the now-
         // invalid context before OnAfterUserAssemblyReload reconstructs us.
         AZ::TickBus::Handler::BusDisconnect();
@@ -476,20 +766,251 @@ namespace O3DESharp
 
     void CSharpScriptComponent::OnAfterUserAssemblyReload()
     {
+        if (m_keptAcrossReload)
+        {
+            m_keptAcrossReload = false;
+            return;
+        }
+
         // The user assemblies have been reloaded and internal calls are
-        // re-registered. Rebuild the managed instance, push exposed
-        // properties, and fire OnCreate - matching the Activate flow.
+        // re-registered. The managed instance is rebuilt - exposed properties
+        // pushed, OnCreate fired, matching the Activate flow - together with
+        // every other affected component in OnUserAssemblyReloadCompleted.
         m_disabledByException = false;
+        s_pendingRecreation.push_back(this);
 
-        if (CreateScriptInstance())
+        // Re-attach to TickBus so OnUpdate resumes firing.
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void CSharpScriptComponent::OnUserAssemblyReloadCompleted()
+    {
+        // Every component gets this; the first one drains the whole queue.
+        if (s_pendingRecreation.empty())
         {
-            SetEntityIdOnScript();
-            PushExposedPropertiesToScript();
-            SafeInvokeMethod("OnCreate");
+            return;
         }
 
-        // Re-attach to TickBus so OnUpdate resumes firing.
-        AZ::TickBus::Handler::BusConnect();
+        AZStd::vector<CSharpScriptComponent*> components;
+        components.swap(s_pendingRecreation);
+        RecreateScriptInstances(components);
+    }
+
+    void CSharpScriptComponent::OnCoralHostReady()
+    {
+        O3DESharpNotificationBus::Handler::BusDisconnect();
+
+        // Every waiting component gets this; the first one drains the queue
+        // and disconnects the rest.
+        if (s_pendingActivation.empty())
+        {
+            return;
+        }
+
+        AZStd::vector<CSharpScriptComponent*> components;
+        components.swap(s_pendingActivation);
+        for (CSharpScriptComponent* component : components)
+        {
+            component->O3DESharpNotificationBus::Handler::BusDisconnect();
+        }
+
+        bool hostInitialized = false;
+        O3DESharpRequestBus::BroadcastResult(hostInitialized, &O3DESharpRequests::IsCoralHostInitialized);
+        if (!hostInitialized)
+        {
+            // The boot failed and nothing will ever create these instances;
+            // name each one rather than leave them silently inert.
+            for (const CSharpScriptComponent* component : components)
+            {
+                AZLOG_ERROR("CSharpScriptComponent: Script '%s' on entity '%s' [%llu] will not start - the C# host failed to boot",
+                    component->m_config.m_scriptClassName.c_str(),
+                    component->GetEntity() ? component->GetEntity()->GetName().c_str() : "Unknown",
+                    static_cast<unsigned long long>(static_cast<AZ::u64>(component->GetEntityId())));
+            }
+            return;
+        }
+
+        RecreateScriptInstances(components);
+    }
+
+    void CSharpScriptComponent::RecreateScriptInstances(AZStd::vector<CSharpScriptComponent*>& components)
+    {
+        ICoralHostManager* hostManager = CoralHostManagerInterface::Get();
+        if (!hostManager || !hostManager->IsInitialized())
+        {
+            AZLOG_ERROR("CSharpScriptComponent: Coral host not initialized");
+            return;
+        }
+
+        AZStd::sort(components.begin(), components.end(),
+            [](const CSharpScriptComponent* lhs, const CSharpScriptComponent* rhs)
+            {
+                const AZ::u64 lhsEntity = static_cast<AZ::u64>(lhs->GetEntityId());
+                const AZ::u64 rhsEntity = static_cast<AZ::u64>(rhs->GetEntityId());
+                return lhsEntity != rhsEntity ? lhsEntity < rhsEntity : lhs->GetId() < rhs->GetId();
+            });
+
+        // Group by script class, in order of first appearance.
+        AZStd::unordered_map<AZStd::string, size_t> groupIndex;
+        AZStd::vector<AZStd::vector<CSharpScriptComponent*>> groups;
+        for (CSharpScriptComponent* component : components)
+        {
+            auto inserted = groupIndex.emplace(component->m_config.m_scriptClassName, groups.size());
+            if (inserted.second)
+            {
+                groups.emplace_back();
+            }
+            groups[inserted.first->second].push_back(component);
+        }
+
+        Coral::Type* batchType = hostManager->GetCoreType("O3DE.ScriptInstanceBatch");
+
+        size_t created = 0;
+        for (const AZStd::vector<CSharpScriptComponent*>& group : groups)
+        {
+            const AZStd::string& className = group.front()->m_config.m_scriptClassName;
+            if (className.empty())
+            {
+                AZLOG_WARN("CSharpScriptComponent: No script class name specified");
+                continue;
+            }
+
+            const ScriptTypeHandle scriptTypeHandle = hostManager->ResolveScriptType(className);
+            Coral::Type* scriptType = hostManager->GetType(scriptTypeHandle);
+            if (!scriptType)
+            {
+                AZLOG_ERROR("CSharpScriptComponent: Script class not found: '%s' (%zu component(s))",
+                    className.c_str(), group.size());
+                continue;
+            }
+
+            created += CreateInstanceBatch(*hostManager, *scriptType, scriptTypeHandle, batchType, group);
+        }
+
+        // OnCreate last, once every instance exists, in the sorted order.
+        for (CSharpScriptComponent* component : components)
+        {
+            if (component->m_scriptInstance.IsValid())
+            {
+                component->SafeInvokeMethod("OnCreate");
+                component->RestoreReloadState();
+                component->MarkScriptReady();
+            }
+            AZStd::vector<AZ::u8>().swap(component->m_reloadState);
+        }
+
+        AZLOG_INFO("CSharpScriptComponent: Created %zu queued script instance(s) of %zu class(es)",
+            created, groups.size());
+    }
+
+    size_t CSharpScriptComponent::CreateInstanceBatch(
+        ICoralHostManager& hostManager,
+        Coral::Type& scriptType,
+        ScriptTypeHandle scriptTypeHandle,
+        Coral::Type* batchType,
+        const AZStd::vector<CSharpScriptComponent*>& components)
+    {
+        bool batchOpen = false;
+        if (batchType)
+        {
+            try
+            {
+                batchType->InvokeStaticMethod("Begin");
+                batchOpen = true;
+            }
+            catch (...)
+            {
+                batchOpen = false;
+            }
+        }
+
+        AZStd::vector<CSharpScriptComponent*> created;
+        AZStd::vector<AZ::u64> entityIds;
+        AZStd::vector<const void*> blocks;
+        AZStd::vector<AZ::s32> blockLengths;
+        created.reserve(components.size());
+        entityIds.reserve(components.size());
+        blocks.reserve(components.size());
+        blockLengths.reserve(components.size());
+
+        for (CSharpScriptComponent* component : components)
+        {
+            component->m_scriptType = scriptTypeHandle;
+            component->m_scriptInstance = hostManager.CreateInstance(scriptType);
+            if (!component->m_scriptInstance.IsValid())
+            {
+                AZLOG_ERROR("CSharpScriptComponent: Failed to create instance of script class: '%s'",
+                    component->m_config.m_scriptClassName.c_str());
+                component->m_scriptType = {};
+                continue;
+            }
+            component->m_scriptInitialized = true;
+
+            // Instances sharing a value map share one cached block, so this
+            // converts each distinct map once per reload.
+            CSharpScriptComponentConfig& config = component->m_config;
+            if (!config.m_exposedPropertyValues.empty() && !ExposedPropertyBlock::IsValid(config.m_exposedPropertyBlock))
+            {
+                ExposedPropertyBlock::GetOrBuildForScript(
+                    config.m_scriptClassName, config.m_exposedPropertyValues, config.m_exposedPropertyBlock);
+            }
+            const bool hasBlock = !config.m_exposedPropertyValues.empty()
+                && ExposedPropertyBlock::IsValid(config.m_exposedPropertyBlock);
+
+            created.push_back(component);
+            entityIds.push_back(static_cast<AZ::u64>(component->GetEntityId()));
+            blocks.push_back(hasBlock ? config.m_exposedPropertyBlock.data() : nullptr);
+            blockLengths.push_back(hasBlock ? static_cast<AZ::s32>(config.m_exposedPropertyBlock.size()) : 0);
+        }
+
+        // One managed transition for the whole group. -1 means the batch
+        // didn't line up (or isn't available) and nothing was applied.
+        AZStd::vector<AZ::s32> results(created.size(), -1);
+        AZ::s32 completed = -1;
+        if (batchOpen)
+        {
+            try
+            {
+                const void* entityIdData = entityIds.data();
+                const void* blockData = blocks.data();
+                const void* blockLengthData = blockLengths.data();
+                void* resultData = results.data();
+                completed = batchType->InvokeStaticMethod<AZ::s32>(
+                    "Complete", entityIdData, blockData, blockLengthData, resultData, static_cast<AZ::s32>(created.size()));
+            }
+            catch (...)
+            {
+                completed = -1;
+            }
+        }
+
+        for (size_t i = 0; i < created.size(); ++i)
+        {
+            CSharpScriptComponent* component = created[i];
+            if (completed < 0)
+            {
+                component->SetEntityIdOnScript();
+                component->PushExposedPropertiesToScript();
+            }
+            else if (results[i] != 0 && !component->m_config.m_exposedPropertyValues.empty())
+            {
+                // No usable block, or it no longer matches the members: the
+                // string path applies - and reports - every value.
+                component->m_config.m_exposedPropertyBlock.clear();
+                component->PushExposedPropertiesToScript();
+            }
+        }
+
+        return created.size();
+    }
+
+    const char* CSharpScriptComponent::GetTraceScope()
+    {
+        if (m_traceScope == nullptr && InteropTracer::IsTracing())
+        {
+            m_traceScope = InteropTracer::Intern(m_config.m_scriptClassName);
+        }
+        return m_traceScope;
     }
 
     void CSharpScriptComponent::DisableAfterUnhandledException(
@@ -512,6 +1033,61 @@ namespace O3DESharp
         // Detach from TickBus so we don't pay the dispatch cost every frame for
         // a component we'll just no-op anyway.
         AZ::TickBus::Handler::BusDisconnect();
+        if (m_parallelSlot >= 0)
+        {
+            if (ParallelScriptUpdater* updater = ParallelScriptUpdater::GetActive())
+            {
+                updater->Unregister(*this);
+            }
+            m_parallelSlot = -1;
+        }
+        if (ScriptTickScheduler* scheduler = ScriptTickScheduler::GetActive())
+        {
+            scheduler->Unregister(*this);
+        }
+        m_scheduleSlot = -1;
+    }
+
+    void CSharpScriptComponent::TickParallel(float deltaTime) noexcept
+    {
+        if (m_disabledByException || m_parallelFailed || !m_scriptInstance.IsValid() || !m_scriptInitialized)
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(O3DESharp, "%s.Tick", m_config.m_scriptClassName.c_str());
+        InteropTraceScope trace(InteropTraceKind::NativeToManaged, GetTraceScope(), "Tick");
+        ScriptCostScope cost(m_cost);
+        try
+        {
+            m_scriptInstance.InvokeMethod("Tick", deltaTime);
+        }
+        catch (const std::exception& ex)
+        {
+            m_parallelFailed = true;
+            m_parallelError = ex.what();
+        }
+        catch (...)
+        {
+            m_parallelFailed = true;
+            m_parallelError = "non-std::exception";
+        }
+
+        // A main-thread-only call the managed side didn't catch itself
+        AZStd::string refused;
+        if (InternalCallGuard::TakeRefusedCall(refused) && !m_parallelFailed)
+        {
+            m_parallelFailed = true;
+            m_parallelError = AZStd::string::format("%s is not allowed in a [ParallelUpdate] update", refused.c_str());
+        }
+    }
+
+    void CSharpScriptComponent::ReportParallelFailure()
+    {
+        AZStd::string what;
+        what.swap(m_parallelError);
+        m_parallelFailed = false;
+        DisableAfterUnhandledException("Tick", what.c_str());
     }
 
     void CSharpScriptComponent::OnExposedPropertyChanged(
@@ -539,6 +1115,7 @@ namespace O3DESharp
             m_config.m_scriptClassName.c_str());
 
         m_config.m_exposedPropertyValues = newValues;
+        m_config.m_exposedPropertyBlock.clear();
         PushExposedPropertiesToScript();
     }
 
@@ -558,13 +1135,10 @@ namespace O3DESharp
             return false;
         }
 
-        // Try to find the type in the user assembly first, then core assembly
-        Coral::Type* scriptType = hostManager->GetUserType(m_config.m_scriptClassName);
-        if (!scriptType)
-        {
-            scriptType = hostManager->GetCoreType(m_config.m_scriptClassName);
-        }
-
+        // User assemblies first, then O3DE.Core - one lookup in the host's
+        // type index either way.
+        const ScriptTypeHandle scriptTypeHandle = hostManager->ResolveScriptType(m_config.m_scriptClassName);
+        Coral::Type* scriptType = hostManager->GetType(scriptTypeHandle);
         if (!scriptType)
         {
             AZLOG_ERROR("CSharpScriptComponent: Script class not found: '%s'",
@@ -572,16 +1146,20 @@ namespace O3DESharp
             return false;
         }
 
-        m_scriptType = scriptType;
+        m_scriptType = scriptTypeHandle;
 
-        // Create an instance of the script class
-        m_scriptInstance = hostManager->CreateInstance(*m_scriptType);
+        // Reuse a parked instance of a [PooledScript] class, else create one
+        m_scriptInstance = hostManager->AcquirePooledInstance(scriptTypeHandle);
+        if (!m_scriptInstance.IsValid())
+        {
+            m_scriptInstance = hostManager->CreateInstance(*scriptType);
+        }
 
         if (!m_scriptInstance.IsValid())
         {
             AZLOG_ERROR("CSharpScriptComponent: Failed to create instance of script class: '%s'",
                 m_config.m_scriptClassName.c_str());
-            m_scriptType = nullptr;
+            m_scriptType = {};
             return false;
         }
 
@@ -595,13 +1173,28 @@ namespace O3DESharp
 
     void CSharpScriptComponent::DestroyScriptInstance()
     {
+        if (m_parallelSlot >= 0)
+        {
+            if (ParallelScriptUpdater* updater = ParallelScriptUpdater::GetActive())
+            {
+                updater->Unregister(*this);
+            }
+            m_parallelSlot = -1;
+        }
+        if (ScriptTickScheduler* scheduler = ScriptTickScheduler::GetActive())
+        {
+            scheduler->Unregister(*this);
+        }
+        m_scheduleSlot = -1;
+
         if (m_scriptInstance.IsValid())
         {
             m_scriptInstance.Destroy();
         }
 
-        m_scriptType = nullptr;
+        m_scriptType = {};
         m_scriptInitialized = false;
+        m_scriptReady = false;
     }
 
     void CSharpScriptComponent::SetEntityIdOnScript()
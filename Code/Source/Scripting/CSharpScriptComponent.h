@@ -15,6 +15,7 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -22,11 +23,18 @@
 
 #include <Coral/ManagedObject.hpp>
 
+#include <O3DESharp/O3DESharpBus.h>
 #include <O3DESharp/O3DESharpHotReloadBus.h>
 #include <O3DESharp/O3DESharpExposedPropertyBus.h>
+#include <O3DESharp/O3DESharpScriptBus.h>
+
+#include "CoralHostManager.h"
+#include "InteropTracer.h"
+#include "ScriptProfiler.h"
 
 namespace O3DESharp
 {
+
     /**
      * Configuration for a C# script component
      */
@@ -65,6 +73,23 @@ namespace O3DESharp
          * OnCreate runs.
          */
         AZStd::unordered_map<AZStd::string, AZStd::string> m_exposedPropertyValues;
+
+        /**
+         * Typed binary form of m_exposedPropertyValues (see
+         * ExposedPropertyBlock.h), applied without any string parsing on the
+         * managed side. Written by the editor when it builds the game entity;
+         * empty for data saved before it existed, in which case the runtime
+         * component derives it from the string map. The string map stays the
+         * source of truth - the block is always rebuildable from it.
+         */
+        AZStd::vector<AZ::u8> m_exposedPropertyBlock;
+
+        /**
+         * Start the script within Activate even when the activation frame
+         * budget is spent, instead of waiting in the ScriptActivationQueue.
+         * For scripts other gameplay relies on existing from the first frame.
+         */
+        bool m_activateImmediately = false;
     };
 
     /**
@@ -109,6 +134,8 @@ namespace O3DESharp
         , public AZ::TransformNotificationBus::Handler
         , public O3DESharpHotReloadNotificationBus::Handler
         , public O3DESharpExposedPropertyNotificationBus::Handler
+        , public O3DESharpNotificationBus::Handler
+        , public O3DESharpScriptRequestBus::Handler
     {
     public:
         AZ_COMPONENT(CSharpScriptComponent, "{05918223-7DEF-48F6-8963-53BA48371E1D}");
@@ -181,6 +208,13 @@ namespace O3DESharp
         // dereference stale handles. See O3DESharpHotReloadBus.h.
         void OnBeforeUserAssemblyReload() override;
         void OnAfterUserAssemblyReload() override;
+        void OnUserAssemblyReloadCompleted() override;
+
+        // O3DESharpNotificationBus::Handler - connected only while this
+        // component waits for an asynchronous host boot to finish. The first
+        // call drains every queued component; if the boot failed each one is
+        // logged and dropped instead of started.
+        void OnCoralHostReady() override;
 
         // O3DESharpExposedPropertyNotificationBus::Handler - inspector edits
         // during Game Mode reach the running script via this bus. See
@@ -188,7 +222,40 @@ namespace O3DESharp
         void OnExposedPropertyChanged(
             const AZStd::unordered_map<AZStd::string, AZStd::string>& newValues) override;
 
+        // O3DESharpScriptRequestBus::Handler
+        const AZStd::string& GetScriptClassName() const override;
+        bool IsScriptReady() const override;
+
     private:
+        friend class ScriptActivationQueue;
+        friend class ParallelScriptUpdater;
+        friend class ScriptProfiler;
+        friend class ScriptTickScheduler;
+
+        /**
+         * Create the managed instance, hand it the entity id and exposed
+         * properties, run OnCreate and announce readiness. Called from
+         * Activate, or by the ScriptActivationQueue on a later frame.
+         */
+        void StartScript();
+
+        /**
+         * After OnCreate: mark the script ready and send
+         * O3DESharpScriptNotifications::OnScriptReady, unless OnCreate threw.
+         * Instances of [ParallelUpdate] classes are handed to the
+         * ParallelScriptUpdater here, [UpdateInterval] ones to the
+         * ScriptTickScheduler.
+         */
+        void MarkScriptReady();
+
+        /**
+         * ScriptComponent.Tick from a ParallelScriptUpdater job. Must not
+         * touch buses: an exception is only recorded, and reported by
+         * ReportParallelFailure on the main thread after the jobs finish.
+         */
+        void TickParallel(float deltaTime) noexcept;
+        void ReportParallelFailure();
+
         /**
          * Create the managed script instance from the configured class name
          */
@@ -205,14 +272,55 @@ namespace O3DESharp
         void SetEntityIdOnScript();
 
         /**
-         * Serialize CSharpScriptComponentConfig::m_exposedPropertyValues to JSON
-         * and hand it to the managed instance via ScriptComponent::ApplyExposedProperties.
+         * Hand CSharpScriptComponentConfig's exposed-property values to the
+         * managed instance: the typed block via
+         * ScriptComponent::ApplyExposedPropertyBlock when one is available,
+         * otherwise the string map as JSON via ScriptComponent::ApplyExposedProperties.
          * Called once per managed-instance lifetime, between SetEntityIdOnScript
          * and OnCreate, so user code in OnCreate sees the editor-configured values.
          * No-op if the map is empty or the instance is invalid.
          */
         void PushExposedPropertiesToScript();
 
+        /**
+         * Hot reload: snapshot the managed instance's fields into m_reloadState
+         * via ScriptComponent::WriteReloadState, before the instance is torn
+         * down. Leaves m_reloadState empty if the script can't be captured.
+         */
+        void CaptureReloadState();
+
+        /**
+         * Hot reload: apply m_reloadState to the re-created instance via
+         * ScriptComponent::ReadReloadState (after OnCreate, so OnCreate's
+         * initialisation doesn't overwrite it), then release the snapshot.
+         */
+        void RestoreReloadState();
+
+        /**
+         * Create the managed instances of every component queued by
+         * OnAfterUserAssemblyReload (or by Activate during an asynchronous
+         * host boot): grouped by script class so each type is
+         * resolved once, each group created back to back and initialised
+         * (entity id + exposed-property block) in a single managed call via
+         * O3DE.ScriptInstanceBatch, then OnCreate dispatched in entity id
+         * order so the result doesn't depend on bus handler order.
+         */
+        static void RecreateScriptInstances(AZStd::vector<CSharpScriptComponent*>& components);
+
+        /**
+         * One group of RecreateScriptInstances: create an instance of
+         * scriptType (resolved from scriptTypeHandle) for each component and
+         * initialise them together.
+         * batchType may be null (older O3DE.Core), in which case each
+         * instance is initialised individually. Returns the number created.
+         */
+        static size_t CreateInstanceBatch(
+            ICoralHostManager& hostManager,
+            Coral::Type& scriptType,
+            ScriptTypeHandle scriptTypeHandle,
+            Coral::Type* batchType,
+            const AZStd::vector<CSharpScriptComponent*>& components);
+
     private:
         // Invoke a managed method, catching any exception thrown across the
         // interop boundary. If a script's lifecycle method throws (e.g. an
@@ -222,6 +330,10 @@ namespace O3DESharp
         void SafeInvokeMethod(const char* methodName) noexcept;
         void SafeInvokeMethod(const char* methodName, float deltaTime) noexcept;
 
+        // Script class name for InteropTraceScope, interned on first use;
+        // null while tracing is off.
+        const char* GetTraceScope();
+
         // Once a managed exception has propagated out of a lifecycle hook we
         // detach from TickBus and treat the component as inert. This avoids
         // the "every entity throws once per frame in Release" failure mode.
@@ -233,8 +345,9 @@ namespace O3DESharp
         // The managed C# object instance
         Coral::ManagedObject m_scriptInstance;
 
-        // Cached type pointer for the script class
-        Coral::Type* m_scriptType = nullptr;
+        // Handle to the script class; ICoralHostManager::GetType returns
+        // nullptr for it once the class has been reloaded.
+        ScriptTypeHandle m_scriptType;
 
         // Flag to track if the script has been initialized
         bool m_scriptInitialized = false;
@@ -242,9 +355,52 @@ namespace O3DESharp
         // Flag to prevent re-entrant activation
         bool m_isActivating = false;
 
+        // Waiting in the ScriptActivationQueue for a frame with budget left
+        bool m_activationQueued = false;
+
+        // OnCreate has run on the current instance (see IsScriptReady)
+        bool m_scriptReady = false;
+
+        // Index in the ParallelScriptUpdater while it ticks this component,
+        // -1 when the component ticks itself
+        AZ::s32 m_parallelSlot = -1;
+
+        // Index in the ScriptProfiler while active, -1 otherwise
+        AZ::s32 m_profilerSlot = -1;
+
+        // Index in the ScriptTickScheduler while it time-slices this
+        // component, -1 when the component ticks itself
+        AZ::s32 m_scheduleSlot = -1;
+
+        // Watchdog state, kept by the ScriptTickScheduler: one bit per
+        // recent update, set if it overran, and whether that got it flagged
+        AZ::u64 m_overrunHistory = 0;
+        bool m_overrunFlagged = false;
+
+        // Time and managed allocations of this frame's dispatches, drained
+        // by the ScriptProfiler once a frame. Written by whichever thread
+        // ticks the component.
+        ScriptCostCounters m_cost;
+
+        // See GetTraceScope
+        const char* m_traceScope = nullptr;
+
+        // Exception from TickParallel, awaiting ReportParallelFailure
+        bool m_parallelFailed = false;
+        AZStd::string m_parallelError;
+
         // Set after an unhandled exception in a lifecycle hook. Once true the
         // component stops dispatching to the managed instance.
         bool m_disabledByException = false;
+
+        // Set by OnBeforeUserAssemblyReload when the reload leaves this
+        // script's assembly loaded, so OnAfterUserAssemblyReload has nothing
+        // to rebuild.
+        bool m_keptAcrossReload = false;
+
+        // Field snapshot of the instance torn down by the current hot reload
+        // (O3DE.Core.HotReload.ScriptStateSnapshot format). Empty otherwise.
+        AZStd::vector<AZ::u8> m_reloadState;
     };
 
     // Template implementations
@@ -22,8 +22,8 @@ namespace O3DESharp::Generated
     // Code/Source/Scripting/Generated/BindingRegistration.g.cpp by the
     // binding generator. The placeholder version of the .g.cpp is a no-op;
     // once the generator runs against the gem headers it overwrites the
-    // bodies with real AddInternalCall registrations + stub function
-    // implementations.
+    // bodies with real AddInternalCall registrations + the direct-call
+    // thunks they point at.
     void RegisterBindings(Coral::ManagedAssembly* assembly);
     void UnregisterBindings(Coral::ManagedAssembly* assembly);
     bool HotReload(Coral::ManagedAssembly* oldAssembly, Coral::ManagedAssembly* newAssembly);
@@ -32,13 +32,31 @@ namespace O3DESharp::Generated
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/Utils/Utils.h>
 
 #include <filesystem>
 
 namespace O3DESharp
 {
+    namespace
+    {
+        // Cheap change detection: a rebuilt assembly essentially always
+        // differs in size or modification time.
+        void ReadFileStamp(const AZStd::string& path, AZ::u64& size, AZ::u64& modTime)
+        {
+            size = AZ::IO::SystemFile::Length(path.c_str());
+            modTime = AZ::IO::SystemFile::ModificationTime(path.c_str());
+        }
+
+        bool IsSameAssemblyFile(const AZStd::string& a, const AZStd::string& b)
+        {
+            return AZ::IO::PathView(a).LexicallyNormal() == AZ::IO::PathView(b).LexicallyNormal();
+        }
+    } // namespace
+
     // Static callback functions for Coral
     void CoralHostManager::CoralMessageCallback(std::string_view message, Coral::MessageLevel level)
     {
@@ -198,16 +216,16 @@ namespace O3DESharp
         // For hot-reload, we'll unload and recreate the entire context
         //
         // KNOWN LIMITATION (investigated for 1.2.0, deliberately deferred - not a
-        // TODO to "just do", see below for why): because m_userContext and
-        // m_coreContext are the same AssemblyLoadContext, every ReloadUserAssemblies()
-        // call (see below) unloads and rebuilds BOTH user and core assemblies, even
-        // though only the user assembly actually changed. .NET's
+        // TODO to "just do", see below for why): because user assemblies share
+        // this context with O3DE.Core by default, every ReloadUserAssemblies()
+        // call unloads and rebuilds BOTH user and core assemblies, even though
+        // only the user assembly actually changed. .NET's
         // AssemblyLoadContext.Unload() is all-or-nothing per context - there is no
         // way to unload just the user assembly from a context that also holds
         // O3DE.Core, so this can't be fixed by restructuring the reload code alone;
         // it requires the contexts to actually be separate objects.
         //
-        // Why they aren't already separate: doing so safely requires solving a
+        // Why they aren't separate by default: doing so safely requires solving a
         // problem this investigation could not resolve without Coral's own source
         // (not vendored in this repo) and, likely, changes to Coral.Managed (the C#
         // bootstrapper - a *separate* forked repo, not part of this codebase at
@@ -215,8 +233,8 @@ namespace O3DESharp
         //   - Two independently-created custom AssemblyLoadContexts do NOT
         //     automatically see each other's loaded assemblies in .NET (only the
         //     Default ALC has that implicit visibility from other contexts). If
-        //     O3DE.Core lived only in m_coreContext, a genuinely separate
-        //     m_userContext would fail to resolve user scripts' references to it
+        //     O3DE.Core lived only in m_coreContext, a genuinely separate user
+        //     context would fail to resolve user scripts' references to it
         //     (Vector3, Entity, ScriptComponent, ...) unless something explicitly
         //     redirects that resolution - the standard .NET pattern for this is a
         //     custom AssemblyLoadContext subclass overriding Load() to fall back to
@@ -234,20 +252,17 @@ namespace O3DESharp
         //     silently, which is worse than the current (correct, if suboptimal)
         //     unified-context behavior.
         //
-        // A real fix needs: (1) confirming what cross-context resolution hooks
-        // Coral's C++ AssemblyLoadContext actually exposes, if any, and (2) if none
-        // exist, adding a custom resolving AssemblyLoadContext in Coral.Managed that
-        // redirects O3DE.Core (and only O3DE.Core) references from the user context
-        // back to the single instance already loaded in the core context. Tracked
-        // as a follow-up requiring engine/Coral-source access this environment
-        // didn't have; see the 1.2.0 audit plan (docs/superpowers/plans/) for the
-        // full investigation.
+        // isolateUserAssemblies (/O3DE/O3DESharp/HotReload/IsolateUserAssemblies)
+        // opts into one context per user assembly (see LoadUserAssemblyRecord),
+        // with no copy of O3DE.Core in it. It only works with a Coral.Managed
+        // that provides the resolver described above, redirecting O3DE.Core
+        // (and other user assembly) references to the instance already loaded.
+        // Nothing in this repo provides that, so it is off by default, and
+        // when it is requested CoreResolvesFromIsolatedContext() checks for the
+        // resolver before any user assembly is loaded. See the 1.2.0 audit plan
+        // (docs/superpowers/plans/) for the full investigation.
         m_coreContext = m_hostInstance->CreateAssemblyLoadContext("O3DEContext");
 
-        // User context is the same as core context - single unified context
-        // This pointer alias simplifies code that expects separate contexts
-        m_userContext = m_coreContext;
-
         // Warn if there's a stale O3DE.Core.dll in the Coral directory
         // This can cause assembly resolution issues since Coral looks there first
 #if !defined(AZ_RELEASE_BUILD)
@@ -274,6 +289,18 @@ namespace O3DESharp
         // Register internal calls (C++ functions exposed to C#)
         RegisterInternalCalls();
 
+        // Without the resolver every user context would get its own O3DE.Core
+        // and no user class would derive from the ScriptComponent native code
+        // sees, so refuse isolation outright rather than load broken scripts.
+        if (m_config.isolateUserAssemblies && !CoreResolvesFromIsolatedContext())
+        {
+            AZLOG_ERROR(
+                "CoralHostManager: IsolateUserAssemblies is set, but O3DE.Core does not resolve to the shared instance "
+                "from a user load context (this Coral.Managed has no cross-context resolver). Loading user assemblies "
+                "into the shared context instead; hot reloads will reload everything.");
+            m_config.isolateUserAssemblies = false;
+        }
+
         // Load every configured user assembly (multi-assembly), or the legacy single one.
         // Not loading any user assembly is OK - the user can call LoadAssembly later.
         if (!m_config.userAssemblyPaths.empty() || !m_config.userAssemblyPath.empty())
@@ -285,6 +312,8 @@ namespace O3DESharp
             }
         }
 
+        RebuildTypeIndex();
+
         m_initialized = true;
         AZLOG_INFO("CoralHostManager: Initialization complete");
 
@@ -300,17 +329,35 @@ namespace O3DESharp
 
         AZLOG_INFO("CoralHostManager: Shutting down...");
 
-        // Clear type caches
-        m_coreTypeCache.clear();
-        m_userTypeCache.clear();
+        const ScriptPoolStats poolTotals = GetScriptPoolStats({});
+        if (poolTotals.hits + poolTotals.misses > 0)
+        {
+            AZLOG_INFO("CoralHostManager: Instance pools: %llu hit(s), %llu miss(es), %llu discard(s)",
+                static_cast<unsigned long long>(poolTotals.hits),
+                static_cast<unsigned long long>(poolTotals.misses),
+                static_cast<unsigned long long>(poolTotals.discards));
+        }
+        ClearInstancePools(nullptr);
 
-        // Unload the unified context (contains both O3DE.Core and user assemblies)
-        if (m_coreAssembly != nullptr || !m_userAssemblies.empty())
+        // Drop the type index. m_loadGeneration keeps counting, so handles
+        // from before a shutdown stay stale after the next Initialize.
+        m_typeSlots.clear();
+        m_typeIndex.clear();
+
+        // User contexts first - they hold references into O3DE.Core. In
+        // shared-context mode the core unload below takes them with it.
+        const bool anyLoaded = m_coreAssembly != nullptr || !m_userAssemblies.empty();
+        for (auto& record : m_userRecords)
+        {
+            UnloadUserAssemblyRecord(*record);
+        }
+        m_userRecords.clear();
+        RebuildUserAssemblyList();
+
+        if (anyLoaded)
         {
             m_hostInstance->UnloadAssemblyLoadContext(m_coreContext);
             m_coreAssembly = nullptr;
-            m_userAssembly = nullptr;
-            m_userAssemblies.clear();
         }
 
         // Shutdown the .NET runtime
@@ -333,21 +380,41 @@ namespace O3DESharp
             return nullptr;
         }
 
-        AZLOG_INFO("CoralHostManager: Loading assembly: %s", assemblyPath.c_str());
+        for (const auto& record : m_userRecords)
+        {
+            if (record->assembly != nullptr && record->path == assemblyPath)
+            {
+                return record->assembly;
+            }
+        }
 
-        Coral::ManagedAssembly& assembly = m_userContext.LoadAssembly(std::string(assemblyPath.c_str()));
+        AZLOG_INFO("CoralHostManager: Loading assembly: %s", assemblyPath.c_str());
 
-        if (assembly.GetLoadStatus() != Coral::AssemblyLoadStatus::Success)
+        // Tracked like a configured user assembly, so its types resolve
+        // through GetUserType and it takes part in hot reload.
+        auto record = AZStd::make_unique<UserAssemblyRecord>();
+        record->path = assemblyPath;
+        if (!LoadUserAssemblyRecord(*record))
         {
-            AZLOG_ERROR("CoralHostManager: Failed to load assembly: %s", assemblyPath.c_str());
             return nullptr;
         }
 
-        AZLOG_INFO("CoralHostManager: Successfully loaded assembly: %s", assembly.GetName().data());
-        return &assembly;
+        Coral::ManagedAssembly* assembly = record->assembly;
+        m_userRecords.push_back(AZStd::move(record));
+        RebuildUserAssemblyList();
+        RefreshUserAssemblyReferences();
+        RebuildTypeIndex();
+
+        AZLOG_INFO("CoralHostManager: Successfully loaded assembly: %s", assembly->GetName().data());
+        return assembly;
     }
 
     bool CoralHostManager::ReloadUserAssemblies()
+    {
+        return ReloadChangedUserAssemblies({});
+    }
+
+    bool CoralHostManager::ReloadChangedUserAssemblies(const AZStd::vector<AZStd::string>& changedAssemblyPaths)
     {
         if (!m_initialized)
         {
@@ -361,7 +428,208 @@ namespace O3DESharp
             return false;
         }
 
-        AZLOG_INFO("CoralHostManager: Reloading user assemblies...");
+        // Everything shares one context: nothing can be unloaded on its own.
+        if (!m_config.isolateUserAssemblies)
+        {
+            return FullReload();
+        }
+
+        // Work out what changed.
+        bool coreChanged = false;
+        AZStd::vector<bool> affected(m_userRecords.size(), false);
+        if (changedAssemblyPaths.empty())
+        {
+            AZ::u64 size = 0;
+            AZ::u64 modTime = 0;
+            ReadFileStamp(m_config.coreApiAssemblyPath, size, modTime);
+            coreChanged = size != m_coreFileSize || modTime != m_coreFileModTime;
+
+            bool anyUserChanged = false;
+            for (size_t i = 0; i < m_userRecords.size(); ++i)
+            {
+                const UserAssemblyRecord& record = *m_userRecords[i];
+                ReadFileStamp(record.path, size, modTime);
+                affected[i] = record.assembly == nullptr || size != record.fileSize || modTime != record.fileModTime;
+                anyUserChanged = anyUserChanged || affected[i];
+            }
+
+            if (!coreChanged && !anyUserChanged)
+            {
+                // Explicit request with nothing visibly changed on disk (file
+                // stamps can be preserved by some copy tools): honour it for
+                // the user assemblies, leave O3DE.Core alone.
+                AZLOG_INFO("CoralHostManager: No assembly file changes detected; reloading all user assemblies");
+                AZStd::fill(affected.begin(), affected.end(), true);
+            }
+        }
+        else
+        {
+            for (const AZStd::string& changedPath : changedAssemblyPaths)
+            {
+                if (IsSameAssemblyFile(changedPath, m_config.coreApiAssemblyPath))
+                {
+                    coreChanged = true;
+                    continue;
+                }
+
+                bool matched = false;
+                for (size_t i = 0; i < m_userRecords.size(); ++i)
+                {
+                    if (IsSameAssemblyFile(changedPath, m_userRecords[i]->path))
+                    {
+                        affected[i] = true;
+                        matched = true;
+                    }
+                }
+                if (!matched)
+                {
+                    AZLOG_INFO("CoralHostManager: Ignoring change to '%s' - not a loaded assembly", changedPath.c_str());
+                }
+            }
+        }
+
+        if (coreChanged)
+        {
+            AZLOG_INFO("CoralHostManager: O3DE.Core changed - full reload");
+            return FullReload();
+        }
+
+        // Anything referencing an affected assembly has to go too: its context
+        // holds references into the old copy.
+        for (bool grew = true; grew;)
+        {
+            grew = false;
+            for (size_t i = 0; i < m_userRecords.size(); ++i)
+            {
+                if (affected[i])
+                {
+                    continue;
+                }
+                for (const AZStd::string& reference : m_userRecords[i]->references)
+                {
+                    for (size_t j = 0; j < m_userRecords.size(); ++j)
+                    {
+                        if (affected[j] && m_userRecords[j]->name == reference)
+                        {
+                            affected[i] = true;
+                            grew = true;
+                            break;
+                        }
+                    }
+                    if (affected[i])
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+
+        const size_t affectedCount = AZStd::count(affected.begin(), affected.end(), true);
+        if (affectedCount == 0)
+        {
+            AZLOG_INFO("CoralHostManager: No user assemblies affected; nothing to reload");
+            return true;
+        }
+
+        AZLOG_INFO("CoralHostManager: Reloading %zu of %zu user assemblies...", affectedCount, m_userRecords.size());
+
+        m_reloadingAssemblies.clear();
+        for (size_t i = 0; i < m_userRecords.size(); ++i)
+        {
+            if (affected[i])
+            {
+                m_reloadingAssemblies.insert(m_userRecords[i]->name);
+                AZLOG_INFO("  %s", m_userRecords[i]->path.c_str());
+            }
+        }
+        m_reloadInProgress = true;
+        m_fullReloadInProgress = false;
+
+        // Handlers ask IsUserTypeReloading() to decide whether their cached
+        // Coral handles are about to dangle; the rest keep running untouched.
+        O3DESharpHotReloadNotificationBus::Broadcast(
+            &O3DESharpHotReloadNotifications::OnBeforeUserAssemblyReload);
+
+        ClearInstancePools(&m_reloadingAssemblies);
+        UnbindTypes(&m_reloadingAssemblies);
+
+        for (size_t i = 0; i < m_userRecords.size(); ++i)
+        {
+            if (affected[i])
+            {
+                UnloadUserAssemblyRecord(*m_userRecords[i]);
+            }
+        }
+
+        // Dependencies first, so a dependent's reference resolves to the new
+        // copy rather than one still draining from an unloaded context.
+        // References are as of the previous load; a cycle (not expected from
+        // C# projects) just falls back to configuration order.
+        bool allLoaded = true;
+        AZStd::vector<bool> pending = affected;
+        for (size_t remaining = affectedCount; remaining > 0;)
+        {
+            size_t next = m_userRecords.size();
+            for (size_t i = 0; i < m_userRecords.size() && next == m_userRecords.size(); ++i)
+            {
+                if (!pending[i])
+                {
+                    continue;
+                }
+
+                bool ready = true;
+                for (const AZStd::string& reference : m_userRecords[i]->references)
+                {
+                    for (size_t j = 0; j < m_userRecords.size() && ready; ++j)
+                    {
+                        ready = !(pending[j] && j != i && m_userRecords[j]->name == reference);
+                    }
+                }
+                if (ready)
+                {
+                    next = i;
+                }
+            }
+            if (next == m_userRecords.size())
+            {
+                next = AZStd::distance(pending.begin(), AZStd::find(pending.begin(), pending.end(), true));
+            }
+
+            allLoaded = LoadUserAssemblyRecord(*m_userRecords[next]) && allLoaded;
+            pending[next] = false;
+            --remaining;
+        }
+
+        RebuildUserAssemblyList();
+        RefreshUserAssemblyReferences();
+        RebuildTypeIndex();
+        m_lastReloadIncludedCore = false;
+
+        O3DESharpHotReloadNotificationBus::Broadcast(
+            &O3DESharpHotReloadNotifications::OnAfterUserAssemblyReload);
+        O3DESharpHotReloadNotificationBus::Broadcast(
+            &O3DESharpHotReloadNotifications::OnUserAssemblyReloadCompleted);
+
+        m_reloadInProgress = false;
+        m_reloadingAssemblies.clear();
+
+        if (allLoaded)
+        {
+            AZLOG_INFO("CoralHostManager: User assemblies reloaded successfully");
+        }
+        else
+        {
+            AZLOG_ERROR("CoralHostManager: One or more user assemblies failed to reload");
+        }
+        return allLoaded;
+    }
+
+    bool CoralHostManager::FullReload()
+    {
+        AZLOG_INFO("CoralHostManager: Reloading O3DE.Core and all user assemblies...");
+
+        m_reloadInProgress = true;
+        m_fullReloadInProgress = true;
 
         // Broadcast OnBeforeUserAssemblyReload so every CSharpScriptComponent
         // (and anything else that caches Coral handles) can release its
@@ -372,29 +640,33 @@ namespace O3DESharp
         O3DESharpHotReloadNotificationBus::Broadcast(
             &O3DESharpHotReloadNotifications::OnBeforeUserAssemblyReload);
 
-        // Clear type caches - both need to be cleared since we're reloading everything
-        m_userTypeCache.clear();
-        m_coreTypeCache.clear();
+        // Everything is reloaded, core types included.
+        ClearInstancePools(nullptr);
+        UnbindTypes(nullptr);
 
-        // Unload the unified context (which contains both O3DE.Core and user assemblies).
-        // This is why every hot-reload also reloads O3DE.Core, not just the user
-        // assembly that actually changed - see the detailed KNOWN LIMITATION note in
-        // Initialize() above (where m_coreContext/m_userContext are created) for why
-        // this can't be fixed without genuinely separate AssemblyLoadContexts, and
-        // why that separation is deferred rather than attempted blind.
+        // User contexts first (they reference O3DE.Core), then the core
+        // context - which in shared-context mode holds the user assemblies too.
+        for (auto& record : m_userRecords)
+        {
+            UnloadUserAssemblyRecord(*record);
+        }
         m_hostInstance->UnloadAssemblyLoadContext(m_coreContext);
         m_coreAssembly = nullptr;
-        m_userAssembly = nullptr;
-        m_userAssemblies.clear();
+        RebuildUserAssemblyList();
 
-        // Create a new unified context
         m_coreContext = m_hostInstance->CreateAssemblyLoadContext("O3DEContext");
-        m_userContext = m_coreContext;  // Same context
+
+        auto endReload = [this]()
+        {
+            m_reloadInProgress = false;
+            m_fullReloadInProgress = false;
+        };
 
         // Reload O3DE.Core first
         if (!LoadCoreAssembly())
         {
             AZLOG_ERROR("CoralHostManager: Failed to reload O3DE.Core assembly");
+            endReload();
             return false;
         }
 
@@ -402,25 +674,85 @@ namespace O3DESharp
         RegisterInternalCalls();
 
         // Reload all user assemblies
-        if (!m_config.userAssemblyPaths.empty() || !m_config.userAssemblyPath.empty())
+        size_t failed = 0;
+        for (auto& record : m_userRecords)
         {
-            if (!LoadUserAssemblies())
+            if (!LoadUserAssemblyRecord(*record))
             {
-                AZLOG_ERROR("CoralHostManager: Failed to reload user assemblies");
-                return false;
+                ++failed;
             }
         }
+        RebuildUserAssemblyList();
+        RefreshUserAssemblyReferences();
+        RebuildTypeIndex();
+        m_lastReloadIncludedCore = true;
+
+        if (!m_userRecords.empty() && failed == m_userRecords.size())
+        {
+            AZLOG_ERROR("CoralHostManager: Failed to reload user assemblies");
+            endReload();
+            return false;
+        }
 
         // Broadcast OnAfterUserAssemblyReload so every script component
-        // re-resolves its Coral::Type and reconstructs its managed instance
-        // against the freshly-loaded user assemblies.
+        // queues the reconstruction of its managed instance against the
+        // freshly-loaded user assemblies; OnUserAssemblyReloadCompleted then
+        // re-creates them all in one batch.
         O3DESharpHotReloadNotificationBus::Broadcast(
             &O3DESharpHotReloadNotifications::OnAfterUserAssemblyReload);
+        O3DESharpHotReloadNotificationBus::Broadcast(
+            &O3DESharpHotReloadNotifications::OnUserAssemblyReloadCompleted);
 
+        endReload();
         AZLOG_INFO("CoralHostManager: User assemblies reloaded successfully");
         return true;
     }
 
+    bool CoralHostManager::IsUserTypeReloading(const AZStd::string& fullTypeName) const
+    {
+        if (!m_reloadInProgress)
+        {
+            return false;
+        }
+        if (m_fullReloadInProgress)
+        {
+            return true;
+        }
+
+        auto it = m_typeIndex.find(fullTypeName);
+        if (it == m_typeIndex.end() || m_typeSlots[it->second].userType == nullptr)
+        {
+            return true;
+        }
+        return m_reloadingAssemblies.find(m_typeSlots[it->second].userAssemblyName) != m_reloadingAssemblies.end();
+    }
+
+    AZStd::vector<AZStd::string> CoralHostManager::GetUserScriptTypeNames()
+    {
+        AZStd::vector<AZStd::string> names;
+        Coral::Type* scriptComponentType = GetCoreType("O3DE.ScriptComponent");
+        if (scriptComponentType == nullptr)
+        {
+            return names;
+        }
+
+        try
+        {
+            for (const TypeIndexSlot& slot : m_typeSlots)
+            {
+                if (slot.userType != nullptr && slot.userType->IsSubclassOf(*scriptComponentType))
+                {
+                    names.push_back(slot.name);
+                }
+            }
+        }
+        catch (...)
+        {
+            AZLOG_WARN("CoralHostManager: Could not list the loaded script classes");
+        }
+        return names;
+    }
+
     Coral::Type* CoralHostManager::GetCoreType(const AZStd::string& fullTypeName)
     {
         if (!m_initialized || m_coreAssembly == nullptr)
@@ -428,59 +760,390 @@ namespace O3DESharp
             return nullptr;
         }
 
-        // Check cache first
-        auto it = m_coreTypeCache.find(fullTypeName);
-        if (it != m_coreTypeCache.end())
+        bool probed = false;
+        const TypeIndexSlot& slot = FindTypeSlot(fullTypeName, probed);
+        if (slot.coreType == nullptr && probed)
         {
-            return it->second;
+            AZLOG_WARN("CoralHostManager: Core type not found: %s", fullTypeName.c_str());
         }
+        return slot.coreType;
+    }
 
-        // Look up the type
-        Coral::Type& type = m_coreAssembly->GetLocalType(std::string_view(fullTypeName.c_str(), fullTypeName.size()));
-        if (!type)
+    Coral::Type* CoralHostManager::GetUserType(const AZStd::string& fullTypeName)
+    {
+        if (!m_initialized || m_userAssemblies.empty())
         {
-            AZLOG_WARN("CoralHostManager: Core type not found: %s", fullTypeName.c_str());
             return nullptr;
         }
 
-        // Cache and return
-        m_coreTypeCache[fullTypeName] = &type;
-        return &type;
+        bool probed = false;
+        const TypeIndexSlot& slot = FindTypeSlot(fullTypeName, probed);
+        if (slot.userType == nullptr && probed)
+        {
+            AZLOG_WARN("CoralHostManager: User type not found in any loaded assembly: %s", fullTypeName.c_str());
+        }
+        return slot.userType;
     }
 
-    Coral::Type* CoralHostManager::GetUserType(const AZStd::string& fullTypeName)
+    ScriptTypeHandle CoralHostManager::ResolveScriptType(const AZStd::string& fullTypeName)
     {
-        if (!m_initialized || m_userAssemblies.empty())
+        if (!m_initialized || fullTypeName.empty())
+        {
+            return {};
+        }
+
+        bool probed = false;
+        const TypeIndexSlot& slot = FindTypeSlot(fullTypeName, probed);
+        if (slot.userType == nullptr && slot.coreType == nullptr)
+        {
+            if (probed)
+            {
+                AZLOG_WARN("CoralHostManager: Script type not found in any loaded assembly: %s", fullTypeName.c_str());
+            }
+            return {};
+        }
+
+        ScriptTypeHandle handle;
+        handle.index = static_cast<AZ::u32>(&slot - m_typeSlots.data());
+        handle.generation = slot.generation;
+        return handle;
+    }
+
+    Coral::Type* CoralHostManager::GetType(ScriptTypeHandle handle) const
+    {
+        if (handle.index >= m_typeSlots.size())
         {
             return nullptr;
         }
 
-        // Check cache first
-        auto it = m_userTypeCache.find(fullTypeName);
-        if (it != m_userTypeCache.end())
+        const TypeIndexSlot& slot = m_typeSlots[handle.index];
+        if (slot.generation != handle.generation || slot.generation == 0)
         {
-            return it->second;
+            return nullptr;
         }
+        return slot.userType != nullptr ? slot.userType : slot.coreType;
+    }
+
+    CoralHostManager::TypeIndexSlot& CoralHostManager::FindTypeSlot(const AZStd::string& fullTypeName, bool& probed)
+    {
+        probed = false;
 
-        // Search every loaded user assembly. First match wins.
+        AZ::u32 index = 0;
+        auto it = m_typeIndex.find(fullTypeName);
+        if (it != m_typeIndex.end())
+        {
+            index = it->second;
+            if (m_typeSlots[index].probedGeneration == m_loadGeneration)
+            {
+                return m_typeSlots[index];
+            }
+        }
+        else
+        {
+            index = static_cast<AZ::u32>(m_typeSlots.size());
+            TypeIndexSlot newSlot;
+            newSlot.name = fullTypeName;
+            m_typeSlots.push_back(AZStd::move(newSlot));
+            m_typeIndex.emplace(fullTypeName, index);
+        }
+
+        // Not produced by the index build (a name spelled differently from
+        // Coral's full name, say, or simply not a type): ask Coral once per
+        // load and remember the answer either way.
+        TypeIndexSlot& slot = m_typeSlots[index];
         const std::string_view typeNameView(fullTypeName.c_str(), fullTypeName.size());
-        for (Coral::ManagedAssembly* assembly : m_userAssemblies)
+
+        Coral::Type* userType = nullptr;
+        AZStd::string userAssemblyName;
+        for (const auto& record : m_userRecords)
         {
-            if (assembly == nullptr)
+            if (record->assembly == nullptr)
             {
                 continue;
             }
 
-            Coral::Type& type = assembly->GetLocalType(typeNameView);
+            Coral::Type& type = record->assembly->GetLocalType(typeNameView);
             if (type)
             {
-                m_userTypeCache[fullTypeName] = &type;
-                return &type;
+                userType = &type;
+                userAssemblyName = record->name;
+                break;
             }
         }
 
-        AZLOG_WARN("CoralHostManager: User type not found in any loaded assembly: %s", fullTypeName.c_str());
-        return nullptr;
+        Coral::Type* coreType = nullptr;
+        if (m_coreAssembly != nullptr)
+        {
+            Coral::Type& type = m_coreAssembly->GetLocalType(typeNameView);
+            coreType = type ? &type : nullptr;
+        }
+
+        if (slot.userType != userType || slot.coreType != coreType)
+        {
+            slot.userType = userType;
+            slot.coreType = coreType;
+            slot.generation = m_loadGeneration;
+        }
+        slot.userAssemblyName = AZStd::move(userAssemblyName);
+        slot.probedGeneration = m_loadGeneration;
+        probed = true;
+        return slot;
+    }
+
+    void CoralHostManager::UnbindTypes(const AZStd::unordered_set<AZStd::string>* assemblyNames)
+    {
+        for (TypeIndexSlot& slot : m_typeSlots)
+        {
+            if (assemblyNames == nullptr)
+            {
+                slot.coreType = nullptr;
+            }
+            else if (slot.userType == nullptr || assemblyNames->find(slot.userAssemblyName) == assemblyNames->end())
+            {
+                continue;
+            }
+
+            slot.userType = nullptr;
+            slot.userAssemblyName.clear();
+            slot.generation = 0;
+        }
+    }
+
+    void CoralHostManager::RebuildTypeIndex()
+    {
+        if (++m_loadGeneration == 0)
+        {
+            m_loadGeneration = 1;
+        }
+
+        // What each slot resolves to in this load; slots not mentioned lose
+        // their types.
+        AZStd::vector<Coral::Type*> userTypes(m_typeSlots.size(), nullptr);
+        AZStd::vector<Coral::Type*> coreTypes(m_typeSlots.size(), nullptr);
+        AZStd::vector<const AZStd::string*> userAssemblyNames(m_typeSlots.size(), nullptr);
+
+        auto slotFor = [this, &userTypes, &coreTypes, &userAssemblyNames](Coral::Type* type) -> AZ::u32
+        {
+            Coral::String fullName = type->GetFullName();
+            if (fullName.Data() == nullptr)
+            {
+                return ScriptTypeHandle::InvalidIndex;
+            }
+            std::string utf8 = static_cast<std::string>(fullName);
+            AZStd::string name(utf8.c_str(), utf8.size());
+
+            auto inserted = m_typeIndex.emplace(name, static_cast<AZ::u32>(m_typeSlots.size()));
+            if (inserted.second)
+            {
+                TypeIndexSlot newSlot;
+                newSlot.name = AZStd::move(name);
+                m_typeSlots.push_back(AZStd::move(newSlot));
+                userTypes.push_back(nullptr);
+                coreTypes.push_back(nullptr);
+                userAssemblyNames.push_back(nullptr);
+            }
+            return inserted.first->second;
+        };
+
+        size_t indexed = 0;
+        try
+        {
+            if (m_coreAssembly != nullptr)
+            {
+                for (Coral::Type* type : m_coreAssembly->GetTypes())
+                {
+                    const AZ::u32 index = type ? slotFor(type) : ScriptTypeHandle::InvalidIndex;
+                    if (index != ScriptTypeHandle::InvalidIndex)
+                    {
+                        coreTypes[index] = type;
+                        ++indexed;
+                    }
+                }
+            }
+
+            for (const auto& record : m_userRecords)
+            {
+                if (record->assembly == nullptr)
+                {
+                    continue;
+                }
+                for (Coral::Type* type : record->assembly->GetTypes())
+                {
+                    const AZ::u32 index = type ? slotFor(type) : ScriptTypeHandle::InvalidIndex;
+                    if (index != ScriptTypeHandle::InvalidIndex && userTypes[index] == nullptr)
+                    {
+                        userTypes[index] = type;
+                        userAssemblyNames[index] = &record->name;
+                        ++indexed;
+                    }
+                }
+            }
+        }
+        catch (...)
+        {
+            // Incomplete enumeration: leave every slot to be probed on demand.
+            AZLOG_WARN("CoralHostManager: Could not enumerate assembly types; resolving them on demand");
+            return;
+        }
+
+        for (size_t i = 0; i < m_typeSlots.size(); ++i)
+        {
+            TypeIndexSlot& slot = m_typeSlots[i];
+            if (slot.userType != userTypes[i] || slot.coreType != coreTypes[i] || slot.generation == 0)
+            {
+                slot.userType = userTypes[i];
+                slot.coreType = coreTypes[i];
+                slot.generation = m_loadGeneration;
+            }
+            slot.userAssemblyName = userAssemblyNames[i] ? *userAssemblyNames[i] : AZStd::string();
+            slot.probedGeneration = m_loadGeneration;
+        }
+
+        AZLOG_INFO("CoralHostManager: Indexed %zu types (load generation %u)", indexed, m_loadGeneration);
+    }
+
+    Coral::ManagedObject CoralHostManager::AcquirePooledInstance(ScriptTypeHandle type)
+    {
+        if (!m_config.enableInstancePooling || GetType(type) == nullptr)
+        {
+            return Coral::ManagedObject();
+        }
+
+        auto it = m_instancePools.find(type.index);
+        if (it == m_instancePools.end() || it->second.generation != type.generation || it->second.capacity <= 0)
+        {
+            return Coral::ManagedObject(); // not (known to be) pooled
+        }
+
+        ScriptInstancePool& pool = it->second;
+        if (pool.instances.empty())
+        {
+            ++pool.stats.misses;
+            return Coral::ManagedObject();
+        }
+
+        Coral::ManagedObject instance = pool.instances.back();
+        pool.instances.pop_back();
+        ++pool.stats.hits;
+        return instance;
+    }
+
+    bool CoralHostManager::ReleaseToPool(ScriptTypeHandle type, Coral::ManagedObject& instance)
+    {
+        if (!m_config.enableInstancePooling || !instance.IsValid() || GetType(type) == nullptr)
+        {
+            return false;
+        }
+
+        ScriptInstancePool& pool = m_instancePools[type.index];
+        if (pool.generation != type.generation)
+        {
+            // Slot rebound since (a pool surviving a reload it shouldn't have).
+            for (Coral::ManagedObject& stale : pool.instances)
+            {
+                stale.Destroy();
+            }
+            pool = ScriptInstancePool();
+            pool.generation = type.generation;
+        }
+
+        if (pool.capacity < 0)
+        {
+            AZ::s32 requested = 0;
+            try
+            {
+                requested = instance.InvokeMethod<AZ::s32>("GetPoolCapacity");
+            }
+            catch (...)
+            {
+                requested = 0; // O3DE.Core without pooling support
+            }
+            pool.capacity = AZStd::min(AZStd::max(requested, 0), static_cast<AZ::s32>(m_config.maxPooledInstancesPerType));
+        }
+
+        if (pool.capacity == 0)
+        {
+            return false;
+        }
+        if (pool.instances.size() >= static_cast<size_t>(pool.capacity))
+        {
+            ++pool.stats.discards;
+            return false;
+        }
+
+        bool reset = false;
+        try
+        {
+            reset = instance.InvokeMethod<bool>("ResetForPool");
+        }
+        catch (...)
+        {
+            reset = false;
+        }
+        if (!reset)
+        {
+            ++pool.stats.discards;
+            return false;
+        }
+
+        pool.instances.push_back(instance);
+        instance = Coral::ManagedObject();
+        ++pool.stats.returns;
+        return true;
+    }
+
+    ScriptPoolStats CoralHostManager::GetScriptPoolStats(ScriptTypeHandle type) const
+    {
+        auto describe = [](const ScriptInstancePool& pool)
+        {
+            ScriptPoolStats stats = pool.stats;
+            stats.pooled = static_cast<AZ::u32>(pool.instances.size());
+            stats.capacity = pool.capacity > 0 ? static_cast<AZ::u32>(pool.capacity) : 0;
+            return stats;
+        };
+
+        if (type.IsValid())
+        {
+            auto it = m_instancePools.find(type.index);
+            return it != m_instancePools.end() && it->second.generation == type.generation
+                ? describe(it->second) : ScriptPoolStats();
+        }
+
+        ScriptPoolStats totals;
+        for (const auto& [index, pool] : m_instancePools)
+        {
+            const ScriptPoolStats stats = describe(pool);
+            totals.hits += stats.hits;
+            totals.misses += stats.misses;
+            totals.returns += stats.returns;
+            totals.discards += stats.discards;
+            totals.pooled += stats.pooled;
+            totals.capacity += stats.capacity;
+        }
+        return totals;
+    }
+
+    void CoralHostManager::ClearInstancePools(const AZStd::unordered_set<AZStd::string>* assemblyNames)
+    {
+        for (auto it = m_instancePools.begin(); it != m_instancePools.end();)
+        {
+            if (assemblyNames != nullptr)
+            {
+                const TypeIndexSlot* slot = it->first < m_typeSlots.size() ? &m_typeSlots[it->first] : nullptr;
+                if (slot != nullptr && (slot->userType == nullptr
+                    || assemblyNames->find(slot->userAssemblyName) == assemblyNames->end()))
+                {
+                    ++it;
+                    continue;
+                }
+            }
+
+            for (Coral::ManagedObject& instance : it->second.instances)
+            {
+                instance.Destroy();
+            }
+            it = m_instancePools.erase(it);
+        }
     }
 
     Coral::ManagedObject CoralHostManager::CreateInstance(Coral::Type& type)
@@ -504,6 +1167,20 @@ namespace O3DESharp
         return m_userAssembly;
     }
 
+    AZStd::vector<AZStd::string> CoralHostManager::GetUserAssemblyNames() const
+    {
+        AZStd::vector<AZStd::string> names;
+        names.reserve(m_userRecords.size());
+        for (const auto& record : m_userRecords)
+        {
+            if (record->assembly != nullptr && !record->name.empty())
+            {
+                names.push_back(record->name);
+            }
+        }
+        return names;
+    }
+
     bool CoralHostManager::LoadCoreAssembly()
     {
         if (m_config.coreApiAssemblyPath.empty())
@@ -544,6 +1221,7 @@ namespace O3DESharp
         }
 
         m_coreAssembly = &assembly;
+        ReadFileStamp(m_config.coreApiAssemblyPath, m_coreFileSize, m_coreFileModTime);
 
         // Debug: Log detailed assembly info
         AZLOG_INFO("CoralHostManager: Core API assembly loaded:");
@@ -607,40 +1285,209 @@ namespace O3DESharp
         size_t failed = 0;
         for (const AZStd::string& assemblyPath : toLoad)
         {
-            AZLOG_INFO("CoralHostManager: Loading user assembly: %s", assemblyPath.c_str());
-
-            if (!AZ::IO::FileIOBase::GetInstance()->Exists(assemblyPath.c_str()))
+            bool alreadyLoaded = false;
+            for (const auto& record : m_userRecords)
+            {
+                alreadyLoaded = alreadyLoaded || record->path == assemblyPath;
+            }
+            if (alreadyLoaded)
             {
-                AZLOG_ERROR("CoralHostManager: User assembly not found: %s", assemblyPath.c_str());
-                ++failed;
                 continue;
             }
 
-            // NOTE: O3DE.Core.dll is already loaded in the same unified context
-            // (m_userContext == m_coreContext), so the user assembly can resolve
-            // its O3DE.Core dependency automatically.
-            Coral::ManagedAssembly& assembly = m_userContext.LoadAssembly(std::string(assemblyPath.c_str()));
+            AZLOG_INFO("CoralHostManager: Loading user assembly: %s", assemblyPath.c_str());
 
-            if (assembly.GetLoadStatus() != Coral::AssemblyLoadStatus::Success)
+            // Kept even if the load fails, so the next hot reload retries it.
+            auto record = AZStd::make_unique<UserAssemblyRecord>();
+            record->path = assemblyPath;
+            if (LoadUserAssemblyRecord(*record))
+            {
+                AZLOG_INFO("CoralHostManager: User assembly loaded: %s", record->name.c_str());
+                ++loaded;
+            }
+            else
             {
-                AZLOG_ERROR("CoralHostManager: Failed to load user assembly: %s", assemblyPath.c_str());
                 ++failed;
-                continue;
             }
-
-            m_userAssemblies.push_back(&assembly);
-            AZLOG_INFO("CoralHostManager: User assembly loaded: %s", assembly.GetName().data());
-            ++loaded;
+            m_userRecords.push_back(AZStd::move(record));
         }
 
         // Keep m_userAssembly pointing at the first loaded assembly for back-compat
         // with anything that still calls GetUserAssembly().
-        m_userAssembly = m_userAssemblies.empty() ? nullptr : m_userAssemblies.front();
+        RebuildUserAssemblyList();
+        RefreshUserAssemblyReferences();
 
         AZLOG_INFO("CoralHostManager: Loaded %zu user assembly(ies), %zu failed", loaded, failed);
         return loaded > 0 || failed == 0;
     }
 
+    bool CoralHostManager::LoadUserAssemblyRecord(UserAssemblyRecord& record)
+    {
+        record.assembly = nullptr;
+        record.references.clear();
+
+        if (!AZ::IO::FileIOBase::GetInstance()->Exists(record.path.c_str()))
+        {
+            AZLOG_ERROR("CoralHostManager: User assembly not found: %s", record.path.c_str());
+            return false;
+        }
+        ReadFileStamp(record.path, record.fileSize, record.fileModTime);
+
+        Coral::AssemblyLoadContext* context = &m_coreContext;
+        if (m_config.isolateUserAssemblies)
+        {
+            // Unique per load: the previous context for this file may still
+            // be draining after its Unload.
+            const AZ::IO::PathView fileName = AZ::IO::PathView(record.path).Stem();
+            record.contextName = AZStd::string::format("O3DEUser.%.*s.%u",
+                AZ_STRING_ARG(fileName.Native()), ++m_contextGeneration);
+            record.context = m_hostInstance->CreateAssemblyLoadContext(
+                std::string_view(record.contextName.c_str(), record.contextName.size()));
+            context = &record.context;
+        }
+        else
+        {
+            // O3DE.Core is already loaded in this same context, so the user
+            // assembly resolves its O3DE.Core dependency directly.
+            record.contextName = "O3DEContext";
+        }
+
+        Coral::ManagedAssembly& assembly = context->LoadAssembly(std::string(record.path.c_str()));
+        if (assembly.GetLoadStatus() != Coral::AssemblyLoadStatus::Success)
+        {
+            AZLOG_ERROR("CoralHostManager: Failed to load user assembly: %s", record.path.c_str());
+            if (m_config.isolateUserAssemblies)
+            {
+                m_hostInstance->UnloadAssemblyLoadContext(record.context);
+            }
+            return false;
+        }
+
+        record.assembly = &assembly;
+        record.name = AZStd::string(assembly.GetName().data(), assembly.GetName().size());
+        return true;
+    }
+
+    void CoralHostManager::UnloadUserAssemblyRecord(UserAssemblyRecord& record)
+    {
+        if (record.assembly == nullptr)
+        {
+            return;
+        }
+        if (m_config.isolateUserAssemblies)
+        {
+            m_hostInstance->UnloadAssemblyLoadContext(record.context);
+        }
+        record.assembly = nullptr;
+    }
+
+    bool CoralHostManager::CoreResolvesFromIsolatedContext()
+    {
+        Coral::Type& helper = m_coreAssembly->GetLocalType("O3DE.Core.HotReload.AssemblyReferences");
+        if (!helper)
+        {
+            AZLOG_WARN("CoralHostManager: O3DE.Core has no AssemblyReferences helper; cannot check cross-context resolution");
+            return false;
+        }
+
+        // A throwaway context set up exactly like a user assembly's.
+        const AZStd::string probeName = AZStd::string::format("O3DEUser.Probe.%u", ++m_contextGeneration);
+        Coral::AssemblyLoadContext probe =
+            m_hostInstance->CreateAssemblyLoadContext(std::string_view(probeName.c_str(), probeName.size()));
+
+        bool resolves = false;
+        try
+        {
+            Coral::ScopedString contextName = Coral::String::New(probeName.c_str());
+            resolves = helper.InvokeStaticMethod<AZ::s32>("ResolvesSharedCore", contextName) != 0;
+        }
+        catch (...)
+        {
+            AZLOG_WARN("CoralHostManager: Cross-context resolution check threw");
+        }
+
+        m_hostInstance->UnloadAssemblyLoadContext(probe);
+        return resolves;
+    }
+
+    void CoralHostManager::RefreshUserAssemblyReferences()
+    {
+        if (!m_config.isolateUserAssemblies || m_coreAssembly == nullptr)
+        {
+            return;
+        }
+
+        Coral::Type& helper = m_coreAssembly->GetLocalType("O3DE.Core.HotReload.AssemblyReferences");
+        for (auto& record : m_userRecords)
+        {
+            record->references.clear();
+            if (record->assembly == nullptr)
+            {
+                continue;
+            }
+
+            if (!helper)
+            {
+                // Older O3DE.Core without the helper: assume every user
+                // assembly references every other, which reloads all of them
+                // (still without touching O3DE.Core).
+                for (const auto& other : m_userRecords)
+                {
+                    if (other.get() != record.get() && !other->name.empty())
+                    {
+                        record->references.push_back(other->name);
+                    }
+                }
+                continue;
+            }
+
+            AZStd::string joined;
+            try
+            {
+                Coral::ScopedString contextName = Coral::String::New(record->contextName.c_str());
+                Coral::ScopedString assemblyName = Coral::String::New(record->name.c_str());
+                Coral::String result = helper.InvokeStaticMethod<Coral::String>(
+                    "GetReferencedAssemblyNames", contextName, assemblyName);
+                if (result.Data() != nullptr)
+                {
+                    std::string utf8 = static_cast<std::string>(result);
+                    joined = AZStd::string(utf8.c_str(), utf8.size());
+                }
+            }
+            catch (...)
+            {
+                AZLOG_WARN("CoralHostManager: Could not read references of '%s'", record->name.c_str());
+            }
+
+            AZ::StringFunc::TokenizeVisitor(joined,
+                [this, &record](AZStd::string_view reference)
+                {
+                    for (const auto& other : m_userRecords)
+                    {
+                        if (other.get() != record.get() && other->name == reference)
+                        {
+                            record->references.emplace_back(reference);
+                            return;
+                        }
+                    }
+                },
+                ';');
+        }
+    }
+
+    void CoralHostManager::RebuildUserAssemblyList()
+    {
+        m_userAssemblies.clear();
+        for (const auto& record : m_userRecords)
+        {
+            if (record->assembly != nullptr)
+            {
+                m_userAssemblies.push_back(record->assembly);
+            }
+        }
+        m_userAssembly = m_userAssemblies.empty() ? nullptr : m_userAssemblies.front();
+    }
+
     bool CoralHostManager::LoadUserAssembly()
     {
         // Legacy single-assembly entry point. Delegate to the multi-assembly loader
@@ -11,6 +11,7 @@
 #include <AzCore/base.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Memory/SystemAllocator.h>
@@ -38,6 +39,12 @@ namespace O3DESharp
         AZStd::vector<AZStd::string> userAssemblyPaths;  // Paths to all user game assemblies to load
         AZStd::string coreApiAssemblyPath;      // Path to O3DE.Core.dll (our API)
         bool enableHotReload = true;            // Enable assembly hot-reloading
+        bool isolateUserAssemblies = false;     // Load each user assembly into its own unloadable context
+                                                // so a reload only touches what changed. Needs a Coral.Managed
+                                                // that resolves O3DE.Core across contexts; Initialize checks
+                                                // for it and falls back to one shared context with an error.
+        bool enableInstancePooling = true;      // Pool instances of [PooledScript] classes across activations
+        AZ::u32 maxPooledInstancesPerType = 256; // Cap on any class's [PooledScript] MaxInstances
     };
 
     /**
@@ -54,6 +61,36 @@ namespace O3DESharp
         AlreadyInitialized
     };
 
+    /**
+     * Small handle to a script type, from ICoralHostManager::ResolveScriptType.
+     * Cheap to store and compare; ICoralHostManager::GetType turns it back
+     * into a Coral::Type*, or nullptr once the type's assembly has been
+     * reloaded since the handle was resolved.
+     */
+    struct ScriptTypeHandle
+    {
+        static constexpr AZ::u32 InvalidIndex = 0xFFFFFFFFu;
+
+        AZ::u32 index = InvalidIndex;   // slot in the host's type index
+        AZ::u32 generation = 0;         // load generation the slot was bound in
+
+        bool IsValid() const { return index != InvalidIndex; }
+    };
+
+    /**
+     * Counters of one script class's instance pool, or of every pool
+     * together (ICoralHostManager::GetScriptPoolStats with an invalid handle).
+     */
+    struct ScriptPoolStats
+    {
+        AZ::u64 hits = 0;           // activations served from the pool
+        AZ::u64 misses = 0;         // activations of a pooled class that found the pool empty
+        AZ::u64 returns = 0;        // deactivated instances parked in the pool
+        AZ::u64 discards = 0;       // deactivated instances released: pool full or OnReset threw
+        AZ::u32 pooled = 0;         // instances parked right now
+        AZ::u32 capacity = 0;       // effective MaxInstances (0 = not pooled / not yet known)
+    };
+
     /**
      * Interface for the Coral Host Manager - allows other systems to interact with C# scripting
      */
@@ -89,11 +126,38 @@ namespace O3DESharp
         virtual Coral::ManagedAssembly* LoadAssembly(const AZStd::string& assemblyPath) = 0;
 
         /**
-         * Reload user assemblies (for hot-reload support)
+         * Reload user assemblies (for hot-reload support). Equivalent to
+         * ReloadChangedUserAssemblies({}).
          * @return true if reload was successful
          */
         virtual bool ReloadUserAssemblies() = 0;
 
+        /**
+         * Reload only the user assemblies in changedAssemblyPaths plus every
+         * user assembly that (transitively) references one of them. O3DE.Core
+         * stays loaded, with its internal calls registered, unless it is in the
+         * set itself. When changedAssemblyPaths is empty the changed set is
+         * detected from file size / modification time; if nothing looks
+         * changed every user assembly is reloaded.
+         * @return true if every reloaded assembly loaded again
+         */
+        virtual bool ReloadChangedUserAssemblies(const AZStd::vector<AZStd::string>& changedAssemblyPaths) = 0;
+
+        /**
+         * Between OnBeforeUserAssemblyReload and OnAfterUserAssemblyReload:
+         * whether the user type fullTypeName is being unloaded by this reload.
+         * Holders of a Coral::Type* / ManagedObject for a type that is not
+         * reloading can keep them. Always true during a full reload and for
+         * types this manager never resolved.
+         */
+        virtual bool IsUserTypeReloading(const AZStd::string& fullTypeName) const = 0;
+
+        /**
+         * Full names of every O3DE.ScriptComponent subclass in the loaded
+         * user assemblies, from the type index. Abstract classes included.
+         */
+        virtual AZStd::vector<AZStd::string> GetUserScriptTypeNames() = 0;
+
         /**
          * Get a type from the core API assembly
          * @param fullTypeName Fully qualified type name (e.g., "O3DE.Entity")
@@ -108,6 +172,45 @@ namespace O3DESharp
          */
         virtual Coral::Type* GetUserType(const AZStd::string& fullTypeName) = 0;
 
+        /**
+         * Resolve a script class the way script components do: user
+         * assemblies first, then O3DE.Core. A single probe into the type
+         * index; misses are cached too, until the next load.
+         * @return An invalid handle if no loaded assembly defines the type
+         */
+        virtual ScriptTypeHandle ResolveScriptType(const AZStd::string& fullTypeName) = 0;
+
+        /**
+         * The type a handle refers to. O(1).
+         * @return nullptr if the handle is invalid or stale (the type was
+         *         reloaded or unloaded since it was resolved)
+         */
+        virtual Coral::Type* GetType(ScriptTypeHandle handle) const = 0;
+
+        /**
+         * Take a parked instance of a [PooledScript] class. It was reset by
+         * ScriptComponent.ResetForPool and needs its entity id, exposed
+         * properties and OnCreate like a newly created one.
+         * @return An invalid object if the pool is empty, the class isn't
+         *         pooled, pooling is disabled or the handle is stale
+         */
+        virtual Coral::ManagedObject AcquirePooledInstance(ScriptTypeHandle type) = 0;
+
+        /**
+         * Offer a deactivated instance (OnDestroy already called) to its
+         * class's pool. The first instance offered tells whether the class
+         * is pooled at all.
+         * @return true if the pool took the instance, which is then left
+         *         empty; false if the caller still owns it and should destroy it
+         */
+        virtual bool ReleaseToPool(ScriptTypeHandle type, Coral::ManagedObject& instance) = 0;
+
+        /**
+         * Pool counters for one class, or summed over every pool when the
+         * handle is invalid.
+         */
+        virtual ScriptPoolStats GetScriptPoolStats(ScriptTypeHandle type) const = 0;
+
         /**
          * Create an instance of a managed type
          * @param type The type to instantiate
@@ -124,6 +227,11 @@ namespace O3DESharp
          * Get the user game assembly
          */
         virtual Coral::ManagedAssembly* GetUserAssembly() = 0;
+
+        /**
+         * Simple names of every loaded user assembly, in load order
+         */
+        virtual AZStd::vector<AZStd::string> GetUserAssemblyNames() const = 0;
     };
 
     using CoralHostManagerInterface = AZ::Interface<ICoralHostManager>;
@@ -154,13 +262,38 @@ namespace O3DESharp
         bool IsInitialized() const override;
         Coral::ManagedAssembly* LoadAssembly(const AZStd::string& assemblyPath) override;
         bool ReloadUserAssemblies() override;
+        bool ReloadChangedUserAssemblies(const AZStd::vector<AZStd::string>& changedAssemblyPaths) override;
+        bool IsUserTypeReloading(const AZStd::string& fullTypeName) const override;
+        AZStd::vector<AZStd::string> GetUserScriptTypeNames() override;
         Coral::Type* GetCoreType(const AZStd::string& fullTypeName) override;
         Coral::Type* GetUserType(const AZStd::string& fullTypeName) override;
+        ScriptTypeHandle ResolveScriptType(const AZStd::string& fullTypeName) override;
+        Coral::Type* GetType(ScriptTypeHandle handle) const override;
+        Coral::ManagedObject AcquirePooledInstance(ScriptTypeHandle type) override;
+        bool ReleaseToPool(ScriptTypeHandle type, Coral::ManagedObject& instance) override;
+        ScriptPoolStats GetScriptPoolStats(ScriptTypeHandle type) const override;
         Coral::ManagedObject CreateInstance(Coral::Type& type) override;
         Coral::ManagedAssembly* GetCoreAssembly() override;
         Coral::ManagedAssembly* GetUserAssembly() override;
+        AZStd::vector<AZStd::string> GetUserAssemblyNames() const override;
+
+        //! True if the most recent reload also reloaded O3DE.Core, i.e. internal
+        //! calls had to be registered again.
+        bool LastReloadIncludedCore() const { return m_lastReloadIncludedCore; }
 
     private:
+        // One loaded user assembly and the context it lives in.
+        struct UserAssemblyRecord
+        {
+            AZStd::string path;
+            AZStd::string name;                         // simple assembly name, as reported by Coral
+            AZStd::string contextName;
+            Coral::AssemblyLoadContext context;         // own context (isolateUserAssemblies only)
+            Coral::ManagedAssembly* assembly = nullptr;
+            AZStd::vector<AZStd::string> references;    // names of the *user* assemblies this one references
+            AZ::u64 fileSize = 0;                       // file stamp at load, for change detection
+            AZ::u64 fileModTime = 0;
+        };
         // Coral message callback for logging
         static void CoralMessageCallback(std::string_view message, Coral::MessageLevel level);
         
@@ -175,6 +308,28 @@ namespace O3DESharp
         // was loaded successfully, or if no user assemblies were configured.
         bool LoadUserAssemblies();
 
+        // (Re)load record.path into a fresh context. Leaves record.assembly null
+        // on failure.
+        bool LoadUserAssemblyRecord(UserAssemblyRecord& record);
+
+        // Unload the context of record (no-op in shared-context mode).
+        void UnloadUserAssemblyRecord(UserAssemblyRecord& record);
+
+        // Whether O3DE.Core, resolved from a fresh user context, is the instance
+        // already loaded in m_coreContext. isolateUserAssemblies needs this.
+        bool CoreResolvesFromIsolatedContext();
+
+        // Ask O3DE.Core which assemblies each loaded user assembly references,
+        // keeping only names that are themselves user assemblies.
+        void RefreshUserAssemblyReferences();
+
+        // Rebuild m_userAssemblies / m_userAssembly from m_userRecords.
+        void RebuildUserAssemblyList();
+
+        // Unload everything, recreate contexts, reload O3DE.Core and every user
+        // assembly, re-register internal calls. The pre-isolation behaviour.
+        bool FullReload();
+
         // Legacy single-assembly variant. Loads m_config.userAssemblyPath.
         // Prefer LoadUserAssemblies() in new code.
         bool LoadUserAssembly();
@@ -182,6 +337,37 @@ namespace O3DESharp
         // Register all internal calls (C++ functions callable from C#)
         void RegisterInternalCalls();
 
+        // One name in the merged type index.
+        struct TypeIndexSlot
+        {
+            AZStd::string name;
+            Coral::Type* userType = nullptr;
+            Coral::Type* coreType = nullptr;
+            AZStd::string userAssemblyName;     // assembly userType came from
+            AZ::u32 generation = 0;             // m_loadGeneration when the types last changed; 0 = unbound
+            AZ::u32 probedGeneration = 0;       // m_loadGeneration the slot is known good for, misses included
+        };
+
+        // Start a new load generation and index every type of O3DE.Core and
+        // of each loaded user assembly (first user assembly wins on clashes).
+        // Called once after every (re)load.
+        void RebuildTypeIndex();
+
+        // Unbind the slots whose user type comes from an assembly in
+        // assemblyNames (or every slot, core types included, if null) so
+        // handles to them go stale even if Coral reuses the addresses.
+        void UnbindTypes(const AZStd::unordered_set<AZStd::string>* assemblyNames);
+
+        // Slot for fullTypeName, valid for the current generation. Names the
+        // index doesn't know yet are probed once with GetLocalType; probed is
+        // set when that happened, so callers can warn once per miss.
+        TypeIndexSlot& FindTypeSlot(const AZStd::string& fullTypeName, bool& probed);
+
+        // Destroy the parked instances of every class from an assembly in
+        // assemblyNames (every pool if null). Must run before those
+        // assemblies' contexts unload.
+        void ClearInstancePools(const AZStd::unordered_set<AZStd::string>* assemblyNames);
+
     private:
         bool m_initialized = false;
         CoralHostConfig m_config;
@@ -189,14 +375,29 @@ namespace O3DESharp
         // The Coral host instance - manages the .NET runtime
         AZStd::unique_ptr<Coral::HostInstance> m_hostInstance;
 
-        // Assembly load context for core assemblies (O3DE.Core.dll)
+        // Assembly load context for core assemblies (O3DE.Core.dll). Only
+        // unloaded on shutdown or when O3DE.Core itself changes. In shared-
+        // context mode the user assemblies live here too.
         Coral::AssemblyLoadContext m_coreContext;
 
-        // Assembly load context for user assemblies (for hot-reload, we can unload this)
-        Coral::AssemblyLoadContext m_userContext;
-
         // Cached pointers to our assemblies
         Coral::ManagedAssembly* m_coreAssembly = nullptr;
+        AZ::u64 m_coreFileSize = 0;
+        AZ::u64 m_coreFileModTime = 0;
+
+        // Every user assembly, in load order. unique_ptr so Coral's
+        // ManagedAssembly pointers into each record's context stay put.
+        AZStd::vector<AZStd::unique_ptr<UserAssemblyRecord>> m_userRecords;
+
+        // Bumped on every context creation so each user context gets a unique
+        // name (an unloading context can linger until the GC collects it).
+        AZ::u32 m_contextGeneration = 0;
+
+        // Reload scope, valid while the Before/After notifications are out
+        bool m_reloadInProgress = false;
+        bool m_fullReloadInProgress = false;
+        AZStd::unordered_set<AZStd::string> m_reloadingAssemblies;
+        bool m_lastReloadIncludedCore = false;
 
         // All user assemblies currently loaded. m_userAssembly (below) is kept as a
         // convenience pointer to the first one so existing single-assembly APIs keep
@@ -204,9 +405,23 @@ namespace O3DESharp
         AZStd::vector<Coral::ManagedAssembly*> m_userAssemblies;
         Coral::ManagedAssembly* m_userAssembly = nullptr;
 
-        // Type cache for faster lookups
-        AZStd::unordered_map<AZStd::string, Coral::Type*> m_coreTypeCache;
-        AZStd::unordered_map<AZStd::string, Coral::Type*> m_userTypeCache;
+        // Merged core + user type index, rebuilt after every load. Slots are
+        // only dropped on shutdown, so a handle's index stays meaningful; its
+        // generation tells whether the slot still holds the same types.
+        AZStd::vector<TypeIndexSlot> m_typeSlots;
+        AZStd::unordered_map<AZStd::string, AZ::u32> m_typeIndex;
+        AZ::u32 m_loadGeneration = 0;
+
+        // Parked instances of [PooledScript] classes, keyed by type slot.
+        // capacity is -1 until the first ReleaseToPool asks the class.
+        struct ScriptInstancePool
+        {
+            AZ::u32 generation = 0;     // slot generation the instances belong to
+            AZ::s32 capacity = -1;
+            AZStd::vector<Coral::ManagedObject> instances;
+            ScriptPoolStats stats;
+        };
+        AZStd::unordered_map<AZ::u32, ScriptInstancePool> m_instancePools;
     };
 
 } // namespace O3DESharp
\ No newline at end of file
@@ -0,0 +1,489 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ExposedPropertyBlock.h"
+
+#include <O3DESharp/O3DESharpBus.h>
+
+#include <AzCore/JSON/document.h>
+#include <AzCore/JSON/rapidjson.h>
+#include <AzCore/Serialization/Locale.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/mutex.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+namespace O3DESharp
+{
+    namespace ExposedPropertyBlock
+    {
+        namespace
+        {
+            constexpr AZ::u32 FnvOffsetBasis = 2166136261u;
+            constexpr AZ::u32 FnvPrime = 16777619u;
+
+            AZ::u32 Fnv1a(AZ::u32 hash, const void* data, size_t size)
+            {
+                const auto* bytes = static_cast<const AZ::u8*>(data);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    hash ^= bytes[i];
+                    hash *= FnvPrime;
+                }
+                return hash;
+            }
+
+            // Bounds the per-class cache; a class rarely has more than a handful
+            // of distinct configurations in one level.
+            constexpr size_t MaxCachedBlocksPerClass = 32;
+
+            struct CachedBlock
+            {
+                AZ::u64 valuesHash = 0;         // HashValues(values)
+                AZStd::unordered_map<AZStd::string, AZStd::string> values;
+                AZStd::vector<AZ::u8> block;    // empty: this map can't be encoded, use the string path
+            };
+
+            struct ClassCache
+            {
+                bool schemaResolved = false;
+                AZStd::vector<SchemaField> schema;
+                AZStd::vector<CachedBlock> blocks;
+            };
+
+            // Only held for lookups and inserts - never across the schema
+            // query, which constructs a managed instance that may call back
+            // in here.
+            AZStd::mutex s_cacheMutex;
+            AZStd::unordered_map<AZStd::string, ClassCache> s_cache;
+            AZ::u64 s_cacheGeneration = 0;      // Bumped by ClearCache
+
+            // Order-independent hash of a value map: the sum of each entry's
+            // mixed FNV-1a. Equal maps hash equal whatever their bucket order.
+            AZ::u64 HashValues(const AZStd::unordered_map<AZStd::string, AZStd::string>& values)
+            {
+                AZ::u64 hash = values.size();
+                for (const auto& [name, value] : values)
+                {
+                    const char separator = '\0';
+                    AZ::u32 entry = Fnv1a(FnvOffsetBasis, name.data(), name.size());
+                    entry = Fnv1a(entry, &separator, sizeof(separator));
+                    entry = Fnv1a(entry, value.data(), value.size());
+                    hash += (static_cast<AZ::u64>(entry) + 1) * 0x9E3779B97F4A7C15ull;
+                }
+                return hash;
+            }
+
+            bool IsSpace(char c)
+            {
+                return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+            }
+
+            // .NET's invariant-culture Parse accepts surrounding whitespace;
+            // the strto* family only skips leading whitespace, so check the
+            // tail ourselves.
+            bool OnlySpaceAfter(const char* end)
+            {
+                while (*end != '\0')
+                {
+                    if (!IsSpace(*end))
+                    {
+                        return false;
+                    }
+                    ++end;
+                }
+                return true;
+            }
+
+            bool ParseSigned(const AZStd::string& raw, AZ::s64 minValue, AZ::s64 maxValue, AZ::s64& out)
+            {
+                errno = 0;
+                char* end = nullptr;
+                const long long value = strtoll(raw.c_str(), &end, 10);
+                if (end == raw.c_str() || errno == ERANGE || !OnlySpaceAfter(end) || value < minValue || value > maxValue)
+                {
+                    return false;
+                }
+                out = value;
+                return true;
+            }
+
+            bool ParseUnsigned(const AZStd::string& raw, AZ::u64 maxValue, AZ::u64& out)
+            {
+                // strtoull silently wraps negative input
+                if (raw.find('-') != AZStd::string::npos)
+                {
+                    return false;
+                }
+                errno = 0;
+                char* end = nullptr;
+                const unsigned long long value = strtoull(raw.c_str(), &end, 10);
+                if (end == raw.c_str() || errno == ERANGE || !OnlySpaceAfter(end) || value > maxValue)
+                {
+                    return false;
+                }
+                out = value;
+                return true;
+            }
+
+            bool ParseBool(const AZStd::string& raw, bool& out)
+            {
+                size_t begin = 0;
+                size_t end = raw.size();
+                while (begin < end && IsSpace(raw[begin]))
+                {
+                    ++begin;
+                }
+                while (end > begin && IsSpace(raw[end - 1]))
+                {
+                    --end;
+                }
+                const AZStd::string_view trimmed(raw.data() + begin, end - begin);
+                if (trimmed.size() == 4 && azstrnicmp(trimmed.data(), "true", 4) == 0)
+                {
+                    out = true;
+                    return true;
+                }
+                if (trimmed.size() == 5 && azstrnicmp(trimmed.data(), "false", 5) == 0)
+                {
+                    out = false;
+                    return true;
+                }
+                return false;
+            }
+
+            template<typename T>
+            void Append(AZStd::vector<AZ::u8>& out, const T& value)
+            {
+                const size_t offset = out.size();
+                out.resize(offset + sizeof(T));
+                memcpy(out.data() + offset, &value, sizeof(T));
+            }
+
+            template<typename T>
+            void AppendEntry(AZStd::vector<AZ::u8>& out, AZ::u32 nameHash, ValueType type, const T& value)
+            {
+                EntryHeader entry;
+                entry.nameHash = nameHash;
+                entry.type = static_cast<AZ::u8>(type);
+                entry.payloadSize = static_cast<AZ::u16>(sizeof(T));
+                Append(out, entry);
+                Append(out, value);
+            }
+
+            bool AppendConverted(AZStd::vector<AZ::u8>& out, AZ::u32 nameHash, ValueType type, const AZStd::string& raw)
+            {
+                AZ::s64 s = 0;
+                AZ::u64 u = 0;
+                switch (type)
+                {
+                case ValueType::Bool:
+                {
+                    bool b = false;
+                    if (!ParseBool(raw, b))
+                    {
+                        return false;
+                    }
+                    AppendEntry(out, nameHash, type, static_cast<AZ::u8>(b ? 1 : 0));
+                    return true;
+                }
+                case ValueType::Byte:
+                    if (!ParseUnsigned(raw, AZStd::numeric_limits<AZ::u8>::max(), u)) return false;
+                    AppendEntry(out, nameHash, type, static_cast<AZ::u8>(u));
+                    return true;
+                case ValueType::SByte:
+                    if (!ParseSigned(raw, AZStd::numeric_limits<AZ::s8>::min(), AZStd::numeric_limits<AZ::s8>::max(), s)) return false;
+                    AppendEntry(out, nameHash, type, static_cast<AZ::s8>(s));
+                    return true;
+                case ValueType::Int16:
+                    if (!ParseSigned(raw, AZStd::numeric_limits<AZ::s16>::min(), AZStd::numeric_limits<AZ::s16>::max(), s)) return false;
+                    AppendEntry(out, nameHash, type, static_cast<AZ::s16>(s));
+                    return true;
+                case ValueType::UInt16:
+                    if (!ParseUnsigned(raw, AZStd::numeric_limits<AZ::u16>::max(), u)) return false;
+                    AppendEntry(out, nameHash, type, static_cast<AZ::u16>(u));
+                    return true;
+                case ValueType::Int32:
+                    if (!ParseSigned(raw, AZStd::numeric_limits<AZ::s32>::min(), AZStd::numeric_limits<AZ::s32>::max(), s)) return false;
+                    AppendEntry(out, nameHash, type, static_cast<AZ::s32>(s));
+                    return true;
+                case ValueType::UInt32:
+                    if (!ParseUnsigned(raw, AZStd::numeric_limits<AZ::u32>::max(), u)) return false;
+                    AppendEntry(out, nameHash, type, static_cast<AZ::u32>(u));
+                    return true;
+                case ValueType::Int64:
+                    if (!ParseSigned(raw, AZStd::numeric_limits<AZ::s64>::min(), AZStd::numeric_limits<AZ::s64>::max(), s)) return false;
+                    AppendEntry(out, nameHash, type, s);
+                    return true;
+                case ValueType::UInt64:
+                    if (!ParseUnsigned(raw, AZStd::numeric_limits<AZ::u64>::max(), u)) return false;
+                    AppendEntry(out, nameHash, type, u);
+                    return true;
+                case ValueType::Float:
+                case ValueType::Double:
+                {
+                    // Values are written by ExposedPropertyHelpers.SerializeValue
+                    // with the invariant culture; make sure a user locale with
+                    // a ',' decimal separator can't change how they read back.
+                    AZ::Locale::ScopedSerializationLocale scopedLocale;
+                    errno = 0;
+                    char* end = nullptr;
+                    if (type == ValueType::Float)
+                    {
+                        const float f = strtof(raw.c_str(), &end);
+                        if (end == raw.c_str() || !OnlySpaceAfter(end))
+                        {
+                            return false;
+                        }
+                        AppendEntry(out, nameHash, type, f);
+                    }
+                    else
+                    {
+                        const double d = strtod(raw.c_str(), &end);
+                        if (end == raw.c_str() || !OnlySpaceAfter(end))
+                        {
+                            return false;
+                        }
+                        AppendEntry(out, nameHash, type, d);
+                    }
+                    return true;
+                }
+                case ValueType::String:
+                {
+                    if (raw.size() > AZStd::numeric_limits<AZ::u16>::max())
+                    {
+                        return false;
+                    }
+                    EntryHeader entry;
+                    entry.nameHash = nameHash;
+                    entry.type = static_cast<AZ::u8>(type);
+                    entry.payloadSize = static_cast<AZ::u16>(raw.size());
+                    Append(out, entry);
+                    out.insert(out.end(), raw.begin(), raw.end());
+                    return true;
+                }
+                default:
+                    return false;
+                }
+            }
+        } // namespace
+
+        ValueType ValueTypeFromTag(AZStd::string_view typeTag)
+        {
+            if (typeTag == "bool")   return ValueType::Bool;
+            if (typeTag == "byte")   return ValueType::Byte;
+            if (typeTag == "sbyte")  return ValueType::SByte;
+            if (typeTag == "short")  return ValueType::Int16;
+            if (typeTag == "ushort") return ValueType::UInt16;
+            if (typeTag == "int")    return ValueType::Int32;
+            if (typeTag == "uint")   return ValueType::UInt32;
+            if (typeTag == "long")   return ValueType::Int64;
+            if (typeTag == "ulong")  return ValueType::UInt64;
+            if (typeTag == "float")  return ValueType::Float;
+            if (typeTag == "double") return ValueType::Double;
+            if (typeTag == "string") return ValueType::String;
+            return ValueType::Invalid;
+        }
+
+        AZ::u32 HashName(AZStd::string_view name)
+        {
+            return Fnv1a(FnvOffsetBasis, name.data(), name.size());
+        }
+
+        AZStd::vector<SchemaField> ParseSchema(const AZStd::string& schemaJson)
+        {
+            AZStd::vector<SchemaField> result;
+            if (schemaJson.empty() || schemaJson == "[]")
+            {
+                return result;
+            }
+
+            rapidjson::Document doc;
+            doc.Parse(schemaJson.c_str());
+            if (doc.HasParseError() || !doc.IsArray())
+            {
+                return result;
+            }
+
+            result.reserve(doc.Size());
+            for (rapidjson::SizeType i = 0; i < doc.Size(); ++i)
+            {
+                const auto& obj = doc[i];
+                if (!obj.IsObject() || !obj.HasMember("name") || !obj["name"].IsString())
+                {
+                    continue;
+                }
+
+                SchemaField field;
+                field.name.assign(obj["name"].GetString(), obj["name"].GetStringLength());
+                if (obj.HasMember("type") && obj["type"].IsString())
+                {
+                    field.type = ValueTypeFromTag(AZStd::string_view(obj["type"].GetString(), obj["type"].GetStringLength()));
+                }
+                result.push_back(AZStd::move(field));
+            }
+            return result;
+        }
+
+        bool BuildFromStrings(
+            const AZStd::vector<SchemaField>& schema,
+            const AZStd::unordered_map<AZStd::string, AZStd::string>& values,
+            AZStd::vector<AZ::u8>& out)
+        {
+            out.clear();
+
+            AZStd::vector<AZ::u8> block;
+            block.resize(sizeof(Header));
+
+            Header header;
+            header.layoutHash = FnvOffsetBasis;
+
+            // Schema order rather than map order, so identical configs always
+            // produce identical blocks (and share a managed apply plan).
+            for (const SchemaField& field : schema)
+            {
+                auto it = values.find(field.name);
+                if (it == values.end())
+                {
+                    continue;
+                }
+                if (header.count == AZStd::numeric_limits<AZ::u16>::max())
+                {
+                    return false;
+                }
+
+                const AZ::u32 nameHash = HashName(field.name);
+                if (!AppendConverted(block, nameHash, field.type, it->second))
+                {
+                    return false;
+                }
+
+                const AZ::u8 type = static_cast<AZ::u8>(field.type);
+                header.layoutHash = Fnv1a(header.layoutHash, &nameHash, sizeof(nameHash));
+                header.layoutHash = Fnv1a(header.layoutHash, &type, sizeof(type));
+                ++header.count;
+            }
+
+            header.size = static_cast<AZ::u32>(block.size());
+            memcpy(block.data(), &header, sizeof(Header));
+            out = AZStd::move(block);
+            return true;
+        }
+
+        bool IsValid(const AZStd::vector<AZ::u8>& block)
+        {
+            if (block.size() < sizeof(Header))
+            {
+                return false;
+            }
+            Header header;
+            memcpy(&header, block.data(), sizeof(Header));
+            return header.magic == Magic && header.version == CurrentVersion && header.size == block.size();
+        }
+
+        bool GetOrBuildForScript(
+            const AZStd::string& scriptClassName,
+            const AZStd::unordered_map<AZStd::string, AZStd::string>& values,
+            AZStd::vector<AZ::u8>& out)
+        {
+            out.clear();
+            if (scriptClassName.empty() || values.empty())
+            {
+                return false;
+            }
+
+            const AZ::u64 valuesHash = HashValues(values);
+            AZ::u64 generation = 0;
+            bool schemaResolved = false;
+            AZStd::vector<SchemaField> schema;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(s_cacheMutex);
+                generation = s_cacheGeneration;
+                auto it = s_cache.find(scriptClassName);
+                if (it != s_cache.end())
+                {
+                    for (const CachedBlock& cached : it->second.blocks)
+                    {
+                        if (cached.valuesHash == valuesHash && cached.values == values)
+                        {
+                            out = cached.block;
+                            return !out.empty();
+                        }
+                    }
+                    if (it->second.schemaResolved)
+                    {
+                        schemaResolved = true;
+                        schema = it->second.schema;
+                    }
+                }
+            }
+
+            // Unlocked from here: the schema query may construct the script,
+            // and its constructor can get back here.
+            if (!schemaResolved)
+            {
+                AZStd::string schemaJson;
+                O3DESharpRequestBus::BroadcastResult(
+                    schemaJson, &O3DESharpRequests::GetExposedPropertySchemaJson, scriptClassName);
+                schema = ParseSchema(schemaJson);
+            }
+
+            // Failed conversions are cached as well so every instance of a
+            // misconfigured prefab doesn't retry the conversion.
+            const bool hasSchema = !schema.empty();
+            const bool built = hasSchema && BuildFromStrings(schema, values, out);
+
+            AZStd::lock_guard<AZStd::mutex> lock(s_cacheMutex);
+            if (generation != s_cacheGeneration)
+            {
+                // Assemblies reloaded meanwhile; the schema may be stale.
+                out.clear();
+                return false;
+            }
+
+            ClassCache& classCache = s_cache[scriptClassName];
+            if (!classCache.schemaResolved)
+            {
+                // An empty schema is cached too: the class has no exposed
+                // members (or doesn't exist), and asking again won't change
+                // that until the next reload clears the cache.
+                classCache.schema = AZStd::move(schema);
+                classCache.schemaResolved = true;
+            }
+            if (!hasSchema)
+            {
+                return false;
+            }
+
+            // Another thread may have built the same map meanwhile
+            for (const CachedBlock& cached : classCache.blocks)
+            {
+                if (cached.valuesHash == valuesHash && cached.values == values)
+                {
+                    return built;
+                }
+            }
+            if (classCache.blocks.size() >= MaxCachedBlocksPerClass)
+            {
+                classCache.blocks.erase(classCache.blocks.begin());
+            }
+            classCache.blocks.push_back({ valuesHash, values, out });
+            return built;
+        }
+
+        void ClearCache()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(s_cacheMutex);
+            s_cache.clear();
+            ++s_cacheGeneration;
+        }
+    } // namespace ExposedPropertyBlock
+
+} // namespace O3DESharp
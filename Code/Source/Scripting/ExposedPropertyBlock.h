@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace O3DESharp
+{
+    /**
+     * Typed binary form of a script's [ExposedProperty] values.
+     *
+     * CSharpScriptComponentConfig::m_exposedPropertyValues stores values as
+     * strings keyed by member name. Turning that into field values used to
+     * mean building a JSON object here and having the managed side re-parse it
+     * and convert every value from string, on every activation. The block
+     * carries the already-converted values instead, so applying it is a
+     * sequence of fixed-size reads on the managed side
+     * (ExposedPropertyHelpers.ApplyBlock).
+     *
+     * Layout (little-endian, must match ExposedPropertyBlock in ExposedProperty.cs):
+     *
+     *   Header   { u32 magic; u16 version; u16 count; u32 layoutHash; u32 size; }
+     *   count x  { u32 nameHash; u8 type; u8 reserved; u16 payloadSize; payload[payloadSize] }
+     *
+     * nameHash is FNV-1a over the member name's UTF-8 bytes. layoutHash is
+     * FNV-1a over the (nameHash, type) pairs in entry order; the managed
+     * applier resolves each distinct layout to member setters once per script
+     * type and reuses that plan for every later block with the same layout.
+     * Strings are stored as raw UTF-8; everything else as its fixed-size value.
+     *
+     * The per-type entry layout comes from the script's exposed-property
+     * schema (the same JSON the inspector uses), so building a block needs the
+     * schema; see BuildFromStrings.
+     */
+    namespace ExposedPropertyBlock
+    {
+        static constexpr AZ::u32 Magic = 0x31425045; // "EPB1"
+        static constexpr AZ::u16 CurrentVersion = 1;
+
+        // Must match ExposedPropertyBlock.ValueType in ExposedProperty.cs.
+        enum class ValueType : AZ::u8
+        {
+            Invalid = 0,
+            Bool,
+            Byte,
+            SByte,
+            Int16,
+            UInt16,
+            Int32,
+            UInt32,
+            Int64,
+            UInt64,
+            Float,
+            Double,
+            String,
+        };
+
+#pragma pack(push, 1)
+        struct Header
+        {
+            AZ::u32 magic = Magic;
+            AZ::u16 version = CurrentVersion;
+            AZ::u16 count = 0;
+            AZ::u32 layoutHash = 0;
+            AZ::u32 size = 0;           // total block size in bytes, header included
+        };
+
+        struct EntryHeader
+        {
+            AZ::u32 nameHash = 0;
+            AZ::u8 type = 0;
+            AZ::u8 reserved = 0;
+            AZ::u16 payloadSize = 0;
+        };
+#pragma pack(pop)
+
+        static_assert(sizeof(Header) == 16, "ExposedPropertyBlock::Header layout changed - update ExposedProperty.cs");
+        static_assert(sizeof(EntryHeader) == 8, "ExposedPropertyBlock::EntryHeader layout changed - update ExposedProperty.cs");
+
+        //! One exposed member as described by the script's schema.
+        struct SchemaField
+        {
+            AZStd::string name;
+            ValueType type = ValueType::Invalid;
+        };
+
+        //! Maps a schema type tag ("float", "int", ...) to its block value type.
+        //! Unsupported tags map to ValueType::Invalid.
+        ValueType ValueTypeFromTag(AZStd::string_view typeTag);
+
+        //! FNV-1a over the UTF-8 bytes of name.
+        AZ::u32 HashName(AZStd::string_view name);
+
+        //! Extract (name, type) pairs, in declaration order, from the schema
+        //! JSON returned by O3DESharpRequests::GetExposedPropertySchemaJson.
+        AZStd::vector<SchemaField> ParseSchema(const AZStd::string& schemaJson);
+
+        //! Convert the string value map into a block laid out by schema.
+        //! Names not in the schema are ignored, as the managed string path
+        //! does. Returns false (and leaves out empty) if any present value has
+        //! an unsupported type or doesn't convert; callers then fall back to
+        //! the string path, which reports the failure per member.
+        bool BuildFromStrings(
+            const AZStd::vector<SchemaField>& schema,
+            const AZStd::unordered_map<AZStd::string, AZStd::string>& values,
+            AZStd::vector<AZ::u8>& out);
+
+        //! Cheap structural check of a stored block (magic, version, size).
+        bool IsValid(const AZStd::vector<AZ::u8>& block);
+
+        //! Block for scriptClassName's values, built at most once per distinct
+        //! value map: every instance of a spawned prefab carries the same map,
+        //! so only the first activation pays for the schema lookup and string
+        //! conversion. Returns false if no schema is available (host not
+        //! running, unknown class) or conversion failed.
+        bool GetOrBuildForScript(
+            const AZStd::string& scriptClassName,
+            const AZStd::unordered_map<AZStd::string, AZStd::string>& values,
+            AZStd::vector<AZ::u8>& out);
+
+        //! Drop every cached schema and block. Called when user assemblies
+        //! reload, since the exposed members may have changed.
+        void ClearCache();
+    } // namespace ExposedPropertyBlock
+
+} // namespace O3DESharp
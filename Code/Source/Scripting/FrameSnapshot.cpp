@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "FrameSnapshot.h"
+#include "ScriptBindings.h"
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Time/ITime.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
+#include <AzFramework/Physics/Configuration/SystemConfiguration.h>
+#include <AzFramework/Input/Channels/InputChannel.h>
+#include <AzFramework/Input/Devices/Keyboard/InputDeviceKeyboard.h>
+#include <AzFramework/Input/Devices/Mouse/InputDeviceMouse.h>
+#include <AzFramework/Input/Buses/Requests/InputSystemCursorRequestBus.h>
+
+namespace O3DESharp
+{
+    namespace
+    {
+        // Static storage so the address handed to managed code stays valid
+        // across O3DE.Core reloads and system component re-activation.
+        InteropInputSnapshot s_inputSnapshot;
+        InteropTimeSnapshot s_timeSnapshot;
+
+        // Mirrors the fixed-step accumulator the physics system keeps
+        // internally, which it doesn't expose. Only used to derive alpha.
+        float s_fixedStepAccumulator = 0.0f;
+
+        float ActiveValue(const AzFramework::InputChannelId& channelId)
+        {
+            const AzFramework::InputChannel* channel = ScriptBindings::FindInputChannel(channelId);
+            return (channel && channel->IsActive()) ? channel->GetValue() : 0.0f;
+        }
+    }
+
+    FrameSnapshotPublisher::~FrameSnapshotPublisher()
+    {
+        Disconnect();
+    }
+
+    void FrameSnapshotPublisher::Connect()
+    {
+        // Start every activation from a clean block so a key that was held
+        // when the previous session ended doesn't read as "released" on the
+        // first frame of the next one.
+        s_inputSnapshot = InteropInputSnapshot();
+        s_timeSnapshot = InteropTimeSnapshot();
+        s_fixedStepAccumulator = 0.0f;
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void FrameSnapshotPublisher::Disconnect()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+    }
+
+    InteropInputSnapshot* FrameSnapshotPublisher::GetInputSnapshot()
+    {
+        return &s_inputSnapshot;
+    }
+
+    InteropTimeSnapshot* FrameSnapshotPublisher::GetTimeSnapshot()
+    {
+        return &s_timeSnapshot;
+    }
+
+    void FrameSnapshotPublisher::CaptureInput()
+    {
+        using Key = AzFramework::InputDeviceKeyboard::Key;
+        using Movement = AzFramework::InputDeviceMouse::Movement;
+
+        InteropInputSnapshot& snapshot = s_inputSnapshot;
+
+        for (int word = 0; word < InteropInputSnapshot::KeyWordCount; ++word)
+        {
+            snapshot.keysPrevious[word] = snapshot.keysDown[word];
+            snapshot.keysDown[word] = 0;
+        }
+        snapshot.buttonsPrevious = snapshot.buttonsDown;
+        snapshot.buttonsDown = 0;
+
+        for (int keyCode = 0; keyCode < InteropInputSnapshot::KeyCodeCount; ++keyCode)
+        {
+            const AzFramework::InputChannel* channel =
+                ScriptBindings::FindInputChannel(ScriptBindings::KeyCodeToChannelId(keyCode));
+            if (channel && channel->IsActive())
+            {
+                snapshot.keysDown[keyCode / 64] |= AZ::u64(1) << (keyCode % 64);
+            }
+        }
+
+        for (int button = 0; button < InteropInputSnapshot::MouseButtonCount; ++button)
+        {
+            const AzFramework::InputChannel* channel =
+                ScriptBindings::FindInputChannel(ScriptBindings::MouseButtonToChannelId(button));
+            if (channel && channel->IsActive())
+            {
+                snapshot.buttonsDown |= AZ::u32(1) << button;
+            }
+        }
+
+        AZ::Vector2 mousePos = AZ::Vector2::CreateZero();
+        AzFramework::InputSystemCursorRequestBus::EventResult(
+            mousePos,
+            AzFramework::InputDeviceMouse::Id,
+            &AzFramework::InputSystemCursorRequests::GetSystemCursorPositionNormalized);
+        snapshot.mouseX = mousePos.GetX();
+        snapshot.mouseY = mousePos.GetY();
+        snapshot.mouseDeltaX = ActiveValue(Movement::X);
+        snapshot.mouseDeltaY = ActiveValue(Movement::Y);
+
+        // Same channel mapping as ScriptBindings::Input_GetAxis, resolved once
+        // per frame instead of once per GetAxis call.
+        const float horizontal =
+            ActiveValue(Key::AlphanumericD) - ActiveValue(Key::AlphanumericA) +
+            ActiveValue(Key::NavigationArrowRight) - ActiveValue(Key::NavigationArrowLeft);
+        const float vertical =
+            ActiveValue(Key::AlphanumericW) - ActiveValue(Key::AlphanumericS) +
+            ActiveValue(Key::NavigationArrowUp) - ActiveValue(Key::NavigationArrowDown);
+
+        snapshot.axes[InteropInputSnapshot::AxisHorizontal] = AZ::GetClamp(horizontal, -1.0f, 1.0f);
+        snapshot.axes[InteropInputSnapshot::AxisVertical] = AZ::GetClamp(vertical, -1.0f, 1.0f);
+        snapshot.axes[InteropInputSnapshot::AxisMouseX] = snapshot.mouseDeltaX;
+        snapshot.axes[InteropInputSnapshot::AxisMouseY] = snapshot.mouseDeltaY;
+
+        ++snapshot.frameIndex;
+    }
+
+    void FrameSnapshotPublisher::CaptureTime()
+    {
+        InteropTimeSnapshot& snapshot = s_timeSnapshot;
+
+        if (auto* timeSystem = AZ::Interface<AZ::ITime>::Get())
+        {
+            snapshot.deltaTime = aznumeric_cast<float>(timeSystem->GetSimulationTickDeltaTimeUs()) / 1000000.0f;
+            snapshot.unscaledDeltaTime = aznumeric_cast<float>(timeSystem->GetRealTickDeltaTimeUs()) / 1000000.0f;
+            snapshot.totalTime = aznumeric_cast<double>(timeSystem->GetElapsedTimeUs()) / 1000000.0;
+            snapshot.timeScale = timeSystem->GetSimulationTickScale();
+        }
+
+        snapshot.fixedDeltaTime = 0.0f;
+        float maxTimestep = 0.0f;
+        if (auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get())
+        {
+            if (const AzPhysics::SystemConfiguration* config = physicsSystem->GetConfiguration())
+            {
+                snapshot.fixedDeltaTime = config->m_fixedTimestep;
+                maxTimestep = config->m_maxTimestep;
+            }
+        }
+
+        if (snapshot.fixedDeltaTime > 0.0f)
+        {
+            // Same per-frame clamp the physics system applies to its own
+            // accumulator, so a hitch doesn't desync the two.
+            const float frameDelta = maxTimestep > 0.0f ? AZ::GetMin(snapshot.deltaTime, maxTimestep) : snapshot.deltaTime;
+            s_fixedStepAccumulator += frameDelta;
+            while (s_fixedStepAccumulator >= snapshot.fixedDeltaTime)
+            {
+                s_fixedStepAccumulator -= snapshot.fixedDeltaTime;
+            }
+            snapshot.fixedStepAlpha = s_fixedStepAccumulator / snapshot.fixedDeltaTime;
+        }
+        else
+        {
+            s_fixedStepAccumulator = 0.0f;
+            snapshot.fixedStepAlpha = 0.0f;
+        }
+
+        ++snapshot.frameIndex;
+    }
+
+    void FrameSnapshotPublisher::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        CaptureTime();
+        CaptureInput();
+    }
+
+    int FrameSnapshotPublisher::GetTickOrder()
+    {
+        return AZ::TICK_INPUT;
+    }
+
+} // namespace O3DESharp
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace O3DESharp
+{
+    /**
+     * Per-frame input state shared with managed code.
+     *
+     * Must match the layout of O3DE.InputSnapshot in Input.cs. The block
+     * lives in static storage (see FrameSnapshotPublisher::GetInputSnapshot),
+     * so its address never changes for the lifetime of the gem and managed
+     * code can cache the pointer after fetching it once through
+     * InternalCalls.Input_GetSnapshot. Every IsKeyDown / GetAxis / ... call on
+     * the C# side is then a plain memory read instead of a native transition
+     * plus an InputChannelRequestBus lookup.
+     *
+     * Key bits are indexed by the C# KeyCode value, mouse button bits by the
+     * C# MouseButton value. "Pressed" / "Released" are derived on the managed
+     * side by comparing the current and previous-frame bitsets.
+     */
+    struct InteropInputSnapshot
+    {
+        static constexpr AZ::u32 CurrentVersion = 1;
+        static constexpr int KeyCodeCount = 85;      // KeyCode.A (0) .. KeyCode.BackQuote (84)
+        static constexpr int KeyWordCount = 2;       // 128 bits, enough for KeyCodeCount
+        static constexpr int MouseButtonCount = 3;   // Left, Right, Middle
+
+        // Virtual axes resolved to small integer ids. Must match O3DE.InputAxis.
+        enum Axis : AZ::u32
+        {
+            AxisHorizontal = 0,
+            AxisVertical,
+            AxisMouseX,
+            AxisMouseY,
+            AxisCount
+        };
+
+        AZ::u32 version = CurrentVersion;
+        AZ::u32 size = sizeof(InteropInputSnapshot);
+        AZ::u64 frameIndex = 0;
+
+        AZ::u64 keysDown[KeyWordCount] = {};
+        AZ::u64 keysPrevious[KeyWordCount] = {};
+        AZ::u32 buttonsDown = 0;
+        AZ::u32 buttonsPrevious = 0;
+
+        float mouseX = 0.0f;        // normalized 0..1
+        float mouseY = 0.0f;
+        float mouseDeltaX = 0.0f;
+        float mouseDeltaY = 0.0f;
+
+        float axes[AxisCount] = {};
+    };
+
+    static_assert(InteropInputSnapshot::KeyCodeCount <= InteropInputSnapshot::KeyWordCount * 64,
+        "InteropInputSnapshot key bitset is too small for the KeyCode range");
+    static_assert(sizeof(InteropInputSnapshot) == 88,
+        "InteropInputSnapshot layout changed - update O3DE.InputSnapshot in Input.cs and bump CurrentVersion");
+
+    /**
+     * Per-frame timing state shared with managed code.
+     *
+     * Must match the layout of O3DE.TimeSnapshot in Time.cs. Like the input
+     * block it lives in static storage, is published once per tick and is read
+     * directly by Time.cs after a single InternalCalls.Time_GetSnapshot call,
+     * replacing one native transition plus an AZ::ITime lookup per property.
+     *
+     * frameIndex counts ticks since the publisher was connected. fixedStepAlpha
+     * is how far the current frame sits between two fixed physics steps
+     * (0..1), for interpolating visuals against fixed-step state.
+     */
+    struct InteropTimeSnapshot
+    {
+        static constexpr AZ::u32 CurrentVersion = 1;
+
+        AZ::u32 version = CurrentVersion;
+        AZ::u32 size = sizeof(InteropTimeSnapshot);
+        AZ::u64 frameIndex = 0;
+        double totalTime = 0.0;             // seconds since application start
+
+        float deltaTime = 0.0f;             // simulation (scaled) tick delta, seconds
+        float unscaledDeltaTime = 0.0f;     // real tick delta, seconds
+        float timeScale = 1.0f;
+        float fixedDeltaTime = 0.0f;        // physics fixed timestep, 0 if no physics system
+        float fixedStepAlpha = 0.0f;
+        AZ::u32 reserved = 0;
+    };
+
+    static_assert(sizeof(InteropTimeSnapshot) == 48,
+        "InteropTimeSnapshot layout changed - update O3DE.TimeSnapshot in Time.cs and bump CurrentVersion");
+
+    /**
+     * FrameSnapshotPublisher - Captures frame-constant engine state into
+     * blocks that managed code reads directly.
+     *
+     * Connects to the TickBus with TICK_INPUT order so the capture runs after
+     * the input system has pumped its devices for the frame but before any
+     * CSharpScriptComponent (TICK_DEFAULT) dispatches OnUpdate. Owned by
+     * O3DESharpSystemComponent and connected for the lifetime of its
+     * activation.
+     */
+    class FrameSnapshotPublisher
+        : public AZ::TickBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameSnapshotPublisher, AZ::SystemAllocator);
+
+        FrameSnapshotPublisher() = default;
+        ~FrameSnapshotPublisher() override;
+
+        void Connect();
+        void Disconnect();
+
+        /// Stable address of the shared input block. Never null.
+        static InteropInputSnapshot* GetInputSnapshot();
+
+        /// Stable address of the shared time block. Never null.
+        static InteropTimeSnapshot* GetTimeSnapshot();
+
+        /// Refresh the input block from the input channels. Called once per
+        /// tick; exposed so tests / headless hosts can drive it manually.
+        static void CaptureInput();
+
+        /// Refresh the time block from AZ::ITime and advance the frame index.
+        static void CaptureTime();
+
+    protected:
+        // AZ::TickBus::Handler
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+    };
+
+} // namespace O3DESharp
@@ -8,7 +8,7 @@
 // PLACEHOLDER FILE - committed so fresh clones build.
 //
 // The binding generator (Code/Tools/BindingGenerator/O3DESharp.BindingGenerator)
-// overwrites this file with per-method stub definitions and AddInternalCall
+// overwrites this file with per-method direct-call thunks and AddInternalCall
 // registration calls when it runs against the O3DESharp gem's headers. Until
 // the first generation pass executes, this minimal version provides empty
 // Register/Unregister/HotReload entry points so the runtime gem links and
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "InternalCallGuard.h"
+
+#include <AzCore/std/string/string_view.h>
+
+namespace O3DESharp::InternalCallGuard
+{
+    namespace
+    {
+        // The hand-written O3DE.InternalCalls a parallel update may use.
+        // Reads only, except logging; transform setters never get here from
+        // a partition because Transform.cs buffers them (ParallelUpdate).
+        constexpr const char* WorkerSafeCalls[] = {
+            "Log_Info",
+            "Log_Warning",
+            "Log_Error",
+            "Log_GetQueue",
+            "Entity_IsValid",
+            "Entity_GetName",
+            "Entity_IsActive",
+            "Entity_GetChildCount",
+            "Entity_GetChildAtIndex",
+            "Entity_GetChildren",
+            "Entity_AreScriptsReady",
+            "Transform_GetWorldPosition",
+            "Transform_GetLocalPosition",
+            "Transform_GetWorldRotation",
+            "Transform_GetWorldRotationEuler",
+            "Transform_GetLocalScale",
+            "Transform_GetLocalUniformScale",
+            "Transform_GetForward",
+            "Transform_GetRight",
+            "Transform_GetUp",
+            "Transform_GetParentId",
+            "Input_IsKeyDown",
+            "Input_IsKeyPressed",
+            "Input_IsKeyReleased",
+            "Input_IsMouseButtonDown",
+            "Input_IsMouseButtonPressed",
+            "Input_IsMouseButtonReleased",
+            "Input_GetMousePosition",
+            "Input_GetMouseDelta",
+            "Input_GetAxis",
+            "Input_GetSnapshot",
+            "Time_GetDeltaTime",
+            "Time_GetTotalTime",
+            "Time_GetTimeScale",
+            "Time_GetFrameCount",
+            "Time_GetSnapshot",
+            "Component_HasComponent",
+        };
+
+        struct RefusedCall
+        {
+            const char* className = nullptr;
+            const char* name = nullptr;
+        };
+
+        thread_local RefusedCall t_refused;
+    }
+
+    bool IsWorkerSafe(const char* className, const char* name)
+    {
+        if (className == nullptr || name == nullptr || AZStd::string_view(className) != "O3DE.InternalCalls")
+        {
+            return false;
+        }
+        for (const char* safe : WorkerSafeCalls)
+        {
+            if (AZStd::string_view(name) == safe)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Refuse(const char* className, const char* name)
+    {
+        if (t_refused.name == nullptr)
+        {
+            t_refused.className = className;
+            t_refused.name = name;
+        }
+    }
+
+    bool TakeRefusedCall(AZStd::string& call)
+    {
+        if (t_refused.name == nullptr)
+        {
+            return false;
+        }
+        call = AZStd::string::format("%s.%s", t_refused.className ? t_refused.className : "", t_refused.name);
+        t_refused = {};
+        return true;
+    }
+
+} // namespace O3DESharp::InternalCallGuard
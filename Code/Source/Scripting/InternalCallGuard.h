@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/string/string.h>
+
+namespace O3DESharp
+{
+    /**
+     * InternalCallGuard - Holds [ParallelUpdate] scripts to the internal
+     * calls that are safe off the main thread.
+     *
+     * ParallelScriptUpdater marks the thread running a partition. Every
+     * internal call registered through O3DESHARP_ADD_INTERNAL_CALL -
+     * ScriptBindings, GenericDispatcher and the generated thunks alike -
+     * checks the mark, and inside a partition only the calls on the
+     * worker-safe list run: transform and entity reads, Time, Input and
+     * logging. Any other call is refused: it returns a zero value without
+     * touching the engine, and the script being ticked is disabled once the
+     * batch is back on the main thread, as if it had thrown.
+     *
+     * The managed wrappers still throw for the common cases
+     * (ParallelUpdate.ThrowIfActive), which gives a better message; this is
+     * what catches everything they don't cover.
+     */
+    namespace InternalCallGuard
+    {
+        namespace Detail
+        {
+            inline thread_local bool t_inParallelPartition = false;
+        }
+
+        /// Whether the internal call may run inside a parallel partition. Asked once per registration.
+        bool IsWorkerSafe(const char* className, const char* name);
+
+        /// Set by ParallelScriptUpdater around each partition
+        inline void SetInParallelPartition(bool inPartition)
+        {
+            Detail::t_inParallelPartition = inPartition;
+        }
+
+        inline bool IsInParallelPartition()
+        {
+            return Detail::t_inParallelPartition;
+        }
+
+        /**
+         * Note a refused call on this thread. The first one since the last
+         * TakeRefusedCall is kept.
+         * @param className, name Must outlive the process (string literals)
+         */
+        void Refuse(const char* className, const char* name);
+
+        /// The first call refused on this thread since the last take, as "Class.Name"; false if none
+        bool TakeRefusedCall(AZStd::string& call);
+    } // namespace InternalCallGuard
+
+} // namespace O3DESharp
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "InteropProfiler.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+#include <cstring>
+
+namespace O3DESharp
+{
+    namespace
+    {
+        // Enough for every job worker plus the main and render threads
+        constexpr AZ::u32 MaxThreads = 256;
+
+        struct BindingCounters
+        {
+            AZStd::atomic<AZ::u64> calls{ 0 };
+            AZStd::atomic<AZ::u64> totalNs{ 0 };
+            AZStd::atomic<AZ::u64> maxNs{ 0 };
+            AZStd::atomic<AZ::u64> bytes{ 0 };
+        };
+
+        // One per thread that has made a profiled call. Only the owning
+        // thread writes; the atomics are there so readers never tear a value.
+        struct ThreadCounters
+        {
+            AZStd::atomic<AZ::u32> epoch{ 0 };
+            BindingCounters bindings[InteropProfiler::MaxBindings];
+        };
+
+        struct BindingName
+        {
+            const char* className = nullptr;
+            const char* name = nullptr;
+        };
+
+        // Blocks are never freed: a thread that exits keeps its totals, and
+        // thunks can still run on other threads while the gem shuts down.
+        AZStd::atomic<ThreadCounters*> s_threads[MaxThreads] = {};
+        AZStd::atomic<AZ::u32> s_threadCount{ 0 };
+
+        // Bumped by Reset; a block from an older epoch counts as empty and
+        // is zeroed by its thread on its next call.
+        AZStd::atomic<AZ::u32> s_epoch{ 1 };
+
+        AZStd::mutex s_bindingMutex;
+        BindingName s_bindingNames[InteropProfiler::MaxBindings];
+        AZStd::atomic<AZ::u32> s_bindingCount{ 0 };
+
+        thread_local ThreadCounters* t_counters = nullptr;
+        thread_local bool t_outOfSlots = false;
+
+        ThreadCounters* GetThreadCounters()
+        {
+            if (t_counters == nullptr && !t_outOfSlots)
+            {
+                const AZ::u32 slot = s_threadCount.fetch_add(1, AZStd::memory_order_relaxed);
+                if (slot >= MaxThreads)
+                {
+                    t_outOfSlots = true;
+                    return nullptr;
+                }
+                t_counters = new ThreadCounters();
+                s_threads[slot].store(t_counters, AZStd::memory_order_release);
+            }
+            return t_counters;
+        }
+
+        // Single writer, so a plain load + store is enough
+        void Bump(AZStd::atomic<AZ::u64>& counter, AZ::u64 amount)
+        {
+            counter.store(counter.load(AZStd::memory_order_relaxed) + amount, AZStd::memory_order_relaxed);
+        }
+
+        AZ::u64 Delta(AZ::u64 current, AZ::u64 previous)
+        {
+            // Below the previous value means a reset happened in between
+            return current >= previous ? current - previous : current;
+        }
+
+        void OnInteropProfilerChanged(const bool& enabled)
+        {
+            InteropProfiler::SetRecording(enabled);
+        }
+    }
+
+    AZ_CVAR(bool, o3desharp_InteropProfiler, false, &OnInteropProfilerChanged, AZ::ConsoleFunctorFlags::Null,
+        "Record call counts and timings for every C# internal call. Needs a build with O3DESHARP_INTEROP_PROFILER.");
+
+    static void o3desharp_InteropTop(const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZ::u32 count = 20;
+        if (!arguments.empty())
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(count, arguments.front());
+        }
+        AZLOG_INFO("%s", InteropProfiler::FormatTop(count).c_str());
+    }
+    AZ_CONSOLEFREEFUNC(o3desharp_InteropTop, AZ::ConsoleFunctorFlags::Null,
+        "Print the C# internal calls with the most total time: o3desharp_InteropTop [count=20]");
+
+    static void o3desharp_InteropReset([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        InteropProfiler::Reset();
+    }
+    AZ_CONSOLEFREEFUNC(o3desharp_InteropReset, AZ::ConsoleFunctorFlags::Null,
+        "Zero the counters printed by o3desharp_InteropTop");
+
+    AZStd::atomic_bool InteropProfiler::s_recording{ false };
+
+    AZ::u32 InteropProfiler::RegisterBinding(const char* className, const char* name)
+    {
+        AZStd::scoped_lock lock(s_bindingMutex);
+        const AZ::u32 count = s_bindingCount.load(AZStd::memory_order_relaxed);
+        for (AZ::u32 i = 0; i < count; ++i)
+        {
+            if (strcmp(s_bindingNames[i].name, name) == 0 && strcmp(s_bindingNames[i].className, className) == 0)
+            {
+                return i;
+            }
+        }
+
+        if (count >= MaxBindings)
+        {
+            AZLOG_WARN("InteropProfiler: more than %u internal calls, %s.%s won't be profiled", MaxBindings, className, name);
+            return InvalidBinding;
+        }
+
+        s_bindingNames[count] = { className, name };
+        s_bindingCount.store(count + 1, AZStd::memory_order_release);
+        return count;
+    }
+
+    void InteropProfiler::SetRecording(bool recording)
+    {
+#if !defined(O3DESHARP_INTEROP_PROFILER)
+        if (recording)
+        {
+            AZLOG_WARN("InteropProfiler: built without O3DESHARP_INTEROP_PROFILER, there is nothing to record");
+        }
+#endif
+        s_recording.store(recording, AZStd::memory_order_relaxed);
+    }
+
+    void InteropProfiler::Record(AZ::u32 binding, AZ::u64 elapsedNs, AZ::u64 bytes)
+    {
+        ThreadCounters* block = GetThreadCounters();
+        if (block == nullptr)
+        {
+            return;
+        }
+
+        const AZ::u32 epoch = s_epoch.load(AZStd::memory_order_relaxed);
+        if (block->epoch.load(AZStd::memory_order_relaxed) != epoch)
+        {
+            for (BindingCounters& counters : block->bindings)
+            {
+                counters.calls.store(0, AZStd::memory_order_relaxed);
+                counters.totalNs.store(0, AZStd::memory_order_relaxed);
+                counters.maxNs.store(0, AZStd::memory_order_relaxed);
+                counters.bytes.store(0, AZStd::memory_order_relaxed);
+            }
+            block->epoch.store(epoch, AZStd::memory_order_release);
+        }
+
+        BindingCounters& counters = block->bindings[binding];
+        Bump(counters.calls, 1);
+        Bump(counters.totalNs, elapsedNs);
+        Bump(counters.bytes, bytes);
+        if (elapsedNs > counters.maxNs.load(AZStd::memory_order_relaxed))
+        {
+            counters.maxNs.store(elapsedNs, AZStd::memory_order_relaxed);
+        }
+    }
+
+    AZStd::vector<InteropProfiler::BindingTotals> InteropProfiler::Snapshot()
+    {
+        const AZ::u32 bindingCount = s_bindingCount.load(AZStd::memory_order_acquire);
+        AZStd::vector<BindingTotals> totals(bindingCount);
+        for (AZ::u32 i = 0; i < bindingCount; ++i)
+        {
+            totals[i].className = s_bindingNames[i].className;
+            totals[i].name = s_bindingNames[i].name;
+        }
+
+        const AZ::u32 epoch = s_epoch.load(AZStd::memory_order_relaxed);
+        const AZ::u32 threadCount = AZStd::min(s_threadCount.load(AZStd::memory_order_relaxed), MaxThreads);
+        for (AZ::u32 t = 0; t < threadCount; ++t)
+        {
+            const ThreadCounters* block = s_threads[t].load(AZStd::memory_order_acquire);
+            if (block == nullptr || block->epoch.load(AZStd::memory_order_acquire) != epoch)
+            {
+                continue;
+            }
+
+            for (AZ::u32 i = 0; i < bindingCount; ++i)
+            {
+                const BindingCounters& counters = block->bindings[i];
+                totals[i].calls += counters.calls.load(AZStd::memory_order_relaxed);
+                totals[i].totalNs += counters.totalNs.load(AZStd::memory_order_relaxed);
+                totals[i].bytes += counters.bytes.load(AZStd::memory_order_relaxed);
+                totals[i].maxNs = AZStd::max(totals[i].maxNs, counters.maxNs.load(AZStd::memory_order_relaxed));
+            }
+        }
+        return totals;
+    }
+
+    void InteropProfiler::Reset()
+    {
+        s_epoch.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    AZStd::string InteropProfiler::FormatTop(AZ::u32 count)
+    {
+#if !defined(O3DESHARP_INTEROP_PROFILER)
+        return "InteropProfiler: built without O3DESHARP_INTEROP_PROFILER";
+#else
+        AZStd::vector<BindingTotals> totals = Snapshot();
+        totals.erase(
+            AZStd::remove_if(totals.begin(), totals.end(), [](const BindingTotals& binding) { return binding.calls == 0; }),
+            totals.end());
+        if (totals.empty())
+        {
+            return IsRecording() ? "InteropProfiler: no internal calls recorded yet"
+                                 : "InteropProfiler: nothing recorded; set o3desharp_InteropProfiler true";
+        }
+
+        AZStd::sort(totals.begin(), totals.end(),
+            [](const BindingTotals& lhs, const BindingTotals& rhs) { return lhs.totalNs > rhs.totalNs; });
+        if (totals.size() > count)
+        {
+            totals.resize(count);
+        }
+
+        AZStd::string out = AZStd::string::format(
+            "InteropProfiler: top %zu internal calls by total time\n%-40s %12s %12s %10s %10s %14s",
+            totals.size(), "binding", "calls", "total ms", "avg us", "max us", "bytes");
+        for (const BindingTotals& binding : totals)
+        {
+            out += AZStd::string::format("\n%-40s %12llu %12.3f %10.3f %10.3f %14llu",
+                binding.name,
+                static_cast<unsigned long long>(binding.calls),
+                binding.totalNs / 1.0e6,
+                binding.totalNs / 1.0e3 / binding.calls,
+                binding.maxNs / 1.0e3,
+                static_cast<unsigned long long>(binding.bytes));
+        }
+        return out;
+#endif
+    }
+
+    InteropProfiler::~InteropProfiler()
+    {
+        Disconnect();
+    }
+
+    void InteropProfiler::Connect()
+    {
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void InteropProfiler::Disconnect()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        m_previous.clear();
+    }
+
+    void InteropProfiler::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (!IsRecording() || !O3DESharpStatsNotificationBus::HasHandlers())
+        {
+            m_previous.clear();
+            return;
+        }
+
+        AZStd::vector<BindingTotals> current = Snapshot();
+        if (m_previous.empty())
+        {
+            // First frame since recording started: nothing to diff against
+            m_previous = AZStd::move(current);
+            return;
+        }
+
+        InteropFrameStats stats;
+        for (size_t i = 0; i < current.size(); ++i)
+        {
+            const BindingTotals previous = i < m_previous.size() ? m_previous[i] : BindingTotals{};
+            const AZ::u64 calls = Delta(current[i].calls, previous.calls);
+            const AZ::u64 totalNs = Delta(current[i].totalNs, previous.totalNs);
+            stats.calls += calls;
+            stats.totalNs += totalNs;
+            stats.bytes += Delta(current[i].bytes, previous.bytes);
+            if (calls > 0 && totalNs >= stats.topBindingNs)
+            {
+                stats.topBinding = current[i].name;
+                stats.topBindingCalls = calls;
+                stats.topBindingNs = totalNs;
+            }
+        }
+        m_previous = AZStd::move(current);
+
+        O3DESharpStatsNotificationBus::Broadcast(&O3DESharpStatsNotifications::OnInteropFrameStats, stats);
+    }
+
+    int InteropProfiler::GetTickOrder()
+    {
+        // After everything that might call into managed code this frame
+        return AZ::TICK_LAST;
+    }
+
+} // namespace O3DESharp
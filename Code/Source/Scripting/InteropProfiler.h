@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/typetraits/is_same.h>
+#include <AzCore/std/typetraits/is_void.h>
+
+#include <Coral/String.hpp>
+
+#include <O3DESharp/O3DESharpStatsBus.h>
+
+#include "InternalCallGuard.h"
+#include "InteropTracer.h"
+
+namespace O3DESharp
+{
+    /**
+     * InteropProfiler - Call counts and timings for every internal call.
+     *
+     * Compiled in with the O3DESHARP_INTEROP_PROFILER CMake option. Internal
+     * calls are then registered through O3DESHARP_ADD_INTERNAL_CALL as a
+     * thunk that times the call and counts the bytes it marshals (arguments
+     * and results by value, plus the characters of any Coral::String).
+     * Without the option the macro registers a thunk that only applies the
+     * InternalCallGuard and InteropTracer, and none of this costs anything.
+     *
+     * Recording is further gated at runtime by the o3desharp_InteropProfiler
+     * cvar (off by default); while it and o3desharp_InteropTrace are off a
+     * thunk is the guard's thread-local check, two relaxed loads and a
+     * branch. Counters live in one block per calling thread and are only
+     * ever written by that thread, so recording takes no locks and no RMW
+     * atomics - readers sum the blocks. o3desharp_InteropTop [N] prints the
+     * N bindings with the most time, o3desharp_InteropReset clears them.
+     *
+     * The instance half is the per-frame rollup: owned by
+     * O3DESharpSystemComponent, it diffs the totals at the end of every tick
+     * and broadcasts them on O3DESharpStatsNotificationBus.
+     */
+    class InteropProfiler
+        : public AZ::TickBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(InteropProfiler, AZ::SystemAllocator);
+
+        /// Upper bound on distinct bindings; later registrations aren't profiled
+        static constexpr AZ::u32 MaxBindings = 512;
+        static constexpr AZ::u32 InvalidBinding = 0xFFFFFFFFu;
+
+        struct BindingTotals
+        {
+            const char* className = nullptr;
+            const char* name = nullptr;
+            AZ::u64 calls = 0;
+            AZ::u64 totalNs = 0;
+            AZ::u64 maxNs = 0;
+            AZ::u64 bytes = 0;
+        };
+
+        /**
+         * Reserve counters for an internal call. Registering the same
+         * (className, name) again - internal calls are re-registered after
+         * every reload - returns the existing id.
+         * @param className, name Must outlive the process (string literals)
+         * @return InvalidBinding once MaxBindings are in use
+         */
+        static AZ::u32 RegisterBinding(const char* className, const char* name);
+
+        /// Whether thunks currently record (o3desharp_InteropProfiler)
+        static bool IsRecording()
+        {
+            return s_recording.load(AZStd::memory_order_relaxed);
+        }
+
+        static void SetRecording(bool recording);
+
+        /// Add one call to the calling thread's counters
+        static void Record(AZ::u32 binding, AZ::u64 elapsedNs, AZ::u64 bytes);
+
+        /// Totals of every registered binding since the last reset, in registration order
+        static AZStd::vector<BindingTotals> Snapshot();
+
+        /// Zero every thread's counters. Each thread clears its own block on its next call.
+        static void Reset();
+
+        /// One line per binding, the N with the most total time first
+        static AZStd::string FormatTop(AZ::u32 count);
+
+        InteropProfiler() = default;
+        ~InteropProfiler() override;
+
+        void Connect();
+        void Disconnect();
+
+    protected:
+        // AZ::TickBus::Handler
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+    private:
+        static AZStd::atomic_bool s_recording;
+
+        // Totals as of the previous rollup, indexed by binding id
+        AZStd::vector<BindingTotals> m_previous;
+    };
+
+    namespace InteropProfilerDetail
+    {
+        template<typename T>
+        AZ::u64 MarshaledBytes([[maybe_unused]] T& value)
+        {
+            if constexpr (AZStd::is_same_v<T, Coral::String>)
+            {
+                // The native side sees a pointer; the payload is what was copied
+                AZ::u64 length = 0;
+                if (const auto* chars = value.Data())
+                {
+                    while (chars[length] != 0)
+                    {
+                        ++length;
+                    }
+                    length *= sizeof(*chars);
+                }
+                return sizeof(Coral::String) + length;
+            }
+            else
+            {
+                return sizeof(T);
+            }
+        }
+
+        // What a call refused by the InternalCallGuard returns
+        template<typename R>
+        R Refused(const char* className, const char* name)
+        {
+            InternalCallGuard::Refuse(className, name);
+            if constexpr (!AZStd::is_void_v<R>)
+            {
+                return R{};
+            }
+        }
+
+        template<auto Fn>
+        struct GuardedInternalCall;
+
+        // Thread rule and tracing, for builds without the profiler
+        template<typename R, typename... Args, R (*Fn)(Args...)>
+        struct GuardedInternalCall<Fn>
+        {
+            static inline const char* s_traceScope = nullptr;
+            static inline const char* s_traceName = nullptr;
+            static inline bool s_workerSafe = false;
+
+            static void* Register(const char* className, const char* name)
+            {
+                s_traceScope = InteropTracer::Intern(className);
+                s_traceName = InteropTracer::Intern(name);
+                s_workerSafe = InternalCallGuard::IsWorkerSafe(className, name);
+                return reinterpret_cast<void*>(&Invoke);
+            }
+
+            static R Invoke(Args... args)
+            {
+                if (InternalCallGuard::IsInParallelPartition() && !s_workerSafe)
+                {
+                    return Refused<R>(s_traceScope, s_traceName);
+                }
+                if (!InteropTracer::IsTracing())
+                {
+                    return Fn(args...);
+                }
+
+                InteropTraceScope trace(InteropTraceKind::ManagedToNative, s_traceScope, s_traceName);
+                return Fn(args...);
+            }
+        };
+
+        template<auto Fn>
+        struct ProfiledInternalCall;
+
+        template<typename R, typename... Args, R (*Fn)(Args...)>
+        struct ProfiledInternalCall<Fn>
+        {
+            static inline AZ::u32 s_binding = InteropProfiler::InvalidBinding;
+            static inline const char* s_traceScope = nullptr;
+            static inline const char* s_traceName = nullptr;
+            static inline bool s_workerSafe = false;
+
+            static void* Register(const char* className, const char* name)
+            {
+                s_binding = InteropProfiler::RegisterBinding(className, name);
+                s_traceScope = InteropTracer::Intern(className);
+                s_traceName = InteropTracer::Intern(name);
+                s_workerSafe = InternalCallGuard::IsWorkerSafe(className, name);
+                return reinterpret_cast<void*>(&Invoke);
+            }
+
+            static R Invoke(Args... args)
+            {
+                if (InternalCallGuard::IsInParallelPartition() && !s_workerSafe)
+                {
+                    return Refused<R>(s_traceScope, s_traceName);
+                }
+
+                const bool recording = InteropProfiler::IsRecording() && s_binding != InteropProfiler::InvalidBinding;
+                if (!recording && !InteropTracer::IsTracing())
+                {
+                    return Fn(args...);
+                }
+
+                InteropTraceScope trace(InteropTraceKind::ManagedToNative, s_traceScope, s_traceName);
+                if (!recording)
+                {
+                    return Fn(args...);
+                }
+
+                const AZ::u64 argumentBytes = (AZ::u64{ 0 } + ... + MarshaledBytes(args));
+                const auto start = AZStd::chrono::steady_clock::now();
+                if constexpr (AZStd::is_void_v<R>)
+                {
+                    Fn(args...);
+                    InteropProfiler::Record(s_binding, ElapsedNs(start), argumentBytes);
+                }
+                else
+                {
+                    R result = Fn(args...);
+                    InteropProfiler::Record(s_binding, ElapsedNs(start), argumentBytes + MarshaledBytes(result));
+                    return result;
+                }
+            }
+
+        private:
+            static AZ::u64 ElapsedNs(AZStd::chrono::steady_clock::time_point start)
+            {
+                return static_cast<AZ::u64>(
+                    AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - start).count());
+            }
+        };
+    } // namespace InteropProfilerDetail
+
+} // namespace O3DESharp
+
+/**
+ * Register an internal call behind the InternalCallGuard and InteropTracer,
+ * and wrapped in the interop profiler when it's compiled in. Use in place of
+ * assembly->AddInternalCall(className, name, reinterpret_cast<void*>(fn));
+ * fn must be a non-overloaded function.
+ */
+#if defined(O3DESHARP_INTEROP_PROFILER)
+#define O3DESHARP_ADD_INTERNAL_CALL(assembly, className, name, fn) \
+    (assembly)->AddInternalCall(className, name, ::O3DESharp::InteropProfilerDetail::ProfiledInternalCall<fn>::Register(className, name))
+#else
+#define O3DESHARP_ADD_INTERNAL_CALL(assembly, className, name, fn) \
+    (assembly)->AddInternalCall(className, name, ::O3DESharp::InteropProfilerDetail::GuardedInternalCall<fn>::Register(className, name))
+#endif
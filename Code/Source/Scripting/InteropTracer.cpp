@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "InteropTracer.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace O3DESharp
+{
+    namespace
+    {
+        constexpr AZ::u32 MaxThreads = 256;
+        constexpr AZ::u64 EventMask = InteropTracer::EventsPerThread - 1;
+        static_assert((InteropTracer::EventsPerThread & EventMask) == 0, "EventsPerThread must be a power of two");
+
+        constexpr const char* DefaultTracePath = "@user@/O3DESharp/InteropTrace.json";
+
+        struct TraceEvent
+        {
+            AZ::u64 startNs;
+            AZ::u64 durationNs;
+            const char* scope;
+            const char* name;
+            AZ::u32 depth;
+            InteropTraceKind kind;
+        };
+
+        // One per thread that has traced. Only the owning thread writes;
+        // head is published with release so a reader sees whole events up
+        // to it. writing is set around each write: the exporter turns
+        // tracing off, then waits for it to clear, so nothing is written
+        // while the ring is read.
+        struct ThreadTrace
+        {
+            AZStd::atomic<AZ::u64> head{ 0 };
+            AZStd::atomic<AZ::u32> epoch{ 0 };
+            AZStd::atomic_bool writing{ false };
+            bool isMainThread = false;
+            TraceEvent events[InteropTracer::EventsPerThread];
+        };
+
+        // Never freed, as in InteropProfiler: a thread's last events
+        // outlive it, and threads may still trace during shutdown.
+        AZStd::atomic<ThreadTrace*> s_threads[MaxThreads] = {};
+        AZStd::atomic<AZ::u32> s_threadCount{ 0 };
+        AZStd::atomic<AZ::u32> s_epoch{ 1 };
+
+        // Tracing is switched on from the console, on the main thread
+        AZStd::thread_id s_mainThread;
+
+        AZStd::mutex s_internMutex;
+
+        thread_local ThreadTrace* t_trace = nullptr;
+        thread_local bool t_outOfSlots = false;
+
+        ThreadTrace* GetThreadTrace()
+        {
+            if (t_trace == nullptr && !t_outOfSlots)
+            {
+                const AZ::u32 slot = s_threadCount.fetch_add(1, AZStd::memory_order_relaxed);
+                if (slot >= MaxThreads)
+                {
+                    t_outOfSlots = true;
+                    return nullptr;
+                }
+                t_trace = new ThreadTrace();
+                t_trace->isMainThread = AZStd::this_thread::get_id() == s_mainThread;
+                s_threads[slot].store(t_trace, AZStd::memory_order_release);
+            }
+            return t_trace;
+        }
+
+        void AppendJsonString(AZStd::string& out, const char* text)
+        {
+            out += '"';
+            for (const char* c = text ? text : ""; *c != '\0'; ++c)
+            {
+                if (*c == '"' || *c == '\\')
+                {
+                    out += '\\';
+                    out += *c;
+                }
+                else if (static_cast<unsigned char>(*c) < 0x20)
+                {
+                    out += AZStd::string::format("\\u%04x", static_cast<unsigned char>(*c));
+                }
+                else
+                {
+                    out += *c;
+                }
+            }
+            out += '"';
+        }
+
+        void OnInteropTraceChanged(const bool& enabled)
+        {
+            InteropTracer::SetTracing(enabled);
+        }
+    }
+
+    AZ_CVAR(bool, o3desharp_InteropTrace, false, &OnInteropTraceChanged, AZ::ConsoleFunctorFlags::Null,
+        "Record every managed/native transition into per-thread rings (see o3desharp_InteropTraceDump)");
+
+    static void o3desharp_InteropTraceDump(const AZ::ConsoleCommandContainer& arguments)
+    {
+        const AZStd::string_view requested = arguments.empty() ? AZStd::string_view(DefaultTracePath) : arguments.front();
+
+        AZ::IO::FixedMaxPath path(requested);
+        if (AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance())
+        {
+            fileIO->ResolvePath(path, AZ::IO::PathView(requested));
+        }
+
+        const AZStd::string json = InteropTracer::ExportChromeTrace();
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(path.c_str(),
+            AZ::IO::SystemFile::SF_OPEN_CREATE |
+            AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY |
+            AZ::IO::SystemFile::SF_OPEN_CREATE_PATH))
+        {
+            AZLOG_ERROR("InteropTracer: Failed to open %s for writing", path.c_str());
+            return;
+        }
+        const AZ::IO::SizeType written = file.Write(json.data(), json.size());
+        file.Close();
+        if (written != json.size())
+        {
+            AZLOG_ERROR("InteropTracer: Failed to write %s", path.c_str());
+            return;
+        }
+        AZLOG_INFO("InteropTracer: Wrote %zu bytes of Chrome trace to %s", json.size(), path.c_str());
+    }
+    AZ_CONSOLEFREEFUNC(o3desharp_InteropTraceDump, AZ::ConsoleFunctorFlags::Null,
+        "Write the recorded managed/native transitions as Chrome trace JSON: o3desharp_InteropTraceDump [path=@user@/O3DESharp/InteropTrace.json]");
+
+    static void o3desharp_InteropTraceClear([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        InteropTracer::Clear();
+    }
+    AZ_CONSOLEFREEFUNC(o3desharp_InteropTraceClear, AZ::ConsoleFunctorFlags::Null,
+        "Drop the transitions recorded so far");
+
+    AZStd::atomic_bool InteropTracer::s_tracing{ false };
+
+    void InteropTracer::SetTracing(bool tracing)
+    {
+        if (tracing)
+        {
+            s_mainThread = AZStd::this_thread::get_id();
+        }
+        // Sequentially consistent, pairing with the writing flag in Record
+        s_tracing.store(tracing);
+    }
+
+    const char* InteropTracer::Intern(AZStd::string_view name)
+    {
+        // Node-based, so the strings never move; never cleared
+        static AZStd::unordered_set<AZStd::string> s_names;
+
+        AZStd::scoped_lock lock(s_internMutex);
+        return s_names.emplace(name).first->c_str();
+    }
+
+    AZ::u64 InteropTracer::NowNs()
+    {
+        return static_cast<AZ::u64>(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(
+            AZStd::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void InteropTracer::Record(
+        InteropTraceKind kind, const char* scope, const char* name, AZ::u64 startNs, AZ::u64 durationNs, AZ::u32 depth)
+    {
+        ThreadTrace* trace = GetThreadTrace();
+        if (trace == nullptr)
+        {
+            return;
+        }
+
+        // Flag, then check: either the exporter sees the flag and waits,
+        // or this sees tracing off and drops a scope that was in flight
+        // when it stopped.
+        trace->writing.store(true);
+        if (!s_tracing.load())
+        {
+            trace->writing.store(false, AZStd::memory_order_release);
+            return;
+        }
+
+        const AZ::u32 epoch = s_epoch.load(AZStd::memory_order_relaxed);
+        if (trace->epoch.load(AZStd::memory_order_relaxed) != epoch)
+        {
+            trace->head.store(0, AZStd::memory_order_relaxed);
+            trace->epoch.store(epoch, AZStd::memory_order_release);
+        }
+
+        const AZ::u64 head = trace->head.load(AZStd::memory_order_relaxed);
+        trace->events[head & EventMask] = TraceEvent{ startNs, durationNs, scope, name, depth, kind };
+        trace->head.store(head + 1, AZStd::memory_order_release);
+        trace->writing.store(false, AZStd::memory_order_release);
+    }
+
+    void InteropTracer::Clear()
+    {
+        s_epoch.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    AZStd::string InteropTracer::ExportChromeTrace()
+    {
+        // Stop writers and wait out the ones mid-write, so the rings hold
+        // still while they're read
+        const bool wasTracing = IsTracing();
+        s_tracing.store(false);
+
+        const AZ::u32 epoch = s_epoch.load(AZStd::memory_order_relaxed);
+        const AZ::u32 threadCount = AZStd::min(s_threadCount.load(AZStd::memory_order_relaxed), MaxThreads);
+        for (AZ::u32 t = 0; t < threadCount; ++t)
+        {
+            if (const ThreadTrace* trace = s_threads[t].load(AZStd::memory_order_acquire))
+            {
+                while (trace->writing.load())
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+        }
+
+        // Timestamps relative to the oldest event keep the numbers short
+        AZ::u64 originNs = AZStd::numeric_limits<AZ::u64>::max();
+        for (AZ::u32 t = 0; t < threadCount; ++t)
+        {
+            const ThreadTrace* trace = s_threads[t].load(AZStd::memory_order_acquire);
+            if (trace == nullptr || trace->epoch.load(AZStd::memory_order_acquire) != epoch)
+            {
+                continue;
+            }
+            const AZ::u64 head = trace->head.load(AZStd::memory_order_acquire);
+            const AZ::u64 first = head > EventsPerThread ? head - EventsPerThread : 0;
+            if (first < head)
+            {
+                originNs = AZStd::min(originNs, trace->events[first & EventMask].startNs);
+            }
+        }
+
+        AZStd::string out = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        bool firstEvent = true;
+        auto separate = [&out, &firstEvent]()
+        {
+            if (!firstEvent)
+            {
+                out += ",\n";
+            }
+            firstEvent = false;
+        };
+
+        for (AZ::u32 t = 0; t < threadCount; ++t)
+        {
+            const ThreadTrace* trace = s_threads[t].load(AZStd::memory_order_acquire);
+            if (trace == nullptr || trace->epoch.load(AZStd::memory_order_acquire) != epoch)
+            {
+                continue;
+            }
+
+            separate();
+            out += AZStd::string::format(
+                "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", t);
+            AppendJsonString(out, trace->isMainThread ? "Main thread" : AZStd::string::format("Worker %u", t).c_str());
+            out += "}}";
+
+            const AZ::u64 head = trace->head.load(AZStd::memory_order_acquire);
+            for (AZ::u64 i = head > EventsPerThread ? head - EventsPerThread : 0; i < head; ++i)
+            {
+                const TraceEvent& event = trace->events[i & EventMask];
+                separate();
+                out += "{\"ph\":\"X\",\"pid\":1,\"cat\":";
+                out += event.kind == InteropTraceKind::NativeToManaged ? "\"native->managed\"" : "\"managed->native\"";
+                out += ",\"name\":";
+                AppendJsonString(out, AZStd::string::format("%s.%s", event.scope ? event.scope : "", event.name).c_str());
+                out += AZStd::string::format(",\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"depth\":%u}}",
+                    t,
+                    (event.startNs - AZStd::min(originNs, event.startNs)) / 1.0e3,
+                    event.durationNs / 1.0e3,
+                    event.depth);
+            }
+        }
+
+        out += "]}\n";
+        if (wasTracing)
+        {
+            s_tracing.store(true);
+        }
+        return out;
+    }
+
+} // namespace O3DESharp
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace O3DESharp
+{
+    enum class InteropTraceKind : AZ::u8
+    {
+        NativeToManaged,    // Script lifecycle dispatch or managed EBus handler event
+        ManagedToNative,    // Internal call
+    };
+
+    /**
+     * InteropTracer - Timeline of managed/native transitions.
+     *
+     * While o3desharp_InteropTrace is on, every InteropTraceScope writes one
+     * event (start, duration, nesting depth) into a ring owned by the
+     * calling thread: no locks, no allocation after the thread's first
+     * event, and the oldest events are overwritten once the ring is full.
+     * o3desharp_InteropTraceDump [path] writes what the rings hold as Chrome
+     * trace JSON, for chrome://tracing or Perfetto.
+     *
+     * Native -> managed transitions are traced by CSharpScriptComponent and
+     * GenericDispatcher's EBus forwarding. Internal calls are traced by the
+     * thunk O3DESHARP_ADD_INTERNAL_CALL registers, with or without
+     * O3DESHARP_INTEROP_PROFILER.
+     */
+    class InteropTracer
+    {
+    public:
+        /// Events kept per thread
+        static constexpr AZ::u32 EventsPerThread = 32 * 1024;
+
+        static bool IsTracing()
+        {
+            return s_tracing.load(AZStd::memory_order_relaxed);
+        }
+
+        static void SetTracing(bool tracing);
+
+        /**
+         * A copy of name that lives as long as the process, for scopes whose
+         * name isn't a literal (script class and bus names). Takes a lock;
+         * cache the result.
+         */
+        static const char* Intern(AZStd::string_view name);
+
+        /**
+         * Chrome trace JSON of every thread's ring, oldest event first.
+         * Pauses tracing and waits for writes in progress while it reads;
+         * scopes that end during the pause aren't recorded.
+         */
+        static AZStd::string ExportChromeTrace();
+
+        /// Drop every recorded event. Each thread clears its own ring on its next event.
+        static void Clear();
+
+    private:
+        friend class InteropTraceScope;
+
+        static AZ::u64 NowNs();
+        static void Record(InteropTraceKind kind, const char* scope, const char* name, AZ::u64 startNs, AZ::u64 durationNs, AZ::u32 depth);
+
+        static AZStd::atomic_bool s_tracing;
+    };
+
+    /**
+     * Records one transition, from construction to destruction, while
+     * tracing is on. scope and name must outlive the process (literals or
+     * InteropTracer::Intern).
+     */
+    class InteropTraceScope
+    {
+    public:
+        InteropTraceScope(InteropTraceKind kind, const char* scope, const char* name)
+        {
+            if (InteropTracer::IsTracing())
+            {
+                m_kind = kind;
+                m_scope = scope;
+                m_name = name;
+                m_depth = t_depth++;
+                m_startNs = InteropTracer::NowNs();
+            }
+        }
+
+        ~InteropTraceScope()
+        {
+            if (m_name != nullptr)
+            {
+                const AZ::u64 endNs = InteropTracer::NowNs();
+                --t_depth;
+                InteropTracer::Record(m_kind, m_scope, m_name, m_startNs, endNs - m_startNs, m_depth);
+            }
+        }
+
+        InteropTraceScope(const InteropTraceScope&) = delete;
+        InteropTraceScope& operator=(const InteropTraceScope&) = delete;
+
+    private:
+        static inline thread_local AZ::u32 t_depth = 0;
+
+        InteropTraceKind m_kind = InteropTraceKind::NativeToManaged;
+        const char* m_scope = nullptr;
+        const char* m_name = nullptr;
+        AZ::u64 m_startNs = 0;
+        AZ::u32 m_depth = 0;
+    };
+
+} // namespace O3DESharp
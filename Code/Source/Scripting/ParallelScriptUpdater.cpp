@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ParallelScriptUpdater.h"
+#include "CSharpScriptComponent.h"
+#include "InternalCallGuard.h"
+#include "ScriptTickScheduler.h"
+
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+
+namespace O3DESharp
+{
+    namespace
+    {
+        ParallelScriptUpdater* s_activeUpdater = nullptr;
+
+        AZ::u64 TypeKey(ScriptTypeHandle type)
+        {
+            return (static_cast<AZ::u64>(type.index) << 32) | type.generation;
+        }
+    }
+
+    ParallelScriptUpdater::~ParallelScriptUpdater()
+    {
+        Disconnect();
+    }
+
+    void ParallelScriptUpdater::Connect(bool useJobs, AZ::u32 minInstancesPerJob)
+    {
+        m_useJobs = useJobs;
+        m_minInstancesPerJob = AZStd::max(minInstancesPerJob, 1u);
+        s_activeUpdater = this;
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void ParallelScriptUpdater::Disconnect()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        if (s_activeUpdater == this)
+        {
+            s_activeUpdater = nullptr;
+        }
+
+        // Anything still registered falls back to ticking itself
+        for (CSharpScriptComponent* component : m_components)
+        {
+            component->m_parallelSlot = -1;
+        }
+        m_components.clear();
+        m_parallelTypes.clear();
+    }
+
+    ParallelScriptUpdater* ParallelScriptUpdater::GetActive()
+    {
+        return s_activeUpdater;
+    }
+
+    bool ParallelScriptUpdater::Register(CSharpScriptComponent& component, ScriptTypeHandle type, Coral::ManagedObject& instance)
+    {
+        if (component.m_parallelSlot >= 0)
+        {
+            return true;
+        }
+        if (!type.IsValid() || !instance.IsValid())
+        {
+            return false;
+        }
+
+        auto it = m_parallelTypes.find(TypeKey(type));
+        if (it == m_parallelTypes.end())
+        {
+            bool parallel = false;
+            try
+            {
+                parallel = instance.InvokeMethod<bool>("IsParallelUpdate");
+            }
+            catch (...)
+            {
+                parallel = false; // O3DE.Core without [ParallelUpdate] support
+            }
+            it = m_parallelTypes.emplace(TypeKey(type), parallel).first;
+        }
+
+        if (!it->second)
+        {
+            return false;
+        }
+
+        component.m_parallelSlot = static_cast<AZ::s32>(m_components.size());
+        m_components.push_back(&component);
+        return true;
+    }
+
+    void ParallelScriptUpdater::Unregister(CSharpScriptComponent& component)
+    {
+        const AZ::s32 slot = component.m_parallelSlot;
+        if (slot < 0 || static_cast<size_t>(slot) >= m_components.size() || m_components[slot] != &component)
+        {
+            return;
+        }
+
+        CSharpScriptComponent* moved = m_components.back();
+        m_components[slot] = moved;
+        moved->m_parallelSlot = slot;
+        m_components.pop_back();
+        component.m_parallelSlot = -1;
+    }
+
+    void ParallelScriptUpdater::TickPartition(
+        Coral::Type& contextType, AZ::s32 partition, size_t begin, size_t end, float deltaTime)
+    {
+        try
+        {
+            contextType.InvokeStaticMethod("BeginPartition", partition);
+        }
+        catch (...)
+        {
+            return;
+        }
+
+        // Same rules whether this is a worker or the main thread
+        InternalCallGuard::SetInParallelPartition(true);
+        for (size_t i = begin; i < end; ++i)
+        {
+            m_components[i]->TickParallel(deltaTime);
+        }
+        InternalCallGuard::SetInParallelPartition(false);
+
+        try
+        {
+            contextType.InvokeStaticMethod("EndPartition");
+        }
+        catch (...)
+        {
+        }
+    }
+
+    void ParallelScriptUpdater::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (m_components.empty())
+        {
+            return;
+        }
+
+        ICoralHostManager* hostManager = CoralHostManagerInterface::Get();
+        Coral::Type* contextType = hostManager && hostManager->IsInitialized()
+            ? hostManager->GetCoreType("O3DE.ParallelUpdate") : nullptr;
+        if (contextType == nullptr)
+        {
+            return;
+        }
+
+        // The batch's wall time counts toward the scheduler's frame budget
+        ScriptTickScheduler* scheduler = ScriptTickScheduler::GetActive();
+        const bool timed = scheduler != nullptr && scheduler->IsTiming();
+        const auto batchStart = AZStd::chrono::steady_clock::now();
+
+        // Contiguous partitions of at least m_minInstancesPerJob, at most
+        // one per worker. Components are in registration order, so each
+        // partition's command buffer is applied in a stable order too.
+        const size_t count = m_components.size();
+        size_t partitions = 1;
+        AZ::JobContext* jobContext = m_useJobs ? AZ::JobContext::GetGlobalContext() : nullptr;
+        if (jobContext != nullptr)
+        {
+            const size_t workers = AZStd::max<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), 1);
+            partitions = AZStd::clamp<size_t>(count / m_minInstancesPerJob, 1, workers);
+        }
+
+        try
+        {
+            contextType->InvokeStaticMethod("Prepare", static_cast<AZ::s32>(partitions));
+        }
+        catch (...)
+        {
+            return;
+        }
+
+        if (partitions == 1)
+        {
+            TickPartition(*contextType, 0, 0, count, deltaTime);
+        }
+        else
+        {
+            AZ::JobCompletion completion(jobContext);
+            const size_t perPartition = (count + partitions - 1) / partitions;
+            for (size_t p = 0; p < partitions; ++p)
+            {
+                const size_t begin = p * perPartition;
+                const size_t end = AZStd::min(begin + perPartition, count);
+                if (begin >= end)
+                {
+                    break;
+                }
+
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [this, contextType, p, begin, end, deltaTime]()
+                    {
+                        TickPartition(*contextType, static_cast<AZ::s32>(p), begin, end, deltaTime);
+                    },
+                    true, jobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+
+        // Back on the main thread. Disable the scripts that threw before
+        // running anything that could deactivate entities; disabling
+        // unregisters, so collect first.
+        AZStd::vector<CSharpScriptComponent*> failed;
+        for (CSharpScriptComponent* component : m_components)
+        {
+            if (component->m_parallelFailed)
+            {
+                failed.push_back(component);
+            }
+        }
+        for (CSharpScriptComponent* component : failed)
+        {
+            component->ReportParallelFailure();
+        }
+
+        try
+        {
+            contextType->InvokeStaticMethod<AZ::s32>("ApplyDeferredWrites");
+        }
+        catch (const std::exception& ex)
+        {
+            AZLOG_ERROR("ParallelScriptUpdater: Applying deferred writes failed: %s", ex.what());
+        }
+        catch (...)
+        {
+            AZLOG_ERROR("ParallelScriptUpdater: Applying deferred writes failed");
+        }
+
+        if (timed)
+        {
+            const auto elapsed = AZStd::chrono::steady_clock::now() - batchStart;
+            scheduler->AddFrameTime(
+                static_cast<AZ::u64>(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(elapsed).count()));
+        }
+    }
+
+    int ParallelScriptUpdater::GetTickOrder()
+    {
+        return AZ::TICK_DEFAULT;
+    }
+
+} // namespace O3DESharp
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <Coral/ManagedObject.hpp>
+
+#include "CoralHostManager.h"
+
+namespace O3DESharp
+{
+    class CSharpScriptComponent;
+
+    /**
+     * ParallelScriptUpdater - Ticks [ParallelUpdate] scripts on job workers.
+     *
+     * Instances of classes marked O3DE.ParallelUpdateAttribute register here
+     * once created instead of ticking from their own CSharpScriptComponent::
+     * OnTick. Each frame they're split into contiguous partitions, one
+     * AZ::Job per partition, and ScriptComponent.Tick runs on the workers
+     * while the main thread waits. Managed code inside a partition is held
+     * to the thread-safe subset (see O3DE.ParallelUpdate): transform reads,
+     * transform writes into a per-partition command buffer, logging. The
+     * buffers are applied on the main thread, in partition order, once
+     * every job has finished - so the outcome doesn't depend on scheduling.
+     *
+     * The main thread is parked for the whole parallel phase, so the engine
+     * state the scripts read can't change under them.
+     *
+     * Ticks at TICK_DEFAULT, alongside the main-thread scripts. Owned by
+     * O3DESharpSystemComponent and connected for the lifetime of its
+     * activation.
+     */
+    class ParallelScriptUpdater
+        : public AZ::TickBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ParallelScriptUpdater, AZ::SystemAllocator);
+
+        static constexpr AZ::u32 DefaultMinInstancesPerJob = 32;
+
+        ParallelScriptUpdater() = default;
+        ~ParallelScriptUpdater() override;
+
+        /**
+         * Make this the active updater.
+         * @param useJobs False ticks the parallel scripts on the main thread
+         *        (same buffered-write semantics), e.g. to rule out threading
+         *        while debugging
+         * @param minInstancesPerJob Smallest partition worth a job; fewer
+         *        instances than this run inline
+         */
+        void Connect(bool useJobs, AZ::u32 minInstancesPerJob);
+        void Disconnect();
+
+        /// The connected updater, or null.
+        static ParallelScriptUpdater* GetActive();
+
+        /**
+         * Take over ticking the component if its script class is
+         * [ParallelUpdate] (asked once per class).
+         * @return true if the component is now ticked from here
+         */
+        bool Register(CSharpScriptComponent& component, ScriptTypeHandle type, Coral::ManagedObject& instance);
+
+        /// Stop ticking the component. No-op if it isn't registered.
+        void Unregister(CSharpScriptComponent& component);
+
+        size_t GetRegisteredCount() const { return m_components.size(); }
+
+    protected:
+        // AZ::TickBus::Handler
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+    private:
+        // Tick components [begin, end) as partition `partition`. Runs on a job worker.
+        void TickPartition(Coral::Type& contextType, AZ::s32 partition, size_t begin, size_t end, float deltaTime);
+
+        AZStd::vector<CSharpScriptComponent*> m_components;
+
+        // Whether a class is [ParallelUpdate], keyed by type-handle index
+        // and generation so a reloaded class is asked again.
+        AZStd::unordered_map<AZ::u64, bool> m_parallelTypes;
+
+        bool m_useJobs = true;
+        AZ::u32 m_minInstancesPerJob = DefaultMinInstancesPerJob;
+    };
+
+} // namespace O3DESharp
@@ -7,6 +7,7 @@
  */
 
 #include "GenericDispatcher.h"
+#include "InteropRecorder.h"
 
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Console/ILogger.h>
@@ -28,11 +29,15 @@
 #include <AzCore/JSON/writer.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 
 #include <Scripting/CoralHostManager.h>
+#include <Scripting/InteropProfiler.h>
+#include <Scripting/InteropTracer.h>
+#include <Scripting/ScriptProfiler.h>
 #include <Coral/Type.hpp>
 
 #include <Coral/Assembly.hpp>
@@ -194,6 +199,9 @@ namespace O3DESharp
         s_dispatcherInstance = nullptr;
         m_reflector = nullptr;
         m_initialized = false;
+        GenericDispatcherInternalCalls::ReleaseResolvedMethods();
+        // The capture's handles end with this dispatcher
+        InteropRecorder::Stop();
 
         AZLOG_INFO("GenericDispatcher: Shutdown complete");
     }
@@ -864,38 +872,42 @@ namespace O3DESharp
         AZLOG_INFO("GenericDispatcher: Registering internal calls for generic dispatch...");
 
         // Reflection queries - register to ReflectionInternalCalls class with Reflection_ prefix
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetClassNames", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::Reflection_GetClassNames));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetMethodNames", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::Reflection_GetMethodNames));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetPropertyNames", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::Reflection_GetPropertyNames));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetEBusNames", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::Reflection_GetEBusNames));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetEBusEventNames", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::Reflection_GetEBusEventNames));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_ClassExists", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::Reflection_ClassExists));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_MethodExists", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::Reflection_MethodExists));
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetClassNames", &GenericDispatcherInternalCalls::Reflection_GetClassNames);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetMethodNames", &GenericDispatcherInternalCalls::Reflection_GetMethodNames);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetPropertyNames", &GenericDispatcherInternalCalls::Reflection_GetPropertyNames);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetEBusNames", &GenericDispatcherInternalCalls::Reflection_GetEBusNames);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetEBusEventNames", &GenericDispatcherInternalCalls::Reflection_GetEBusEventNames);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_ClassExists", &GenericDispatcherInternalCalls::Reflection_ClassExists);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_MethodExists", &GenericDispatcherInternalCalls::Reflection_MethodExists);
 
         // Method invocation
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_InvokeStaticMethod", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::InvokeStaticMethod));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_InvokeInstanceMethod", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::InvokeInstanceMethod));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_InvokeGlobalMethod", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::InvokeGlobalMethod));
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_InvokeStaticMethod", &GenericDispatcherInternalCalls::InvokeStaticMethod);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_InvokeInstanceMethod", &GenericDispatcherInternalCalls::InvokeInstanceMethod);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_InvokeGlobalMethod", &GenericDispatcherInternalCalls::InvokeGlobalMethod);
+
+        // Typed dispatch - generated wrappers resolve once, then invoke by handle
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_ResolveMethod", &GenericDispatcherInternalCalls::ResolveMethod);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_InvokeResolved", &GenericDispatcherInternalCalls::InvokeResolved);
 
         // Property access
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetProperty", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::GetProperty));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_SetProperty", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::SetProperty));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetGlobalProperty", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::GetGlobalProperty));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_SetGlobalProperty", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::SetGlobalProperty));
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetProperty", &GenericDispatcherInternalCalls::GetProperty);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_SetProperty", &GenericDispatcherInternalCalls::SetProperty);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_GetGlobalProperty", &GenericDispatcherInternalCalls::GetGlobalProperty);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_SetGlobalProperty", &GenericDispatcherInternalCalls::SetGlobalProperty);
 
         // EBus
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_BroadcastEBusEvent", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::BroadcastEBusEvent));
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_BroadcastEBusEvent", &GenericDispatcherInternalCalls::BroadcastEBusEvent);
 
         // Phase 18-E2: managed EBus handler authoring. RegisterEBusHandler
         // spins up a BehaviorEBusHandler with a generic hook that forwards
         // every event back into managed via Coral.
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_RegisterEBusHandler", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::RegisterEBusHandler));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_UnregisterEBusHandler", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::UnregisterEBusHandler));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_SendEBusEvent", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::SendEBusEvent));
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_RegisterEBusHandler", &GenericDispatcherInternalCalls::RegisterEBusHandler);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_UnregisterEBusHandler", &GenericDispatcherInternalCalls::UnregisterEBusHandler);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_SendEBusEvent", &GenericDispatcherInternalCalls::SendEBusEvent);
 
         // Object lifecycle
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_CreateInstance", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::CreateInstance));
-        assembly->AddInternalCall("O3DE.Reflection.ReflectionInternalCalls", "Reflection_DestroyInstance", reinterpret_cast<void*>(&GenericDispatcherInternalCalls::DestroyInstance));
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_CreateInstance", &GenericDispatcherInternalCalls::CreateInstance);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.Reflection.ReflectionInternalCalls", "Reflection_DestroyInstance", &GenericDispatcherInternalCalls::DestroyInstance);
 
         assembly->UploadInternalCalls();
 
@@ -1702,6 +1714,18 @@ namespace O3DESharp
                     return true;
                 }
 
+                // Lookup without copying the class name - for the typed
+                // dispatch path, which never formats a message on success.
+                bool LookupObject(int64_t handle, void*& outAddress, AZ::BehaviorClass*& outClass) const
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                    auto it = m_entries.find(handle);
+                    if (it == m_entries.end()) return false;
+                    outAddress = it->second.address;
+                    outClass = it->second.behaviorClass;
+                    return true;
+                }
+
                 // Removes the entry and returns the snapshot so the
                 // caller can run the C++ destructor + deallocator
                 // outside the lock (those may re-enter the dispatcher).
@@ -1933,17 +1957,35 @@ namespace O3DESharp
                 // arguments via its built-in primitive support.
                 Coral::ScopedString eventNameStr = Coral::String::New(eventName);
                 Coral::ScopedString argsJsonStr = Coral::String::New(argsJson);
-                try
+                AZ_PROFILE_SCOPE(O3DESharp, "EBus %s.%s", proxy->bus->m_name.c_str(), eventName);
+                // Handlers fire from any thread, so intern per event rather
+                // than caching on the proxy; only paid while tracing.
+                const bool tracing = InteropTracer::IsTracing();
+                InteropTraceScope trace(InteropTraceKind::NativeToManaged,
+                    tracing ? InteropTracer::Intern(proxy->bus->m_name) : nullptr,
+                    tracing ? InteropTracer::Intern(eventName) : nullptr);
+                ScriptCostCounters cost;
                 {
-                    registryType->InvokeStaticMethod(
-                        "DispatchEvent", token, eventNameStr, argsJsonStr);
+                    ScriptCostScope costScope(cost);
+                    try
+                    {
+                        registryType->InvokeStaticMethod(
+                            "DispatchEvent", token, eventNameStr, argsJsonStr);
+                    }
+                    catch (...)
+                    {
+                        AZ_Warning("O3DESharp", false,
+                            "ForwardEventToManaged('%s'): exception from managed DispatchEvent; "
+                            "event dropped",
+                            eventName);
+                    }
                 }
-                catch (...)
+                if (cost.calls != 0)
                 {
-                    AZ_Warning("O3DESharp", false,
-                        "ForwardEventToManaged('%s'): exception from managed DispatchEvent; "
-                        "event dropped",
-                        eventName);
+                    if (ScriptProfiler* profiler = ScriptProfiler::GetActive())
+                    {
+                        profiler->RecordEBusEvent(proxy->bus->m_name, cost);
+                    }
                 }
             }
 
@@ -2086,6 +2128,7 @@ namespace O3DESharp
 
         Coral::String InvokeStaticMethod(Coral::String className, Coral::String methodName, Coral::String argsJson)
         {
+            InteropRecordScope record(InteropRecordOp::InvokeStaticMethod, className, methodName, argsJson);
             std::string classNameStr(className);
             std::string methodNameStr(methodName);
             // Deferred: only formatted when an error branch below actually
@@ -2139,6 +2182,7 @@ namespace O3DESharp
 
         Coral::String InvokeInstanceMethod(Coral::String className, Coral::String methodName, int64_t instanceHandle, Coral::String argsJson)
         {
+            InteropRecordScope record(InteropRecordOp::InvokeInstanceMethod, className, methodName, instanceHandle, argsJson);
             std::string classNameStr(className);
             std::string methodNameStr(methodName);
             // Deferred: only formatted when actually read below (an early
@@ -2321,6 +2365,7 @@ namespace O3DESharp
 
         Coral::String InvokeGlobalMethod(Coral::String methodName, Coral::String argsJson)
         {
+            InteropRecordScope record(InteropRecordOp::InvokeGlobalMethod, methodName, argsJson);
             std::string methodNameStr(methodName);
             auto contextLabel = [&]() -> AZStd::string
             {
@@ -2349,6 +2394,7 @@ namespace O3DESharp
 
         Coral::String GetProperty(Coral::String className, Coral::String propertyName, int64_t instanceHandle)
         {
+            InteropRecordScope record(InteropRecordOp::GetProperty, className, propertyName, instanceHandle);
             std::string classNameStr(className);
             std::string propertyNameStr(propertyName);
             auto contextLabel = [&]() -> AZStd::string
@@ -2438,6 +2484,7 @@ namespace O3DESharp
 
         bool SetProperty(Coral::String className, Coral::String propertyName, int64_t instanceHandle, Coral::String valueJson)
         {
+            InteropRecordScope record(InteropRecordOp::SetProperty, className, propertyName, instanceHandle, valueJson);
             std::string classNameStr(className);
             std::string propertyNameStr(propertyName);
             auto contextLabel = [&]() -> AZStd::string
@@ -2521,6 +2568,7 @@ namespace O3DESharp
 
         Coral::String GetGlobalProperty(Coral::String propertyName)
         {
+            InteropRecordScope record(InteropRecordOp::GetGlobalProperty, propertyName);
             std::string propertyNameStr(propertyName);
             auto contextLabel = [&]() -> AZStd::string
             {
@@ -2557,6 +2605,7 @@ namespace O3DESharp
 
         bool SetGlobalProperty(Coral::String propertyName, Coral::String valueJson)
         {
+            InteropRecordScope record(InteropRecordOp::SetGlobalProperty, propertyName, valueJson);
             std::string propertyNameStr(propertyName);
 
             auto* ctx = GetBehaviorContext();
@@ -2601,11 +2650,13 @@ namespace O3DESharp
 
         Coral::String BroadcastEBusEvent(Coral::String busName, Coral::String eventName, Coral::String argsJson)
         {
+            InteropRecordScope record(InteropRecordOp::BroadcastEBusEvent, busName, eventName, argsJson);
             return DispatchEBusEvent(busName, eventName, argsJson, /*addressed*/ false, /*busId*/ 0u);
         }
 
         Coral::String SendEBusEvent(Coral::String busName, Coral::String eventName, int64_t address, Coral::String argsJson)
         {
+            InteropRecordScope record(InteropRecordOp::SendEBusEvent, busName, eventName, address, argsJson);
             return DispatchEBusEvent(
                 busName, eventName, argsJson,
                 /*addressed*/ true,
@@ -2614,6 +2665,7 @@ namespace O3DESharp
 
         int64_t CreateInstance(Coral::String className, Coral::String argsJson)
         {
+            InteropRecordScope record(InteropRecordOp::CreateInstance, className, argsJson);
             AZ_UNUSED(argsJson);  // constructor args - default-construct only for now
 
             if (!s_dispatcherInstance)
@@ -2653,11 +2705,12 @@ namespace O3DESharp
 
             void* address = result.returnValue.objectHandle;
             const int64_t handle = s_instanceTable.Register(address, behaviorClass, AZStd::string(classNameStr.c_str()));
-            return handle;
+            return record.Result(handle);
         }
 
         void DestroyInstance(Coral::String className, int64_t instanceHandle)
         {
+            InteropRecordScope record(InteropRecordOp::DestroyInstance, className, instanceHandle);
             AZ_UNUSED(className);  // handle-recorded class is the source of truth
             if (!s_dispatcherInstance || instanceHandle == 0)
             {
@@ -2869,6 +2922,420 @@ namespace O3DESharp
                 }
             }
         }
+
+        namespace
+        {
+            // ============================================================
+            // Typed dispatch: pre-resolved methods + InteropArgument slots.
+            // ============================================================
+            // The JSON entry points above look the class and method up by
+            // name, parse an args array and format a result string on
+            // every call. Generated wrappers know their signature at build
+            // time, so they resolve once through ResolveMethod and then
+            // call InvokeResolved with a stack-allocated InteropArgument
+            // block. The slot kind of every argument and of the result is
+            // worked out here at resolve time from the BehaviorParameter
+            // type ids, so the invoke path is a switch per argument.
+            constexpr size_t MaxTypedArguments = 8;
+
+            enum class TypedSlot : AZ::u8
+            {
+                Unsupported,
+                Void,
+                Bool,
+                Int8,
+                UInt8,
+                Int16,
+                UInt16,
+                Int32,
+                UInt32,
+                Int64,
+                UInt64,
+                Float,
+                Double,
+                Vector2,
+                Vector3,
+                Quaternion,
+                EntityId,
+            };
+
+            // Strings, containers and reflected objects stay on the JSON
+            // path - none of them fit a 16-byte slot without an
+            // allocation on one side or the other.
+            TypedSlot ClassifyTypedSlot(const AZ::BehaviorParameter& param)
+            {
+                if ((param.m_traits & AZ::BehaviorParameter::TR_POINTER) != 0)
+                {
+                    return TypedSlot::Unsupported;
+                }
+
+                const AZ::TypeId& t = param.m_typeId;
+                if (t == azrtti_typeid<bool>())           return TypedSlot::Bool;
+                if (t == azrtti_typeid<AZ::s8>())         return TypedSlot::Int8;
+                if (t == azrtti_typeid<AZ::u8>())         return TypedSlot::UInt8;
+                if (t == azrtti_typeid<AZ::s16>())        return TypedSlot::Int16;
+                if (t == azrtti_typeid<AZ::u16>())        return TypedSlot::UInt16;
+                if (t == azrtti_typeid<AZ::s32>())        return TypedSlot::Int32;
+                if (t == azrtti_typeid<AZ::u32>())        return TypedSlot::UInt32;
+                if (t == azrtti_typeid<AZ::s64>())        return TypedSlot::Int64;
+                if (t == azrtti_typeid<AZ::u64>())        return TypedSlot::UInt64;
+                if (t == azrtti_typeid<float>())          return TypedSlot::Float;
+                if (t == azrtti_typeid<double>())         return TypedSlot::Double;
+                if (t == azrtti_typeid<AZ::Vector2>())    return TypedSlot::Vector2;
+                if (t == azrtti_typeid<AZ::Vector3>())    return TypedSlot::Vector3;
+                if (t == azrtti_typeid<AZ::Quaternion>()) return TypedSlot::Quaternion;
+                if (t == azrtti_typeid<AZ::EntityId>())   return TypedSlot::EntityId;
+                return TypedSlot::Unsupported;
+            }
+
+            // Same shape as JsonValueToBehaviorParameter: type id, traits
+            // and name from the parameter, value in the argument's inline
+            // temp storage.
+            void StoreTypedArgument(
+                TypedSlot slot,
+                const InteropArgument& in,
+                const AZ::BehaviorParameter& param,
+                AZ::BehaviorArgument& outArg)
+            {
+                outArg.m_typeId = param.m_typeId;
+                outArg.m_traits = param.m_traits;
+                outArg.m_name = param.m_name;
+
+                switch (slot)
+                {
+                case TypedSlot::Bool:       outArg.StoreInTempData(bool(in.boolValue)); break;
+                case TypedSlot::Int8:       outArg.StoreInTempData(AZ::s8(in.int8Value)); break;
+                case TypedSlot::UInt8:      outArg.StoreInTempData(AZ::u8(in.uint8Value)); break;
+                case TypedSlot::Int16:      outArg.StoreInTempData(AZ::s16(in.int16Value)); break;
+                case TypedSlot::UInt16:     outArg.StoreInTempData(AZ::u16(in.uint16Value)); break;
+                case TypedSlot::Int32:      outArg.StoreInTempData(AZ::s32(in.int32Value)); break;
+                case TypedSlot::UInt32:     outArg.StoreInTempData(AZ::u32(in.uint32Value)); break;
+                case TypedSlot::Int64:      outArg.StoreInTempData(AZ::s64(in.int64Value)); break;
+                case TypedSlot::UInt64:     outArg.StoreInTempData(AZ::u64(in.uint64Value)); break;
+                case TypedSlot::Float:      outArg.StoreInTempData(float(in.floatValue)); break;
+                case TypedSlot::Double:     outArg.StoreInTempData(double(in.doubleValue)); break;
+                case TypedSlot::Vector2:
+                    outArg.StoreInTempData(AZ::Vector2(in.vectorValue[0], in.vectorValue[1]));
+                    break;
+                case TypedSlot::Vector3:
+                    outArg.StoreInTempData(AZ::Vector3(in.vectorValue[0], in.vectorValue[1], in.vectorValue[2]));
+                    break;
+                case TypedSlot::Quaternion:
+                    outArg.StoreInTempData(AZ::Quaternion(in.vectorValue[0], in.vectorValue[1], in.vectorValue[2], in.vectorValue[3]));
+                    break;
+                case TypedSlot::EntityId:
+                    outArg.StoreInTempData(AZ::EntityId(in.uint64Value));
+                    break;
+                default:
+                    break; // rejected at resolve time
+                }
+            }
+
+            void LoadTypedResult(TypedSlot slot, const AZ::BehaviorArgument& result, InteropArgument& out)
+            {
+                memset(&out, 0, sizeof(out));
+                if (result.m_value == nullptr)
+                {
+                    return;
+                }
+
+                switch (slot)
+                {
+                case TypedSlot::Bool:       out.boolValue = *result.GetAsUnsafe<bool>(); break;
+                case TypedSlot::Int8:       out.int8Value = *result.GetAsUnsafe<AZ::s8>(); break;
+                case TypedSlot::UInt8:      out.uint8Value = *result.GetAsUnsafe<AZ::u8>(); break;
+                case TypedSlot::Int16:      out.int16Value = *result.GetAsUnsafe<AZ::s16>(); break;
+                case TypedSlot::UInt16:     out.uint16Value = *result.GetAsUnsafe<AZ::u16>(); break;
+                case TypedSlot::Int32:      out.int32Value = *result.GetAsUnsafe<AZ::s32>(); break;
+                case TypedSlot::UInt32:     out.uint32Value = *result.GetAsUnsafe<AZ::u32>(); break;
+                case TypedSlot::Int64:      out.int64Value = *result.GetAsUnsafe<AZ::s64>(); break;
+                case TypedSlot::UInt64:     out.uint64Value = *result.GetAsUnsafe<AZ::u64>(); break;
+                case TypedSlot::Float:      out.floatValue = *result.GetAsUnsafe<float>(); break;
+                case TypedSlot::Double:     out.doubleValue = *result.GetAsUnsafe<double>(); break;
+                case TypedSlot::Vector2:
+                    {
+                        const AZ::Vector2* v = result.GetAsUnsafe<AZ::Vector2>();
+                        out.vectorValue[0] = v->GetX();
+                        out.vectorValue[1] = v->GetY();
+                    }
+                    break;
+                case TypedSlot::Vector3:
+                    {
+                        const AZ::Vector3* v = result.GetAsUnsafe<AZ::Vector3>();
+                        out.vectorValue[0] = v->GetX();
+                        out.vectorValue[1] = v->GetY();
+                        out.vectorValue[2] = v->GetZ();
+                    }
+                    break;
+                case TypedSlot::Quaternion:
+                    {
+                        const AZ::Quaternion* q = result.GetAsUnsafe<AZ::Quaternion>();
+                        out.vectorValue[0] = q->GetX();
+                        out.vectorValue[1] = q->GetY();
+                        out.vectorValue[2] = q->GetZ();
+                        out.vectorValue[3] = q->GetW();
+                    }
+                    break;
+                case TypedSlot::EntityId:
+                    out.uint64Value = static_cast<AZ::u64>(*result.GetAsUnsafe<AZ::EntityId>());
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            struct ResolvedMethod
+            {
+                AZ::BehaviorMethod* method = nullptr;
+                AZStd::fixed_vector<TypedSlot, MaxTypedArguments> arguments;
+                TypedSlot result = TypedSlot::Void;
+            };
+
+            // Handles are (generation << 32) | (index + 1). Clear() bumps
+            // the generation, so a handle cached by managed code across a
+            // dispatcher restart is reported stale instead of reaching a
+            // BehaviorMethod that may no longer exist. A method resolved
+            // twice (same wrapper in two generated assemblies) shares one
+            // entry.
+            class ResolvedMethodTable
+            {
+            public:
+                int64_t Add(const ResolvedMethod& resolved)
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                    auto it = m_indices.find(resolved.method);
+                    AZ::u32 index;
+                    if (it != m_indices.end())
+                    {
+                        index = it->second;
+                    }
+                    else
+                    {
+                        index = static_cast<AZ::u32>(m_entries.size());
+                        m_entries.push_back(resolved);
+                        m_indices.emplace(resolved.method, index);
+                    }
+                    return static_cast<int64_t>((static_cast<AZ::u64>(m_generation) << 32) | (index + 1));
+                }
+
+                bool Lookup(int64_t handle, ResolvedMethod& outResolved) const
+                {
+                    const AZ::u32 generation = static_cast<AZ::u32>(static_cast<AZ::u64>(handle) >> 32);
+                    const AZ::u32 slot = static_cast<AZ::u32>(static_cast<AZ::u64>(handle) & 0xFFFFFFFFu);
+                    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                    if (generation != m_generation || slot == 0 || slot > m_entries.size())
+                    {
+                        return false;
+                    }
+                    outResolved = m_entries[slot - 1];
+                    return true;
+                }
+
+                void Clear()
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                    m_entries.clear();
+                    m_indices.clear();
+                    ++m_generation;
+                }
+
+            private:
+                mutable AZStd::mutex m_mutex;
+                AZStd::vector<ResolvedMethod> m_entries;
+                AZStd::unordered_map<AZ::BehaviorMethod*, AZ::u32> m_indices;
+                AZ::u32 m_generation = 1;
+            };
+
+            static ResolvedMethodTable s_resolvedMethods;
+
+            // Walk an overload chain for the variant taking argumentCount
+            // arguments, not counting `this`.
+            AZ::BehaviorMethod* FindOverloadByArity(AZ::BehaviorMethod* method, size_t argumentCount)
+            {
+                for (; method != nullptr; method = method->m_overload)
+                {
+                    const size_t thisCount = method->IsMember() ? 1 : 0;
+                    if (method->GetNumArguments() == argumentCount + thisCount)
+                    {
+                        return method;
+                    }
+                }
+                return nullptr;
+            }
+        } // anonymous namespace
+
+        int64_t ResolveMethod(Coral::String className, Coral::String memberName, int32_t argumentCount, int32_t kind)
+        {
+            InteropRecordScope record(InteropRecordOp::ResolveMethod, className, memberName, argumentCount, kind);
+            std::string classNameStr(className);
+            std::string memberNameStr(memberName);
+            auto warn = [&](const char* reason)
+            {
+                AZ_Warning("O3DESharp", false, "ResolveMethod('%s', '%s', %d): %s",
+                    classNameStr.c_str(), memberNameStr.c_str(), argumentCount, reason);
+            };
+
+            AZ::BehaviorContext* ctx = GetBehaviorContext();
+            if (ctx == nullptr)
+            {
+                warn("no BehaviorContext");
+                return 0;
+            }
+            if (argumentCount < 0 || static_cast<size_t>(argumentCount) > MaxTypedArguments)
+            {
+                warn("argument count outside the typed-dispatch range");
+                return 0;
+            }
+
+            AZ::BehaviorClass* cls = nullptr;
+            if (!classNameStr.empty())
+            {
+                auto classIt = ctx->m_classes.find(classNameStr.c_str());
+                if (classIt == ctx->m_classes.end())
+                {
+                    warn("class not reflected");
+                    return 0;
+                }
+                cls = classIt->second;
+            }
+
+            AZ::BehaviorMethod* method = nullptr;
+            switch (static_cast<InteropMemberKind>(kind))
+            {
+            case InteropMemberKind::Method:
+                {
+                    auto& methods = cls ? cls->m_methods : ctx->m_methods;
+                    auto methodIt = methods.find(memberNameStr.c_str());
+                    if (methodIt != methods.end())
+                    {
+                        method = FindOverloadByArity(methodIt->second, static_cast<size_t>(argumentCount));
+                    }
+                }
+                break;
+            case InteropMemberKind::PropertyGetter:
+            case InteropMemberKind::PropertySetter:
+                {
+                    auto& properties = cls ? cls->m_properties : ctx->m_properties;
+                    auto propIt = properties.find(memberNameStr.c_str());
+                    if (propIt != properties.end() && propIt->second != nullptr)
+                    {
+                        method = static_cast<InteropMemberKind>(kind) == InteropMemberKind::PropertyGetter
+                            ? propIt->second->m_getter : propIt->second->m_setter;
+                        method = FindOverloadByArity(method, static_cast<size_t>(argumentCount));
+                    }
+                }
+                break;
+            default:
+                warn("unknown member kind");
+                return 0;
+            }
+
+            if (method == nullptr)
+            {
+                warn("not reflected with that argument count");
+                return 0;
+            }
+
+            ResolvedMethod resolved;
+            resolved.method = method;
+            const size_t thisCount = method->IsMember() ? 1 : 0;
+            for (size_t i = 0; i < static_cast<size_t>(argumentCount); ++i)
+            {
+                const AZ::BehaviorParameter* param = method->GetArgument(i + thisCount);
+                const TypedSlot slot = param ? ClassifyTypedSlot(*param) : TypedSlot::Unsupported;
+                if (slot == TypedSlot::Unsupported)
+                {
+                    warn("an argument type has no typed-dispatch representation");
+                    return 0;
+                }
+                resolved.arguments.push_back(slot);
+            }
+            if (method->HasResult())
+            {
+                const AZ::BehaviorParameter* resultParam = method->GetResult();
+                resolved.result = resultParam ? ClassifyTypedSlot(*resultParam) : TypedSlot::Unsupported;
+                if (resolved.result == TypedSlot::Unsupported)
+                {
+                    warn("the return type has no typed-dispatch representation");
+                    return 0;
+                }
+            }
+
+            return record.Result(s_resolvedMethods.Add(resolved));
+        }
+
+        int32_t InvokeResolved(
+            int64_t methodHandle,
+            int64_t instanceHandle,
+            const InteropArgument* arguments,
+            int32_t argumentCount,
+            InteropArgument* result)
+        {
+            InteropRecordScope record(InteropRecordOp::InvokeResolved, methodHandle, instanceHandle, InteropArgumentSpan{ arguments, argumentCount });
+            ResolvedMethod resolved;
+            if (!s_resolvedMethods.Lookup(methodHandle, resolved))
+            {
+                return record.Result(static_cast<int32_t>(InteropInvokeStatus::StaleHandle));
+            }
+            if (argumentCount < 0 || static_cast<size_t>(argumentCount) != resolved.arguments.size()
+                || (argumentCount > 0 && arguments == nullptr))
+            {
+                return record.Result(static_cast<int32_t>(InteropInvokeStatus::ArgumentMismatch));
+            }
+
+            AZ::BehaviorMethod* method = resolved.method;
+            AZ::BehaviorArgument dispatchArgs[MaxTypedArguments + 1];
+            unsigned int count = 0;
+            if (method->IsMember())
+            {
+                void* address = nullptr;
+                AZ::BehaviorClass* behaviorClass = nullptr;
+                if (!s_instanceTable.LookupObject(instanceHandle, address, behaviorClass)
+                    || address == nullptr || behaviorClass == nullptr)
+                {
+                    return record.Result(static_cast<int32_t>(InteropInvokeStatus::InvalidInstance));
+                }
+                dispatchArgs[0].m_value = address;
+                dispatchArgs[0].m_typeId = behaviorClass->m_typeId;
+                dispatchArgs[0].m_traits = AZ::BehaviorParameter::TR_POINTER;
+                count = 1;
+            }
+            for (size_t i = 0; i < resolved.arguments.size(); ++i, ++count)
+            {
+                StoreTypedArgument(resolved.arguments[i], arguments[i], *method->GetArgument(count), dispatchArgs[count]);
+            }
+
+            // Zeroed storage for the result, big enough for every slot
+            // kind - see ResultStorageRequirements for why m_value has to
+            // point somewhere before Call.
+            alignas(16) AZ::u8 resultStorage[sizeof(AZ::Quaternion)] = {};
+            AZ::BehaviorArgument resultArg;
+            const bool hasResult = resolved.result != TypedSlot::Void;
+            if (hasResult)
+            {
+                const AZ::BehaviorParameter* resultParam = method->GetResult();
+                resultArg.m_typeId = resultParam->m_typeId;
+                resultArg.m_name = resultParam->m_name;
+                resultArg.m_traits = resultParam->m_traits;
+                resultArg.m_value = resultStorage;
+            }
+
+            if (!method->Call(count > 0 ? dispatchArgs : nullptr, count, hasResult ? &resultArg : nullptr))
+            {
+                return record.Result(static_cast<int32_t>(InteropInvokeStatus::CallFailed));
+            }
+
+            if (hasResult && result != nullptr)
+            {
+                LoadTypedResult(resolved.result, resultArg, *result);
+            }
+            return record.Result(static_cast<int32_t>(InteropInvokeStatus::Ok));
+        }
+
+        void ReleaseResolvedMethods()
+        {
+            s_resolvedMethods.Clear();
+        }
     }
 
 } // namespace O3DESharp
@@ -80,6 +80,48 @@ namespace O3DESharp
         static MarshalledValue FromObject(void* handle, const AZStd::string& typeName);
     };
 
+    /**
+     * One argument or return slot of the typed dispatch path
+     * (GenericDispatcherInternalCalls::InvokeResolved). Fixed-size and
+     * blittable so managed code can stackalloc a whole argument list;
+     * which member is live follows from the resolved method's signature.
+     * Must match O3DE.Reflection.NativeArgument.
+     */
+    union InteropArgument
+    {
+        bool boolValue;
+        int8_t int8Value;
+        int16_t int16Value;
+        int32_t int32Value;
+        int64_t int64Value;
+        uint8_t uint8Value;
+        uint16_t uint16Value;
+        uint32_t uint32Value;
+        uint64_t uint64Value;   // also AZ::EntityId
+        float floatValue;
+        double doubleValue;
+        float vectorValue[4];   // Vector2 / Vector3 / Quaternion, xyzw
+    };
+    static_assert(sizeof(InteropArgument) == 16, "InteropArgument must match NativeArgument's 16-byte layout");
+
+    /// What ResolveMethod looks up. Must match O3DE.Reflection.NativeMemberKind.
+    enum class InteropMemberKind : int32_t
+    {
+        Method = 0,
+        PropertyGetter = 1,
+        PropertySetter = 2,
+    };
+
+    /// InvokeResolved outcome. Must match O3DE.Reflection.NativeInvokeStatus.
+    enum class InteropInvokeStatus : int32_t
+    {
+        Ok = 0,
+        StaleHandle = 1,        // dispatcher restarted since the handle was resolved
+        InvalidInstance = 2,    // instance handle not in the NativeObject table
+        ArgumentMismatch = 3,   // argument count differs from the resolved signature
+        CallFailed = 4,         // BehaviorMethod::Call returned false
+    };
+
     /**
      * Result of a dispatched method call
      */
@@ -371,6 +413,20 @@ namespace O3DESharp
         // release (0 on failure). 'address' is ignored for singleton buses.
         int64_t RegisterEBusHandler(Coral::String busName, uint64_t address, int64_t managedToken);
         void UnregisterEBusHandler(int64_t managedToken);
+
+        // Typed dispatch for generated wrappers. ResolveMethod looks a
+        // method (or property accessor) up once - className empty for
+        // globals, kind an InteropMemberKind - and returns an opaque
+        // handle, 0 if it isn't reflected or its signature has no
+        // InteropArgument representation. InvokeResolved then calls it
+        // with a blittable argument block: no JSON, no name lookup.
+        // Returns an InteropInvokeStatus; 'result' may be null for void.
+        int64_t ResolveMethod(Coral::String className, Coral::String memberName, int32_t argumentCount, int32_t kind);
+        int32_t InvokeResolved(int64_t methodHandle, int64_t instanceHandle, const InteropArgument* arguments, int32_t argumentCount, InteropArgument* result);
+
+        // Invalidate every handle ResolveMethod has given out. Called on
+        // dispatcher shutdown; managed callers re-resolve on StaleHandle.
+        void ReleaseResolvedMethods();
     }
 
 } // namespace O3DESharp
\ No newline at end of file
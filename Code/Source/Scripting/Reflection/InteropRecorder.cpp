@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "InteropRecorder.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+#include <string>
+
+namespace O3DESharp
+{
+    namespace
+    {
+        // File layout, in host byte order (little-endian on every supported platform):
+        //   header:  "O3IR" u32 version
+        //   record:  u8 op
+        //     DefineString: u32 length, bytes
+        //     otherwise:    u64 startNs, u64 durationNs, s64 result, u8 fieldCount, fields
+        //   field:   u8 kind
+        //     Int: s64 | String: u32 string id | Arguments: u8 count, count * 16 bytes
+        constexpr char CaptureMagic[4] = { 'O', '3', 'I', 'R' };
+
+        constexpr const char* DefaultCapturePath = "@user@/O3DESharp/InteropCapture.o3ir";
+
+        // Written out once this much is pending, and on Stop
+        constexpr size_t FlushBytes = 64 * 1024;
+
+        struct RecorderState
+        {
+            AZStd::mutex mutex;
+            AZ::IO::SystemFile file;
+            AZStd::vector<AZ::u8> pending;
+            AZStd::unordered_map<AZStd::string, AZ::u32> stringIds;
+            AZStd::chrono::steady_clock::time_point start;
+            AZ::u64 records = 0;
+        };
+
+        RecorderState& GetState()
+        {
+            static RecorderState s_state;
+            return s_state;
+        }
+
+        template<typename T>
+        void Append(AZStd::vector<AZ::u8>& out, const T& value)
+        {
+            const auto* bytes = reinterpret_cast<const AZ::u8*>(&value);
+            out.insert(out.end(), bytes, bytes + sizeof(T));
+        }
+
+        void FlushPending(RecorderState& state)
+        {
+            if (!state.pending.empty())
+            {
+                state.file.Write(state.pending.data(), state.pending.size());
+                state.pending.clear();
+            }
+        }
+
+        AZ::u64 ToNs(AZStd::chrono::steady_clock::duration duration)
+        {
+            return static_cast<AZ::u64>(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(duration).count());
+        }
+
+        // Bounds-checked cursor over a loaded capture
+        class CaptureReader
+        {
+        public:
+            CaptureReader(const AZ::u8* data, size_t size)
+                : m_data(data)
+                , m_size(size)
+            {
+            }
+
+            bool AtEnd() const
+            {
+                return m_offset == m_size;
+            }
+
+            template<typename T>
+            bool Read(T& value)
+            {
+                if (m_size - m_offset < sizeof(T))
+                {
+                    return false;
+                }
+                memcpy(&value, m_data + m_offset, sizeof(T));
+                m_offset += sizeof(T);
+                return true;
+            }
+
+            bool ReadBytes(void* out, size_t size)
+            {
+                if (m_size - m_offset < size)
+                {
+                    return false;
+                }
+                memcpy(out, m_data + m_offset, size);
+                m_offset += size;
+                return true;
+            }
+
+            size_t GetOffset() const
+            {
+                return m_offset;
+            }
+
+        private:
+            const AZ::u8* m_data;
+            size_t m_size;
+            size_t m_offset = 0;
+        };
+    }
+
+    static void o3desharp_InteropRecord(const AZ::ConsoleCommandContainer& arguments)
+    {
+        const AZStd::string path(arguments.empty() ? AZStd::string_view(DefaultCapturePath) : arguments.front());
+        InteropRecorder::Start(path.c_str());
+    }
+    AZ_CONSOLEFREEFUNC(o3desharp_InteropRecord, AZ::ConsoleFunctorFlags::Null,
+        "Record GenericDispatcher calls for O3DESharp.InteropReplay: o3desharp_InteropRecord [path=@user@/O3DESharp/InteropCapture.o3ir]");
+
+    static void o3desharp_InteropRecordStop([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        InteropRecorder::Stop();
+    }
+    AZ_CONSOLEFREEFUNC(o3desharp_InteropRecordStop, AZ::ConsoleFunctorFlags::Null,
+        "Finish the capture o3desharp_InteropRecord started");
+
+    const char* GetInteropRecordOpName(InteropRecordOp op)
+    {
+        switch (op)
+        {
+        case InteropRecordOp::DefineString:         return "DefineString";
+        case InteropRecordOp::ResolveMethod:        return "ResolveMethod";
+        case InteropRecordOp::InvokeResolved:       return "InvokeResolved";
+        case InteropRecordOp::InvokeStaticMethod:   return "InvokeStaticMethod";
+        case InteropRecordOp::InvokeInstanceMethod: return "InvokeInstanceMethod";
+        case InteropRecordOp::InvokeGlobalMethod:   return "InvokeGlobalMethod";
+        case InteropRecordOp::GetProperty:          return "GetProperty";
+        case InteropRecordOp::SetProperty:          return "SetProperty";
+        case InteropRecordOp::GetGlobalProperty:    return "GetGlobalProperty";
+        case InteropRecordOp::SetGlobalProperty:    return "SetGlobalProperty";
+        case InteropRecordOp::BroadcastEBusEvent:   return "BroadcastEBusEvent";
+        case InteropRecordOp::SendEBusEvent:        return "SendEBusEvent";
+        case InteropRecordOp::CreateInstance:       return "CreateInstance";
+        case InteropRecordOp::DestroyInstance:      return "DestroyInstance";
+        default:                                    return "Unknown";
+        }
+    }
+
+    AZStd::atomic_bool InteropRecorder::s_recording{ false };
+
+    bool InteropRecorder::Start(const char* path)
+    {
+        RecorderState& state = GetState();
+        AZStd::scoped_lock lock(state.mutex);
+        if (state.file.IsOpen())
+        {
+            AZLOG_WARN("InteropRecorder: Already recording; o3desharp_InteropRecordStop first");
+            return false;
+        }
+
+        AZ::IO::FixedMaxPath resolved(path);
+        if (AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance())
+        {
+            fileIO->ResolvePath(resolved, AZ::IO::PathView(path));
+        }
+        if (!state.file.Open(resolved.c_str(),
+            AZ::IO::SystemFile::SF_OPEN_CREATE |
+            AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY |
+            AZ::IO::SystemFile::SF_OPEN_CREATE_PATH))
+        {
+            AZLOG_ERROR("InteropRecorder: Failed to open %s for writing", resolved.c_str());
+            return false;
+        }
+
+        state.pending.clear();
+        state.stringIds.clear();
+        state.records = 0;
+        state.pending.insert(state.pending.end(), CaptureMagic, CaptureMagic + sizeof(CaptureMagic));
+        Append(state.pending, FormatVersion);
+        state.start = AZStd::chrono::steady_clock::now();
+        s_recording.store(true, AZStd::memory_order_relaxed);
+
+        AZLOG_INFO("InteropRecorder: Recording to %s", resolved.c_str());
+        return true;
+    }
+
+    void InteropRecorder::Stop()
+    {
+        s_recording.store(false, AZStd::memory_order_relaxed);
+
+        RecorderState& state = GetState();
+        AZStd::scoped_lock lock(state.mutex);
+        if (!state.file.IsOpen())
+        {
+            return;
+        }
+        FlushPending(state);
+        state.file.Close();
+        AZLOG_INFO("InteropRecorder: Captured %llu calls, %zu distinct strings",
+            static_cast<unsigned long long>(state.records), state.stringIds.size());
+        state.stringIds.clear();
+    }
+
+    void InteropRecorder::Commit(
+        InteropRecordOp op,
+        AZStd::chrono::steady_clock::time_point start,
+        AZStd::chrono::steady_clock::time_point end,
+        AZ::s64 result,
+        const Field* fields,
+        size_t fieldCount)
+    {
+        RecorderState& state = GetState();
+        AZStd::scoped_lock lock(state.mutex);
+        if (!state.file.IsOpen())
+        {
+            // Stopped while the call ran
+            return;
+        }
+
+        // Define new strings first, so the record only carries ids
+        AZ::u32 stringIds[InteropCaptureRecord::MaxFields] = {};
+        for (size_t i = 0; i < fieldCount; ++i)
+        {
+            if (fields[i].kind != InteropRecordField::Kind::String)
+            {
+                continue;
+            }
+            const std::string text = fields[i].string ? std::string(*fields[i].string) : std::string();
+            const AZStd::string key(text.c_str(), text.size());
+            auto it = state.stringIds.find(key);
+            if (it == state.stringIds.end())
+            {
+                it = state.stringIds.emplace(key, static_cast<AZ::u32>(state.stringIds.size())).first;
+                Append(state.pending, static_cast<AZ::u8>(InteropRecordOp::DefineString));
+                Append(state.pending, static_cast<AZ::u32>(key.size()));
+                state.pending.insert(state.pending.end(), key.begin(), key.end());
+            }
+            stringIds[i] = it->second;
+        }
+
+        Append(state.pending, static_cast<AZ::u8>(op));
+        Append(state.pending, start > state.start ? ToNs(start - state.start) : AZ::u64{ 0 });
+        Append(state.pending, ToNs(end - start));
+        Append(state.pending, result);
+        Append(state.pending, static_cast<AZ::u8>(fieldCount));
+        for (size_t i = 0; i < fieldCount; ++i)
+        {
+            const Field& field = fields[i];
+            Append(state.pending, static_cast<AZ::u8>(field.kind));
+            switch (field.kind)
+            {
+            case InteropRecordField::Kind::Int:
+                Append(state.pending, field.intValue);
+                break;
+            case InteropRecordField::Kind::String:
+                Append(state.pending, stringIds[i]);
+                break;
+            case InteropRecordField::Kind::Arguments:
+                {
+                    // A count the call rejected is recorded as an empty block
+                    const bool valid = field.arguments.data != nullptr && field.arguments.count > 0 && field.arguments.count <= 255;
+                    const AZ::u8 count = valid ? static_cast<AZ::u8>(field.arguments.count) : 0;
+                    Append(state.pending, count);
+                    const auto* bytes = reinterpret_cast<const AZ::u8*>(field.arguments.data);
+                    if (count > 0)
+                    {
+                        state.pending.insert(state.pending.end(), bytes, bytes + count * sizeof(InteropArgument));
+                    }
+                }
+                break;
+            }
+        }
+        ++state.records;
+
+        if (state.pending.size() >= FlushBytes)
+        {
+            FlushPending(state);
+        }
+    }
+
+    bool InteropCapture::Load(const char* path, AZStd::string& error)
+    {
+        strings.clear();
+        arguments.clear();
+        records.clear();
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(path, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        {
+            error = AZStd::string::format("can't open %s", path);
+            return false;
+        }
+        AZStd::vector<AZ::u8> data(static_cast<size_t>(file.Length()));
+        const bool read = data.empty() || file.Read(data.size(), data.data()) == data.size();
+        file.Close();
+        if (!read)
+        {
+            error = AZStd::string::format("can't read %s", path);
+            return false;
+        }
+
+        auto fail = [this, &error](const AZStd::string& reason)
+        {
+            strings.clear();
+            arguments.clear();
+            records.clear();
+            error = reason;
+            return false;
+        };
+
+        CaptureReader reader(data.data(), data.size());
+        char magic[sizeof(CaptureMagic)] = {};
+        AZ::u32 version = 0;
+        if (!reader.ReadBytes(magic, sizeof(magic)) || memcmp(magic, CaptureMagic, sizeof(magic)) != 0)
+        {
+            return fail("not an interop capture");
+        }
+        if (!reader.Read(version) || version != InteropRecorder::FormatVersion)
+        {
+            return fail(AZStd::string::format("capture version %u, expected %u", version, InteropRecorder::FormatVersion));
+        }
+
+        while (!reader.AtEnd())
+        {
+            const size_t recordOffset = reader.GetOffset();
+            auto truncated = [&fail, recordOffset]()
+            {
+                return fail(AZStd::string::format("truncated or corrupt record at byte %zu", recordOffset));
+            };
+
+            AZ::u8 op = 0;
+            reader.Read(op);
+            if (op == static_cast<AZ::u8>(InteropRecordOp::DefineString))
+            {
+                AZ::u32 length = 0;
+                AZStd::string text;
+                if (!reader.Read(length))
+                {
+                    return truncated();
+                }
+                text.resize(length);
+                if (!reader.ReadBytes(text.data(), length))
+                {
+                    return truncated();
+                }
+                strings.push_back(AZStd::move(text));
+                continue;
+            }
+            if (op >= static_cast<AZ::u8>(InteropRecordOp::Count))
+            {
+                return truncated();
+            }
+
+            InteropCaptureRecord& record = records.emplace_back();
+            record.op = static_cast<InteropRecordOp>(op);
+            AZ::u8 fieldCount = 0;
+            if (!reader.Read(record.startNs) || !reader.Read(record.durationNs) || !reader.Read(record.result)
+                || !reader.Read(fieldCount) || fieldCount > InteropCaptureRecord::MaxFields)
+            {
+                return truncated();
+            }
+            for (AZ::u8 i = 0; i < fieldCount; ++i)
+            {
+                InteropRecordField& field = record.fields.emplace_back();
+                AZ::u8 kind = 0;
+                if (!reader.Read(kind))
+                {
+                    return truncated();
+                }
+                field.kind = static_cast<InteropRecordField::Kind>(kind);
+                switch (field.kind)
+                {
+                case InteropRecordField::Kind::Int:
+                    if (!reader.Read(field.intValue))
+                    {
+                        return truncated();
+                    }
+                    break;
+                case InteropRecordField::Kind::String:
+                    {
+                        AZ::u32 id = 0;
+                        if (!reader.Read(id) || id >= strings.size())
+                        {
+                            return truncated();
+                        }
+                        field.intValue = id;
+                    }
+                    break;
+                case InteropRecordField::Kind::Arguments:
+                    {
+                        AZ::u8 count = 0;
+                        if (!reader.Read(count))
+                        {
+                            return truncated();
+                        }
+                        field.intValue = static_cast<AZ::s64>(arguments.size());
+                        field.argumentCount = count;
+                        arguments.resize(arguments.size() + count);
+                        if (!reader.ReadBytes(arguments.data() + field.intValue, count * sizeof(InteropArgument)))
+                        {
+                            return truncated();
+                        }
+                    }
+                    break;
+                default:
+                    return truncated();
+                }
+            }
+        }
+        return true;
+    }
+
+} // namespace O3DESharp
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/typetraits/is_integral.h>
+
+#include <Coral/String.hpp>
+
+#include "GenericDispatcher.h"
+
+namespace O3DESharp
+{
+    /**
+     * GenericDispatcherInternalCalls entry point a capture record replays.
+     * Values are written to capture files: append only.
+     */
+    enum class InteropRecordOp : AZ::u8
+    {
+        DefineString = 0,       // File-level: the next entry of the string table
+        ResolveMethod,
+        InvokeResolved,
+        InvokeStaticMethod,
+        InvokeInstanceMethod,
+        InvokeGlobalMethod,
+        GetProperty,
+        SetProperty,
+        GetGlobalProperty,
+        SetGlobalProperty,
+        BroadcastEBusEvent,
+        SendEBusEvent,
+        CreateInstance,
+        DestroyInstance,
+        Count
+    };
+
+    /// Name of an op, for reports
+    const char* GetInteropRecordOpName(InteropRecordOp op);
+
+    /// InvokeResolved's argument block, as a recorded field
+    struct InteropArgumentSpan
+    {
+        const InteropArgument* data = nullptr;
+        int32_t count = 0;
+    };
+
+    /// One argument of a loaded record, in the entry point's parameter order
+    struct InteropRecordField
+    {
+        enum class Kind : AZ::u8
+        {
+            Int = 0,        // intValue
+            String = 1,     // intValue indexes InteropCapture::strings
+            Arguments = 2,  // intValue indexes InteropCapture::arguments, argumentCount long
+        };
+
+        Kind kind = Kind::Int;
+        AZ::s64 intValue = 0;
+        AZ::u32 argumentCount = 0;
+    };
+
+    struct InteropCaptureRecord
+    {
+        static constexpr size_t MaxFields = 4;
+
+        InteropRecordOp op = InteropRecordOp::DefineString;
+        AZ::u64 startNs = 0;        // Since the capture started
+        AZ::u64 durationNs = 0;
+        AZ::s64 result = 0;         // Handle or status for ResolveMethod, InvokeResolved and CreateInstance; 0 otherwise
+        AZStd::fixed_vector<InteropRecordField, MaxFields> fields;
+    };
+
+    /// A capture file read back into memory
+    struct InteropCapture
+    {
+        AZStd::vector<AZStd::string> strings;
+        AZStd::vector<InteropArgument> arguments;
+        AZStd::vector<InteropCaptureRecord> records;
+
+        /// Read a file InteropRecorder wrote. On failure error says why and the capture is empty.
+        bool Load(const char* path, AZStd::string& error);
+    };
+
+    /**
+     * InteropRecorder - Captures GenericDispatcher traffic for offline replay.
+     *
+     * While recording (o3desharp_InteropRecord [path] to start,
+     * o3desharp_InteropRecordStop to finish), every call managed code makes
+     * through the typed and JSON dispatch entry points, instance lifecycle
+     * and EBus sends is appended to a capture file: which entry point, its
+     * arguments (names and JSON through a string table, InvokeResolved's
+     * argument block as raw InteropArguments), when it started, how long it
+     * took, and the handle or status it returned. The O3DESharp.InteropReplay
+     * tool plays a capture back against a headless dispatcher.
+     *
+     * Records are written in completion order, from whichever thread made
+     * the call, under one lock; recording is for benchmark captures, not
+     * for shipping builds. Handler registration and reflection queries
+     * aren't recorded - they need the managed side to mean anything.
+     */
+    class InteropRecorder
+    {
+    public:
+        static constexpr AZ::u32 FormatVersion = 1;
+
+        static bool IsRecording()
+        {
+            return s_recording.load(AZStd::memory_order_relaxed);
+        }
+
+        /// Start a new capture at path (aliases resolved). False if one is already running or the file can't be opened.
+        static bool Start(const char* path);
+
+        /// Finish the capture, if any, and close its file
+        static void Stop();
+
+    private:
+        friend class InteropRecordScope;
+
+        struct Field
+        {
+            InteropRecordField::Kind kind = InteropRecordField::Kind::Int;
+            AZ::s64 intValue = 0;
+            const Coral::String* string = nullptr;
+            InteropArgumentSpan arguments;
+        };
+
+        static void Commit(
+            InteropRecordOp op,
+            AZStd::chrono::steady_clock::time_point start,
+            AZStd::chrono::steady_clock::time_point end,
+            AZ::s64 result,
+            const Field* fields,
+            size_t fieldCount);
+
+        static AZStd::atomic_bool s_recording;
+    };
+
+    /**
+     * Records one GenericDispatcher entry point call, from construction to
+     * destruction, while InteropRecorder is recording. Fields are the call's
+     * parameters, which must outlive the scope: Coral::String, integers and
+     * InteropArgumentSpan. Wrap the value returned with Result() where the
+     * replayer needs it to map handles or check statuses.
+     */
+    class InteropRecordScope
+    {
+    public:
+        template<typename... Fields>
+        explicit InteropRecordScope(InteropRecordOp op, const Fields&... fields)
+        {
+            static_assert(sizeof...(Fields) <= InteropCaptureRecord::MaxFields, "Too many recorded fields");
+            if (InteropRecorder::IsRecording())
+            {
+                m_recording = true;
+                m_op = op;
+                (AddField(fields), ...);
+                m_start = AZStd::chrono::steady_clock::now();
+            }
+        }
+
+        ~InteropRecordScope()
+        {
+            if (m_recording)
+            {
+                InteropRecorder::Commit(
+                    m_op, m_start, AZStd::chrono::steady_clock::now(), m_result, m_fields.data(), m_fields.size());
+            }
+        }
+
+        template<typename T>
+        T Result(T value)
+        {
+            m_result = static_cast<AZ::s64>(value);
+            return value;
+        }
+
+        InteropRecordScope(const InteropRecordScope&) = delete;
+        InteropRecordScope& operator=(const InteropRecordScope&) = delete;
+
+    private:
+        void AddField(const Coral::String& value)
+        {
+            InteropRecorder::Field& field = m_fields.emplace_back();
+            field.kind = InteropRecordField::Kind::String;
+            field.string = &value;
+        }
+
+        void AddField(const InteropArgumentSpan& value)
+        {
+            InteropRecorder::Field& field = m_fields.emplace_back();
+            field.kind = InteropRecordField::Kind::Arguments;
+            field.arguments = value;
+        }
+
+        template<typename T>
+        void AddField(const T& value)
+        {
+            static_assert(AZStd::is_integral_v<T>, "Recorded fields are strings, integers or argument blocks");
+            InteropRecorder::Field& field = m_fields.emplace_back();
+            field.intValue = static_cast<AZ::s64>(value);
+        }
+
+        bool m_recording = false;
+        InteropRecordOp m_op = InteropRecordOp::DefineString;
+        AZ::s64 m_result = 0;
+        AZStd::chrono::steady_clock::time_point m_start;
+        AZStd::fixed_vector<InteropRecorder::Field, InteropCaptureRecord::MaxFields> m_fields;
+    };
+
+} // namespace O3DESharp
@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "InteropReplayer.h"
+
+#include <AzCore/std/chrono/chrono.h>
+
+namespace O3DESharp
+{
+    namespace
+    {
+        // Return values a replayed call hands back to managed code; the
+        // managed side would free them, so the replayer does.
+        void Discard(Coral::String value)
+        {
+            Coral::String::Free(value);
+        }
+
+        void Discard([[maybe_unused]] bool value)
+        {
+        }
+
+        double MeanUs(AZ::u64 ns, AZ::u64 calls)
+        {
+            return calls > 0 ? static_cast<double>(ns) / static_cast<double>(calls) / 1.0e3 : 0.0;
+        }
+    }
+
+    AZStd::string InteropReplayResult::Format() const
+    {
+        AZStd::string out = AZStd::string::format(
+            "%-22s %10s %14s %14s %8s\n", "op", "calls/pass", "recorded us", "replayed us", "ratio");
+        AZ::u64 recordedNs = 0;
+        AZ::u64 replayedNs = 0;
+        for (size_t i = 0; i < ops.size(); ++i)
+        {
+            const InteropReplayOpStats& stats = ops[i];
+            if (stats.calls == 0)
+            {
+                continue;
+            }
+            const AZ::u64 callsPerPass = passes > 0 ? stats.calls / passes : stats.calls;
+            const double recordedUs = MeanUs(stats.recordedNs, stats.calls);
+            const double replayedUs = MeanUs(stats.replayedNs, stats.calls);
+            out += AZStd::string::format("%-22s %10llu %14.3f %14.3f %8.2f\n",
+                GetInteropRecordOpName(static_cast<InteropRecordOp>(i)),
+                static_cast<unsigned long long>(callsPerPass),
+                recordedUs,
+                replayedUs,
+                recordedUs > 0.0 ? replayedUs / recordedUs : 0.0);
+            recordedNs += stats.recordedNs;
+            replayedNs += stats.replayedNs;
+        }
+        out += AZStd::string::format("total: %.3f ms recorded, %.3f ms replayed per pass over %u passes; %llu skipped, %llu mismatched\n",
+            passes > 0 ? recordedNs / 1.0e6 / passes : 0.0,
+            passes > 0 ? replayedNs / 1.0e6 / passes : 0.0,
+            passes,
+            static_cast<unsigned long long>(skipped),
+            static_cast<unsigned long long>(mismatches));
+        return out;
+    }
+
+    InteropReplayer::InteropReplayer(const InteropCapture& capture)
+        : m_capture(capture)
+    {
+        m_strings.reserve(capture.strings.size());
+        for (const AZStd::string& text : capture.strings)
+        {
+            m_strings.push_back(Coral::String::New(text.c_str()));
+        }
+        m_emptyString = Coral::String::New("");
+    }
+
+    InteropReplayer::~InteropReplayer()
+    {
+        DestroyLiveInstances();
+        for (Coral::String& text : m_strings)
+        {
+            Coral::String::Free(text);
+        }
+        Coral::String::Free(m_emptyString);
+    }
+
+    InteropReplayResult InteropReplayer::Run(AZ::u32 passes)
+    {
+        InteropReplayResult result;
+        for (AZ::u32 pass = 0; pass < passes; ++pass)
+        {
+            // Handles are per pass: the capture resolves and creates again
+            m_methods.clear();
+            for (const InteropCaptureRecord& record : m_capture.records)
+            {
+                if (!Replay(record, result))
+                {
+                    ++result.skipped;
+                    continue;
+                }
+                InteropReplayOpStats& stats = result.ops[static_cast<size_t>(record.op)];
+                ++stats.calls;
+                stats.recordedNs += record.durationNs;
+            }
+            DestroyLiveInstances();
+            ++result.passes;
+        }
+        return result;
+    }
+
+    bool InteropReplayer::GetString(const InteropCaptureRecord& record, size_t index, Coral::String& out) const
+    {
+        if (index >= record.fields.size() || record.fields[index].kind != InteropRecordField::Kind::String)
+        {
+            return false;
+        }
+        out = m_strings[static_cast<size_t>(record.fields[index].intValue)];
+        return true;
+    }
+
+    bool InteropReplayer::GetInt(const InteropCaptureRecord& record, size_t index, AZ::s64& out) const
+    {
+        if (index >= record.fields.size() || record.fields[index].kind != InteropRecordField::Kind::Int)
+        {
+            return false;
+        }
+        out = record.fields[index].intValue;
+        return true;
+    }
+
+    AZ::s64 InteropReplayer::MapInstance(AZ::s64 recorded) const
+    {
+        auto it = m_instances.find(recorded);
+        return it != m_instances.end() ? it->second : 0;
+    }
+
+    void InteropReplayer::DestroyLiveInstances()
+    {
+        for (const auto& [recorded, handle] : m_instances)
+        {
+            GenericDispatcherInternalCalls::DestroyInstance(m_emptyString, handle);
+        }
+        m_instances.clear();
+    }
+
+    bool InteropReplayer::Replay(const InteropCaptureRecord& record, InteropReplayResult& result)
+    {
+        namespace Calls = GenericDispatcherInternalCalls;
+
+        Coral::String s0, s1, s2;
+        AZ::s64 i0 = 0, i1 = 0;
+        AZStd::chrono::steady_clock::time_point start;
+        auto begin = [&start]()
+        {
+            start = AZStd::chrono::steady_clock::now();
+        };
+        auto end = [&start, &result, &record]()
+        {
+            const auto elapsed = AZStd::chrono::steady_clock::now() - start;
+            result.ops[static_cast<size_t>(record.op)].replayedNs +=
+                static_cast<AZ::u64>(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(elapsed).count());
+        };
+
+        switch (record.op)
+        {
+        case InteropRecordOp::ResolveMethod:
+            {
+                if (!GetString(record, 0, s0) || !GetString(record, 1, s1) || !GetInt(record, 2, i0) || !GetInt(record, 3, i1))
+                {
+                    return false;
+                }
+                begin();
+                const int64_t handle = Calls::ResolveMethod(s0, s1, static_cast<int32_t>(i0), static_cast<int32_t>(i1));
+                end();
+                if ((handle != 0) != (record.result != 0))
+                {
+                    ++result.mismatches;
+                }
+                if (record.result != 0)
+                {
+                    m_methods[record.result] = handle;
+                }
+            }
+            return true;
+
+        case InteropRecordOp::InvokeResolved:
+            {
+                if (!GetInt(record, 0, i0) || !GetInt(record, 1, i1) || record.fields.size() < 3
+                    || record.fields[2].kind != InteropRecordField::Kind::Arguments)
+                {
+                    return false;
+                }
+                const InteropRecordField& block = record.fields[2];
+                const InteropArgument* arguments = block.argumentCount > 0
+                    ? m_capture.arguments.data() + block.intValue : nullptr;
+                auto method = m_methods.find(i0);
+                const int64_t methodHandle = method != m_methods.end() ? method->second : 0;
+                const int64_t instanceHandle = i1 != 0 ? MapInstance(i1) : 0;
+                InteropArgument returned;
+                begin();
+                const int32_t status = Calls::InvokeResolved(
+                    methodHandle, instanceHandle, arguments, static_cast<int32_t>(block.argumentCount), &returned);
+                end();
+                if (status != record.result)
+                {
+                    ++result.mismatches;
+                }
+            }
+            return true;
+
+        case InteropRecordOp::InvokeStaticMethod:
+            if (!GetString(record, 0, s0) || !GetString(record, 1, s1) || !GetString(record, 2, s2))
+            {
+                return false;
+            }
+            begin();
+            Discard(Calls::InvokeStaticMethod(s0, s1, s2));
+            end();
+            return true;
+
+        case InteropRecordOp::InvokeInstanceMethod:
+            {
+                Coral::String argsJson;
+                if (!GetString(record, 0, s0) || !GetString(record, 1, s1) || !GetInt(record, 2, i0) || !GetString(record, 3, argsJson))
+                {
+                    return false;
+                }
+                const int64_t instanceHandle = MapInstance(i0);
+                begin();
+                Discard(Calls::InvokeInstanceMethod(s0, s1, instanceHandle, argsJson));
+                end();
+            }
+            return true;
+
+        case InteropRecordOp::InvokeGlobalMethod:
+            if (!GetString(record, 0, s0) || !GetString(record, 1, s1))
+            {
+                return false;
+            }
+            begin();
+            Discard(Calls::InvokeGlobalMethod(s0, s1));
+            end();
+            return true;
+
+        case InteropRecordOp::GetProperty:
+            {
+                if (!GetString(record, 0, s0) || !GetString(record, 1, s1) || !GetInt(record, 2, i0))
+                {
+                    return false;
+                }
+                const int64_t instanceHandle = i0 != 0 ? MapInstance(i0) : 0;
+                begin();
+                Discard(Calls::GetProperty(s0, s1, instanceHandle));
+                end();
+            }
+            return true;
+
+        case InteropRecordOp::SetProperty:
+            {
+                if (!GetString(record, 0, s0) || !GetString(record, 1, s1) || !GetInt(record, 2, i0) || !GetString(record, 3, s2))
+                {
+                    return false;
+                }
+                const int64_t instanceHandle = i0 != 0 ? MapInstance(i0) : 0;
+                begin();
+                Discard(Calls::SetProperty(s0, s1, instanceHandle, s2));
+                end();
+            }
+            return true;
+
+        case InteropRecordOp::GetGlobalProperty:
+            if (!GetString(record, 0, s0))
+            {
+                return false;
+            }
+            begin();
+            Discard(Calls::GetGlobalProperty(s0));
+            end();
+            return true;
+
+        case InteropRecordOp::SetGlobalProperty:
+            if (!GetString(record, 0, s0) || !GetString(record, 1, s1))
+            {
+                return false;
+            }
+            begin();
+            Discard(Calls::SetGlobalProperty(s0, s1));
+            end();
+            return true;
+
+        case InteropRecordOp::BroadcastEBusEvent:
+            if (!GetString(record, 0, s0) || !GetString(record, 1, s1) || !GetString(record, 2, s2))
+            {
+                return false;
+            }
+            begin();
+            Discard(Calls::BroadcastEBusEvent(s0, s1, s2));
+            end();
+            return true;
+
+        case InteropRecordOp::SendEBusEvent:
+            {
+                // The address is an entity or bus id, not a handle: replayed as is
+                if (!GetString(record, 0, s0) || !GetString(record, 1, s1) || !GetInt(record, 2, i0) || !GetString(record, 3, s2))
+                {
+                    return false;
+                }
+                begin();
+                Discard(Calls::SendEBusEvent(s0, s1, i0, s2));
+                end();
+            }
+            return true;
+
+        case InteropRecordOp::CreateInstance:
+            {
+                if (!GetString(record, 0, s0) || !GetString(record, 1, s1))
+                {
+                    return false;
+                }
+                begin();
+                const int64_t handle = Calls::CreateInstance(s0, s1);
+                end();
+                if ((handle != 0) != (record.result != 0))
+                {
+                    ++result.mismatches;
+                }
+                if (record.result != 0 && handle != 0)
+                {
+                    m_instances[record.result] = handle;
+                }
+            }
+            return true;
+
+        case InteropRecordOp::DestroyInstance:
+            {
+                if (!GetString(record, 0, s0) || !GetInt(record, 1, i0))
+                {
+                    return false;
+                }
+                auto instance = m_instances.find(i0);
+                if (instance == m_instances.end())
+                {
+                    // Created before the capture started, or failed to create here
+                    ++result.mismatches;
+                    return true;
+                }
+                const int64_t handle = instance->second;
+                m_instances.erase(instance);
+                begin();
+                Calls::DestroyInstance(s0, handle);
+                end();
+            }
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+} // namespace O3DESharp
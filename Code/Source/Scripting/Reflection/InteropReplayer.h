@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+#include <Coral/String.hpp>
+
+#include "InteropRecorder.h"
+
+namespace O3DESharp
+{
+    struct InteropReplayOpStats
+    {
+        AZ::u64 calls = 0;
+        AZ::u64 recordedNs = 0;     // Sum of the captured durations
+        AZ::u64 replayedNs = 0;     // Sum over the replay, every pass
+    };
+
+    struct InteropReplayResult
+    {
+        AZStd::array<InteropReplayOpStats, static_cast<size_t>(InteropRecordOp::Count)> ops;
+        AZ::u32 passes = 0;
+        AZ::u64 skipped = 0;        // Records whose fields don't match their op
+        AZ::u64 mismatches = 0;     // Handle or status differs from the capture (unreflected class, different build)
+
+        /// One line per op, with the recorded and mean replayed time per call
+        AZStd::string Format() const;
+    };
+
+    /**
+     * InteropReplayer - Plays an InteropCapture back through
+     * GenericDispatcherInternalCalls, in capture order, as fast as it will go.
+     *
+     * Needs an initialized GenericDispatcher over a BehaviorContext that
+     * reflects what the capture touched; O3DESharp.InteropReplay sets one up
+     * headless. Method and instance handles are mapped from the capture's
+     * values to the ones this process hands out, and strings are built once
+     * up front, so the timings are the native side's alone. Results the
+     * capture recorded (resolve and create succeeding, InvokeResolved
+     * statuses) are checked as the replay goes and counted as mismatches.
+     */
+    class InteropReplayer
+    {
+    public:
+        explicit InteropReplayer(const InteropCapture& capture);
+        ~InteropReplayer();
+
+        /// Replay the whole capture passes times. Instances it leaves alive are destroyed after each pass, untimed.
+        InteropReplayResult Run(AZ::u32 passes = 1);
+
+        InteropReplayer(const InteropReplayer&) = delete;
+        InteropReplayer& operator=(const InteropReplayer&) = delete;
+
+    private:
+        // Replay one record; false if its fields don't fit the op
+        bool Replay(const InteropCaptureRecord& record, InteropReplayResult& result);
+
+        bool GetString(const InteropCaptureRecord& record, size_t index, Coral::String& out) const;
+        bool GetInt(const InteropCaptureRecord& record, size_t index, AZ::s64& out) const;
+
+        AZ::s64 MapInstance(AZ::s64 recorded) const;
+        void DestroyLiveInstances();
+
+        const InteropCapture& m_capture;
+        AZStd::vector<Coral::String> m_strings;
+        Coral::String m_emptyString;
+        AZStd::unordered_map<AZ::s64, AZ::s64> m_methods;
+        AZStd::unordered_map<AZ::s64, AZ::s64> m_instances;
+    };
+
+} // namespace O3DESharp
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ScriptActivationQueue.h"
+#include "CSharpScriptComponent.h"
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Components/CameraBus.h>
+
+#include <O3DESharp/O3DESharpBus.h>
+
+namespace O3DESharp
+{
+    namespace
+    {
+        ScriptActivationQueue* s_activeQueue = nullptr;
+
+        using Clock = AZStd::chrono::steady_clock;
+    }
+
+    ScriptActivationQueue::~ScriptActivationQueue()
+    {
+        Disconnect();
+    }
+
+    void ScriptActivationQueue::Connect(AZStd::chrono::microseconds frameBudget)
+    {
+        m_frameBudget = frameBudget;
+        m_spentThisFrame = AZStd::chrono::microseconds(0);
+        s_activeQueue = this;
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void ScriptActivationQueue::Disconnect()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        if (s_activeQueue == this)
+        {
+            s_activeQueue = nullptr;
+        }
+
+        AZ_Warning("ScriptActivationQueue", m_queue.empty(),
+            "%zu queued script(s) dropped at shutdown", m_queue.size());
+        m_queue.clear();
+        m_startedSinceEmpty = 0;
+        m_framesSinceEmpty = 0;
+    }
+
+    ScriptActivationQueue* ScriptActivationQueue::GetActive()
+    {
+        return s_activeQueue;
+    }
+
+    bool ScriptActivationQueue::StartOrEnqueue(CSharpScriptComponent& component, bool critical)
+    {
+        if (critical || m_frameBudget.count() <= 0 || m_spentThisFrame < m_frameBudget)
+        {
+            Start(component);
+            return true;
+        }
+
+        Entry entry;
+        entry.component = &component;
+        AZ::TransformBus::EventResult(entry.position, component.GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
+        entry.sequence = m_nextSequence++;
+        m_queue.push_back(entry);
+        return false;
+    }
+
+    void ScriptActivationQueue::Remove(CSharpScriptComponent& component)
+    {
+        auto it = AZStd::find_if(m_queue.begin(), m_queue.end(),
+            [&component](const Entry& entry) { return entry.component == &component; });
+        if (it != m_queue.end())
+        {
+            // Order is restored by the sort on the next tick
+            *it = m_queue.back();
+            m_queue.pop_back();
+        }
+    }
+
+    void ScriptActivationQueue::Start(CSharpScriptComponent& component)
+    {
+        const Clock::time_point start = Clock::now();
+        component.StartScript();
+        m_spentThisFrame += AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(Clock::now() - start);
+    }
+
+    void ScriptActivationQueue::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        m_spentThisFrame = AZStd::chrono::microseconds(0);
+        if (m_queue.empty())
+        {
+            return;
+        }
+
+        // Nearest to the active camera first; in queue order without one.
+        // Sorted farthest-first so the next script is at the back.
+        AZ::EntityId camera;
+        Camera::CameraSystemRequestBus::BroadcastResult(camera, &Camera::CameraSystemRequests::GetActiveCamera);
+        if (camera.IsValid())
+        {
+            AZ::Vector3 focus = AZ::Vector3::CreateZero();
+            AZ::TransformBus::EventResult(focus, camera, &AZ::TransformBus::Events::GetWorldTranslation);
+            AZStd::sort(m_queue.begin(), m_queue.end(),
+                [&focus](const Entry& lhs, const Entry& rhs)
+                {
+                    const float lhsDistance = lhs.position.GetDistanceSq(focus);
+                    const float rhsDistance = rhs.position.GetDistanceSq(focus);
+                    return lhsDistance != rhsDistance ? lhsDistance > rhsDistance : lhs.sequence > rhs.sequence;
+                });
+        }
+        else
+        {
+            AZStd::sort(m_queue.begin(), m_queue.end(),
+                [](const Entry& lhs, const Entry& rhs) { return lhs.sequence > rhs.sequence; });
+        }
+
+        // At least one per frame. OnCreate may activate or deactivate other
+        // entities, which pushes to / removes from the queue - hence back()
+        // is re-read every iteration.
+        ++m_framesSinceEmpty;
+        do
+        {
+            CSharpScriptComponent* component = m_queue.back().component;
+            m_queue.pop_back();
+            Start(*component);
+            ++m_startedSinceEmpty;
+        } while (!m_queue.empty() && m_spentThisFrame < m_frameBudget);
+
+        if (m_queue.empty())
+        {
+            AZLOG_INFO("ScriptActivationQueue: Started %u deferred script(s) over %u frame(s)",
+                m_startedSinceEmpty, m_framesSinceEmpty);
+            m_startedSinceEmpty = 0;
+            m_framesSinceEmpty = 0;
+            O3DESharpNotificationBus::Broadcast(&O3DESharpNotifications::OnScriptActivationQueueDrained);
+        }
+    }
+
+    int ScriptActivationQueue::GetTickOrder()
+    {
+        return AZ::TICK_GAME;
+    }
+
+} // namespace O3DESharp
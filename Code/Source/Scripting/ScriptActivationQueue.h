@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace O3DESharp
+{
+    class CSharpScriptComponent;
+
+    /**
+     * ScriptActivationQueue - Spreads script creation over frames.
+     *
+     * A level with thousands of scripted entities activates them all in one
+     * frame, and each CSharpScriptComponent::Activate constructs its managed
+     * instance and runs OnCreate on the spot. With a frame budget set, each
+     * frame starts scripts inline until the budget is spent; components
+     * activating after that wait here and are started on later frames, the
+     * ones closest to the active camera first. A frame always starts at
+     * least one queued script so the queue drains even with a tiny budget.
+     *
+     * Components flagged "Activate Immediately" skip the queue. Queued
+     * components report IsScriptReady() == false until they're started, and
+     * send O3DESharpScriptNotifications::OnScriptReady when they are.
+     *
+     * Ticks at TICK_GAME so scripts started this frame get their first
+     * OnUpdate in the same frame. Owned by O3DESharpSystemComponent and
+     * connected for the lifetime of its activation.
+     */
+    class ScriptActivationQueue
+        : public AZ::TickBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ScriptActivationQueue, AZ::SystemAllocator);
+
+        ScriptActivationQueue() = default;
+        ~ScriptActivationQueue() override;
+
+        /// Make this the active queue. A zero budget starts every script inline.
+        void Connect(AZStd::chrono::microseconds frameBudget);
+
+        /// Stop being the active queue. Scripts still queued are dropped.
+        void Disconnect();
+
+        /// The connected queue, or null (no system component, or shutting down).
+        static ScriptActivationQueue* GetActive();
+
+        /**
+         * Start the component's script now if this frame's budget isn't
+         * spent yet (or it is critical), else queue it.
+         * @return true if the script was started
+         */
+        bool StartOrEnqueue(CSharpScriptComponent& component, bool critical);
+
+        /// Drop a queued component (deactivated before its turn). No-op if it isn't queued.
+        void Remove(CSharpScriptComponent& component);
+
+        size_t GetQueuedCount() const { return m_queue.size(); }
+
+    protected:
+        // AZ::TickBus::Handler
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+    private:
+        struct Entry
+        {
+            CSharpScriptComponent* component = nullptr;
+            AZ::Vector3 position = AZ::Vector3::CreateZero();   // world position when queued
+            AZ::u64 sequence = 0;                               // FIFO tie-break
+        };
+
+        // Start one script and charge its cost to this frame.
+        void Start(CSharpScriptComponent& component);
+
+        AZStd::vector<Entry> m_queue;
+        AZStd::chrono::microseconds m_frameBudget{ 0 };
+        AZStd::chrono::microseconds m_spentThisFrame{ 0 };
+        AZ::u64 m_nextSequence = 0;
+
+        // Drain statistics, logged when the queue empties
+        AZ::u32 m_startedSinceEmpty = 0;
+        AZ::u32 m_framesSinceEmpty = 0;
+    };
+
+} // namespace O3DESharp
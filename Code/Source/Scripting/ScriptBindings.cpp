@@ -8,6 +8,9 @@
 
 #include "ScriptBindings.h"
 #include "CoralHostManager.h"
+#include "FrameSnapshot.h"
+#include "InteropProfiler.h"
+#include "ScriptLogQueue.h"
 
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Component/Entity.h>
@@ -23,6 +26,7 @@
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+#include <O3DESharp/O3DESharpScriptBus.h>
 
 #include <Coral/Assembly.hpp>
 
@@ -43,77 +47,81 @@ namespace O3DESharp
         // ============================================================
         // Logging Functions - O3DE.InternalCalls
         // ============================================================
-        assembly->AddInternalCall("O3DE.InternalCalls", "Log_Info", reinterpret_cast<void*>(&Log_Info));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Log_Warning", reinterpret_cast<void*>(&Log_Warning));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Log_Error", reinterpret_cast<void*>(&Log_Error));
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Log_Info", &Log_Info);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Log_Warning", &Log_Warning);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Log_Error", &Log_Error);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Log_GetQueue", &Log_GetQueue);
 
         // ============================================================
         // Entity Functions - O3DE.InternalCalls
         // ============================================================
-        assembly->AddInternalCall("O3DE.InternalCalls", "Entity_IsValid", reinterpret_cast<void*>(&Entity_IsValid));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Entity_GetName", reinterpret_cast<void*>(&Entity_GetName));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Entity_SetName", reinterpret_cast<void*>(&Entity_SetName));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Entity_IsActive", reinterpret_cast<void*>(&Entity_IsActive));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Entity_Activate", reinterpret_cast<void*>(&Entity_Activate));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Entity_Deactivate", reinterpret_cast<void*>(&Entity_Deactivate));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Entity_Destroy", reinterpret_cast<void*>(&Entity_Destroy));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Entity_FindByName", reinterpret_cast<void*>(&Entity_FindByName));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Entity_GetChildCount", reinterpret_cast<void*>(&Entity_GetChildCount));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Entity_GetChildAtIndex", reinterpret_cast<void*>(&Entity_GetChildAtIndex));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Entity_GetChildren", reinterpret_cast<void*>(&Entity_GetChildren));
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Entity_IsValid", &Entity_IsValid);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Entity_GetName", &Entity_GetName);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Entity_SetName", &Entity_SetName);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Entity_IsActive", &Entity_IsActive);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Entity_Activate", &Entity_Activate);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Entity_Deactivate", &Entity_Deactivate);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Entity_Destroy", &Entity_Destroy);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Entity_FindByName", &Entity_FindByName);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Entity_GetChildCount", &Entity_GetChildCount);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Entity_GetChildAtIndex", &Entity_GetChildAtIndex);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Entity_GetChildren", &Entity_GetChildren);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Entity_AreScriptsReady", &Entity_AreScriptsReady);
 
         // ============================================================
         // Transform Functions - O3DE.InternalCalls
         // ============================================================
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_GetWorldPosition", reinterpret_cast<void*>(&Transform_GetWorldPosition));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_SetWorldPosition", reinterpret_cast<void*>(&Transform_SetWorldPosition));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_GetLocalPosition", reinterpret_cast<void*>(&Transform_GetLocalPosition));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_SetLocalPosition", reinterpret_cast<void*>(&Transform_SetLocalPosition));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_GetWorldRotation", reinterpret_cast<void*>(&Transform_GetWorldRotation));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_SetWorldRotation", reinterpret_cast<void*>(&Transform_SetWorldRotation));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_GetWorldRotationEuler", reinterpret_cast<void*>(&Transform_GetWorldRotationEuler));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_SetWorldRotationEuler", reinterpret_cast<void*>(&Transform_SetWorldRotationEuler));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_GetLocalScale", reinterpret_cast<void*>(&Transform_GetLocalScale));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_SetLocalScale", reinterpret_cast<void*>(&Transform_SetLocalScale));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_GetLocalUniformScale", reinterpret_cast<void*>(&Transform_GetLocalUniformScale));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_SetLocalUniformScale", reinterpret_cast<void*>(&Transform_SetLocalUniformScale));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_GetForward", reinterpret_cast<void*>(&Transform_GetForward));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_GetRight", reinterpret_cast<void*>(&Transform_GetRight));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_GetUp", reinterpret_cast<void*>(&Transform_GetUp));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_GetParentId", reinterpret_cast<void*>(&Transform_GetParentId));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Transform_SetParent", reinterpret_cast<void*>(&Transform_SetParent));
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_GetWorldPosition", &Transform_GetWorldPosition);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_SetWorldPosition", &Transform_SetWorldPosition);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_GetLocalPosition", &Transform_GetLocalPosition);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_SetLocalPosition", &Transform_SetLocalPosition);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_GetWorldRotation", &Transform_GetWorldRotation);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_SetWorldRotation", &Transform_SetWorldRotation);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_GetWorldRotationEuler", &Transform_GetWorldRotationEuler);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_SetWorldRotationEuler", &Transform_SetWorldRotationEuler);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_GetLocalScale", &Transform_GetLocalScale);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_SetLocalScale", &Transform_SetLocalScale);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_GetLocalUniformScale", &Transform_GetLocalUniformScale);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_SetLocalUniformScale", &Transform_SetLocalUniformScale);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_GetForward", &Transform_GetForward);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_GetRight", &Transform_GetRight);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_GetUp", &Transform_GetUp);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_GetParentId", &Transform_GetParentId);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Transform_SetParent", &Transform_SetParent);
 
         // ============================================================
         // Input Functions - O3DE.InternalCalls
         // ============================================================
-        assembly->AddInternalCall("O3DE.InternalCalls", "Input_IsKeyDown", reinterpret_cast<void*>(&Input_IsKeyDown));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Input_IsKeyPressed", reinterpret_cast<void*>(&Input_IsKeyPressed));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Input_IsKeyReleased", reinterpret_cast<void*>(&Input_IsKeyReleased));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Input_IsMouseButtonDown", reinterpret_cast<void*>(&Input_IsMouseButtonDown));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Input_IsMouseButtonPressed", reinterpret_cast<void*>(&Input_IsMouseButtonPressed));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Input_IsMouseButtonReleased", reinterpret_cast<void*>(&Input_IsMouseButtonReleased));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Input_GetMousePosition", reinterpret_cast<void*>(&Input_GetMousePosition));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Input_GetMouseDelta", reinterpret_cast<void*>(&Input_GetMouseDelta));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Input_GetAxis", reinterpret_cast<void*>(&Input_GetAxis));
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Input_IsKeyDown", &Input_IsKeyDown);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Input_IsKeyPressed", &Input_IsKeyPressed);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Input_IsKeyReleased", &Input_IsKeyReleased);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Input_IsMouseButtonDown", &Input_IsMouseButtonDown);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Input_IsMouseButtonPressed", &Input_IsMouseButtonPressed);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Input_IsMouseButtonReleased", &Input_IsMouseButtonReleased);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Input_GetMousePosition", &Input_GetMousePosition);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Input_GetMouseDelta", &Input_GetMouseDelta);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Input_GetAxis", &Input_GetAxis);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Input_GetSnapshot", &Input_GetSnapshot);
 
         // ============================================================
         // Time Functions - O3DE.InternalCalls
         // ============================================================
-        assembly->AddInternalCall("O3DE.InternalCalls", "Time_GetDeltaTime", reinterpret_cast<void*>(&Time_GetDeltaTime));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Time_GetTotalTime", reinterpret_cast<void*>(&Time_GetTotalTime));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Time_GetTimeScale", reinterpret_cast<void*>(&Time_GetTimeScale));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Time_SetTimeScale", reinterpret_cast<void*>(&Time_SetTimeScale));
-        assembly->AddInternalCall("O3DE.InternalCalls", "Time_GetFrameCount", reinterpret_cast<void*>(&Time_GetFrameCount));
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Time_GetDeltaTime", &Time_GetDeltaTime);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Time_GetTotalTime", &Time_GetTotalTime);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Time_GetTimeScale", &Time_GetTimeScale);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Time_SetTimeScale", &Time_SetTimeScale);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Time_GetFrameCount", &Time_GetFrameCount);
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Time_GetSnapshot", &Time_GetSnapshot);
 
         // ============================================================
         // Physics Functions - O3DE.InternalCalls
         // ============================================================
-        assembly->AddInternalCall("O3DE.InternalCalls", "Physics_Raycast", reinterpret_cast<void*>(&Physics_Raycast));
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Physics_Raycast", &Physics_Raycast);
 
         // ============================================================
         // Component Functions - O3DE.InternalCalls
         // ============================================================
-        assembly->AddInternalCall("O3DE.InternalCalls", "Component_HasComponent", reinterpret_cast<void*>(&Component_HasComponent));
+        O3DESHARP_ADD_INTERNAL_CALL(assembly, "O3DE.InternalCalls", "Component_HasComponent", &Component_HasComponent);
 
         // Upload all registered internal calls to the .NET runtime
         assembly->UploadInternalCalls();
@@ -125,24 +133,37 @@ namespace O3DESharp
     // Logging Implementation
     // ============================================================
 
+    // The synchronous Log_* calls are the fallback for messages that don't
+    // fit a ScriptLogQueue slot (or when no queue is running). Flush the
+    // queue first so they don't overtake records the same script queued
+    // earlier.
+
     void ScriptBindings::Log_Info(Coral::String message)
     {
+        ScriptLogQueue::FlushActive();
         std::string msg(message);
         AZLOG_INFO("[C#] %s", msg.c_str());
     }
 
     void ScriptBindings::Log_Warning(Coral::String message)
     {
+        ScriptLogQueue::FlushActive();
         std::string msg(message);
         AZLOG_WARN("[C#] %s", msg.c_str());
     }
 
     void ScriptBindings::Log_Error(Coral::String message)
     {
+        ScriptLogQueue::FlushActive();
         std::string msg(message);
         AZLOG_ERROR("[C#] %s", msg.c_str());
     }
 
+    InteropLogQueueHeader* ScriptBindings::Log_GetQueue()
+    {
+        return ScriptLogQueue::GetActiveBlock();
+    }
+
     // ============================================================
     // Entity Implementation
     // ============================================================
@@ -288,6 +309,11 @@ namespace O3DESharp
         return writeCount;
     }
 
+    bool ScriptBindings::Entity_AreScriptsReady(AZ::u64 entityId)
+    {
+        return AreEntityScriptsReady(AZ::EntityId(entityId));
+    }
+
     // ============================================================
     // Transform Implementation
     // ============================================================
@@ -448,7 +474,7 @@ namespace O3DESharp
     // ============================================================
 
     // Helper to query the state of an input channel by its ID
-    static const AzFramework::InputChannel* FindInputChannel(const AzFramework::InputChannelId& channelId)
+    const AzFramework::InputChannel* ScriptBindings::FindInputChannel(const AzFramework::InputChannelId& channelId)
     {
         const AzFramework::InputChannel* channel = nullptr;
         AzFramework::InputChannelRequestBus::EventResult(
@@ -722,6 +748,11 @@ namespace O3DESharp
         return 0.0f;
     }
 
+    InteropInputSnapshot* ScriptBindings::Input_GetSnapshot()
+    {
+        return FrameSnapshotPublisher::GetInputSnapshot();
+    }
+
     // ============================================================
     // Time Implementation
     // ============================================================
@@ -758,16 +789,20 @@ namespace O3DESharp
         if (auto* timeSystem = AZ::Interface<AZ::ITime>::Get())
         {
             timeSystem->SetSimulationTickScale(scale);
+            // Reflect the change immediately so Time.TimeScale reads back what
+            // was just set instead of waiting for the next capture.
+            FrameSnapshotPublisher::GetTimeSnapshot()->timeScale = scale;
         }
     }
 
     AZ::u64 ScriptBindings::Time_GetFrameCount()
     {
-        if (auto* timeSystem = AZ::Interface<AZ::ITime>::Get())
-        {
-            return static_cast<AZ::u64>(timeSystem->GetElapsedTimeMs());
-        }
-        return 0;
+        return FrameSnapshotPublisher::GetTimeSnapshot()->frameIndex;
+    }
+
+    InteropTimeSnapshot* ScriptBindings::Time_GetSnapshot()
+    {
+        return FrameSnapshotPublisher::GetTimeSnapshot();
     }
 
     // ============================================================
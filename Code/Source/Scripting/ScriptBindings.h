@@ -25,6 +25,9 @@ namespace Coral
 namespace O3DESharp
 {
     class CoralHostManager;
+    struct InteropInputSnapshot;
+    struct InteropTimeSnapshot;
+    struct InteropLogQueueHeader;
 
     /**
      * Interop structures for passing data between C++ and C#
@@ -78,9 +81,8 @@ namespace O3DESharp
          */
         static void RegisterAll(Coral::ManagedAssembly* assembly);
 
-    private:
         // ============================================================
-        // Input Helpers
+        // Input Helpers (shared with FrameSnapshotPublisher)
         // ============================================================
 
         /// Maps a C# KeyCode integer to an O3DE InputChannelId
@@ -89,6 +91,11 @@ namespace O3DESharp
         /// Maps a C# mouse button integer to an O3DE InputChannelId
         static const AzFramework::InputChannelId& MouseButtonToChannelId(int button);
 
+        /// Looks up the live input channel for channelId, or nullptr if no device provides it
+        static const AzFramework::InputChannel* FindInputChannel(const AzFramework::InputChannelId& channelId);
+
+    private:
+
         // ============================================================
         // Logging Functions
         // ============================================================
@@ -97,6 +104,11 @@ namespace O3DESharp
         static void Log_Warning(Coral::String message);
         static void Log_Error(Coral::String message);
 
+        /// Returns the shared ring of the running ScriptLogQueue, or nullptr.
+        /// Debug.cs writes records straight into it; the calls above are
+        /// only used for oversized messages or when no queue is running.
+        static InteropLogQueueHeader* Log_GetQueue();
+
         // ============================================================
         // Entity Functions
         // ============================================================
@@ -122,6 +134,10 @@ namespace O3DESharp
         /// contract which had the same benign race).
         static int Entity_GetChildren(AZ::u64 entityId, AZ::u64* outBuffer, int bufferCapacity);
 
+        /// Whether every C# script on entityId has run OnCreate (see
+        /// O3DESharpScriptRequests::IsScriptReady). True without scripts.
+        static bool Entity_AreScriptsReady(AZ::u64 entityId);
+
         // ============================================================
         // Transform Functions
         // ============================================================
@@ -162,6 +178,11 @@ namespace O3DESharp
         static InteropVector3 Input_GetMouseDelta();
         static float Input_GetAxis(Coral::String axisName);
 
+        /// Returns the stable address of the per-frame input block captured by
+        /// FrameSnapshotPublisher. Input.cs calls this once and then reads the
+        /// block directly; the per-query calls above remain as a fallback.
+        static InteropInputSnapshot* Input_GetSnapshot();
+
         // ============================================================
         // Time Functions
         // ============================================================
@@ -172,6 +193,10 @@ namespace O3DESharp
         static void Time_SetTimeScale(float scale);
         static AZ::u64 Time_GetFrameCount();
 
+        /// Returns the stable address of the per-frame time block captured by
+        /// FrameSnapshotPublisher. Read directly by Time.cs.
+        static InteropTimeSnapshot* Time_GetSnapshot();
+
         // ============================================================
         // Physics Functions
         // ============================================================
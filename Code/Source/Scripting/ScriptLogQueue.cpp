@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ScriptLogQueue.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/limits.h>
+
+#include <new>
+
+namespace O3DESharp
+{
+    namespace
+    {
+        constexpr AZ::u64 RateWindowUs = 1000000;
+        constexpr auto ConsumerPollInterval = AZStd::chrono::milliseconds(5);
+
+        // Guards s_activeQueue against a Log_* call racing Stop().
+        AZStd::mutex s_activeMutex;
+        ScriptLogQueue* s_activeQueue = nullptr;
+
+        AZ::u64 WallClockUs()
+        {
+            return aznumeric_cast<AZ::u64>(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::system_clock::now().time_since_epoch()).count());
+        }
+    }
+
+    static void o3desharp_ScriptLogStats(const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZ::u32 count = 10;
+        if (!arguments.empty())
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(count, arguments.front());
+        }
+        AZLOG_INFO("%s", ScriptLogQueue::FormatActiveStats(count).c_str());
+    }
+    AZ_CONSOLEFREEFUNC(o3desharp_ScriptLogStats, AZ::ConsoleFunctorFlags::Null,
+        "Print the C# log queue counters and the noisiest entities: o3desharp_ScriptLogStats [count=10]");
+
+    ScriptLogQueue::ScriptLogQueue(AZ::u32 capacity)
+    {
+        // Slot index is position & (capacity - 1)
+        AZ::u32 roundedCapacity = 2;
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity <<= 1;
+        }
+        capacity = roundedCapacity;
+
+        const size_t blockSize = sizeof(InteropLogQueueHeader) + size_t(capacity) * sizeof(InteropLogRecord);
+        m_block = azmalloc(blockSize, alignof(InteropLogQueueHeader));
+
+        m_header = new (m_block) InteropLogQueueHeader();
+        m_header->capacity = capacity;
+
+        for (AZ::u32 i = 0; i < capacity; ++i)
+        {
+            InteropLogRecord* record = new (RecordAt(i)) InteropLogRecord();
+            record->sequence.store(i, AZStd::memory_order_relaxed);
+        }
+    }
+
+    ScriptLogQueue::~ScriptLogQueue()
+    {
+        Stop();
+
+        for (AZ::u32 i = 0; i < m_header->capacity; ++i)
+        {
+            RecordAt(i)->~InteropLogRecord();
+        }
+        m_header->~InteropLogQueueHeader();
+        azfree(m_block);
+    }
+
+    InteropLogRecord* ScriptLogQueue::RecordAt(AZ::u64 position) const
+    {
+        auto* records = reinterpret_cast<InteropLogRecord*>(reinterpret_cast<AZ::u8*>(m_block) + m_header->size);
+        return &records[position & (m_header->capacity - 1)];
+    }
+
+    void ScriptLogQueue::Start()
+    {
+        if (m_running.exchange(true))
+        {
+            return;
+        }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(s_activeMutex);
+            AZ_Warning("O3DESharp", s_activeQueue == nullptr, "ScriptLogQueue: replacing an already active log queue");
+            s_activeQueue = this;
+        }
+
+        AZStd::thread_desc desc;
+        desc.m_name = "O3DESharp Script Log";
+        m_consumer = AZStd::thread(desc, [this]() { ConsumerLoop(); });
+    }
+
+    void ScriptLogQueue::Stop()
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(s_activeMutex);
+            if (s_activeQueue == this)
+            {
+                s_activeQueue = nullptr;
+            }
+        }
+
+        if (m_running.exchange(false))
+        {
+            m_wake.notify_all();
+            if (m_consumer.joinable())
+            {
+                m_consumer.join();
+            }
+        }
+
+        // Final drain, then summarise any rate-limit windows still open so
+        // nothing suppressed goes unreported.
+        AZStd::lock_guard<AZStd::mutex> lock(m_drainMutex);
+        DrainLocked();
+        CloseExpiredWindowsLocked(AZStd::numeric_limits<AZ::u64>::max());
+    }
+
+    void ScriptLogQueue::Flush()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_drainMutex);
+        DrainLocked();
+    }
+
+    void ScriptLogQueue::SetMaxMessagesPerEntityPerSecond(AZ::u32 limit)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_drainMutex);
+        m_maxPerEntityPerSecond = limit;
+    }
+
+    ScriptLogQueue::Stats ScriptLogQueue::GetStats() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_drainMutex);
+
+        Stats stats;
+        stats.logged = m_totalLogged;
+        stats.suppressed = m_totalSuppressed;
+        stats.dropped = m_header->droppedCount.load(AZStd::memory_order_relaxed);
+        stats.entities.reserve(m_entityCounters.size());
+        for (const auto& [entityId, counters] : m_entityCounters)
+        {
+            stats.entities.emplace_back(entityId, counters);
+        }
+        AZStd::sort(stats.entities.begin(), stats.entities.end(),
+            [](const auto& a, const auto& b) { return a.second.logged > b.second.logged; });
+        return stats;
+    }
+
+    AZStd::string ScriptLogQueue::FormatStats(AZ::u32 count) const
+    {
+        const Stats stats = GetStats();
+        AZStd::string out = AZStd::string::format(
+            "C# log queue: %llu logged, %llu rate-limited, %llu dropped (ring full)\n",
+            static_cast<unsigned long long>(stats.logged),
+            static_cast<unsigned long long>(stats.suppressed),
+            static_cast<unsigned long long>(stats.dropped));
+        const size_t shown = AZ::GetMin<size_t>(count, stats.entities.size());
+        for (size_t i = 0; i < shown; ++i)
+        {
+            const auto& [entityId, counters] = stats.entities[i];
+            out += AZStd::string::format("  %s: %llu logged, %llu rate-limited\n",
+                entityId != 0 ? AZStd::string::format("[%llu]", static_cast<unsigned long long>(entityId)).c_str() : "(no entity)",
+                static_cast<unsigned long long>(counters.logged),
+                static_cast<unsigned long long>(counters.suppressed));
+        }
+        return out;
+    }
+
+    AZStd::string ScriptLogQueue::FormatActiveStats(AZ::u32 count)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(s_activeMutex);
+        return s_activeQueue ? s_activeQueue->FormatStats(count) : AZStd::string("C# log queue is not running");
+    }
+
+    InteropLogQueueHeader* ScriptLogQueue::GetActiveBlock()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(s_activeMutex);
+        return s_activeQueue ? s_activeQueue->m_header : nullptr;
+    }
+
+    void ScriptLogQueue::FlushActive()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(s_activeMutex);
+        if (s_activeQueue)
+        {
+            s_activeQueue->Flush();
+        }
+    }
+
+    void ScriptLogQueue::ConsumerLoop()
+    {
+        while (m_running.load(AZStd::memory_order_acquire))
+        {
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_drainMutex);
+                DrainLocked();
+
+                const AZ::u64 nowUs = WallClockUs();
+                if (nowUs - m_lastWindowSweepUs >= RateWindowUs)
+                {
+                    m_lastWindowSweepUs = nowUs;
+                    CloseExpiredWindowsLocked(nowUs);
+                }
+            }
+
+            // Producers never signal - that would cost the transition this
+            // queue exists to avoid - so poll at a short fixed interval.
+            AZStd::unique_lock<AZStd::mutex> lock(m_wakeMutex);
+            m_wake.wait_for(lock, ConsumerPollInterval, [this]() { return !m_running.load(AZStd::memory_order_acquire); });
+        }
+    }
+
+    void ScriptLogQueue::DrainLocked()
+    {
+        const AZ::u64 capacity = m_header->capacity;
+
+        for (;;)
+        {
+            InteropLogRecord* record = RecordAt(m_dequeuePos);
+            const AZ::u64 sequence = record->sequence.load(AZStd::memory_order_acquire);
+            if (sequence != m_dequeuePos + 1)
+            {
+                // Next slot not published yet (empty, or a producer is still
+                // filling it - it will be picked up on the next pass).
+                break;
+            }
+
+            Emit(*record);
+
+            record->sequence.store(m_dequeuePos + capacity, AZStd::memory_order_release);
+            ++m_dequeuePos;
+        }
+
+        const AZ::u64 dropped = m_header->droppedCount.load(AZStd::memory_order_relaxed);
+        if (dropped != m_reportedDropped)
+        {
+            AZLOG_WARN("[C#] Script log buffer saturated: %llu message(s) dropped (%llu total)",
+                static_cast<unsigned long long>(dropped - m_reportedDropped),
+                static_cast<unsigned long long>(dropped));
+            m_reportedDropped = dropped;
+        }
+    }
+
+    void ScriptLogQueue::Emit(const InteropLogRecord& record)
+    {
+        EntityCounters& counters = m_entityCounters[record.entityId];
+
+        // Errors are never rate limited: entity 0 is shared by every
+        // unattributed caller, and a chatty one mustn't hide someone else's
+        // Debug.LogError.
+        if (m_maxPerEntityPerSecond > 0 && record.level != 2)
+        {
+            // Timestamps come from several producer threads and aren't
+            // strictly ordered, so compare rather than subtract.
+            if (record.timestampUs >= counters.windowStartUs + RateWindowUs)
+            {
+                CloseWindow(record.entityId, counters);
+                counters.windowStartUs = record.timestampUs;
+            }
+
+            if (counters.windowCount >= m_maxPerEntityPerSecond)
+            {
+                ++counters.windowSuppressed;
+                ++counters.suppressed;
+                ++m_totalSuppressed;
+                return;
+            }
+            ++counters.windowCount;
+        }
+
+        ++counters.logged;
+        ++m_totalLogged;
+
+        const int length = static_cast<int>(AZ::GetMin<AZ::u32>(record.length, InteropLogRecord::MessageCapacity));
+        const unsigned long long entityId = static_cast<unsigned long long>(record.entityId);
+
+        switch (record.level)
+        {
+        case 2:
+            if (entityId != 0)
+            {
+                AZLOG_ERROR("[C#][%llu] %.*s", entityId, length, record.message);
+            }
+            else
+            {
+                AZLOG_ERROR("[C#] %.*s", length, record.message);
+            }
+            break;
+        case 1:
+            if (entityId != 0)
+            {
+                AZLOG_WARN("[C#][%llu] %.*s", entityId, length, record.message);
+            }
+            else
+            {
+                AZLOG_WARN("[C#] %.*s", length, record.message);
+            }
+            break;
+        default:
+            if (entityId != 0)
+            {
+                AZLOG_INFO("[C#][%llu] %.*s", entityId, length, record.message);
+            }
+            else
+            {
+                AZLOG_INFO("[C#] %.*s", length, record.message);
+            }
+            break;
+        }
+    }
+
+    void ScriptLogQueue::CloseWindow(AZ::u64 entityId, EntityCounters& counters)
+    {
+        if (counters.windowSuppressed > 0)
+        {
+            AZLOG_WARN("[C#][%llu] Rate limit: suppressed %u message(s) (limit %u/s per entity)",
+                static_cast<unsigned long long>(entityId), counters.windowSuppressed, m_maxPerEntityPerSecond);
+        }
+        counters.windowCount = 0;
+        counters.windowSuppressed = 0;
+    }
+
+    void ScriptLogQueue::CloseExpiredWindowsLocked(AZ::u64 nowUs)
+    {
+        for (auto& [entityId, counters] : m_entityCounters)
+        {
+            if (counters.windowSuppressed > 0 && nowUs >= counters.windowStartUs + RateWindowUs)
+            {
+                CloseWindow(entityId, counters);
+            }
+        }
+    }
+
+} // namespace O3DESharp
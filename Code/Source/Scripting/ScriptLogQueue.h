@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace O3DESharp
+{
+    /**
+     * One slot of the shared log ring. Must match O3DE.LogRecord in LogQueue.cs.
+     *
+     * Producers (managed, any thread) claim a slot by advancing
+     * InteropLogQueueHeader::enqueuePos, fill the payload, then publish it by
+     * storing sequence = position + 1. The consumer releases the slot back by
+     * storing sequence = position + capacity. This is a bounded MPSC queue
+     * with per-slot sequence numbers; no locks on either side.
+     */
+    struct InteropLogRecord
+    {
+        static constexpr AZ::u32 RecordSize = 512;
+        static constexpr AZ::u32 HeaderBytes = 32;
+        static constexpr AZ::u32 MessageCapacity = RecordSize - HeaderBytes;
+
+        AZStd::atomic<AZ::u64> sequence;
+        AZ::u32 level;              // 0 = info, 1 = warning, 2 = error
+        AZ::u16 length;             // UTF-8 bytes used in message
+        AZ::u16 reserved;
+        AZ::u64 entityId;           // AZ::EntityId value, 0 for static / non-script callers
+        AZ::u64 timestampUs;        // producer wall clock, microseconds since the Unix epoch
+        char message[MessageCapacity];
+    };
+
+    static_assert(sizeof(InteropLogRecord) == InteropLogRecord::RecordSize,
+        "InteropLogRecord layout changed - update O3DE.LogRecord in LogQueue.cs");
+    static_assert(AZStd::atomic<AZ::u64>::is_always_lock_free,
+        "The log ring is shared with managed Interlocked operations and needs lock-free 64-bit atomics");
+
+    /**
+     * Header of the shared log ring. Must match O3DE.LogQueueHeader in
+     * LogQueue.cs. The records follow the header contiguously starting at
+     * offset `size`.
+     *
+     * enqueuePos and droppedCount are written by every producer and sit on
+     * their own cache lines so they don't false-share with the read-only
+     * fields managed code checks on every call.
+     */
+    struct InteropLogQueueHeader
+    {
+        static constexpr AZ::u32 CurrentVersion = 1;
+
+        AZ::u32 version = CurrentVersion;
+        AZ::u32 size = sizeof(InteropLogQueueHeader);
+        AZ::u32 capacity = 0;       // power of two
+        AZ::u32 recordSize = InteropLogRecord::RecordSize;
+
+        alignas(64) AZStd::atomic<AZ::u64> enqueuePos{ 0 };
+        alignas(64) AZStd::atomic<AZ::u64> droppedCount{ 0 };
+    };
+
+    static_assert(sizeof(InteropLogQueueHeader) == 192,
+        "InteropLogQueueHeader layout changed - update O3DE.LogQueueHeader in LogQueue.cs and bump CurrentVersion");
+
+    /**
+     * ScriptLogQueue - Asynchronous sink for Debug.Log and friends.
+     *
+     * Owns the shared ring managed code writes log records into and a
+     * background thread that drains it into the AZ logger, so a chatty
+     * script pays for a UTF-8 encode and a memcpy instead of a native
+     * transition plus a synchronous AZLOG_* per message.
+     *
+     * The consumer also applies a per-entity rate limit to info and warning
+     * records (those beyond the limit within one second are counted and
+     * summarised instead of printed; errors always get through), keeps
+     * per-entity message counters, and reports how many records producers
+     * had to drop because the ring was full. o3desharp_ScriptLogStats prints
+     * the counters.
+     *
+     * Messages too long for a slot are not queued; Debug.cs sends them down
+     * the synchronous Log_* path, which flushes this queue first so ordering
+     * is preserved for the calling thread.
+     *
+     * Owned by O3DESharpSystemComponent. Only one instance is active at a
+     * time; Log_GetQueue hands its block to managed code.
+     */
+    class ScriptLogQueue
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ScriptLogQueue, AZ::SystemAllocator);
+
+        static constexpr AZ::u32 DefaultCapacity = 1024;
+        static constexpr AZ::u32 DefaultMaxMessagesPerEntityPerSecond = 200;
+
+        struct EntityCounters
+        {
+            AZ::u64 logged = 0;
+            AZ::u64 suppressed = 0;
+
+            // Current rate-limit window
+            AZ::u64 windowStartUs = 0;
+            AZ::u32 windowCount = 0;
+            AZ::u32 windowSuppressed = 0;
+        };
+
+        struct Stats
+        {
+            AZ::u64 logged = 0;
+            AZ::u64 suppressed = 0;
+            AZ::u64 dropped = 0;
+            AZStd::vector<AZStd::pair<AZ::u64, EntityCounters>> entities; // sorted by logged, descending
+        };
+
+        explicit ScriptLogQueue(AZ::u32 capacity = DefaultCapacity);
+        ~ScriptLogQueue();
+
+        ScriptLogQueue(const ScriptLogQueue&) = delete;
+        ScriptLogQueue& operator=(const ScriptLogQueue&) = delete;
+
+        /// Start the consumer thread and make this the active queue.
+        void Start();
+
+        /// Stop the consumer thread after a final drain. Safe to call twice.
+        void Stop();
+
+        /// Drain everything currently published, on the calling thread.
+        void Flush();
+
+        /// Per-entity limit; 0 disables rate limiting.
+        void SetMaxMessagesPerEntityPerSecond(AZ::u32 limit);
+
+        /// Snapshot of the counters, for diagnostics.
+        Stats GetStats() const;
+
+        /// Totals plus the count noisiest entities, for o3desharp_ScriptLogStats
+        AZStd::string FormatStats(AZ::u32 count) const;
+
+        /// FormatStats of the active queue, or a note that none is running.
+        static AZStd::string FormatActiveStats(AZ::u32 count);
+
+        /// Shared block of the active queue, or nullptr if none is running.
+        static InteropLogQueueHeader* GetActiveBlock();
+
+        /// Flush the active queue, if any. Used by the synchronous Log_* calls.
+        static void FlushActive();
+
+    private:
+        InteropLogRecord* RecordAt(AZ::u64 position) const;
+
+        void ConsumerLoop();
+        void DrainLocked();
+        void CloseExpiredWindowsLocked(AZ::u64 nowUs);
+        void Emit(const InteropLogRecord& record);
+        void CloseWindow(AZ::u64 entityId, EntityCounters& counters);
+
+        // Header + records, one 64-byte aligned allocation
+        void* m_block = nullptr;
+        InteropLogQueueHeader* m_header = nullptr;
+        AZ::u64 m_dequeuePos = 0;
+        AZ::u64 m_reportedDropped = 0;
+        AZ::u64 m_lastWindowSweepUs = 0;
+
+        AZ::u32 m_maxPerEntityPerSecond = DefaultMaxMessagesPerEntityPerSecond;
+        AZ::u64 m_totalLogged = 0;
+        AZ::u64 m_totalSuppressed = 0;
+        AZStd::unordered_map<AZ::u64, EntityCounters> m_entityCounters;
+
+        // Serialises draining between the consumer thread and Flush().
+        mutable AZStd::mutex m_drainMutex;
+
+        AZStd::thread m_consumer;
+        AZStd::mutex m_wakeMutex;
+        AZStd::condition_variable m_wake;
+        AZStd::atomic_bool m_running{ false };
+    };
+
+} // namespace O3DESharp
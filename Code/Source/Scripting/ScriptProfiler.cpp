@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ScriptProfiler.h"
+#include "CSharpScriptComponent.h"
+#include "CoralHostManager.h"
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+#include <Coral/Type.hpp>
+
+AZ_DEFINE_BUDGET(O3DESharp);
+
+namespace O3DESharp
+{
+    namespace
+    {
+        using AllocatedBytesFn = AZ::s64 (*)();
+
+        ScriptProfiler* s_activeProfiler = nullptr;
+
+        // [UnmanagedCallersOnly] O3DE.ScriptProfiling.GetAllocatedBytes.
+        // Read from job workers during parallel ticks; only changed on the
+        // main thread while no script is running.
+        AZStd::atomic<AllocatedBytesFn> s_allocatedBytes{ nullptr };
+
+        void OnScriptAccountingChanged(const bool& enabled)
+        {
+            ScriptProfiler::SetAccounting(enabled);
+        }
+    }
+
+    AZ_CVAR(bool, o3desharp_ScriptAccounting, false, &OnScriptAccountingChanged, AZ::ConsoleFunctorFlags::Null,
+        "Time every C# script dispatch and count its managed allocations (see o3desharp_ScriptCosts)");
+
+    static void o3desharp_ScriptCosts(const AZ::ConsoleCommandContainer& arguments)
+    {
+        bool byEntity = false;
+        AZ::u32 count = 20;
+        for (AZStd::string_view argument : arguments)
+        {
+            if (argument == "entities")
+            {
+                byEntity = true;
+            }
+            else if (argument != "types")
+            {
+                AZ::ConsoleTypeHelpers::StringToValue(count, argument);
+            }
+        }
+
+        if (ScriptProfiler* profiler = ScriptProfiler::GetActive())
+        {
+            AZLOG_INFO("%s", profiler->FormatTop(byEntity, count).c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(o3desharp_ScriptCosts, AZ::ConsoleFunctorFlags::Null,
+        "Print the most expensive C# scripts: o3desharp_ScriptCosts [types|entities] [count=20]");
+
+    AZStd::atomic_bool ScriptProfiler::s_accounting{ false };
+
+    ScriptProfiler::~ScriptProfiler()
+    {
+        Disconnect();
+    }
+
+    void ScriptProfiler::Connect(bool accounting)
+    {
+        SetAccounting(accounting);
+        s_activeProfiler = this;
+        AZ::TickBus::Handler::BusConnect();
+        O3DESharpStatsRequestBus::Handler::BusConnect();
+        O3DESharpHotReloadNotificationBus::Handler::BusConnect();
+    }
+
+    void ScriptProfiler::Disconnect()
+    {
+        O3DESharpHotReloadNotificationBus::Handler::BusDisconnect();
+        O3DESharpStatsRequestBus::Handler::BusDisconnect();
+        AZ::TickBus::Handler::BusDisconnect();
+        if (s_activeProfiler == this)
+        {
+            s_activeProfiler = nullptr;
+        }
+
+        // Anything still registered stops reporting
+        for (const Registration& registration : m_registrations)
+        {
+            registration.component->m_profilerSlot = -1;
+        }
+        m_registrations.clear();
+        m_types.clear();
+        m_entities.clear();
+        {
+            AZStd::scoped_lock lock(m_pendingMutex);
+            m_pendingEBus.clear();
+        }
+        s_allocatedBytes.store(nullptr, AZStd::memory_order_relaxed);
+        m_samplerUnavailable = false;
+    }
+
+    ScriptProfiler* ScriptProfiler::GetActive()
+    {
+        return s_activeProfiler;
+    }
+
+    void ScriptProfiler::SetAccounting(bool accounting)
+    {
+        s_accounting.store(accounting, AZStd::memory_order_relaxed);
+    }
+
+    AZ::s64 ScriptProfiler::SampleAllocatedBytes()
+    {
+        AllocatedBytesFn sampler = s_allocatedBytes.load(AZStd::memory_order_acquire);
+        return sampler ? sampler() : 0;
+    }
+
+    void ScriptProfiler::Register(CSharpScriptComponent& component)
+    {
+        if (component.m_profilerSlot >= 0)
+        {
+            return;
+        }
+
+        Registration registration;
+        registration.component = &component;
+
+        const AZStd::string& className = component.m_config.m_scriptClassName;
+        registration.type = &m_types[className];
+        registration.type->stats.name = className;
+        registration.type->stats.instances += 1;
+
+        const AZ::u64 entityId = static_cast<AZ::u64>(component.GetEntityId());
+        registration.entity = &m_entities[entityId];
+        registration.entity->stats.entityId = entityId;
+        if (registration.entity->stats.instances++ == 0 && component.GetEntity())
+        {
+            registration.entity->stats.name = component.GetEntity()->GetName();
+        }
+
+        component.m_profilerSlot = static_cast<AZ::s32>(m_registrations.size());
+        m_registrations.push_back(registration);
+    }
+
+    void ScriptProfiler::Unregister(CSharpScriptComponent& component)
+    {
+        const AZ::s32 slot = component.m_profilerSlot;
+        if (slot < 0 || static_cast<size_t>(slot) >= m_registrations.size() || m_registrations[slot].component != &component)
+        {
+            return;
+        }
+
+        // OnDestroy and whatever else ran this frame still counts for the class
+        Registration& registration = m_registrations[slot];
+        AddCost(registration.type->frame, component.m_cost);
+        component.m_cost = {};
+        registration.type->stats.instances -= 1;
+        if (--registration.entity->stats.instances == 0)
+        {
+            m_entities.erase(registration.entity->stats.entityId);
+        }
+
+        registration = m_registrations.back();
+        registration.component->m_profilerSlot = slot;
+        m_registrations.pop_back();
+        component.m_profilerSlot = -1;
+    }
+
+    void ScriptProfiler::RecordEBusEvent(const AZStd::string& busName, const ScriptCostCounters& cost)
+    {
+        AZStd::scoped_lock lock(m_pendingMutex);
+        AddCost(m_pendingEBus[busName], cost);
+    }
+
+    void ScriptProfiler::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (!IsAccounting())
+        {
+            return;
+        }
+
+        if (s_allocatedBytes.load(AZStd::memory_order_relaxed) == nullptr && !m_samplerUnavailable)
+        {
+            ResolveSampler();
+        }
+
+        for (Registration& registration : m_registrations)
+        {
+            ScriptCostCounters& cost = registration.component->m_cost;
+            if (cost.calls != 0)
+            {
+                AddCost(registration.type->frame, cost);
+                AddCost(registration.entity->frame, cost);
+                cost = {};
+            }
+        }
+
+        {
+            AZStd::scoped_lock lock(m_pendingMutex);
+            for (const auto& [busName, cost] : m_pendingEBus)
+            {
+                AZStd::string label = AZStd::string::format("EBus %s", busName.c_str());
+                CostRow& row = m_types[label];
+                row.stats.name = AZStd::move(label);
+                AddCost(row.frame, cost);
+            }
+            m_pendingEBus.clear();
+        }
+
+        for (auto& [className, row] : m_types)
+        {
+            RollRow(row);
+        }
+        for (auto& [entityId, row] : m_entities)
+        {
+            RollRow(row);
+        }
+    }
+
+    int ScriptProfiler::GetTickOrder()
+    {
+        // After the scripts (TICK_DEFAULT) and the parallel updater
+        return AZ::TICK_LAST;
+    }
+
+    void ScriptProfiler::ResolveSampler()
+    {
+        ICoralHostManager* hostManager = CoralHostManagerInterface::Get();
+        if (hostManager == nullptr || !hostManager->IsInitialized())
+        {
+            return;
+        }
+
+        Coral::Type* profilingType = hostManager->GetCoreType("O3DE.ScriptProfiling");
+        AZ::s64 sampler = 0;
+        if (profilingType != nullptr)
+        {
+            try
+            {
+                sampler = profilingType->InvokeStaticMethod<AZ::s64>("GetAllocatedBytesSampler");
+            }
+            catch (...)
+            {
+                sampler = 0;
+            }
+        }
+
+        if (sampler == 0)
+        {
+            // Older O3DE.Core: account time only, and don't ask every frame
+            AZLOG_WARN("ScriptProfiler: O3DE.ScriptProfiling unavailable, managed allocations won't be counted");
+            m_samplerUnavailable = true;
+            return;
+        }
+        s_allocatedBytes.store(reinterpret_cast<AllocatedBytesFn>(static_cast<AZ::u64>(sampler)), AZStd::memory_order_release);
+    }
+
+    void ScriptProfiler::OnBeforeUserAssemblyReload()
+    {
+        // O3DE.Core may be unloaded with the rest; re-resolve on the next tick
+        s_allocatedBytes.store(nullptr, AZStd::memory_order_release);
+        m_samplerUnavailable = false;
+    }
+
+    void ScriptProfiler::AddCost(ScriptCostCounters& into, const ScriptCostCounters& cost)
+    {
+        into.calls += cost.calls;
+        into.ns += cost.ns;
+        into.bytes += cost.bytes;
+    }
+
+    void ScriptProfiler::RollRow(CostRow& row)
+    {
+        ScriptCostStats& stats = row.stats;
+        stats.lastFrameCalls = row.frame.calls;
+        stats.lastFrameNs = row.frame.ns;
+        stats.lastFrameBytes = row.frame.bytes;
+        stats.averageNs += (static_cast<double>(row.frame.ns) - stats.averageNs) / RollingFrames;
+        stats.averageBytes += (static_cast<double>(row.frame.bytes) - stats.averageBytes) / RollingFrames;
+        stats.peakNs = AZStd::max(stats.peakNs, row.frame.ns);
+        stats.totalCalls += row.frame.calls;
+        stats.totalNs += row.frame.ns;
+        stats.totalBytes += row.frame.bytes;
+        row.frame = {};
+    }
+
+    AZStd::string ScriptProfiler::FormatTop(bool byEntity, AZ::u32 count) const
+    {
+        AZStd::vector<ScriptCostStats> rows = byEntity ? GetScriptEntityCosts() : GetScriptTypeCosts();
+        if (!IsAccounting() && rows.empty())
+        {
+            return "ScriptProfiler: nothing recorded; set o3desharp_ScriptAccounting true";
+        }
+
+        AZStd::sort(rows.begin(), rows.end(),
+            [](const ScriptCostStats& lhs, const ScriptCostStats& rhs) { return lhs.averageNs > rhs.averageNs; });
+        if (rows.size() > count)
+        {
+            rows.resize(count);
+        }
+
+        AZStd::string out = AZStd::string::format(
+            "ScriptProfiler: top %zu script %s by average frame time\n%-40s %9s %10s %10s %10s %12s %14s",
+            rows.size(), byEntity ? "entities" : "classes", byEntity ? "entity" : "class", "instances", "avg us", "last us",
+            "peak us", "avg bytes", "total bytes");
+        for (const ScriptCostStats& row : rows)
+        {
+            const AZStd::string label = byEntity
+                ? AZStd::string::format("%s [%llu]", row.name.c_str(), static_cast<unsigned long long>(row.entityId))
+                : row.name;
+            out += AZStd::string::format("\n%-40s %9u %10.1f %10.1f %10.1f %12.0f %14llu",
+                label.c_str(),
+                row.instances,
+                row.averageNs / 1.0e3,
+                row.lastFrameNs / 1.0e3,
+                row.peakNs / 1.0e3,
+                row.averageBytes,
+                static_cast<unsigned long long>(row.totalBytes));
+        }
+        return out;
+    }
+
+    bool ScriptProfiler::IsScriptCostAccountingEnabled() const
+    {
+        return IsAccounting();
+    }
+
+    void ScriptProfiler::SetScriptCostAccountingEnabled(bool enabled)
+    {
+        SetAccounting(enabled);
+    }
+
+    AZStd::vector<ScriptCostStats> ScriptProfiler::GetScriptTypeCosts() const
+    {
+        AZStd::vector<ScriptCostStats> rows;
+        rows.reserve(m_types.size());
+        for (const auto& [className, row] : m_types)
+        {
+            rows.push_back(row.stats);
+        }
+        return rows;
+    }
+
+    AZStd::vector<ScriptCostStats> ScriptProfiler::GetScriptEntityCosts() const
+    {
+        AZStd::vector<ScriptCostStats> rows;
+        rows.reserve(m_entities.size());
+        for (const auto& [entityId, row] : m_entities)
+        {
+            rows.push_back(row.stats);
+        }
+        return rows;
+    }
+
+    void ScriptProfiler::ResetScriptCosts()
+    {
+        auto reset = [](CostRow& row)
+        {
+            ScriptCostStats& stats = row.stats;
+            stats.lastFrameCalls = stats.lastFrameNs = stats.lastFrameBytes = 0;
+            stats.averageNs = stats.averageBytes = 0.0;
+            stats.peakNs = stats.totalCalls = stats.totalNs = stats.totalBytes = 0;
+        };
+        for (auto& [className, row] : m_types)
+        {
+            reset(row);
+        }
+        for (auto& [entityId, row] : m_entities)
+        {
+            reset(row);
+        }
+    }
+
+} // namespace O3DESharp
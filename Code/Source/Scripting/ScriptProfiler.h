@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Debug/Budget.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+
+#include <O3DESharp/O3DESharpHotReloadBus.h>
+#include <O3DESharp/O3DESharpStatsBus.h>
+
+// Profiler budget for every managed dispatch: AZ_PROFILE_SCOPE(O3DESharp, ...)
+AZ_DECLARE_BUDGET(O3DESharp);
+
+namespace O3DESharp
+{
+    class CSharpScriptComponent;
+
+    /// Cost of the dispatches made since the last rollup
+    struct ScriptCostCounters
+    {
+        AZ::u64 calls = 0;
+        AZ::u64 ns = 0;
+        AZ::u64 bytes = 0;
+    };
+
+    /**
+     * ScriptProfiler - Per-script CPU time and managed allocation accounting.
+     *
+     * Every managed dispatch (ScriptComponent lifecycle methods, Tick on
+     * either thread, managed EBus handler events) opens an AZ_PROFILE_SCOPE
+     * named after the script class. While accounting is on
+     * (o3desharp_ScriptAccounting, default from
+     * /O3DE/O3DESharp/Profiling/ScriptAccounting) a ScriptCostScope also
+     * times it and samples GC.GetAllocatedBytesForCurrentThread on either
+     * side, adding both to counters owned by the component - so parallel
+     * ticks write without sharing anything.
+     *
+     * Once a frame, after every script has run, the counters are drained
+     * into two rolling tables, per script class and per entity, which
+     * O3DESharpStatsRequestBus and o3desharp_ScriptCosts expose.
+     *
+     * Owned by O3DESharpSystemComponent and connected for the lifetime of
+     * its activation; script components register while active.
+     */
+    class ScriptProfiler
+        : public AZ::TickBus::Handler
+        , protected O3DESharpStatsRequestBus::Handler
+        , protected O3DESharpHotReloadNotificationBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ScriptProfiler, AZ::SystemAllocator);
+
+        /// Frames the rolling averages span (about a second at 60 Hz)
+        static constexpr AZ::u32 RollingFrames = 60;
+
+        ScriptProfiler() = default;
+        ~ScriptProfiler() override;
+
+        /**
+         * Make this the active profiler.
+         * @param accounting Initial o3desharp_ScriptAccounting state
+         */
+        void Connect(bool accounting);
+        void Disconnect();
+
+        /// The connected profiler, or null.
+        static ScriptProfiler* GetActive();
+
+        /// Whether ScriptCostScope records. Any thread.
+        static bool IsAccounting()
+        {
+            return s_accounting.load(AZStd::memory_order_relaxed);
+        }
+
+        static void SetAccounting(bool accounting);
+
+        /// Managed bytes allocated so far by the calling thread, 0 if the sampler isn't resolved
+        static AZ::s64 SampleAllocatedBytes();
+
+        void Register(CSharpScriptComponent& component);
+
+        /// Flush the component's pending costs into its class's row and forget it
+        void Unregister(CSharpScriptComponent& component);
+
+        /// Add a managed EBus handler event's cost to the "EBus <busName>" row. Any thread.
+        void RecordEBusEvent(const AZStd::string& busName, const ScriptCostCounters& cost);
+
+        /// The N most expensive classes or entities by rolling average time
+        AZStd::string FormatTop(bool byEntity, AZ::u32 count) const;
+
+    protected:
+        // AZ::TickBus::Handler
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+        // O3DESharpStatsRequestBus::Handler
+        bool IsScriptCostAccountingEnabled() const override;
+        void SetScriptCostAccountingEnabled(bool enabled) override;
+        AZStd::vector<ScriptCostStats> GetScriptTypeCosts() const override;
+        AZStd::vector<ScriptCostStats> GetScriptEntityCosts() const override;
+        void ResetScriptCosts() override;
+
+        // O3DESharpHotReloadNotificationBus::Handler - the sampler points into O3DE.Core
+        void OnBeforeUserAssemblyReload() override;
+
+    private:
+        struct CostRow
+        {
+            ScriptCostStats stats;
+            ScriptCostCounters frame;
+        };
+
+        struct Registration
+        {
+            CSharpScriptComponent* component = nullptr;
+            CostRow* type = nullptr;
+            CostRow* entity = nullptr;
+        };
+
+        // Ask O3DE.ScriptProfiling for its allocation sampler. Main thread.
+        void ResolveSampler();
+
+        static void AddCost(ScriptCostCounters& into, const ScriptCostCounters& cost);
+        static void RollRow(CostRow& row);
+
+        static AZStd::atomic_bool s_accounting;
+
+        AZStd::vector<Registration> m_registrations;
+
+        // Node-based, so the row pointers held by m_registrations stay valid
+        AZStd::unordered_map<AZStd::string, CostRow> m_types;
+        AZStd::unordered_map<AZ::u64, CostRow> m_entities;
+
+        // EBus handler costs from any thread, folded into m_types on the tick
+        AZStd::mutex m_pendingMutex;
+        AZStd::unordered_map<AZStd::string, ScriptCostCounters> m_pendingEBus;
+
+        bool m_samplerUnavailable = false;
+    };
+
+    /**
+     * Times one managed dispatch into counters while accounting is on.
+     * Allocations are sampled outside the timed span, so the sampler's own
+     * transition doesn't count as script time.
+     */
+    class ScriptCostScope
+    {
+    public:
+        explicit ScriptCostScope(ScriptCostCounters& counters)
+            : m_counters(ScriptProfiler::IsAccounting() ? &counters : nullptr)
+        {
+            if (m_counters)
+            {
+                m_startBytes = ScriptProfiler::SampleAllocatedBytes();
+                m_start = AZStd::chrono::steady_clock::now();
+            }
+        }
+
+        ~ScriptCostScope()
+        {
+            if (m_counters)
+            {
+                const auto elapsed = AZStd::chrono::steady_clock::now() - m_start;
+                const AZ::s64 allocated = ScriptProfiler::SampleAllocatedBytes() - m_startBytes;
+                m_counters->calls += 1;
+                m_counters->ns += static_cast<AZ::u64>(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(elapsed).count());
+                m_counters->bytes += allocated > 0 ? static_cast<AZ::u64>(allocated) : 0;
+            }
+        }
+
+        ScriptCostScope(const ScriptCostScope&) = delete;
+        ScriptCostScope& operator=(const ScriptCostScope&) = delete;
+
+    private:
+        ScriptCostCounters* m_counters;
+        AZStd::chrono::steady_clock::time_point m_start;
+        AZ::s64 m_startBytes = 0;
+    };
+
+} // namespace O3DESharp
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ScriptTickScheduler.h"
+#include "CSharpScriptComponent.h"
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+
+#include <O3DESharp/O3DESharpStatsBus.h>
+
+namespace O3DESharp
+{
+    namespace
+    {
+        ScriptTickScheduler* s_activeScheduler = nullptr;
+
+        using Clock = AZStd::chrono::steady_clock;
+
+        // Updates a script's overrun history covers
+        constexpr AZ::u32 OverrunWindow = 64;
+
+        AZ::u64 TypeKey(ScriptTypeHandle type)
+        {
+            return (static_cast<AZ::u64>(type.index) << 32) | type.generation;
+        }
+
+        AZ::u32 CountOverruns(AZ::u64 history)
+        {
+            AZ::u32 count = 0;
+            for (; history != 0; history &= history - 1)
+            {
+                ++count;
+            }
+            return count;
+        }
+
+        AZ::u64 MsToNs(float ms)
+        {
+            return ms > 0.0f ? static_cast<AZ::u64>(static_cast<double>(ms) * 1.0e6) : 0;
+        }
+
+        void OnScriptFrameBudgetChanged(const float& budgetMs)
+        {
+            if (ScriptTickScheduler* scheduler = ScriptTickScheduler::GetActive())
+            {
+                scheduler->SetFrameBudget(MsToNs(budgetMs));
+            }
+        }
+    }
+
+    AZ_CVAR(float, o3desharp_ScriptFrameBudgetMs, 0.0f, &OnScriptFrameBudgetChanged, AZ::ConsoleFunctorFlags::Null,
+        "Main-thread C# script time per frame before [UpdateInterval] scripts are deferred; 0 = no budget");
+
+    static void o3desharp_ScriptOverruns([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (ScriptTickScheduler* scheduler = ScriptTickScheduler::GetActive())
+        {
+            AZLOG_INFO("%s", scheduler->FormatOverruns().c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(o3desharp_ScriptOverruns, AZ::ConsoleFunctorFlags::Null,
+        "List the C# scripts flagged for repeatedly overrunning their update time limit");
+
+    ScriptTickScheduler::~ScriptTickScheduler()
+    {
+        Disconnect();
+    }
+
+    void ScriptTickScheduler::Connect(AZ::u64 frameBudgetNs, AZ::u64 overrunNs, AZ::u32 overrunsToFlag)
+    {
+        // The cvar's callback had no scheduler to reach if it was set before
+        // activation, so pick its value up here; otherwise seed it from the
+        // setting so the two agree.
+        const float cvarBudgetMs = o3desharp_ScriptFrameBudgetMs;
+        if (cvarBudgetMs > 0.0f)
+        {
+            frameBudgetNs = MsToNs(cvarBudgetMs);
+        }
+        else if (frameBudgetNs > 0)
+        {
+            o3desharp_ScriptFrameBudgetMs = static_cast<float>(frameBudgetNs / 1.0e6);
+        }
+
+        m_overrunNs = overrunNs;
+        m_overrunsToFlag = AZStd::clamp(overrunsToFlag, 1u, OverrunWindow);
+        SetFrameBudget(frameBudgetNs);
+        m_frameNs = 0;
+        m_overBudgetFrames = 0;
+        s_activeScheduler = this;
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void ScriptTickScheduler::Disconnect()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        if (s_activeScheduler == this)
+        {
+            s_activeScheduler = nullptr;
+        }
+
+        // Anything still registered falls back to ticking itself
+        for (const SlicedEntry& entry : m_sliced)
+        {
+            if (entry.component != nullptr)
+            {
+                entry.component->m_scheduleSlot = -1;
+            }
+        }
+        ClearFlagged();
+        m_sliced.clear();
+        m_intervals.clear();
+        m_cursor = 0;
+        m_needsCompact = false;
+    }
+
+    ScriptTickScheduler* ScriptTickScheduler::GetActive()
+    {
+        return s_activeScheduler;
+    }
+
+    void ScriptTickScheduler::SetFrameBudget(AZ::u64 frameBudgetNs)
+    {
+        m_frameBudgetNs = frameBudgetNs;
+        m_timing = m_frameBudgetNs > 0 || m_overrunNs > 0;
+        if (!m_timing)
+        {
+            // Nothing updates the histories any more, so nothing would
+            // ever unflag them
+            ClearFlagged();
+        }
+    }
+
+    void ScriptTickScheduler::ClearFlagged()
+    {
+        for (CSharpScriptComponent* component : m_flagged)
+        {
+            component->m_overrunFlagged = false;
+            component->m_overrunHistory = 0;
+        }
+        m_flagged.clear();
+    }
+
+    bool ScriptTickScheduler::Register(CSharpScriptComponent& component, ScriptTypeHandle type, Coral::ManagedObject& instance)
+    {
+        if (component.m_scheduleSlot >= 0)
+        {
+            return true;
+        }
+        if (!type.IsValid() || !instance.IsValid())
+        {
+            return false;
+        }
+
+        auto it = m_intervals.find(TypeKey(type));
+        if (it == m_intervals.end())
+        {
+            AZ::s32 interval = 0;
+            try
+            {
+                interval = instance.InvokeMethod<AZ::s32>("GetUpdateInterval");
+            }
+            catch (...)
+            {
+                interval = 0; // O3DE.Core without [UpdateInterval] support
+            }
+            it = m_intervals.emplace(TypeKey(type), static_cast<AZ::u32>(AZStd::max(interval, 0))).first;
+        }
+
+        if (it->second == 0)
+        {
+            return false;
+        }
+
+        // Instances of a class are spread over the frames of its interval
+        SlicedEntry entry;
+        entry.component = &component;
+        entry.interval = it->second;
+        entry.framesWaited = static_cast<AZ::u32>(m_sliced.size() % it->second);
+
+        component.m_scheduleSlot = static_cast<AZ::s32>(m_sliced.size());
+        m_sliced.push_back(entry);
+        return true;
+    }
+
+    void ScriptTickScheduler::Unregister(CSharpScriptComponent& component)
+    {
+        const AZ::s32 slot = component.m_scheduleSlot;
+        if (slot >= 0 && static_cast<size_t>(slot) < m_sliced.size() && m_sliced[slot].component == &component)
+        {
+            // Removed on the next tick, so a walk in progress keeps its indices
+            m_sliced[slot].component = nullptr;
+            m_needsCompact = true;
+        }
+        component.m_scheduleSlot = -1;
+
+        if (component.m_overrunFlagged)
+        {
+            m_flagged.erase(AZStd::remove(m_flagged.begin(), m_flagged.end(), &component), m_flagged.end());
+            component.m_overrunFlagged = false;
+        }
+        component.m_overrunHistory = 0;
+    }
+
+    void ScriptTickScheduler::RunUpdate(CSharpScriptComponent& component, float deltaTime)
+    {
+        if (!m_timing)
+        {
+            component.SafeInvokeMethod("Tick", deltaTime);
+            return;
+        }
+
+        const auto start = Clock::now();
+        component.SafeInvokeMethod("Tick", deltaTime);
+        const auto elapsed = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(Clock::now() - start);
+
+        // A script that deactivated its own entity has been unregistered;
+        // its time still counts against the frame
+        if (component.m_scriptInstance.IsValid())
+        {
+            RecordUpdate(component, static_cast<AZ::u64>(elapsed.count()));
+        }
+        else
+        {
+            m_frameNs += static_cast<AZ::u64>(elapsed.count());
+        }
+    }
+
+    void ScriptTickScheduler::RecordUpdate(CSharpScriptComponent& component, AZ::u64 ns)
+    {
+        m_frameNs += ns;
+
+        const AZ::u64 limitNs = m_overrunNs > 0 ? m_overrunNs : m_frameBudgetNs;
+        if (limitNs == 0)
+        {
+            return;
+        }
+
+        const bool overran = ns > limitNs;
+        component.m_overrunHistory = (component.m_overrunHistory << 1) | (overran ? 1u : 0u);
+
+        if (overran && !component.m_overrunFlagged)
+        {
+            const AZ::u32 overruns = CountOverruns(component.m_overrunHistory);
+            if (overruns < m_overrunsToFlag)
+            {
+                return;
+            }
+
+            component.m_overrunFlagged = true;
+            m_flagged.push_back(&component);
+
+            ScriptOverrunStats stats;
+            stats.name = component.m_config.m_scriptClassName;
+            stats.entityName = component.GetEntity() ? component.GetEntity()->GetName() : AZStd::string();
+            stats.entityId = static_cast<AZ::u64>(component.GetEntityId());
+            stats.overruns = overruns;
+            stats.lastNs = ns;
+            stats.limitNs = limitNs;
+
+            AZLOG_WARN("ScriptTickScheduler: '%s' on entity '%s' went over %.3f ms in %u of its last %u updates (last %.3f ms)",
+                stats.name.c_str(), stats.entityName.c_str(), limitNs / 1.0e6, overruns, OverrunWindow, ns / 1.0e6);
+            O3DESharpStatsNotificationBus::Broadcast(&O3DESharpStatsNotifications::OnScriptOverrun, stats);
+        }
+        else if (component.m_overrunFlagged && component.m_overrunHistory == 0)
+        {
+            component.m_overrunFlagged = false;
+            m_flagged.erase(AZStd::remove(m_flagged.begin(), m_flagged.end(), &component), m_flagged.end());
+            AZLOG_INFO("ScriptTickScheduler: '%s' on entity '%s' is back within %.3f ms",
+                component.m_config.m_scriptClassName.c_str(),
+                component.GetEntity() ? component.GetEntity()->GetName().c_str() : "Unknown",
+                limitNs / 1.0e6);
+        }
+    }
+
+    void ScriptTickScheduler::Compact()
+    {
+        size_t kept = 0;
+        size_t cursor = 0;
+        for (size_t i = 0; i < m_sliced.size(); ++i)
+        {
+            if (i == m_cursor)
+            {
+                cursor = kept;
+            }
+            if (m_sliced[i].component == nullptr)
+            {
+                continue;
+            }
+            m_sliced[kept] = m_sliced[i];
+            m_sliced[kept].component->m_scheduleSlot = static_cast<AZ::s32>(kept);
+            ++kept;
+        }
+        m_sliced.resize(kept);
+        m_cursor = cursor < kept ? cursor : 0;
+        m_needsCompact = false;
+    }
+
+    AZStd::string ScriptTickScheduler::FormatOverruns() const
+    {
+        const AZ::u64 limitNs = m_overrunNs > 0 ? m_overrunNs : m_frameBudgetNs;
+        if (limitNs == 0)
+        {
+            return "Script overrun watchdog is off (set /O3DE/O3DESharp/Scheduler/OverrunMs or a frame budget)";
+        }
+
+        AZStd::string out = AZStd::string::format("%zu script(s) flagged for going over %.3f ms:\n", m_flagged.size(), limitNs / 1.0e6);
+        for (const CSharpScriptComponent* component : m_flagged)
+        {
+            out += AZStd::string::format("  %s on '%s' [%llu]: %u of the last %u updates\n",
+                component->m_config.m_scriptClassName.c_str(),
+                component->GetEntity() ? component->GetEntity()->GetName().c_str() : "Unknown",
+                static_cast<unsigned long long>(static_cast<AZ::u64>(component->GetEntityId())),
+                CountOverruns(component->m_overrunHistory),
+                OverrunWindow);
+        }
+        return out;
+    }
+
+    void ScriptTickScheduler::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (m_needsCompact)
+        {
+            Compact();
+        }
+
+        AZ::u32 updated = 0;
+        AZ::u32 deferred = 0;
+        const size_t count = m_sliced.size();
+        if (count > 0)
+        {
+            AZ_PROFILE_SCOPE(O3DESharp, "ScriptTickScheduler::UpdateSliced");
+
+            // One round-robin pass. Updates may register or unregister
+            // scripts: new entries wait for the next frame, removed ones are
+            // only nulled, so indices hold until the pass is over.
+            const size_t start = m_cursor < count ? m_cursor : 0;
+            size_t firstDeferred = count;
+            for (size_t n = 0; n < count; ++n)
+            {
+                const size_t i = (start + n) % count;
+                SlicedEntry& entry = m_sliced[i];
+                if (entry.component == nullptr)
+                {
+                    continue;
+                }
+
+                entry.pendingDeltaTime += deltaTime;
+                if (++entry.framesWaited < entry.interval)
+                {
+                    continue;
+                }
+
+                if (m_frameBudgetNs > 0 && m_frameNs >= m_frameBudgetNs && updated > 0)
+                {
+                    firstDeferred = AZStd::min(firstDeferred, n);
+                    ++deferred;
+                    continue;
+                }
+
+                CSharpScriptComponent* component = entry.component;
+                const float elapsed = entry.pendingDeltaTime;
+                entry.pendingDeltaTime = 0.0f;
+                entry.framesWaited = 0;
+                ++updated;
+                RunUpdate(*component, elapsed); // May grow m_sliced: entry isn't used past here
+            }
+
+            // Deferred scripts go first next frame
+            m_cursor = firstDeferred < count ? (start + firstDeferred) % count : start;
+        }
+
+        if (m_frameBudgetNs > 0)
+        {
+            if (m_frameNs > m_frameBudgetNs)
+            {
+                ++m_overBudgetFrames;
+            }
+            if (O3DESharpStatsNotificationBus::HasHandlers())
+            {
+                ScriptBudgetFrameStats stats;
+                stats.budgetNs = m_frameBudgetNs;
+                stats.scriptNs = m_frameNs;
+                stats.slicedUpdates = updated;
+                stats.deferredUpdates = deferred;
+                stats.overBudgetFrames = m_overBudgetFrames;
+                O3DESharpStatsNotificationBus::Broadcast(&O3DESharpStatsNotifications::OnScriptBudgetFrameStats, stats);
+            }
+        }
+        m_frameNs = 0;
+    }
+
+    int ScriptTickScheduler::GetTickOrder()
+    {
+        // After the every-frame scripts and the parallel updater (TICK_DEFAULT)
+        return AZ::TICK_DEFAULT + 1;
+    }
+
+} // namespace O3DESharp
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+#include <Coral/ManagedObject.hpp>
+
+#include "CoralHostManager.h"
+
+namespace O3DESharp
+{
+    class CSharpScriptComponent;
+
+    /**
+     * ScriptTickScheduler - Frame budget for script updates, time slicing
+     * and the overrun watchdog.
+     *
+     * Instances of classes marked O3DE.UpdateIntervalAttribute register here
+     * once created instead of ticking from their own CSharpScriptComponent::
+     * OnTick. Each frame, after the every-frame scripts, the scheduler walks
+     * them round-robin and updates the ones whose interval is up, passing
+     * the time since their last update. With a frame budget set, once the
+     * frame's script time (every main-thread update plus the
+     * [ParallelUpdate] batches) is over it, due scripts are pushed to the
+     * next frame and the walk resumes from the first of them; a frame always
+     * updates at least one, so none starve.
+     *
+     * The watchdog times every main-thread update while a budget or an
+     * overrun limit is set. An update over the limit is an overrun; a
+     * script with OverrunsToFlag of them among its last 64 updates is
+     * flagged once, with a warning and O3DESharpStatsNotifications::
+     * OnScriptOverrun, until it has gone 64 updates without one.
+     * o3desharp_ScriptOverruns lists the flagged scripts.
+     *
+     * Ticks at TICK_DEFAULT + 1, after the scripts and the parallel
+     * updater. Owned by O3DESharpSystemComponent and connected for the
+     * lifetime of its activation.
+     */
+    class ScriptTickScheduler
+        : public AZ::TickBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ScriptTickScheduler, AZ::SystemAllocator);
+
+        static constexpr AZ::u32 DefaultOverrunsToFlag = 5;
+
+        ScriptTickScheduler() = default;
+        ~ScriptTickScheduler() override;
+
+        /**
+         * Make this the active scheduler.
+         * @param frameBudgetNs Main-thread script time per frame before
+         *        time-sliced updates are deferred; 0 for no budget. A
+         *        non-zero o3desharp_ScriptFrameBudgetMs set before this
+         *        (autoexec, command line) takes precedence, and the cvar is
+         *        left showing whichever budget is in effect.
+         * @param overrunNs Single update time that counts as an overrun;
+         *        0 uses the frame budget
+         * @param overrunsToFlag Overruns among a script's last 64 updates
+         *        that flag it
+         */
+        void Connect(AZ::u64 frameBudgetNs, AZ::u64 overrunNs, AZ::u32 overrunsToFlag);
+        void Disconnect();
+
+        /// The connected scheduler, or null.
+        static ScriptTickScheduler* GetActive();
+
+        /// Change the frame budget (o3desharp_ScriptFrameBudgetMs). 0 turns it off,
+        /// and if that stops the timing, clears every flagged script.
+        void SetFrameBudget(AZ::u64 frameBudgetNs);
+
+        /// Whether updates are being timed (a budget or an overrun limit is set)
+        bool IsTiming() const { return m_timing; }
+
+        /**
+         * Take over updating the component if its script class is
+         * [UpdateInterval] (asked once per class).
+         * @return true if the component is now updated from here
+         */
+        bool Register(CSharpScriptComponent& component, ScriptTypeHandle type, Coral::ManagedObject& instance);
+
+        /// Stop updating the component and drop its overrun state. No-op if it has none.
+        void Unregister(CSharpScriptComponent& component);
+
+        /// Run the component's update, timed and checked by the watchdog while IsTiming(). Main thread.
+        void RunUpdate(CSharpScriptComponent& component, float deltaTime);
+
+        /// Charge script time spent outside RunUpdate (the parallel batches) to this frame. Main thread.
+        void AddFrameTime(AZ::u64 ns) { m_frameNs += ns; }
+
+        /// One line per flagged script
+        AZStd::string FormatOverruns() const;
+
+        size_t GetSlicedCount() const { return m_sliced.size(); }
+
+    protected:
+        // AZ::TickBus::Handler
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+    private:
+        struct SlicedEntry
+        {
+            CSharpScriptComponent* component = nullptr;     // Null once unregistered, until the next tick compacts
+            AZ::u32 interval = 1;
+            AZ::u32 framesWaited = 0;
+            float pendingDeltaTime = 0.0f;
+        };
+
+        // Record one timed update against the component and the frame
+        void RecordUpdate(CSharpScriptComponent& component, AZ::u64 ns);
+
+        // Drop the entries unregistered since the last tick, keeping the order
+        void Compact();
+
+        // Unflag every flagged script and forget its overrun history
+        void ClearFlagged();
+
+        AZStd::vector<SlicedEntry> m_sliced;
+        AZStd::vector<CSharpScriptComponent*> m_flagged;
+        size_t m_cursor = 0;                // Where the next round-robin pass starts
+        bool m_needsCompact = false;
+
+        // Interval of each class, keyed by type-handle index and generation
+        // so a reloaded class is asked again. 0 = every frame.
+        AZStd::unordered_map<AZ::u64, AZ::u32> m_intervals;
+
+        AZ::u64 m_frameBudgetNs = 0;
+        AZ::u64 m_overrunNs = 0;            // As configured; 0 follows the budget
+        AZ::u32 m_overrunsToFlag = DefaultOverrunsToFlag;
+        bool m_timing = false;
+
+        AZ::u64 m_frameNs = 0;              // Script time so far this frame
+        AZ::u64 m_overBudgetFrames = 0;
+    };
+
+} // namespace O3DESharp
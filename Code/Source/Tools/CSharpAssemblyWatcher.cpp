@@ -12,9 +12,13 @@
 
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/string/string_view.h>
 #include <AzCore/Utils/Utils.h>
 
+#include <QByteArray>
 #include <QDir>
+#include <QFile>
 #include <QFileInfo>
 #include <QFileSystemWatcher>
 #include <QStringList>
@@ -33,8 +37,177 @@ namespace O3DESharp
             return lower.endsWith(QStringLiteral(".dll"))
                 || lower.endsWith(QStringLiteral(".pdb"));
         }
+
+        // How many 200ms retries a DLL that can't be opened (the build still
+        // holds it) gets before the reload goes ahead without it.
+        constexpr int MaxUnreadableRetries = 10;
+
+        // Reads the module version id (MVID) of a .NET PE image:
+        // PE header -> CLI header -> metadata root -> Module row in the #~
+        // stream -> #GUID heap (ECMA-335 II.24/25). Returns false for anything
+        // that isn't a well-formed managed image.
+        bool ReadModuleVersionId(const QByteArray& image, AZ::u8 (&mvid)[16])
+        {
+            const auto* data = reinterpret_cast<const AZ::u8*>(image.constData());
+            const size_t size = static_cast<size_t>(image.size());
+            auto inRange = [size](size_t offset, size_t length)
+            {
+                return offset <= size && length <= size - offset;
+            };
+            auto u16At = [data](size_t offset)
+            {
+                return static_cast<AZ::u16>(data[offset] | (data[offset + 1] << 8));
+            };
+            auto u32At = [data](size_t offset)
+            {
+                return static_cast<AZ::u32>(data[offset])
+                    | (static_cast<AZ::u32>(data[offset + 1]) << 8)
+                    | (static_cast<AZ::u32>(data[offset + 2]) << 16)
+                    | (static_cast<AZ::u32>(data[offset + 3]) << 24);
+            };
+
+            if (!inRange(0, 0x40) || data[0] != 'M' || data[1] != 'Z')
+            {
+                return false;
+            }
+            const size_t peHeader = u32At(0x3C);
+            if (!inRange(peHeader, 24) || u32At(peHeader) != 0x00004550) // "PE\0\0"
+            {
+                return false;
+            }
+
+            const size_t coffHeader = peHeader + 4;
+            const AZ::u16 sectionCount = u16At(coffHeader + 2);
+            const AZ::u16 optionalHeaderSize = u16At(coffHeader + 16);
+            const size_t optionalHeader = coffHeader + 20;
+            if (optionalHeaderSize < 2 || !inRange(optionalHeader, optionalHeaderSize))
+            {
+                return false;
+            }
+
+            // Data directory 14 is the CLI header; the directories start
+            // further in for PE32+ (magic 0x20B) than for PE32.
+            const size_t dataDirectories = optionalHeader + (u16At(optionalHeader) == 0x20B ? 112 : 96);
+            const size_t cliDirectory = dataDirectories + 14 * 8;
+            if (cliDirectory + 8 > optionalHeader + optionalHeaderSize)
+            {
+                return false;
+            }
+
+            const size_t sectionTable = optionalHeader + optionalHeaderSize;
+            auto rvaToOffset = [&](AZ::u32 rva, size_t& offset)
+            {
+                for (AZ::u16 i = 0; i < sectionCount; ++i)
+                {
+                    const size_t section = sectionTable + i * 40;
+                    if (!inRange(section, 40))
+                    {
+                        return false;
+                    }
+                    const AZ::u32 virtualAddress = u32At(section + 12);
+                    const AZ::u32 rawSize = u32At(section + 16);
+                    if (rva >= virtualAddress && rva - virtualAddress < rawSize)
+                    {
+                        offset = static_cast<size_t>(u32At(section + 20)) + (rva - virtualAddress);
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            size_t cliHeader = 0;
+            size_t metadataRoot = 0;
+            if (!rvaToOffset(u32At(cliDirectory), cliHeader) || !inRange(cliHeader, 16)
+                || !rvaToOffset(u32At(cliHeader + 8), metadataRoot) || !inRange(metadataRoot, 16)
+                || u32At(metadataRoot) != 0x424A5342) // "BSJB"
+            {
+                return false;
+            }
+
+            size_t cursor = metadataRoot + 16 + u32At(metadataRoot + 12); // past the version string
+            if (!inRange(cursor, 4))
+            {
+                return false;
+            }
+            const AZ::u16 streamCount = u16At(cursor + 2);
+            cursor += 4;
+
+            size_t tableStream = 0;
+            size_t guidHeap = 0;
+            size_t guidHeapSize = 0;
+            for (AZ::u16 i = 0; i < streamCount; ++i)
+            {
+                size_t nameLength = 0;
+                while (inRange(cursor + 8 + nameLength, 1) && data[cursor + 8 + nameLength] != 0)
+                {
+                    ++nameLength;
+                }
+                if (!inRange(cursor + 8 + nameLength, 1))
+                {
+                    return false;
+                }
+
+                const AZStd::string_view name(reinterpret_cast<const char*>(data + cursor + 8), nameLength);
+                if (name == "#~")
+                {
+                    tableStream = metadataRoot + u32At(cursor);
+                }
+                else if (name == "#GUID")
+                {
+                    guidHeap = metadataRoot + u32At(cursor);
+                    guidHeapSize = u32At(cursor + 4);
+                }
+                cursor += 8 + ((nameLength + 4) & ~size_t(3)); // name is NUL-terminated, 4-byte padded
+            }
+            if (tableStream == 0 || guidHeap == 0 || !inRange(tableStream, 24) || !inRange(guidHeap, guidHeapSize))
+            {
+                return false;
+            }
+
+            // #~ header: heap-size flags at +6, 64-bit present-table mask at
+            // +8, then a u32 row count per present table. The Module table
+            // (table 0, always one row) comes first: Generation u16, Name
+            // string index, Mvid guid index.
+            const AZ::u8 heapSizes = data[tableStream + 6];
+            const AZ::u64 presentTables = static_cast<AZ::u64>(u32At(tableStream + 8))
+                | (static_cast<AZ::u64>(u32At(tableStream + 12)) << 32);
+            if ((presentTables & 1) == 0)
+            {
+                return false;
+            }
+            size_t presentCount = 0;
+            for (AZ::u64 bits = presentTables; bits != 0; bits &= bits - 1)
+            {
+                ++presentCount;
+            }
+
+            const size_t moduleRow = tableStream + 24 + presentCount * 4;
+            const size_t stringIndexSize = (heapSizes & 0x1) ? 4 : 2;
+            const size_t guidIndexSize = (heapSizes & 0x2) ? 4 : 2;
+            const size_t mvidIndexOffset = moduleRow + 2 + stringIndexSize;
+            if (!inRange(mvidIndexOffset, guidIndexSize))
+            {
+                return false;
+            }
+            const AZ::u32 mvidIndex = guidIndexSize == 4 ? u32At(mvidIndexOffset) : u16At(mvidIndexOffset);
+            if (mvidIndex == 0 || static_cast<size_t>(mvidIndex) * 16 > guidHeapSize)
+            {
+                return false;
+            }
+
+            memcpy(mvid, data + guidHeap + (mvidIndex - 1) * 16, sizeof(mvid));
+            return true;
+        }
     } // namespace
 
+    bool CSharpAssemblyWatcher::AssemblyFingerprint::operator==(const AssemblyFingerprint& other) const
+    {
+        return hasMvid == other.hasMvid
+            && memcmp(mvid, other.mvid, sizeof(mvid)) == 0
+            && size == other.size
+            && contentCrc == other.contentCrc;
+    }
+
     CSharpAssemblyWatcher::CSharpAssemblyWatcher(QObject* parent)
         : QObject(parent)
         , m_watcher(new QFileSystemWatcher(this))
@@ -99,6 +272,8 @@ namespace O3DESharp
             m_watcher->addPaths(toWatch);
         }
 
+        CaptureBaseline();
+
         AZ_TracePrintf(
             "O3DESharp",
             "CSharpAssemblyWatcher: watching '%s' for *.dll changes (debounce %d ms)\n",
@@ -125,6 +300,8 @@ namespace O3DESharp
             }
         }
         m_individuallyWatchedFiles.clear();
+        m_fingerprints.clear();
+        m_unreadableRetries = 0;
         m_watchedDirectory.clear();
     }
 
@@ -210,21 +387,137 @@ namespace O3DESharp
         DispatchReload();
     }
 
+    bool CSharpAssemblyWatcher::ComputeFingerprint(const AZStd::string& path, AssemblyFingerprint& out)
+    {
+        QFile file(QString::fromUtf8(path.c_str()));
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            return false;
+        }
+        const QByteArray bytes = file.readAll();
+
+        out = AssemblyFingerprint{};
+        out.size = static_cast<AZ::u64>(bytes.size());
+        out.contentCrc = static_cast<AZ::u32>(AZ::Crc32(bytes.constData(), static_cast<size_t>(bytes.size())));
+        out.hasMvid = ReadModuleVersionId(bytes, out.mvid);
+        return true;
+    }
+
+    void CSharpAssemblyWatcher::CaptureBaseline()
+    {
+        m_fingerprints.clear();
+
+        QDir dir(QString::fromUtf8(m_watchedDirectory.c_str()));
+        const QFileInfoList entries = dir.entryInfoList({ QStringLiteral("*.dll") }, QDir::Files | QDir::NoDotAndDotDot);
+        for (const QFileInfo& info : entries)
+        {
+            const AZStd::string path = info.absoluteFilePath().toUtf8().constData();
+            AssemblyFingerprint fingerprint;
+            if (ComputeFingerprint(path, fingerprint))
+            {
+                m_fingerprints.emplace(path, fingerprint);
+            }
+        }
+    }
+
     void CSharpAssemblyWatcher::DispatchReload()
     {
+        // Fingerprint what's on disk now. PDBs are ignored: they only matter
+        // together with their DLL, and a rebuilt DLL changes its own bytes.
+        QDir dir(QString::fromUtf8(m_watchedDirectory.c_str()));
+        const QFileInfoList entries = dir.entryInfoList({ QStringLiteral("*.dll") }, QDir::Files | QDir::NoDotAndDotDot);
+
+        AZStd::unordered_map<AZStd::string, AssemblyFingerprint> current;
+        AZStd::vector<AZStd::string> changed;
+        bool anyUnreadable = false;
+        for (const QFileInfo& info : entries)
+        {
+            const AZStd::string path = info.absoluteFilePath().toUtf8().constData();
+            auto previous = m_fingerprints.find(path);
+
+            AssemblyFingerprint fingerprint;
+            if (!ComputeFingerprint(path, fingerprint))
+            {
+                // Keep the old fingerprint, so the file counts as changed
+                // once it can be read.
+                anyUnreadable = true;
+                if (previous != m_fingerprints.end())
+                {
+                    current.emplace(path, previous->second);
+                }
+                continue;
+            }
+
+            if (previous == m_fingerprints.end() || previous->second != fingerprint)
+            {
+                changed.push_back(path);
+            }
+            current.emplace(path, fingerprint);
+        }
+
+        if (anyUnreadable && m_unreadableRetries < MaxUnreadableRetries)
+        {
+            // Still being written; look again shortly rather than reload half
+            // of a build.
+            ++m_unreadableRetries;
+            m_debounceTimer->start(200);
+            return;
+        }
+        AZ_Warning(
+            "O3DESharp", !anyUnreadable,
+            "CSharpAssemblyWatcher: some assemblies in '%s' could not be read; reloading without them.",
+            m_watchedDirectory.c_str());
+        m_unreadableRetries = 0;
+
+        if (changed.empty())
+        {
+            // Removed DLLs simply drop out of the map.
+            m_fingerprints = AZStd::move(current);
+            AZ_TracePrintf(
+                "O3DESharp",
+                "CSharpAssemblyWatcher: assemblies in '%s' were rewritten with identical contents, skipping reload\n",
+                m_watchedDirectory.c_str());
+            return;
+        }
+
         AZ_Printf(
             "O3DESharp",
-            "CSharpAssemblyWatcher: detected change in '%s', requesting user assembly reload\n",
-            m_watchedDirectory.c_str());
+            "CSharpAssemblyWatcher: %zu assembly(ies) changed in '%s', requesting user assembly reload\n",
+            changed.size(), m_watchedDirectory.c_str());
+        for (const AZStd::string& path : changed)
+        {
+            AZ_Printf("O3DESharp", "  %s\n", path.c_str());
+        }
 
         bool reloaded = false;
-        O3DESharpRequestBus::BroadcastResult(reloaded, &O3DESharpRequests::ReloadUserAssemblies);
+        O3DESharpRequestBus::BroadcastResult(reloaded, &O3DESharpRequests::ReloadChangedUserAssemblies, changed);
+
+        if (!reloaded)
+        {
+            // The new contents never made it in: keep the fingerprints they
+            // replaced, so rewriting the same bytes (a rebuild, or the lock
+            // going away) counts as a change and gets another try.
+            for (const AZStd::string& path : changed)
+            {
+                auto previous = m_fingerprints.find(path);
+                if (previous != m_fingerprints.end())
+                {
+                    current[path] = previous->second;
+                }
+                else
+                {
+                    current.erase(path);
+                }
+            }
+        }
+        // Removed DLLs simply drop out of the map.
+        m_fingerprints = AZStd::move(current);
 
         if (!reloaded)
         {
             AZ_Warning(
                 "O3DESharp", false,
-                "CSharpAssemblyWatcher: ReloadUserAssemblies returned false. "
+                "CSharpAssemblyWatcher: ReloadChangedUserAssemblies returned false. "
                 "Check that hot-reload is enabled and the Coral host is initialized.");
         }
     }
@@ -9,7 +9,9 @@
 #pragma once
 
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 
 #if !defined(Q_MOC_RUN)
 #include <QObject>
@@ -25,13 +27,17 @@ namespace O3DESharp
      * Editor-only file watcher that auto-reloads C# user assemblies when DLL
      * files change in the project's Bin/Scripts/ directory.
      *
-     * The actual reload is handed off to O3DESharpRequestBus::ReloadUserAssemblies,
-     * which goes through CoralHostManager::ReloadUserAssemblies and the
+     * The actual reload is handed off to O3DESharpRequestBus::ReloadChangedUserAssemblies,
+     * which goes through CoralHostManager::ReloadChangedUserAssemblies and the
      * O3DESharpHotReloadNotificationBus (Phase 13). This class is purely the
      * "when do we trigger that?" half - it owns:
      *   - a QFileSystemWatcher subscribed to <ProjectPath>/Bin/Scripts/
      *   - a QTimer used as a debounce so we don't react to half-written DLLs
      *     during a multi-chunk dotnet build write
+     *   - a fingerprint (module MVID + size + CRC of the bytes) per DLL, so a
+     *     build that rewrites identical assemblies - incremental dotnet build
+     *     touches timestamps even when the IL is unchanged - reloads nothing,
+     *     and a real change only reloads the assemblies that differ
      *
      * Why Qt instead of AzFramework::FileWatcher?
      *   AzFramework does NOT export a public FileWatcher. The Code/Tools/
@@ -84,11 +90,34 @@ namespace O3DESharp
         void OnDebounceElapsed();
 
     private:
+        // Identity of one DLL's contents. The MVID alone isn't enough:
+        // non-deterministic builds give identical IL a new one, and a
+        // hand-patched file can keep it.
+        struct AssemblyFingerprint
+        {
+            AZ::u8 mvid[16] = {};
+            bool hasMvid = false;
+            AZ::u64 size = 0;
+            AZ::u32 contentCrc = 0;
+
+            bool operator==(const AssemblyFingerprint& other) const;
+            bool operator!=(const AssemblyFingerprint& other) const { return !(*this == other); }
+        };
+
         // Dispatched by OnDebounceElapsed once the user has stopped touching
         // the directory for the configured debounce window. Broadcasts on
-        // O3DESharpRequestBus to do the actual reload through Coral.
+        // O3DESharpRequestBus to do the actual reload through Coral, passing
+        // only the DLLs whose fingerprint changed.
         void DispatchReload();
 
+        // Reads and fingerprints path. False if it can't be read (still being
+        // written, or gone).
+        static bool ComputeFingerprint(const AZStd::string& path, AssemblyFingerprint& out);
+
+        // Fingerprint every DLL currently in the watched directory into
+        // m_fingerprints. Called on Start, before anything has changed.
+        void CaptureBaseline();
+
         QFileSystemWatcher* m_watcher = nullptr;
         QTimer* m_debounceTimer = nullptr;
 
@@ -100,6 +129,13 @@ namespace O3DESharp
         // platforms to fire on content changes, not just adds/removes).
         AZStd::unordered_set<AZStd::string> m_individuallyWatchedFiles;
 
+        // Last fingerprint seen per DLL (absolute path), i.e. what the host
+        // has loaded as far as this watcher knows.
+        AZStd::unordered_map<AZStd::string, AssemblyFingerprint> m_fingerprints;
+
+        // Consecutive debounce re-arms spent waiting for an unreadable DLL.
+        int m_unreadableRetries = 0;
+
         // Set to true while we're known to be in the middle of a build. The
         // dispatcher reschedules the reload until this clears so we don't try
         // to load a half-written DLL.
@@ -21,6 +21,7 @@
 #include <AzToolsFramework/API/ToolsApplicationAPI.h>
 
 #include <Scripting/CoralHostManager.h>
+#include <Scripting/ExposedPropertyBlock.h>
 #include <Tools/CSharpEditorToolsBus.h>
 
 namespace O3DESharp
@@ -40,7 +41,7 @@ namespace O3DESharp
             }
 
             serializeContext->Class<EditorCSharpScriptConfig, AZ::ComponentConfig>()
-                ->Version(3) // bumped: m_validationStatus now serialized for the inspector readout
+                ->Version(4) // bumped: added m_activateImmediately
                 ->Field("ScriptClassName", &EditorCSharpScriptConfig::m_scriptClassName)
                 ->Field("AssemblyPath", &EditorCSharpScriptConfig::m_assemblyPath)
                 ->Field("ExposedProperties", &EditorCSharpScriptConfig::m_exposedPropertyValues)
@@ -53,6 +54,7 @@ namespace O3DESharp
                 // from a saved prefab is invisible in practice.
                 // m_isValid stays unserialized: it's not referenced from EditContext.
                 ->Field("ValidationStatus", &EditorCSharpScriptConfig::m_validationStatus)
+                ->Field("ActivateImmediately", &EditorCSharpScriptConfig::m_activateImmediately)
                 ;
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -89,6 +91,11 @@ namespace O3DESharp
                         "the runtime instance when edited during Game Mode.")
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                         ->Attribute(AZ_CRC_CE("ScriptClassNameAttr"), &EditorCSharpScriptConfig::m_scriptClassName)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &EditorCSharpScriptConfig::m_activateImmediately,
+                        "Activate Immediately",
+                        "Start the script on activation even when the frame's activation budget "
+                        "(/O3DE/O3DESharp/Activation/FrameBudgetMs) is spent. For scripts other "
+                        "gameplay relies on from the first frame.")
                     ;
                     // (Entity-id discovery for the live-push broadcast is
                     // done from the handler's WriteGUIValuesIntoProperty
@@ -184,6 +191,7 @@ namespace O3DESharp
         m_config.m_scriptClassName = config.m_scriptClassName;
         m_config.m_assemblyPath = config.m_assemblyPath;
         m_config.m_exposedPropertyValues = config.m_exposedPropertyValues;
+        m_config.m_activateImmediately = config.m_activateImmediately;
         ValidateScript();
     }
 
@@ -193,6 +201,7 @@ namespace O3DESharp
         config.m_scriptClassName = m_config.m_scriptClassName;
         config.m_assemblyPath = m_config.m_assemblyPath;
         config.m_exposedPropertyValues = m_config.m_exposedPropertyValues;
+        config.m_activateImmediately = m_config.m_activateImmediately;
         return config;
     }
 
@@ -434,8 +443,8 @@ namespace O3DESharp
         [[maybe_unused]] const AZStd::string& assemblyPath) const
     {
         // assemblyPath is intentionally ignored here: CoralHostManager owns the unified
-        // load context and any class name lookup is satisfied by GetUserType iterating
-        // every currently-loaded user assembly. Per-assembly disambiguation can be
+        // load context and any class name lookup is satisfied by GetUserType, which
+        // indexes every currently-loaded user assembly. Per-assembly disambiguation can be
         // added later if scripts ever live in non-default assemblies.
         auto* coralHost = AZ::Interface<ICoralHostManager>::Get();
         if (coralHost == nullptr)
@@ -471,6 +480,14 @@ namespace O3DESharp
         runtimeConfig.m_scriptClassName = m_config.m_scriptClassName;
         runtimeConfig.m_assemblyPath = m_config.m_assemblyPath;
         runtimeConfig.m_exposedPropertyValues = m_config.m_exposedPropertyValues;
+        runtimeConfig.m_activateImmediately = m_config.m_activateImmediately;
+
+        // Pre-convert the values into the typed block so spawned instances
+        // skip string parsing entirely. Needs the script's schema, i.e. a
+        // running Coral host; when there isn't one (e.g. an Asset Processor
+        // build) the block stays empty and the runtime derives it instead.
+        ExposedPropertyBlock::GetOrBuildForScript(
+            runtimeConfig.m_scriptClassName, runtimeConfig.m_exposedPropertyValues, runtimeConfig.m_exposedPropertyBlock);
 
         auto* runtimeComponent = gameEntity->CreateComponent<CSharpScriptComponent>(runtimeConfig);
         AZ_UNUSED(runtimeComponent);
@@ -46,6 +46,9 @@ namespace O3DESharp
         //! transferred verbatim by BuildGameEntity / SetConfiguration /
         //! GetConfiguration. See O3DE.ExposedPropertyAttribute (Phase 7).
         AZStd::unordered_map<AZStd::string, AZStd::string> m_exposedPropertyValues;
+
+        //! Mirrors CSharpScriptComponentConfig::m_activateImmediately
+        bool m_activateImmediately = false;
     };
 
     /**
@@ -84,6 +87,7 @@ namespace O3DESharp
         // Configuration access
         void SetConfiguration(const CSharpScriptComponentConfig& config);
         CSharpScriptComponentConfig GetConfiguration() const;
+        const AZStd::string& GetScriptClassName() const { return m_config.m_scriptClassName; }
 
         //! Validate the current script class
         void ValidateScript();
@@ -12,14 +12,18 @@
 #include "CSharpAssemblyWatcher.h"
 #include "Components/CSharpScriptClassPropertyHandler.h"
 #include "Components/CSharpExposedPropertiesHandler.h"
+#include "Components/EditorCSharpScriptComponent.h"
 
 #include <O3DESharp/O3DESharpBus.h>
 #include <O3DESharp/O3DESharpTypeIds.h>
 
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
 #include <AzCore/Platform.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/IO/SystemFile.h>
 
 #if defined(AZ_PLATFORM_WINDOWS)
@@ -1114,6 +1118,32 @@ except Exception as e:
         RunBootstrapFunctionAsync(bootstrapFn);
     }
 
+    void O3DESharpEditorSystemComponent::OnEntityStreamLoadSuccess()
+    {
+        // A level just loaded: have the runtime build the exposed-property
+        // schemas of its script classes on a worker thread now, instead of
+        // one managed construction per class on the main thread the first
+        // time each inspector is shown.
+        AZStd::vector<AZStd::string> classNames;
+        AZ::ComponentApplicationBus::Broadcast(&AZ::ComponentApplicationRequests::EnumerateEntities,
+            [&classNames](AZ::Entity* entity)
+            {
+                for (const auto* script : entity->FindComponents<EditorCSharpScriptComponent>())
+                {
+                    const AZStd::string& className = script->GetScriptClassName();
+                    if (!className.empty() && AZStd::find(classNames.begin(), classNames.end(), className) == classNames.end())
+                    {
+                        classNames.push_back(className);
+                    }
+                }
+            });
+
+        if (!classNames.empty())
+        {
+            O3DESharpRequestBus::Broadcast(&O3DESharpRequests::PrecomputeExposedPropertySchemas, classNames);
+        }
+    }
+
     void O3DESharpEditorSystemComponent::OnBeforeUserAssemblyReload()
     {
         // Phase 17d-3: capture whether a native (mixed-mode / VS) debugger
@@ -115,10 +115,12 @@ namespace O3DESharp
         void ToggleWaitForDebuggerOnActivate();
         bool IsWaitForDebuggerOnActivateEnabled() const;
 
-        // EditorEntityContextNotificationBus - we only use OnStartPlayInEditorBegin
-        // to trigger the configured auto-attach. Hooked in Activate, dropped
-        // in Deactivate alongside the other bus handlers.
+        // EditorEntityContextNotificationBus - OnStartPlayInEditorBegin
+        // triggers the configured auto-attach, OnEntityStreamLoadSuccess
+        // warms the schemas of the script classes the level uses. Hooked in
+        // Activate, dropped in Deactivate alongside the other bus handlers.
         void OnStartPlayInEditorBegin() override;
+        void OnEntityStreamLoadSuccess() override;
 
         // O3DESharpHotReloadNotificationBus - Phase 17d-3. Detects when the
         // debugger detached across a hot-reload cycle (most IDEs preserve
@@ -192,4 +192,40 @@ public class DeterministicOrderingTests
         winner1[0].QualifiedName.Should().Be("GemB::Widget");
         winner2[0].QualifiedName.Should().Be("GemA::Widget");
     }
+
+    [Fact]
+    public void MergeHeaderResults_KeepsHeaderOrder_RegardlessOfCompletionOrder()
+    {
+        // ParseHeaders / MultiGemBindingGenerator parse headers concurrently
+        // and drop each result into the slot of its header. Filling the
+        // slots in reverse (as if the last header finished first) must
+        // still merge in header order.
+        var headers = new[] { "A.h", "B.h", "C.h" };
+        var perHeader = new ParsedBindings?[headers.Length];
+        for (int i = headers.Length - 1; i >= 0; i--)
+        {
+            var part = new ParsedBindings { GemName = "Gem" };
+            part.Classes.Add(new ParsedClass { Name = $"Class{i}", QualifiedName = $"Gem::Class{i}", SourceFile = headers[i] });
+            part.SourceFiles.Add(headers[i]);
+            perHeader[i] = part;
+        }
+
+        var merged = O3DEHeaderParser.MergeHeaderResults("Gem", perHeader);
+
+        merged.GemName.Should().Be("Gem");
+        merged.Classes.Select(c => c.SourceFile).Should().Equal(headers);
+        merged.SourceFiles.Should().BeEquivalentTo(headers);
+    }
+
+    [Fact]
+    public void MergeHeaderResults_SkipsHeadersThatFailedToParse()
+    {
+        var part = new ParsedBindings { GemName = "Gem" };
+        part.Enums.Add(new ParsedEnum { Name = "Mode", QualifiedName = "Gem::Mode" });
+
+        var merged = O3DEHeaderParser.MergeHeaderResults("Gem", new ParsedBindings?[] { null, part, null });
+
+        merged.Enums.Should().ContainSingle(e => e.QualifiedName == "Gem::Mode");
+        merged.Classes.Should().BeEmpty();
+    }
 }
@@ -296,4 +296,143 @@ public class ExposedPropertyTests
         [ExposedProperty]
         public System.Guid Id = System.Guid.Empty;
     }
+
+    // ---- ApplyBlock / EncodeBlock -------------------------------------
+
+    // Same member names as SimpleScript, but Speed changed from float to int
+    // - what a recompiled script looks like against a stale stored block.
+    private class RetypedScript
+    {
+        [ExposedProperty]
+        public int Speed = 0;
+
+        [ExposedProperty]
+        public int MaxHealth = 0;
+    }
+
+    private enum SpeedClass
+    {
+        Slow,
+        Fast,
+    }
+
+    // Speed changed to a type blocks can't carry
+    private class EnumSpeedScript
+    {
+        [ExposedProperty]
+        public SpeedClass Speed = SpeedClass.Slow;
+
+        [ExposedProperty]
+        public int MaxHealth = 0;
+    }
+
+    [Fact]
+    public void EncodeBlock_ApplyBlock_RoundTripsEveryMember()
+    {
+        var source = new DerivedScript
+        {
+            Speed = 7.25f,
+            MaxHealth = 120,
+            CanJump = false,
+            Tag = "größe \"q\"",
+            Multiplier = 0.125,
+            Lives = 9,
+        };
+        var block = ExposedPropertyHelpers.EncodeBlock(source);
+
+        var target = new DerivedScript();
+        int unapplied = ExposedPropertyHelpers.ApplyBlock(target, block);
+
+        unapplied.Should().Be(0);
+        target.Speed.Should().Be(7.25f);
+        target.MaxHealth.Should().Be(120);
+        target.CanJump.Should().BeFalse();
+        target.Tag.Should().Be("größe \"q\"");
+        target.Multiplier.Should().Be(0.125);
+        target.Lives.Should().Be(9u);
+    }
+
+    [Fact]
+    public void ApplyBlock_SameLayoutDifferentValues_ReusesPlanAndAppliesNewValues()
+    {
+        var first = ExposedPropertyHelpers.EncodeBlock(new SimpleScript { Speed = 1f, Tag = "a" });
+        var second = ExposedPropertyHelpers.EncodeBlock(new SimpleScript { Speed = 2f, Tag = "bb" });
+
+        // Layout hash depends on names and types only, not values.
+        System.BitConverter.ToUInt32(first, 8).Should().Be(System.BitConverter.ToUInt32(second, 8));
+
+        var target = new SimpleScript();
+        ExposedPropertyHelpers.ApplyBlock(target, first).Should().Be(0);
+        ExposedPropertyHelpers.ApplyBlock(target, second).Should().Be(0);
+
+        target.Speed.Should().Be(2f);
+        target.Tag.Should().Be("bb");
+    }
+
+    [Fact]
+    public void ApplyBlock_TypeChangedMember_IsCountedAndOthersStillApply()
+    {
+        var block = ExposedPropertyHelpers.EncodeBlock(new SimpleScript { Speed = 3f, MaxHealth = 77 });
+        var target = new RetypedScript();
+
+        int unapplied = ExposedPropertyHelpers.ApplyBlock(target, block);
+
+        unapplied.Should().Be(1, "Speed is now an int; the caller falls back to the string map");
+        target.MaxHealth.Should().Be(77);
+        target.Speed.Should().Be(0);
+    }
+
+    [Fact]
+    public void ApplyBlock_MemberWithoutBlockEncoding_IsSkippedAndOthersStillApply()
+    {
+        var block = ExposedPropertyHelpers.EncodeBlock(new SimpleScript { Speed = 3f, MaxHealth = 77 });
+        var target = new EnumSpeedScript();
+
+        ExposedPropertyHelpers.ApplyBlock(target, block).Should().Be(0);
+        ExposedPropertyHelpers.ApplyBlock(target, block).Should().Be(0, "the cached plan skips it too");
+
+        target.MaxHealth.Should().Be(77);
+        target.Speed.Should().Be(SpeedClass.Slow);
+    }
+
+    [Fact]
+    public void ApplyBlock_MalformedBlock_ReturnsMinusOneAndLeavesInstanceUntouched()
+    {
+        var errors = new List<string>();
+        var block = ExposedPropertyHelpers.EncodeBlock(new SimpleScript { Speed = 5f });
+        var target = new SimpleScript();
+
+        var badMagic = (byte[])block.Clone();
+        badMagic[0] ^= 0xFF;
+        ExposedPropertyHelpers.ApplyBlock(target, badMagic, errors.Add).Should().Be(-1);
+
+        var truncated = block.AsSpan(0, block.Length - 1).ToArray();
+        ExposedPropertyHelpers.ApplyBlock(target, truncated, errors.Add).Should().Be(-1);
+
+        ExposedPropertyHelpers.ApplyBlock(target, System.Array.Empty<byte>(), errors.Add).Should().Be(-1);
+
+        errors.Should().HaveCount(3);
+        target.Speed.Should().Be(1.0f);
+    }
+
+    [Fact]
+    public void ApplyBlock_EmptyBlock_AppliesNothing()
+    {
+        var block = ExposedPropertyHelpers.EncodeBlock(new object());
+        block.Length.Should().Be(ExposedPropertyBlock.HeaderSize);
+
+        var target = new SimpleScript();
+        ExposedPropertyHelpers.ApplyBlock(target, block).Should().Be(0);
+        target.Speed.Should().Be(1.0f);
+    }
+
+    [Fact]
+    public void HashName_IsFnv1aOverUtf8()
+    {
+        // Reference values for 32-bit FNV-1a; ExposedPropertyBlock.cpp must
+        // produce the same hashes for blocks to apply.
+        ExposedPropertyBlock.HashName("").Should().Be(2166136261u);
+        ExposedPropertyBlock.HashName("a").Should().Be(0xE40C292Cu);
+        ExposedPropertyBlock.HashName("foobar").Should().Be(0xBF9CF968u);
+    }
 }
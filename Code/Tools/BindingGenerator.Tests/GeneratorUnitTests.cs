@@ -360,6 +360,144 @@ public class GeneratorUnitTests
         emitted.Should().Contain("return 0;");
     }
 
+    // --------------------------------------------------------------------
+    // Direct-call thunks: the generated body converts the interop arguments
+    // and calls the exported C++ declaration instead of warning.
+    // --------------------------------------------------------------------
+
+    private static readonly ParsedClass ThunkOwner = new ParsedClass { Name = "Mover", QualifiedName = "MyGem::Mover" };
+
+    [Fact]
+    public void EmitThunkDefinition_InstanceMethod_CastsThisAndConvertsMathTypes()
+    {
+        var mapper = new TypeMapper();
+        var method = new ParsedMethod
+        {
+            Name = "MoveTo",
+            IsStatic = false,
+            ReturnType = mapper.MapType("AZ::Vector3"),
+            Parameters =
+            {
+                new ParsedParameter { Name = "target", Type = mapper.MapParameterType("const AZ::Vector3 &") },
+                new ParsedParameter { Name = "speed", Type = mapper.MapParameterType("float") },
+            },
+        };
+        var sb = new System.Text.StringBuilder();
+        CppRegistrationGenerator.EmitThunkDefinition(sb, "Mover_MoveTo", ThunkOwner, method).Should().BeTrue();
+
+        var emitted = sb.ToString();
+        emitted.Should().Contain("O3DESharp::InteropVector3 Mover_MoveTo(void* thisPtr, void* target, float speed)");
+        emitted.Should().Contain("return O3DESharp::InteropVector3{};", "a disposed wrapper passes a null handle");
+        emitted.Should().Contain(
+            "return O3DESharp::InteropVector3(static_cast<::MyGem::Mover*>(thisPtr)->MoveTo(static_cast<const O3DESharp::InteropVector3*>(target)->ToAZ(), speed));");
+        emitted.Should().NotContain("AZ_WarningOnce");
+    }
+
+    [Fact]
+    public void EmitThunkDefinition_NonConstMathReference_WritesBackAfterTheCall()
+    {
+        var mapper = new TypeMapper();
+        var method = new ParsedMethod
+        {
+            Name = "Clamp",
+            IsStatic = true,
+            ReturnType = mapper.MapType("bool"),
+            Parameters =
+            {
+                new ParsedParameter { Name = "position", Type = mapper.MapParameterType("AZ::Vector3 &") },
+            },
+        };
+        var sb = new System.Text.StringBuilder();
+        CppRegistrationGenerator.EmitThunkDefinition(sb, "Mover_Clamp", ThunkOwner, method).Should().BeTrue();
+
+        var emitted = sb.ToString();
+        emitted.Should().Contain("AZ::Vector3 positionValue = static_cast<O3DESharp::InteropVector3*>(position)->ToAZ();");
+        emitted.Should().Contain("auto&& result = ::MyGem::Mover::Clamp(positionValue);");
+        emitted.IndexOf("*static_cast<O3DESharp::InteropVector3*>(position) = O3DESharp::InteropVector3(positionValue);")
+            .Should().BeLessThan(emitted.IndexOf("return result;"), "the write-back has to happen before returning");
+    }
+
+    [Fact]
+    public void EmitThunkDefinition_StandaloneFunction_ConvertsEntityIdsAndStrings()
+    {
+        var mapper = new TypeMapper();
+        var function = new ParsedFunction
+        {
+            Name = "FindChild",
+            Namespace = "MyGem::Util",
+            ReturnType = mapper.MapType("AZ::EntityId"),
+            Parameters =
+            {
+                new ParsedParameter { Name = "parent", Type = mapper.MapParameterType("AZ::EntityId") },
+                new ParsedParameter { Name = "name", Type = mapper.MapParameterType("const AZStd::string &") },
+            },
+        };
+        var sb = new System.Text.StringBuilder();
+        CppRegistrationGenerator.EmitThunkDefinition(sb, "FindChild", function).Should().BeTrue();
+
+        var emitted = sb.ToString();
+        emitted.Should().Contain("AZ::u64 FindChild(AZ::u64 parent, void* name)");
+        emitted.Should().Contain(
+            "return static_cast<AZ::u64>(::MyGem::Util::FindChild(AZ::EntityId(parent), AZStd::string(name ? static_cast<const char*>(name) : \"\")));");
+    }
+
+    [Fact]
+    public void EmitThunkDefinition_ArrayParameter_PassesPointerAndCount()
+    {
+        var mapper = new TypeMapper();
+        var values = mapper.MapParameterType("const AZStd::vector<float> &");
+        values.CSharpTypeName.Should().Be("ReadOnlySpan<float>");
+        values.ArrayElementType.Should().Be("float");
+
+        var method = new ParsedMethod
+        {
+            Name = "SetWeights",
+            IsStatic = false,
+            ReturnType = mapper.MapType("void"),
+            Parameters = { new ParsedParameter { Name = "weights", Type = values } },
+        };
+        var sb = new System.Text.StringBuilder();
+        CppRegistrationGenerator.EmitThunkDefinition(sb, "Mover_SetWeights", ThunkOwner, method).Should().BeTrue();
+
+        var emitted = sb.ToString();
+        emitted.Should().Contain("void Mover_SetWeights(void* thisPtr, void* weights, AZ::s32 weightsCount)");
+        emitted.Should().Contain(
+            "static_cast<::MyGem::Mover*>(thisPtr)->SetWeights(AZStd::vector<float>(static_cast<const float*>(weights), static_cast<const float*>(weights) + weightsCount));");
+    }
+
+    [Fact]
+    public void MapParameterType_OnlyReadOnlyPrimitiveArraysBecomeSpans()
+    {
+        var mapper = new TypeMapper();
+        mapper.MapParameterType("AZStd::span<const AZ::u32>").CSharpTypeName.Should().Be("ReadOnlySpan<uint>");
+        mapper.MapParameterType("AZStd::vector<float> &").CSharpTypeName.Should().Be("IntPtr", "a non-const reference may be written to");
+        mapper.MapParameterType("AZStd::vector<AZ::Vector3>").CSharpTypeName.Should().Be("IntPtr", "Vector3 layouts differ across the boundary");
+        mapper.MapParameterType("AZStd::vector<float> *").CSharpTypeName.Should().Be("IntPtr");
+    }
+
+    [Fact]
+    public void EmitThunkDefinition_ObjectReturnedByValue_FallsBackToStub()
+    {
+        var mapper = new TypeMapper();
+        var method = new ParsedMethod
+        {
+            Name = "GetTransform",
+            IsStatic = false,
+            IsConst = true,
+            ReturnType = mapper.MapType("AZ::Transform"),
+        };
+        var sb = new System.Text.StringBuilder();
+        CppRegistrationGenerator.EmitThunkDefinition(sb, "Mover_GetTransform", ThunkOwner, method)
+            .Should().BeFalse("a by-value object has no address that outlives the call");
+        sb.Length.Should().Be(0);
+
+        // A reference return has one
+        method.ReturnType = mapper.MapType("const AZ::Transform &");
+        CppRegistrationGenerator.EmitThunkDefinition(sb, "Mover_GetTransform", ThunkOwner, method).Should().BeTrue();
+        sb.ToString().Should().Contain(
+            "return const_cast<void*>(static_cast<const void*>(&(static_cast<const ::MyGem::Mover*>(thisPtr)->GetTransform())));");
+    }
+
     // --------------------------------------------------------------------
     // BindingConfig: engine-required defines never disappear behind user JSON
     // --------------------------------------------------------------------
@@ -463,4 +601,102 @@ public class GeneratorUnitTests
             try { Directory.Delete(tempDir, recursive: true); } catch { /* best-effort */ }
         }
     }
+
+    [Fact]
+    public void BuildCache_ConcurrentUpdates_RecordEveryGem()
+    {
+        // MultiGemBindingGenerator updates the cache from its parallel
+        // per-gem phases; no entry may be lost and Save must not race them.
+        var tempDir = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName());
+        Directory.CreateDirectory(tempDir);
+        var cacheFile = Path.Combine(tempDir, ".binding_cache.json");
+
+        try
+        {
+            var header = Path.Combine(tempDir, "Shared.h");
+            File.WriteAllText(header, "// shared");
+            var outputArtifact = Path.Combine(tempDir, "out.g.cs");
+            File.WriteAllText(outputArtifact, "// generated");
+
+            const int gemCount = 64;
+            var cache = new BuildCache(cacheFile);
+            System.Threading.Tasks.Parallel.For(0, gemCount, i =>
+            {
+                var gemName = $"Gem{i}";
+                cache.NeedsRegeneration(gemName, new[] { header }, "cfg");
+                cache.UpdateEntry(gemName, new[] { header }, System.Array.Empty<string>(), "cfg", new[] { outputArtifact });
+                if (i % 16 == 0)
+                {
+                    cache.Save();
+                }
+            });
+            cache.Save();
+
+            cache.GetStats().EntryCount.Should().Be(gemCount);
+
+            var reloaded = new BuildCache(cacheFile);
+            reloaded.GetStats().EntryCount.Should().Be(gemCount);
+            for (int i = 0; i < gemCount; i++)
+            {
+                reloaded.NeedsRegeneration($"Gem{i}", new[] { header }, "cfg").Should().BeFalse();
+            }
+        }
+        finally
+        {
+            try { Directory.Delete(tempDir, recursive: true); } catch { /* best-effort */ }
+        }
+    }
+
+    [Fact]
+    public void HeaderParseCache_ServesUnchangedHeader_AndMissesAfterEdits()
+    {
+        var tempDir = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName());
+        Directory.CreateDirectory(tempDir);
+        var header = Path.Combine(tempDir, "Widget.h");
+        var dependency = Path.Combine(tempDir, "AzCoreMathVector3.h");
+        var cacheDir = Path.Combine(tempDir, ".binding_header_cache");
+
+        try
+        {
+            File.WriteAllText(header, "// widget v1");
+            File.WriteAllText(dependency, "// vector3 v1");
+            var argsHash = HeaderParseCache.ComputeArgsHash(new[] { "-I" + tempDir }, requireExportAttribute: false);
+
+            var fragment = new ParsedBindings { GemName = "Gem", SkippedFilteredClassCount = 2 };
+            fragment.Classes.Add(new ParsedClass { Name = "Widget", QualifiedName = "Gem::Widget", SourceFile = header });
+            fragment.SourceFiles.Add(header);
+            fragment.SourceFiles.Add(dependency);
+
+            new HeaderParseCache(cacheDir).Store(header, argsHash, fragment);
+
+            // A fresh instance (next run) serves the stored fragment.
+            var cache = new HeaderParseCache(cacheDir);
+            cache.TryGet(header, argsHash, "Gem", out var cached).Should().BeTrue();
+            cached.Classes.Should().ContainSingle(c => c.QualifiedName == "Gem::Widget");
+            cached.SkippedFilteredClassCount.Should().Be(2);
+            cached.SourceFiles.Should().Contain(Path.GetFullPath(dependency));
+
+            // Different parse options are a different key.
+            var otherArgs = HeaderParseCache.ComputeArgsHash(new[] { "-DFOO" }, requireExportAttribute: false);
+            new HeaderParseCache(cacheDir).TryGet(header, otherArgs, "Gem", out _).Should().BeFalse();
+
+            // --force: ignore what is stored.
+            new HeaderParseCache(cacheDir, readEnabled: false).TryGet(header, argsHash, "Gem", out _).Should().BeFalse();
+
+            // Editing only the dependency invalidates the header's entry.
+            File.WriteAllText(dependency, "// vector3 v2");
+            new HeaderParseCache(cacheDir).TryGet(header, argsHash, "Gem", out _).Should().BeFalse(
+                "a header's cached parse depends on the headers that contributed declarations to it");
+
+            // Editing the header itself does too.
+            File.WriteAllText(dependency, "// vector3 v1");
+            File.WriteAllText(header, "// widget v2");
+            new HeaderParseCache(cacheDir).TryGet(header, argsHash, "Gem", out _).Should().BeFalse();
+        }
+        finally
+        {
+            try { Directory.Delete(tempDir, recursive: true); } catch { /* best-effort */ }
+        }
+    }
 }
+
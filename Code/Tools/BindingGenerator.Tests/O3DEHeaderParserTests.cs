@@ -86,4 +86,29 @@ public class O3DEHeaderParserTests : IDisposable
         bindings.Functions.Should().BeEmpty();
         bindings.Enums.Should().BeEmpty();
     }
+
+    [Fact]
+    public void ParseHeaders_Parallel_MatchesSerialParse()
+    {
+        // Arrange: enough headers that several workers are in flight at once.
+        var headers = Enumerable.Range(0, 8)
+            .Select(i => TestFixtures.CreateSampleHeader(_tempDir, $"Parallel{i}Class"))
+            .OrderBy(h => h, StringComparer.OrdinalIgnoreCase)
+            .ToList();
+        var includePaths = new List<string> { _tempDir };
+        var defines = BindingConfig.EngineRequiredDefines.ToList();
+
+        // Act
+        var serial = new O3DEHeaderParser(requireExportAttribute: false, verbose: false)
+            .ParseHeaders(headers, includePaths, defines, "ParallelGem", maxDegreeOfParallelism: 1);
+        var parallel = new O3DEHeaderParser(requireExportAttribute: false, verbose: false)
+            .ParseHeaders(headers, includePaths, defines, "ParallelGem");
+
+        // Assert: same declarations in the same (header) order - each
+        // worker's own CXIndex must not change what is found or where.
+        parallel.Classes.Select(c => c.QualifiedName).Should().Equal(serial.Classes.Select(c => c.QualifiedName));
+        parallel.Classes.Select(c => c.SourceFile).Should().Equal(serial.Classes.Select(c => c.SourceFile));
+        parallel.SourceFiles.Should().BeEquivalentTo(serial.SourceFiles);
+        serial.Classes.Should().HaveCount(headers.Count);
+    }
 }
@@ -468,4 +468,126 @@ public class ReflectionGeneratorTests : IDisposable
         cs.Should().Contain("public static object Method(",
             "unknown marshal_type falls back to System.Object");
     }
+
+    // ============================================================
+    // Typed dispatch: pre-resolved NativeMethod + NativeArgument span
+    // ============================================================
+
+    [Fact]
+    public void BlittableSignatures_UseTypedDispatch()
+    {
+        var json = """
+        {
+            "classes": [{
+                "name": "TypedClass",
+                "type_id": "{abab1111-0000-0000-0000-000000000000}",
+                "source_gem_name": "TestGem",
+                "methods": [
+                    {
+                        "name": "Scale", "is_static": true,
+                        "return_type": {"marshal_type": "Vector3", "type_name": "Vector3"},
+                        "parameters": [
+                            { "name": "v", "type_name": "Vector3", "marshal_type": "Vector3" },
+                            { "name": "s", "type_name": "float", "marshal_type": "Float" }
+                        ]
+                    },
+                    {
+                        "name": "Reset", "is_static": false,
+                        "return_type": {"marshal_type": "Void", "type_name": "void"},
+                        "parameters": []
+                    }
+                ],
+                "properties": [
+                    { "name": "Count", "type": {"marshal_type": "Int32", "type_name": "int"}, "is_readonly": false }
+                ]
+            }],
+            "ebuses": [], "global_methods": [], "global_properties": []
+        }
+        """;
+        var dir = GenerateFromJson(json);
+        var cs = ReadGeneratedFile(dir, "TestGem/Classes/TypedClass.g.cs");
+
+        cs.Should().Contain("private static readonly NativeMethod __Scale_2 = NativeMethod.Method(TypeName, \"Scale\", 2);");
+        cs.Should().Contain("stackalloc NativeArgument[2];");
+        cs.Should().Contain("__args[0].Vector3 = arg0_Vector3;");
+        cs.Should().Contain("__args[1].Float = arg1_float;");
+        cs.Should().Contain("return __Scale_2.Invoke(__args).Vector3;");
+        cs.Should().Contain("__Reset_0.Invoke(__instance, default);");
+        cs.Should().Contain("return __get_Count.Invoke(__instance, default).Int32;");
+        cs.Should().Contain("__set_Count.Invoke(__instance, __args);");
+        cs.Should().NotContain("NativeReflection.", "every member here has a blittable signature");
+    }
+
+    [Fact]
+    public void NonBlittableSignatures_KeepJsonDispatch()
+    {
+        // Strings and objects have no NativeArgument slot; the second
+        // same-arity overload can't be told apart by the native resolve.
+        var json = """
+        {
+            "classes": [{
+                "name": "MixedClass",
+                "type_id": "{abab2222-0000-0000-0000-000000000000}",
+                "source_gem_name": "TestGem",
+                "methods": [
+                    {
+                        "name": "GetName", "is_static": true,
+                        "return_type": {"marshal_type": "String", "type_name": "AZStd::string"},
+                        "parameters": []
+                    },
+                    {
+                        "name": "Set", "is_static": true,
+                        "return_type": {"marshal_type": "Void", "type_name": "void"},
+                        "parameters": [ { "name": "a", "type_name": "int", "marshal_type": "Int32" } ]
+                    },
+                    {
+                        "name": "Set", "is_static": true,
+                        "return_type": {"marshal_type": "Void", "type_name": "void"},
+                        "parameters": [ { "name": "a", "type_name": "float", "marshal_type": "Float" } ]
+                    }
+                ],
+                "properties": [
+                    { "name": "Owner", "type": {"marshal_type": "Object", "type_name": "Entity"}, "is_readonly": true }
+                ]
+            }],
+            "ebuses": [], "global_methods": [], "global_properties": []
+        }
+        """;
+        var dir = GenerateFromJson(json);
+        var cs = ReadGeneratedFile(dir, "TestGem/Classes/MixedClass.g.cs");
+
+        cs.Should().Contain("NativeReflection.InvokeStaticMethod(TypeName, \"GetName\"");
+        Regex.Matches(cs, @"NativeMethod __Set_1 =").Count.Should().Be(1);
+        cs.Should().Contain("NativeReflection.InvokeStaticMethod(TypeName, \"Set\", arg0_float);",
+            "the second one-argument overload falls back to the name-based path");
+        cs.Should().Contain("NativeReflection.GetProperty<object>(__instance, \"Owner\")");
+        cs.Should().NotContain("__get_Owner");
+    }
+
+    [Fact]
+    public void GlobalBlittableMembers_ResolveWithoutClassName()
+    {
+        var json = """
+        {
+            "classes": [], "ebuses": [],
+            "global_methods": [{
+                "name": "Clamp", "source_gem_name": "TestGem",
+                "return_type": {"marshal_type": "Double", "type_name": "double"},
+                "parameters": [ { "name": "v", "type_name": "double", "marshal_type": "Double" } ]
+            }],
+            "global_properties": [{
+                "name": "g_Speed", "source_gem_name": "TestGem",
+                "type": {"marshal_type": "Float", "type_name": "float"}, "is_readonly": false
+            }]
+        }
+        """;
+        var dir = GenerateFromJson(json);
+        var cs = ReadGeneratedFile(dir, "TestGem/Globals.g.cs");
+
+        cs.Should().Contain("NativeMethod.Method(null, \"Clamp\", 1);");
+        cs.Should().Contain("return __Clamp_1.Invoke(__args).Double;");
+        cs.Should().Contain("NativeMethod.Getter(null, \"g_Speed\");");
+        cs.Should().Contain("get => __get_g_Speed.Invoke(default).Float;");
+        cs.Should().Contain("__set_g_Speed.Invoke(__args);");
+    }
 }
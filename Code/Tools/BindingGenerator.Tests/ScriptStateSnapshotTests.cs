@@ -0,0 +1,216 @@
+//
+// Copyright (c) Contributors to the Open 3D Engine Project.
+// For complete copyright and license terms please see the LICENSE at the root of this distribution.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+//
+
+using System;
+using O3DE;
+using O3DE.Core.HotReload;
+
+namespace O3DESharp.BindingGenerator.Tests;
+
+/// <summary>
+/// Tests for the hot-reload field snapshot (ScriptStateSnapshot): what gets
+/// captured, and how a snapshot of one version of a script type lands on the
+/// next version.
+/// </summary>
+public class ScriptStateSnapshotTests
+{
+    // ---- Test fixtures -----------------------------------------------
+
+    private enum Mode { Idle, Running = 7 }
+
+    private enum Flags : ulong { None = 0, High = 0x8000_0000_0000_0000 }
+
+    private struct Point
+    {
+        public float X;
+        public float Y;
+        public bool Visible;
+    }
+
+    private struct PointReordered
+    {
+        public float Y;
+        public float X;
+        public bool Visible;
+    }
+
+    private class FakeBase
+    {
+        public int BaseField = 1;
+    }
+
+    private class ScriptV1 : FakeBase
+    {
+        public int Health = 100;
+        private float m_timer;
+        public string? Label = "start";
+        public Mode State;
+        public Flags Bits;
+        public Point Position;
+        public double Speed { get; set; } = 2.0;
+
+        [NonSerialized]
+        public int Transient = 5;
+
+        public readonly int Fixed = 9;
+
+        public object Reference = new();
+
+        public float Timer { get => m_timer; set => m_timer = value; }
+    }
+
+    // Next version: Speed removed, Health became a float, Label unchanged,
+    // NewField added.
+    private class ScriptV2 : FakeBase
+    {
+        public float Health = 1f;
+        private float m_timer;
+        public string? Label = "default";
+        public Mode State;
+        public int NewField = 42;
+
+        public float Timer => m_timer;
+    }
+
+    private class WithPoint
+    {
+        public Point Position;
+    }
+
+    private class WithReorderedPoint
+    {
+        public PointReordered Position;
+    }
+
+    // ---- Round trip --------------------------------------------------
+
+    [Fact]
+    public void CaptureRestore_RoundTripsSupportedFields()
+    {
+        var source = new ScriptV1
+        {
+            Health = 37,
+            Label = "changed",
+            State = Mode.Running,
+            Bits = Flags.High,
+            Position = new Point { X = 1.5f, Y = -2f, Visible = true },
+            Speed = 9.25,
+            Timer = 3.5f,
+            BaseField = 11,
+        };
+
+        var snapshot = ScriptStateSnapshot.Capture(source, typeof(FakeBase));
+        var target = new ScriptV1();
+
+        ScriptStateSnapshot.Restore(target, snapshot, typeof(FakeBase)).Should().Be(0);
+
+        target.Health.Should().Be(37);
+        target.Label.Should().Be("changed");
+        target.State.Should().Be(Mode.Running);
+        target.Bits.Should().Be(Flags.High);
+        target.Position.Should().Be(new Point { X = 1.5f, Y = -2f, Visible = true });
+        target.Speed.Should().Be(9.25);
+        target.Timer.Should().Be(3.5f);
+    }
+
+    [Fact]
+    public void Capture_SkipsNonSerializedReadonlyReferenceAndStopTypeFields()
+    {
+        var source = new ScriptV1 { Transient = 123, BaseField = 77 };
+        var snapshot = ScriptStateSnapshot.Capture(source, typeof(FakeBase));
+
+        var target = new ScriptV1();
+        ScriptStateSnapshot.Restore(target, snapshot, typeof(FakeBase));
+
+        target.Transient.Should().Be(5);
+        target.BaseField.Should().Be(1);
+        target.Fixed.Should().Be(9);
+    }
+
+    [Fact]
+    public void Restore_NullString_RestoresNull()
+    {
+        var snapshot = ScriptStateSnapshot.Capture(new ScriptV1 { Label = null }, typeof(FakeBase));
+        var target = new ScriptV1();
+
+        ScriptStateSnapshot.Restore(target, snapshot, typeof(FakeBase)).Should().Be(0);
+        target.Label.Should().BeNull();
+    }
+
+    // ---- Across versions ---------------------------------------------
+
+    [Fact]
+    public void Restore_OntoNextVersion_MatchesByNameAndType()
+    {
+        var source = new ScriptV1 { Health = 10, Label = "kept", State = Mode.Running, Timer = 8f };
+        var snapshot = ScriptStateSnapshot.Capture(source, typeof(FakeBase));
+
+        var target = new ScriptV2();
+        int mismatches = ScriptStateSnapshot.Restore(target, snapshot, typeof(FakeBase));
+
+        mismatches.Should().Be(1, "Health changed from int to float");
+        target.Health.Should().Be(1f);
+        target.Label.Should().Be("kept");
+        target.State.Should().Be(Mode.Running);
+        target.Timer.Should().Be(8f);
+        target.NewField.Should().Be(42);
+    }
+
+    private class ScriptV3
+    {
+        public float Health = 1f;
+        public string? Label = "default";
+    }
+
+    [Fact]
+    public void Restore_SameLayoutTwice_ReusesPlan()
+    {
+        var first = ScriptStateSnapshot.Capture(new ScriptV1 { Health = 1, Label = "a" }, typeof(FakeBase));
+        var second = ScriptStateSnapshot.Capture(new ScriptV1 { Health = 2, Label = "b" }, typeof(FakeBase));
+
+        var a = new ScriptV3();
+        var b = new ScriptV3();
+        ScriptStateSnapshot.Restore(a, first).Should().Be(1);
+        ScriptStateSnapshot.ResolvedPlanCount(typeof(ScriptV3)).Should().Be(1);
+        ScriptStateSnapshot.Restore(b, second).Should().Be(1);
+        ScriptStateSnapshot.ResolvedPlanCount(typeof(ScriptV3)).Should().Be(1, "the second snapshot has the same layout");
+
+        a.Label.Should().Be("a");
+        b.Label.Should().Be("b");
+    }
+
+    [Fact]
+    public void Restore_StructWithChangedLayout_IsCountedNotCopied()
+    {
+        var snapshot = ScriptStateSnapshot.Capture(new WithPoint { Position = new Point { X = 4f, Y = 5f } });
+        var target = new WithReorderedPoint();
+
+        ScriptStateSnapshot.Restore(target, snapshot).Should().Be(1);
+        target.Position.X.Should().Be(0f);
+        target.Position.Y.Should().Be(0f);
+    }
+
+    // ---- Malformed input ---------------------------------------------
+
+    [Fact]
+    public void Restore_MalformedSnapshot_ReturnsMinusOne()
+    {
+        var snapshot = ScriptStateSnapshot.Capture(new ScriptV1 { Health = 3 }, typeof(FakeBase));
+        var target = new ScriptV1();
+
+        var badMagic = (byte[])snapshot.Clone();
+        badMagic[0] ^= 0xFF;
+        ScriptStateSnapshot.Restore(target, badMagic, typeof(FakeBase)).Should().Be(-1);
+
+        var truncated = snapshot.AsSpan(0, snapshot.Length - 1).ToArray();
+        ScriptStateSnapshot.Restore(target, truncated, typeof(FakeBase)).Should().Be(-1);
+
+        ScriptStateSnapshot.Restore(target, Array.Empty<byte>(), typeof(FakeBase)).Should().Be(-1);
+
+        target.Health.Should().Be(100);
+    }
+}
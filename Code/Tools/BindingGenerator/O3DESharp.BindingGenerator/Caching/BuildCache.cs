@@ -94,12 +94,16 @@ namespace O3DESharp.BindingGenerator.Caching
     }
 
     /// <summary>
-    /// Manages build cache for incremental builds
+    /// Manages build cache for incremental builds. Safe to use from the
+    /// generator's parallel per-gem phases: _cacheData is only touched under
+    /// _lock, and entries are replaced wholesale rather than mutated, so a
+    /// looked-up entry can be read (and its files hashed) outside the lock.
     /// </summary>
     public class BuildCache
     {
         private readonly string _cacheFilePath;
         private readonly bool _verbose;
+        private readonly object _lock = new object();
         private BuildCacheData _cacheData;
 
         private static readonly JsonSerializerOptions JsonOptions = new JsonSerializerOptions
@@ -129,7 +133,12 @@ namespace O3DESharp.BindingGenerator.Caching
         /// <returns>True if regeneration is needed</returns>
         public bool NeedsRegeneration(string gemName, IEnumerable<string> headerFiles, string configHash)
         {
-            if (!_cacheData.Gems.TryGetValue(gemName, out var entry))
+            GemCacheEntry? entry;
+            lock (_lock)
+            {
+                _cacheData.Gems.TryGetValue(gemName, out entry);
+            }
+            if (entry == null)
             {
                 Log($"Cache miss for gem '{gemName}': No cache entry exists");
                 return true;
@@ -292,7 +301,10 @@ namespace O3DESharp.BindingGenerator.Caching
             // Compute combined input hash
             entry.InputHash = FileHasher.ComputeStringHash(string.Join("|", entry.FileHashes.Values));
 
-            _cacheData.Gems[gemName] = entry;
+            lock (_lock)
+            {
+                _cacheData.Gems[gemName] = entry;
+            }
             Log($"Updated cache entry for gem '{gemName}': {entry.DirectHeaders.Count} direct + {entry.FileHashes.Count - entry.DirectHeaders.Count} transitive headers");
         }
 
@@ -302,7 +314,12 @@ namespace O3DESharp.BindingGenerator.Caching
         /// <param name="gemName">Name of the gem</param>
         public void InvalidateEntry(string gemName)
         {
-            if (_cacheData.Gems.Remove(gemName))
+            bool removed;
+            lock (_lock)
+            {
+                removed = _cacheData.Gems.Remove(gemName);
+            }
+            if (removed)
             {
                 Log($"Invalidated cache entry for gem '{gemName}'");
             }
@@ -313,7 +330,10 @@ namespace O3DESharp.BindingGenerator.Caching
         /// </summary>
         public void Clear()
         {
-            _cacheData = new BuildCacheData();
+            lock (_lock)
+            {
+                _cacheData = new BuildCacheData();
+            }
             Log("Cleared all cache entries");
         }
 
@@ -330,7 +350,11 @@ namespace O3DESharp.BindingGenerator.Caching
                     Directory.CreateDirectory(directory);
                 }
 
-                var json = JsonSerializer.Serialize(_cacheData, JsonOptions);
+                string json;
+                lock (_lock)
+                {
+                    json = JsonSerializer.Serialize(_cacheData, JsonOptions);
+                }
                 File.WriteAllText(_cacheFilePath, json);
                 Log($"Saved cache to {_cacheFilePath}");
             }
@@ -345,8 +369,11 @@ namespace O3DESharp.BindingGenerator.Caching
         /// </summary>
         public (int EntryCount, long TotalFilesTracked) GetStats()
         {
-            var totalFiles = _cacheData.Gems.Values.Sum(e => e.FileHashes.Count);
-            return (_cacheData.Gems.Count, totalFiles);
+            lock (_lock)
+            {
+                var totalFiles = _cacheData.Gems.Values.Sum(e => e.FileHashes.Count);
+                return (_cacheData.Gems.Count, totalFiles);
+            }
         }
 
         private BuildCacheData Load()
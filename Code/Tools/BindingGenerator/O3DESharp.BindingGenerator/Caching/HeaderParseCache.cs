@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.IO;
+using System.Text.Json;
+using System.Text.Json.Serialization;
+using System.Threading;
+using O3DESharp.BindingGenerator.Parsing;
+
+namespace O3DESharp.BindingGenerator.Caching
+{
+    /// <summary>
+    /// One header's parse result as stored on disk
+    /// </summary>
+    public class HeaderCacheEntry
+    {
+        /// <summary>
+        /// Tool and parser version the fragment was produced by
+        /// </summary>
+        [JsonPropertyName("tool_version")]
+        public string ToolVersion { get; set; } = string.Empty;
+
+        /// <summary>
+        /// Full path of the parsed header
+        /// </summary>
+        [JsonPropertyName("header")]
+        public string Header { get; set; } = string.Empty;
+
+        /// <summary>
+        /// Content hash of the header when it was parsed
+        /// </summary>
+        [JsonPropertyName("header_hash")]
+        public string HeaderHash { get; set; } = string.Empty;
+
+        /// <summary>
+        /// Hash of the clang command line and parser options
+        /// </summary>
+        [JsonPropertyName("args_hash")]
+        public string ArgsHash { get; set; } = string.Empty;
+
+        /// <summary>
+        /// Content hashes of every non-system header that contributed a
+        /// declaration to the parse (the header itself included). Any
+        /// mismatch turns the entry into a miss, so an edit to an upstream
+        /// AzCore header re-parses the gem headers that pulled it in.
+        /// </summary>
+        [JsonPropertyName("dependencies")]
+        public Dictionary<string, string> Dependencies { get; set; } = new Dictionary<string, string>();
+
+        [JsonPropertyName("skipped_filtered")]
+        public int SkippedFilteredClassCount { get; set; }
+
+        [JsonPropertyName("skipped_no_bindable_members")]
+        public int SkippedNoBindableMembersCount { get; set; }
+
+        [JsonPropertyName("classes")]
+        public List<ParsedClass> Classes { get; set; } = new List<ParsedClass>();
+
+        [JsonPropertyName("functions")]
+        public List<ParsedFunction> Functions { get; set; } = new List<ParsedFunction>();
+
+        [JsonPropertyName("enums")]
+        public List<ParsedEnum> Enums { get; set; } = new List<ParsedEnum>();
+    }
+
+    /// <summary>
+    /// Persistent per-header cache of O3DEHeaderParser results. Where
+    /// BuildCache decides per gem whether anything changed, this lets a
+    /// stale gem re-parse only the headers that actually changed and reuse
+    /// the stored fragments for the rest.
+    ///
+    /// One JSON file per (header path, clang args) under the cache
+    /// directory, so concurrent parse workers never contend on a shared
+    /// file and an edited header overwrites its own slot instead of
+    /// growing the cache. An entry is used only if the tool version, the
+    /// header's content hash and every recorded dependency hash still
+    /// match.
+    /// </summary>
+    public class HeaderParseCache
+    {
+        /// <summary>
+        /// Bump whenever O3DEHeaderParser's output for the same input changes
+        /// </summary>
+        public const int ParserVersion = 1;
+
+        /// <summary>
+        /// Version stamped into every entry
+        /// </summary>
+        public static string ToolVersion => $"{BuildCache.ToolVersion}+parser{ParserVersion}";
+
+        private readonly string _cacheDirectory;
+        private readonly bool _verbose;
+        private readonly bool _readEnabled;
+
+        // Hashes computed during this run. Every gem's parse records the
+        // same few hundred AzCore prelude headers as dependencies, so
+        // without this each lookup would re-hash them all.
+        private readonly ConcurrentDictionary<string, string?> _fileHashes =
+            new ConcurrentDictionary<string, string?>(StringComparer.OrdinalIgnoreCase);
+
+        private int _hits;
+        private int _misses;
+
+        private static readonly JsonSerializerOptions JsonOptions = new JsonSerializerOptions
+        {
+            WriteIndented = false,
+            DefaultIgnoreCondition = JsonIgnoreCondition.WhenWritingNull
+        };
+
+        /// <param name="cacheDirectory">Directory holding the entry files</param>
+        /// <param name="verbose">Log every hit and miss</param>
+        /// <param name="readEnabled">False to ignore existing entries but still write new ones (--force)</param>
+        public HeaderParseCache(string cacheDirectory, bool verbose = false, bool readEnabled = true)
+        {
+            _cacheDirectory = cacheDirectory;
+            _verbose = verbose;
+            _readEnabled = readEnabled;
+        }
+
+        /// <summary>
+        /// Headers served from the cache so far
+        /// </summary>
+        public int Hits => _hits;
+
+        /// <summary>
+        /// Headers that had to be parsed so far
+        /// </summary>
+        public int Misses => _misses;
+
+        /// <summary>
+        /// Hash the parse options that affect a header's result
+        /// </summary>
+        public static string ComputeArgsHash(IEnumerable<string> clangArgs, bool requireExportAttribute)
+        {
+            return FileHasher.ComputeStringHash($"{requireExportAttribute}\n{string.Join("\n", clangArgs)}");
+        }
+
+        /// <summary>
+        /// Look up a header's stored parse result
+        /// </summary>
+        /// <param name="headerFile">Header to look up</param>
+        /// <param name="argsHash">Result of <see cref="ComputeArgsHash"/></param>
+        /// <param name="gemName">Gem the fragment is for</param>
+        /// <param name="fragment">The stored declarations, on a hit</param>
+        public bool TryGet(string headerFile, string argsHash, string gemName, out ParsedBindings fragment)
+        {
+            fragment = null!;
+            var fullPath = Path.GetFullPath(headerFile);
+            if (!_readEnabled)
+            {
+                Interlocked.Increment(ref _misses);
+                return false;
+            }
+
+            var loaded = Load(GetEntryPath(fullPath, argsHash));
+            var reason = loaded == null ? "no entry" : Validate(loaded, fullPath, argsHash);
+            if (reason != null)
+            {
+                Interlocked.Increment(ref _misses);
+                Log($"Miss for {Path.GetFileName(fullPath)}: {reason}");
+                return false;
+            }
+
+            var entry = loaded!;
+            fragment = new ParsedBindings
+            {
+                GemName = gemName,
+                Classes = entry.Classes,
+                Functions = entry.Functions,
+                Enums = entry.Enums,
+                SkippedFilteredClassCount = entry.SkippedFilteredClassCount,
+                SkippedNoBindableMembersCount = entry.SkippedNoBindableMembersCount
+            };
+            fragment.SourceFiles.UnionWith(entry.Dependencies.Keys);
+            Interlocked.Increment(ref _hits);
+            Log($"Hit for {Path.GetFileName(fullPath)}");
+            return true;
+        }
+
+        /// <summary>
+        /// Store a header's freshly parsed result
+        /// </summary>
+        /// <param name="headerFile">Parsed header</param>
+        /// <param name="argsHash">Result of <see cref="ComputeArgsHash"/></param>
+        /// <param name="fragment">What the header contributed</param>
+        public void Store(string headerFile, string argsHash, ParsedBindings fragment)
+        {
+            var fullPath = Path.GetFullPath(headerFile);
+            var headerHash = GetFileHash(fullPath);
+            if (headerHash == null)
+            {
+                return;
+            }
+
+            var entry = new HeaderCacheEntry
+            {
+                ToolVersion = ToolVersion,
+                Header = fullPath,
+                HeaderHash = headerHash,
+                ArgsHash = argsHash,
+                SkippedFilteredClassCount = fragment.SkippedFilteredClassCount,
+                SkippedNoBindableMembersCount = fragment.SkippedNoBindableMembersCount,
+                Classes = fragment.Classes,
+                Functions = fragment.Functions,
+                Enums = fragment.Enums
+            };
+            entry.Dependencies[fullPath] = headerHash;
+            foreach (var dependency in fragment.SourceFiles)
+            {
+                var hash = GetFileHash(dependency);
+                if (hash != null)
+                {
+                    entry.Dependencies[Path.GetFullPath(dependency)] = hash;
+                }
+            }
+
+            try
+            {
+                Directory.CreateDirectory(_cacheDirectory);
+
+                // Write-then-rename so a reader (another worker, or another
+                // generator process sharing the directory) never sees a
+                // half-written entry.
+                var path = GetEntryPath(fullPath, argsHash);
+                var tempPath = $"{path}.{Guid.NewGuid():N}.tmp";
+                File.WriteAllText(tempPath, JsonSerializer.Serialize(entry, JsonOptions));
+                File.Move(tempPath, path, overwrite: true);
+            }
+            catch (Exception ex)
+            {
+                Log($"Warning: Could not store entry for {fullPath}: {ex.Message}");
+            }
+        }
+
+        private string? Validate(HeaderCacheEntry entry, string fullPath, string argsHash)
+        {
+            if (entry.ToolVersion != ToolVersion)
+            {
+                return $"tool version changed ({entry.ToolVersion} -> {ToolVersion})";
+            }
+            if (entry.ArgsHash != argsHash || !string.Equals(entry.Header, fullPath, StringComparison.OrdinalIgnoreCase))
+            {
+                return "parse options changed";
+            }
+            if (GetFileHash(fullPath) != entry.HeaderHash)
+            {
+                return "header changed";
+            }
+            foreach (var (dependency, hash) in entry.Dependencies)
+            {
+                if (GetFileHash(dependency) != hash)
+                {
+                    return $"dependency changed: {dependency}";
+                }
+            }
+            return null;
+        }
+
+        private string GetEntryPath(string fullPath, string argsHash)
+        {
+            var key = FileHasher.ComputeStringHash($"{fullPath.ToLowerInvariant()}|{argsHash}");
+            return Path.Combine(_cacheDirectory, $"{Path.GetFileNameWithoutExtension(fullPath)}.{key.Substring(0, 16)}.json");
+        }
+
+        private string? GetFileHash(string path)
+        {
+            return _fileHashes.GetOrAdd(Path.GetFullPath(path), p =>
+            {
+                try
+                {
+                    return File.Exists(p) ? FileHasher.ComputeFileHash(p) : null;
+                }
+                catch
+                {
+                    return null;
+                }
+            });
+        }
+
+        private HeaderCacheEntry? Load(string path)
+        {
+            if (!File.Exists(path))
+            {
+                return null;
+            }
+
+            try
+            {
+                return JsonSerializer.Deserialize<HeaderCacheEntry>(File.ReadAllText(path), JsonOptions);
+            }
+            catch (Exception ex)
+            {
+                Log($"Warning: Could not load {path}: {ex.Message}");
+                return null;
+            }
+        }
+
+        private void Log(string message)
+        {
+            if (_verbose)
+            {
+                Console.WriteLine($"[HeaderCache] {message}");
+            }
+        }
+    }
+}
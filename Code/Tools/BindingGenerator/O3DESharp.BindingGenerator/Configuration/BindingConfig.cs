@@ -131,6 +131,12 @@ namespace O3DESharp.BindingGenerator.Configuration
         /// </summary>
         public string CacheFilePath { get; set; } = ".binding_cache.json";
 
+        /// <summary>
+        /// Directory for per-header parse results (incremental builds only).
+        /// Lets a gem with one edited header re-parse just that header.
+        /// </summary>
+        public string HeaderCachePath { get; set; } = ".binding_header_cache";
+
         /// <summary>
         /// Require O3DE_EXPORT_CSHARP attribute on declarations.
         /// If false, all public declarations will be exported.
@@ -66,24 +66,12 @@ namespace O3DESharp.BindingGenerator.Generation
             Log($"Generating C# code for gem '{bindings.GemName}' to {outputDirectory}");
 
             // Filter classes/functions/enums with valid names before generating
-            var validClasses = bindings.Classes
-                .Where(c => IsValidCSharpIdentifier(SanitizeIdentifier(c.Name)))
-                .ToList();
-            var validFunctions = bindings.Functions
-                .Where(f => IsValidCSharpIdentifier(SanitizeIdentifier(f.Name)))
-                .ToList();
+            var validClasses = GetExportedClasses(bindings);
+            var validFunctions = GetExportedFunctions(bindings);
             var validEnums = bindings.Enums
                 .Where(e => IsValidCSharpIdentifier(SanitizeIdentifier(e.Name)))
                 .ToList();
 
-            // Deduplicate classes that map to the same sanitized name (e.g., same class
-            // name in different C++ namespaces). Keep only the first occurrence since all
-            // would produce the same InternalCalls field names and wrapper class file.
-            validClasses = DeduplicateByName(validClasses, c => SanitizeIdentifier(c.Name));
-
-            // Deduplicate standalone functions with the same sanitized name
-            validFunctions = DeduplicateByName(validFunctions, f => SanitizeIdentifier(f.Name));
-
             // Generate InternalCalls file
             GenerateInternalCalls(validClasses, validFunctions, safeGemName, outputDirectory);
 
@@ -107,6 +95,42 @@ namespace O3DESharp.BindingGenerator.Generation
             Log($"Generated {validClasses.Count} wrapper classes and {validEnums.Count} enums");
         }
 
+        /// <summary>
+        /// Classes that get an InternalCalls section and a wrapper: valid
+        /// names only, and the first of any that sanitize to the same name
+        /// (e.g. the same class name in different C++ namespaces) - the rest
+        /// would produce the same InternalCalls field names and wrapper file.
+        /// CppRegistrationGenerator registers exactly this set.
+        /// </summary>
+        internal static List<ParsedClass> GetExportedClasses(ParsedBindings bindings)
+        {
+            var validClasses = bindings.Classes
+                .Where(c => IsValidCSharpIdentifier(SanitizeIdentifier(c.Name)))
+                .ToList();
+            return DeduplicateByName(validClasses, c => SanitizeIdentifier(c.Name));
+        }
+
+        /// <summary>
+        /// Standalone functions that get an InternalCalls field, filtered and
+        /// deduplicated the same way as <see cref="GetExportedClasses"/>.
+        /// </summary>
+        internal static List<ParsedFunction> GetExportedFunctions(ParsedBindings bindings)
+        {
+            var validFunctions = bindings.Functions
+                .Where(f => IsValidCSharpIdentifier(SanitizeIdentifier(f.Name)))
+                .ToList();
+            return DeduplicateByName(validFunctions, f => SanitizeIdentifier(f.Name));
+        }
+
+        /// <summary>
+        /// Full name of the generated InternalCalls class for a gem - the
+        /// class name CppRegistrationGenerator passes to AddInternalCall.
+        /// </summary>
+        public static string InternalCallsTypeName(string namespaceRoot, string gemName)
+        {
+            return $"{namespaceRoot}.{SanitizeIdentifier(gemName)}.InternalCalls";
+        }
+
         private void GenerateInternalCalls(List<ParsedClass> classes, List<ParsedFunction> functions, string gemName, string outputDirectory)
         {
             var sb = new StringBuilder();
@@ -200,10 +224,10 @@ namespace O3DESharp.BindingGenerator.Generation
             // Add parameter marshal types
             foreach (var param in method.Parameters)
             {
-                marshalTypes.Add(GetMarshalType(param.Type));
+                marshalTypes.AddRange(GetParameterMarshalTypes(param.Type));
             }
 
-            var returnMarshalType = GetMarshalType(method.ReturnType);
+            var returnMarshalType = GetReturnMarshalType(method.ReturnType);
 
             // Build delegate signature: delegate* unmanaged<param1, param2, ..., returnType>
             var allTypes = new List<string>(marshalTypes) { returnMarshalType };
@@ -215,8 +239,8 @@ namespace O3DESharp.BindingGenerator.Generation
         private void GenerateStandaloneFunctionDeclaration(StringBuilder sb, ParsedFunction function)
         {
             var safeName = SanitizeIdentifier(function.Name);
-            var marshalTypes = function.Parameters.Select(p => GetMarshalType(p.Type)).ToList();
-            var returnMarshalType = GetMarshalType(function.ReturnType);
+            var marshalTypes = function.Parameters.SelectMany(p => GetParameterMarshalTypes(p.Type)).ToList();
+            var returnMarshalType = GetReturnMarshalType(function.ReturnType);
 
             var allTypes = new List<string>(marshalTypes) { returnMarshalType };
             var typesStr = string.Join(", ", allTypes);
@@ -427,7 +451,10 @@ namespace O3DESharp.BindingGenerator.Generation
             // method is already marked unsafe, and the InternalCalls field's
             // delegate signature is "IntPtr" for any reference (see
             // GetMarshalType). C# Unsafe.AsPointer is the standard way to
-            // get a stable address out of a ref / readonly ref.
+            // get a stable address out of a ref / readonly ref. Span
+            // parameters are pinned with 'fixed' and passed as pointer +
+            // length.
+            var pinned = new List<string>();
             usedNames.Clear();
             for (int i = 0; i < method.Parameters.Count; i++)
             {
@@ -440,7 +467,14 @@ namespace O3DESharp.BindingGenerator.Generation
                 usedNames.Add(safePName);
 
                 bool isByRefBlittable = param.Type.IsReference && TypeMapper.IsBlittableType(param.Type.CSharpTypeName);
-                if (isByRefBlittable)
+                if (param.Type.ArrayElementType != null)
+                {
+                    var pinnedName = $"{safePName.TrimStart('@')}Ptr";
+                    pinned.Add($"fixed ({param.Type.ArrayElementType}* {pinnedName} = {safePName})");
+                    args.Add($"(IntPtr){pinnedName}");
+                    args.Add($"{safePName}.Length");
+                }
+                else if (isByRefBlittable)
                 {
                     if (param.Type.IsConst)
                     {
@@ -463,15 +497,30 @@ namespace O3DESharp.BindingGenerator.Generation
 
             var argsStr = string.Join(", ", args);
 
+            var indent = "            ";
+            foreach (var fixedStatement in pinned)
+            {
+                sb.AppendLine($"{indent}{fixedStatement}");
+            }
+            if (pinned.Count > 0)
+            {
+                sb.AppendLine($"{indent}{{");
+                indent += "    ";
+            }
+
             if (csReturnType == "void")
             {
-                sb.AppendLine($"            InternalCalls.{internalCallName}({argsStr});");
+                sb.AppendLine($"{indent}InternalCalls.{internalCallName}({argsStr});");
             }
             else
             {
-                sb.AppendLine($"            return InternalCalls.{internalCallName}({argsStr});");
+                sb.AppendLine($"{indent}return InternalCalls.{internalCallName}({argsStr});");
             }
 
+            if (pinned.Count > 0)
+            {
+                sb.AppendLine("            }");
+            }
             sb.AppendLine("        }");
             sb.AppendLine();
         }
@@ -620,7 +669,7 @@ namespace O3DESharp.BindingGenerator.Generation
         /// Sanitize a C++ name to be a valid C# identifier.
         /// Strips namespaces, template args, and replaces invalid characters.
         /// </summary>
-        private static string SanitizeIdentifier(string cppName)
+        internal static string SanitizeIdentifier(string cppName)
         {
             if (string.IsNullOrEmpty(cppName))
                 return "_Unknown";
@@ -733,18 +782,46 @@ namespace O3DESharp.BindingGenerator.Generation
             return csType;
         }
 
+        /// <summary>
+        /// The unmanaged types a parameter occupies in the delegate*
+        /// signature: one, except for a span, which is passed as a pointer
+        /// to its first element plus an int length.
+        /// </summary>
+        private static IEnumerable<string> GetParameterMarshalTypes(ParsedType type)
+        {
+            if (type.ArrayElementType != null)
+            {
+                return new[] { "IntPtr", "int" };
+            }
+            return new[] { GetMarshalType(type) };
+        }
+
+        /// <summary>
+        /// Unmanaged return type. Unlike parameters, a reference to a
+        /// blittable value type is returned by value: the wrapper declares
+        /// the value type, and the native thunk copies it out.
+        /// </summary>
+        private static string GetReturnMarshalType(ParsedType type)
+        {
+            if (type.IsReference && !type.IsPointer && TypeMapper.IsBlittableType(type.CSharpTypeName))
+            {
+                return type.CSharpTypeName;
+            }
+            return GetMarshalType(type);
+        }
+
         /// <summary>
         /// Get the valid (bindable) methods from a parsed class. Every overload
         /// is preserved; <see cref="InternalCallFieldName"/> is responsible for
         /// disambiguating them when emitting field / function names so the
         /// InternalCalls layer can have multiple entries for the same C# name.
         /// </summary>
-        private static List<ParsedMethod> GetValidMethods(ParsedClass parsedClass)
+        internal static List<ParsedMethod> GetValidMethods(ParsedClass parsedClass)
         {
             return parsedClass.Methods
                 .Where(m => IsValidCSharpIdentifier(SanitizeIdentifier(m.Name)))
                 .Where(m => IsValidCSharpType(m.ReturnType.CSharpTypeName))
-                .Where(m => m.Parameters.All(p => IsValidCSharpType(p.Type.CSharpTypeName)))
+                .Where(m => m.Parameters.All(p => p.Type.ArrayElementType != null || IsValidCSharpType(p.Type.CSharpTypeName)))
                 .ToList();
         }
 
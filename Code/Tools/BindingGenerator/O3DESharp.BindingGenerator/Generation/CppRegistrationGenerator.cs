@@ -21,12 +21,23 @@ namespace O3DESharp.BindingGenerator.Generation
     public class CppRegistrationGenerator
     {
         private readonly bool _verbose;
+        private readonly string? _csharpNamespace;
 
         public CppRegistrationGenerator(bool verbose = false)
         {
             _verbose = verbose;
         }
 
+        /// <param name="csharpNamespace">Root namespace the C# generator was
+        /// given, so registrations target the generated InternalCalls class
+        /// (<c>{namespace}.{Gem}.InternalCalls</c>)</param>
+        /// <param name="verbose">Log each generated file</param>
+        public CppRegistrationGenerator(string csharpNamespace, bool verbose = false)
+        {
+            _csharpNamespace = csharpNamespace;
+            _verbose = verbose;
+        }
+
         /// <summary>
         /// Generate C++ registration code from parsed bindings
         /// </summary>
@@ -44,41 +55,100 @@ namespace O3DESharp.BindingGenerator.Generation
 
         private void GenerateRegistrationFile(ParsedBindings bindings, string outputDirectory)
         {
+            // Same class/method/function sets, in the same order, as the
+            // InternalCalls fields CSharpCodeGenerator emits.
+            var classes = CSharpCodeGenerator.GetExportedClasses(bindings);
+            var functions = CSharpCodeGenerator.GetExportedFunctions(bindings);
+            var internalCallsType = _csharpNamespace != null
+                ? CSharpCodeGenerator.InternalCallsTypeName(_csharpNamespace, bindings.GemName)
+                : $"{bindings.GemName}.InternalCalls";
+
             var sb = new StringBuilder();
 
             // File header
             AppendFileHeader(sb);
 
             sb.AppendLine("#include <Coral/Assembly.hpp>");
+            sb.AppendLine("#include <AzCore/Component/EntityId.h>");
             sb.AppendLine("#include <AzCore/Console/ILogger.h>");
+            sb.AppendLine("#include <AzCore/Math/Crc.h>");
+            sb.AppendLine("#include <AzCore/std/containers/span.h>");
+            sb.AppendLine("#include <AzCore/std/containers/vector.h>");
+            sb.AppendLine("#include <AzCore/std/string/string.h>");
+            sb.AppendLine("#include <Scripting/InteropProfiler.h>  // O3DESHARP_ADD_INTERNAL_CALL");
             sb.AppendLine("#include <Scripting/ScriptBindings.h>  // InteropVector3 / InteropQuaternion");
             sb.AppendLine($"#include \"{bindings.GemName}_HotReload.g.h\"");
+
+            // The exported declarations the thunks call
+            var headers = classes.Select(c => c.SourceFile)
+                .Concat(functions.Select(f => f.SourceFile))
+                .Where(f => !string.IsNullOrEmpty(f))
+                .Select(f => Path.GetRelativePath(outputDirectory, f).Replace('\\', '/'))
+                .Distinct(StringComparer.Ordinal)
+                .OrderBy(f => f, StringComparer.Ordinal)
+                .ToList();
+            if (headers.Count > 0)
+            {
+                sb.AppendLine();
+                foreach (var header in headers)
+                {
+                    sb.AppendLine($"#include \"{header}\"");
+                }
+            }
+
             sb.AppendLine();
             sb.AppendLine($"namespace {bindings.GemName}::Generated");
             sb.AppendLine("{");
-            sb.AppendLine("    // Generator-emitted stub bodies. Each function logs a one-shot");
-            sb.AppendLine("    // AZ_Warning and returns a zero-value of its return type so the");
-            sb.AppendLine("    // file links cleanly without hand-written implementations. To");
-            sb.AppendLine("    // replace a stub with a real binding, either:");
-            sb.AppendLine("    //   * provide a hand-written definition of the same function in");
-            sb.AppendLine("    //     a separate translation unit and remove the stub for that");
-            sb.AppendLine("    //     method here on the next regen; or");
-            sb.AppendLine("    //   * rerun the generator after marking the method as");
-            sb.AppendLine("    //     hand-implemented in your binding_config.json (future work).");
+            sb.AppendLine("    // Direct-call thunks, one per InternalCalls field. Each has the");
+            sb.AppendLine("    // blittable signature of its C# delegate* unmanaged field");
+            sb.AppendLine("    // (InteropVector3 / InteropQuaternion, u64 entity ids, pointer +");
+            sb.AppendLine("    // count for spans, void* for objects and strings), converts the");
+            sb.AppendLine("    // arguments and calls the exported declaration directly - the same");
+            sb.AppendLine("    // path as the hand-written ScriptBindings.");
+            sb.AppendLine("    //");
+            sb.AppendLine("    // Signatures that can't cross the boundary without marshaling");
+            sb.AppendLine("    // (objects or containers returned by value, Guid, ...) get a stub");
+            sb.AppendLine("    // that logs a one-shot AZ_Warning and returns a zero-value instead;");
+            sb.AppendLine("    // hand-write those in ScriptBindings.");
             sb.AppendLine();
 
-            foreach (var parsedClass in bindings.Classes)
+            // (class label, C++ function name) per AddInternalCall, in emission order
+            var registrations = new List<(string Label, string FuncName)>();
+            var emittedNames = new HashSet<string>(StringComparer.Ordinal);
+
+            foreach (var parsedClass in classes)
             {
-                foreach (var method in parsedClass.Methods)
+                var safeClassName = CSharpCodeGenerator.SanitizeIdentifier(parsedClass.Name);
+                var methods = CSharpCodeGenerator.GetValidMethods(parsedClass);
+                foreach (var method in methods)
                 {
-                    var funcName = CSharpCodeGenerator.InternalCallFieldName(parsedClass.Name, method, parsedClass.Methods);
-                    EmitStubDefinition(sb, parsedClass.Name + "::" + method.Name, BuildCppSignature(funcName, method), method.ReturnType);
+                    var funcName = CppSymbol(CSharpCodeGenerator.InternalCallFieldName(safeClassName, method, methods));
+                    if (!emittedNames.Add(funcName))
+                    {
+                        continue;
+                    }
+
+                    if (!EmitThunkDefinition(sb, funcName, parsedClass, method))
+                    {
+                        EmitStubDefinition(sb, parsedClass.Name + "::" + method.Name, BuildCppSignature(funcName, method), method.ReturnType);
+                    }
+                    registrations.Add((parsedClass.Name, funcName));
                 }
             }
 
-            foreach (var function in bindings.Functions)
+            foreach (var function in functions)
             {
-                EmitStubDefinition(sb, function.Name, BuildCppSignature(function.Name, function), function.ReturnType);
+                var funcName = CppSymbol(CSharpCodeGenerator.SanitizeIdentifier(function.Name));
+                if (!emittedNames.Add(funcName))
+                {
+                    continue;
+                }
+
+                if (!EmitThunkDefinition(sb, funcName, function))
+                {
+                    EmitStubDefinition(sb, function.Name, BuildCppSignature(funcName, function), function.ReturnType);
+                }
+                registrations.Add((string.Empty, funcName));
             }
 
             sb.AppendLine();
@@ -96,27 +166,23 @@ namespace O3DESharp.BindingGenerator.Generation
             sb.AppendLine($"        AZLOG_INFO(\"Registering {bindings.GemName} bindings to assembly '%s'\", assembly->GetName().data());");
             sb.AppendLine();
 
-            // Register each class's methods. Same overload-aware name as the
-            // forward-decl block above.
-            foreach (var parsedClass in bindings.Classes)
+            // Register each thunk under its InternalCalls field name. Same
+            // overload-aware name as the definitions above. Through
+            // O3DESHARP_ADD_INTERNAL_CALL, like the hand-written bindings, so
+            // the [ParallelUpdate] thread rule and the profiler apply.
+            string? currentLabel = null;
+            foreach (var (label, funcName) in registrations)
             {
-                sb.AppendLine($"        // {parsedClass.Name} bindings");
-                foreach (var method in parsedClass.Methods)
+                if (label != currentLabel)
                 {
-                    var funcName = CSharpCodeGenerator.InternalCallFieldName(parsedClass.Name, method, parsedClass.Methods);
-                    sb.AppendLine($"        assembly->AddInternalCall(\"{bindings.GemName}.InternalCalls\", \"{funcName}\", reinterpret_cast<void*>(&{funcName}));");
-                }
-            }
-
-            // Register standalone functions
-            if (bindings.Functions.Count > 0)
-            {
-                sb.AppendLine();
-                sb.AppendLine("        // Standalone function bindings");
-                foreach (var function in bindings.Functions)
-                {
-                    sb.AppendLine($"        assembly->AddInternalCall(\"{bindings.GemName}.InternalCalls\", \"{function.Name}\", reinterpret_cast<void*>(&{function.Name}));");
+                    if (currentLabel != null)
+                    {
+                        sb.AppendLine();
+                    }
+                    sb.AppendLine(label.Length > 0 ? $"        // {label} bindings" : "        // Standalone function bindings");
+                    currentLabel = label;
                 }
+                sb.AppendLine($"        O3DESHARP_ADD_INTERNAL_CALL(assembly, \"{internalCallsType}\", \"{funcName}\", &{funcName});");
             }
 
             sb.AppendLine("    }");
@@ -277,27 +343,45 @@ namespace O3DESharp.BindingGenerator.Generation
         //   - bool/int/short/...     -> matching size-preserving C++ scalar
         //   - Vector3 / Quaternion   -> InteropVector3 / InteropQuaternion
         //                              (defined in ScriptBindings.h)
+        //   - ReadOnlySpan<T>        -> void* + AZ::s32 count
         // Anything we don't recognise falls back to "void*" plus a /* comment */
         // showing the original type so a human can still see what was intended.
         // -------------------------------------------------------------------
 
         /// <summary>Public for testing.</summary>
         public static string BuildCppSignature(string funcName, ParsedMethod method)
+        {
+            return BuildCppSignature(funcName, method.IsStatic, method.ReturnType, method.Parameters);
+        }
+
+        /// <summary>Public for testing. ParsedFunction overload (no 'this').</summary>
+        public static string BuildCppSignature(string funcName, ParsedFunction function)
+        {
+            return BuildCppSignature(funcName, true, function.ReturnType, function.Parameters);
+        }
+
+        private static string BuildCppSignature(string funcName, bool isStatic, ParsedType returnType, IReadOnlyList<ParsedParameter> parameters)
         {
             var sb = new StringBuilder();
-            sb.Append(MapMarshalTypeToCpp(GetMarshalType(method.ReturnType)));
+            sb.Append(MapMarshalTypeToCpp(GetReturnMarshalType(returnType)));
             sb.Append(' ').Append(funcName).Append('(');
 
             var parts = new List<string>();
-            if (!method.IsStatic)
+            if (!isStatic)
             {
                 parts.Add("void* thisPtr");
             }
-            for (int i = 0; i < method.Parameters.Count; i++)
+            for (int i = 0; i < parameters.Count; i++)
             {
-                var p = method.Parameters[i];
+                var p = parameters[i];
+                var paramName = CppParameterName(p, i);
+                if (p.Type.ArrayElementType != null)
+                {
+                    parts.Add($"void* {paramName}");
+                    parts.Add($"AZ::s32 {paramName}Count");
+                    continue;
+                }
                 var cpp = MapMarshalTypeToCpp(GetMarshalType(p.Type));
-                var paramName = string.IsNullOrEmpty(p.Name) ? $"arg{i}" : SanitizeCppIdentifier(p.Name);
                 parts.Add($"{cpp} {paramName}");
             }
             sb.Append(string.Join(", ", parts));
@@ -305,24 +389,9 @@ namespace O3DESharp.BindingGenerator.Generation
             return sb.ToString();
         }
 
-        /// <summary>Public for testing. ParsedFunction overload (no 'this').</summary>
-        public static string BuildCppSignature(string funcName, ParsedFunction function)
+        private static string CppParameterName(ParsedParameter parameter, int index)
         {
-            var sb = new StringBuilder();
-            sb.Append(MapMarshalTypeToCpp(GetMarshalType(function.ReturnType)));
-            sb.Append(' ').Append(funcName).Append('(');
-
-            var parts = new List<string>();
-            for (int i = 0; i < function.Parameters.Count; i++)
-            {
-                var p = function.Parameters[i];
-                var cpp = MapMarshalTypeToCpp(GetMarshalType(p.Type));
-                var paramName = string.IsNullOrEmpty(p.Name) ? $"arg{i}" : SanitizeCppIdentifier(p.Name);
-                parts.Add($"{cpp} {paramName}");
-            }
-            sb.Append(string.Join(", ", parts));
-            sb.Append(')');
-            return sb.ToString();
+            return string.IsNullOrEmpty(parameter.Name) ? $"arg{index}" : SanitizeCppIdentifier(parameter.Name);
         }
 
         /// <summary>
@@ -341,6 +410,17 @@ namespace O3DESharp.BindingGenerator.Generation
             return csType;
         }
 
+        /// <summary>
+        /// Same as CSharpCodeGenerator.GetReturnMarshalType: a reference to a
+        /// blittable value type is returned by value.
+        /// </summary>
+        private static string GetReturnMarshalType(ParsedType type)
+        {
+            if (type.IsReference && !type.IsPointer && TypeMapper.IsBlittableType(type.CSharpTypeName))
+                return type.CSharpTypeName;
+            return GetMarshalType(type);
+        }
+
         private static string MapMarshalTypeToCpp(string marshal)
         {
             return marshal switch
@@ -382,7 +462,7 @@ namespace O3DESharp.BindingGenerator.Generation
             sb.AppendLine("    {");
             sb.AppendLine($"        AZ_WarningOnce(\"O3DESharp\", false, \"Unimplemented binding stub: {humanLabel} - generator emitted a stub body; provide a real implementation to replace it.\");");
 
-            var marshal = GetMarshalType(returnType);
+            var marshal = GetReturnMarshalType(returnType);
             if (marshal != "void")
             {
                 sb.AppendLine($"        return {BuildStubReturnExpression(marshal)};");
@@ -416,6 +496,378 @@ namespace O3DESharp.BindingGenerator.Generation
             };
         }
 
+        // -------------------------------------------------------------------
+        // Direct-call thunk emission
+        //
+        // A thunk has exactly the BuildCppSignature signature and forwards to
+        // the exported C++ declaration, converting each argument from its
+        // interop type (see MapMarshalTypeToCpp) to the declared parameter
+        // type and the result back. The declared C++ types come from
+        // ParsedType.CppTypeName. Anything that needs real marshaling makes
+        // the Try* converters fail and the caller falls back to a stub.
+        // -------------------------------------------------------------------
+
+        /// <summary>
+        /// Emit a thunk for a class method. Instance methods receive the
+        /// object as <c>thisPtr</c> (the wrapper's native handle) and return
+        /// a zero-value when it is null, i.e. the wrapper was disposed.
+        /// Public for golden-file testing.
+        /// </summary>
+        /// <returns>false (nothing emitted) if the signature can't be thunked</returns>
+        public static bool EmitThunkDefinition(StringBuilder sb, string funcName, ParsedClass owner, ParsedMethod method)
+        {
+            var className = QualifyCpp(string.IsNullOrEmpty(owner.QualifiedName) ? owner.Name : owner.QualifiedName);
+            var callee = method.IsStatic
+                ? $"{className}::{method.Name}"
+                : $"static_cast<{(method.IsConst ? "const " : "")}{className}*>(thisPtr)->{method.Name}";
+            return EmitThunk(sb, BuildCppSignature(funcName, method), callee, !method.IsStatic, method.ReturnType, method.Parameters);
+        }
+
+        /// <summary>
+        /// Emit a thunk for a standalone function. Public for golden-file testing.
+        /// </summary>
+        /// <returns>false (nothing emitted) if the signature can't be thunked</returns>
+        public static bool EmitThunkDefinition(StringBuilder sb, string funcName, ParsedFunction function)
+        {
+            var callee = QualifyCpp(string.IsNullOrEmpty(function.Namespace) ? function.Name : $"{function.Namespace}::{function.Name}");
+            return EmitThunk(sb, BuildCppSignature(funcName, function), callee, false, function.ReturnType, function.Parameters);
+        }
+
+        private static bool EmitThunk(
+            StringBuilder sb, string signature, string callee, bool hasThis, ParsedType returnType, IReadOnlyList<ParsedParameter> parameters)
+        {
+            var args = new List<string>();
+            var before = new List<string>();
+            var after = new List<string>();
+            for (int i = 0; i < parameters.Count; i++)
+            {
+                if (!TryConvertArgument(parameters[i].Type, CppParameterName(parameters[i], i), args, before, after))
+                {
+                    return false;
+                }
+            }
+
+            var call = $"{callee}({string.Join(", ", args)})";
+            var returnMarshal = GetReturnMarshalType(returnType);
+            List<string>? returnLines = null;
+            if (returnMarshal != "void")
+            {
+                // Write-backs for 'T&' arguments have to run after the call
+                // but before returning, so hold the result in a local then.
+                var resultExpr = after.Count > 0 ? "result" : call;
+                if (!TryConvertReturn(returnType, resultExpr, out returnLines))
+                {
+                    return false;
+                }
+            }
+
+            sb.AppendLine($"    {signature}");
+            sb.AppendLine("    {");
+            if (hasThis)
+            {
+                sb.AppendLine("        if (thisPtr == nullptr)");
+                sb.AppendLine("        {");
+                sb.AppendLine(returnMarshal == "void" ? "            return;" : $"            return {BuildStubReturnExpression(returnMarshal)};");
+                sb.AppendLine("        }");
+            }
+            foreach (var line in before)
+            {
+                sb.AppendLine($"        {line}");
+            }
+
+            if (returnLines == null)
+            {
+                sb.AppendLine($"        {call};");
+                foreach (var line in after)
+                {
+                    sb.AppendLine($"        {line}");
+                }
+            }
+            else
+            {
+                if (after.Count > 0)
+                {
+                    sb.AppendLine($"        auto&& result = {call};");
+                    foreach (var line in after)
+                    {
+                        sb.AppendLine($"        {line}");
+                    }
+                }
+                foreach (var line in returnLines)
+                {
+                    sb.AppendLine($"        {line}");
+                }
+            }
+            sb.AppendLine("    }");
+            sb.AppendLine();
+            return true;
+        }
+
+        /// <summary>
+        /// Convert one interop argument to the declared C++ parameter type.
+        /// Appends the argument expression to <paramref name="args"/>, plus
+        /// any statements needed before / after the call (non-const math
+        /// references are copied into a local and written back).
+        /// </summary>
+        private static bool TryConvertArgument(ParsedType type, string name, List<string> args, List<string> before, List<string> after)
+        {
+            var baseCpp = StripCppQualifiers(type.CppTypeName);
+            var constPrefix = type.IsConst ? "const " : "";
+
+            if (type.ArrayElementType != null)
+            {
+                var element = type.ArrayElementCppType ?? type.ArrayElementType;
+                if (baseCpp.StartsWith("AZStd::span", StringComparison.Ordinal))
+                {
+                    args.Add($"{baseCpp}(static_cast<{element}*>({name}), static_cast<size_t>({name}Count))");
+                }
+                else
+                {
+                    args.Add($"{baseCpp}(static_cast<const {element}*>({name}), static_cast<const {element}*>({name}) + {name}Count)");
+                }
+                return true;
+            }
+
+            if (type.IsPointer)
+            {
+                var pointerType = NormalizeCpp(type.CppTypeName);
+                if (pointerType.EndsWith(" const", StringComparison.Ordinal))
+                {
+                    pointerType = pointerType.Substring(0, pointerType.Length - 6);
+                }
+                args.Add($"static_cast<{pointerType}>({name})");
+                return true;
+            }
+
+            var interop = InteropStructFor(type.CSharpTypeName);
+            if (type.IsReference)
+            {
+                if (interop != null)
+                {
+                    if (type.IsConst)
+                    {
+                        args.Add($"static_cast<const {interop}*>({name})->ToAZ()");
+                    }
+                    else
+                    {
+                        before.Add($"{baseCpp} {name}Value = static_cast<{interop}*>({name})->ToAZ();");
+                        args.Add($"{name}Value");
+                        after.Add($"*static_cast<{interop}*>({name}) = {interop}({name}Value);");
+                    }
+                    return true;
+                }
+                if (IsIdType(baseCpp))
+                {
+                    if (!type.IsConst)
+                    {
+                        return false;
+                    }
+                    args.Add($"{baseCpp}(*static_cast<const {IdMarshalCpp(baseCpp)}*>({name}))");
+                    return true;
+                }
+                if (IsStringType(baseCpp))
+                {
+                    if (!type.IsConst)
+                    {
+                        return false;
+                    }
+                    args.Add($"{baseCpp}({name} ? static_cast<const char*>({name}) : \"\")");
+                    return true;
+                }
+                if (type.CSharpTypeName == "Vector2" || type.CSharpTypeName == "Guid" || string.IsNullOrEmpty(baseCpp) || baseCpp.Contains('<'))
+                {
+                    return false;
+                }
+                // A primitive (C# passes the address of its value) or an
+                // object (C# passes its native handle) - either way a T*.
+                args.Add($"*static_cast<{constPrefix}{baseCpp}*>({name})");
+                return true;
+            }
+
+            if (interop != null)
+            {
+                args.Add($"{name}.ToAZ()");
+                return true;
+            }
+            if (IsIdType(baseCpp))
+            {
+                args.Add($"{baseCpp}({name})");
+                return true;
+            }
+            if (IsStringType(baseCpp))
+            {
+                args.Add($"{baseCpp}({name} ? static_cast<const char*>({name}) : \"\")");
+                return true;
+            }
+
+            var marshal = GetMarshalType(type);
+            if (marshal == "IntPtr")
+            {
+                // An object taken by value: C# hands over its native handle
+                if (string.IsNullOrEmpty(baseCpp) || baseCpp.Contains('<'))
+                {
+                    return false;
+                }
+                args.Add($"*static_cast<const {baseCpp}*>({name})");
+                return true;
+            }
+            if (!IsPrimitiveMarshal(marshal))
+            {
+                return false; // no C++ interop type (Guid, Vector2, Coral types, ...)
+            }
+
+            // Primitive: converts implicitly
+            args.Add(name);
+            return true;
+        }
+
+        /// <summary>
+        /// Statements returning <paramref name="expr"/> (the call, or the
+        /// local holding its result) as the interop return type.
+        /// </summary>
+        private static bool TryConvertReturn(ParsedType type, string expr, out List<string> lines)
+        {
+            lines = new List<string>();
+            var baseCpp = StripCppQualifiers(type.CppTypeName);
+
+            if (type.IsPointer)
+            {
+                lines.Add($"return const_cast<void*>(static_cast<const void*>({expr}));");
+                return true;
+            }
+
+            var interop = InteropStructFor(type.CSharpTypeName);
+            if (interop != null)
+            {
+                lines.Add($"return {interop}({expr});");
+                return true;
+            }
+            if (IsIdType(baseCpp))
+            {
+                lines.Add($"return static_cast<{IdMarshalCpp(baseCpp)}>({expr});");
+                return true;
+            }
+            if (baseCpp == "AZStd::string" && type.IsReference)
+            {
+                lines.Add($"return const_cast<char*>(({expr}).c_str());");
+                return true;
+            }
+            if (IsStringType(baseCpp))
+            {
+                // The returned pointer stays valid until this thunk runs
+                // again on the same thread; copy it out on the C# side.
+                lines.Add("static thread_local AZStd::string s_result;");
+                if (baseCpp == "AZStd::string")
+                {
+                    lines.Add($"s_result = {expr};");
+                }
+                else
+                {
+                    lines.Add($"const AZStd::string_view resultView = {expr};");
+                    lines.Add("s_result.assign(resultView.data(), resultView.size());");
+                }
+                lines.Add("return const_cast<char*>(s_result.c_str());");
+                return true;
+            }
+
+            var marshal = GetReturnMarshalType(type);
+            if (marshal == "IntPtr")
+            {
+                // Only a reference has an address that outlives the call
+                if (!type.IsReference || string.IsNullOrEmpty(baseCpp) || baseCpp.Contains('<'))
+                {
+                    return false;
+                }
+                lines.Add($"return const_cast<void*>(static_cast<const void*>(&({expr})));");
+                return true;
+            }
+            if (!IsPrimitiveMarshal(marshal))
+            {
+                return false;
+            }
+
+            lines.Add($"return {expr};");
+            return true;
+        }
+
+        private static bool IsPrimitiveMarshal(string marshal)
+        {
+            return marshal switch
+            {
+                "bool" or "byte" or "sbyte" or "short" or "ushort" or
+                "int" or "uint" or "long" or "ulong" or
+                "float" or "double" or "char" or "nint" or "nuint" => true,
+                _ => false,
+            };
+        }
+
+        private static string? InteropStructFor(string csType)
+        {
+            return csType switch
+            {
+                "Vector3" => "O3DESharp::InteropVector3",
+                "Quaternion" => "O3DESharp::InteropQuaternion",
+                _ => null,
+            };
+        }
+
+        // Id wrappers that cross as their integer value
+        private static bool IsIdType(string baseCpp)
+        {
+            return baseCpp == "AZ::EntityId" || baseCpp == "AZ::Crc32";
+        }
+
+        private static string IdMarshalCpp(string baseCpp)
+        {
+            return baseCpp == "AZ::EntityId" ? "AZ::u64" : "AZ::u32";
+        }
+
+        // Strings cross as a null-terminated UTF-8 char*
+        private static bool IsStringType(string baseCpp)
+        {
+            return baseCpp == "AZStd::string" || baseCpp == "AZStd::string_view";
+        }
+
+        /// <summary>
+        /// The declared C++ type without const, reference or pointer - the
+        /// same normalization TypeMapper.MapType applies before lookup.
+        /// </summary>
+        private static string StripCppQualifiers(string cppType)
+        {
+            var type = NormalizeCpp(cppType);
+            if (type.StartsWith("const ", StringComparison.Ordinal))
+            {
+                type = type.Substring(6).Trim();
+            }
+            type = type.TrimEnd('*', '&', ' ');
+            if (type.EndsWith(" const", StringComparison.Ordinal))
+            {
+                type = type.Substring(0, type.Length - 6).Trim();
+            }
+            return type;
+        }
+
+        private static string NormalizeCpp(string cppType)
+        {
+            return string.Join(" ", (cppType ?? string.Empty).Split((char[]?)null, StringSplitOptions.RemoveEmptyEntries))
+                .Replace(" *", "*")
+                .Replace(" &", "&");
+        }
+
+        // Fully qualify from the global namespace so a name can't resolve to
+        // something in {Gem}::Generated.
+        private static string QualifyCpp(string name)
+        {
+            return name.StartsWith("::", StringComparison.Ordinal) ? name : "::" + name;
+        }
+
+        // InternalCalls field names are C# identifiers; a keyword is escaped
+        // with '@', which isn't part of the name.
+        private static string CppSymbol(string fieldName)
+        {
+            return fieldName.TrimStart('@');
+        }
+
         private static string SanitizeCppIdentifier(string raw)
         {
             if (string.IsNullOrEmpty(raw)) return "arg";
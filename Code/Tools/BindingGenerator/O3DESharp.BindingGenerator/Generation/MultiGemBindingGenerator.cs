@@ -8,9 +8,12 @@
 
 using System;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.IO;
 using System.Linq;
 using System.Text.Json;
+using System.Threading.Tasks;
+using ClangSharp.Interop;
 using O3DESharp.BindingGenerator.Caching;
 using O3DESharp.BindingGenerator.Configuration;
 using O3DESharp.BindingGenerator.GemDiscovery;
@@ -49,19 +52,40 @@ namespace O3DESharp.BindingGenerator.Generation
         // missing-header errors that strict-dep mode would surface as
         // "no bindable members" skips.
         private readonly bool _allGemsIncludePath;
+
+        // Cap on concurrent gems/headers in every GenerateAll phase; -1 uses
+        // every core. 1 reproduces the old one-after-another behavior.
+        private readonly int _maxDegreeOfParallelism;
         private BuildCache? _buildCache;
+        private HeaderParseCache? _headerCache;
 
-        public MultiGemBindingGenerator(BindingConfig config, bool verbose = false, bool forceRebuild = false, string? enginePath = null, bool allGemsIncludePath = false)
+        public MultiGemBindingGenerator(BindingConfig config, bool verbose = false, bool forceRebuild = false, string? enginePath = null, bool allGemsIncludePath = false, int maxDegreeOfParallelism = -1)
         {
             _config = config;
             _verbose = verbose;
             _forceRebuild = forceRebuild;
             _enginePath = enginePath;
             _allGemsIncludePath = allGemsIncludePath;
+            _maxDegreeOfParallelism = maxDegreeOfParallelism > 0 ? maxDegreeOfParallelism : -1;
         }
 
         /// <summary>
-        /// Generate bindings for all enabled gems in dependency order
+        /// Generate bindings for all enabled gems in dependency order.
+        ///
+        /// Runs as four phases, each spread over all cores and each timed
+        /// under --verbose:
+        ///   prepare  - per gem: settings, header discovery, cache check,
+        ///              include paths and clang args
+        ///   parse    - every header of every stale gem as one flat work
+        ///              list, so a 250-header gem doesn't leave the other
+        ///              cores idle once the small gems are done; headers
+        ///              unchanged since the last run come from the
+        ///              HeaderParseCache instead of libclang
+        ///   generate - per gem: merge, sort, emit C#/C++/metadata/.csproj
+        ///   cache    - per gem: hash inputs into the BuildCache
+        /// Every per-gem and per-header result lands in a slot indexed by its
+        /// position in <paramref name="sortedGems"/> / the sorted header
+        /// list, so the output is identical to a serial run.
         /// </summary>
         /// <param name="gems">All discovered gems</param>
         /// <param name="sortedGems">Gems in dependency order</param>
@@ -71,6 +95,7 @@ namespace O3DESharp.BindingGenerator.Generation
             Log($"Generating bindings for {sortedGems.Count} gems in dependency order...");
 
             var result = new GenerationResult();
+            var totalSw = Stopwatch.StartNew();
 
             // Initialize build cache if incremental builds are enabled
             if (_config.Global.IncrementalBuild && !_forceRebuild)
@@ -85,43 +110,155 @@ namespace O3DESharp.BindingGenerator.Generation
                 Log("Force rebuild requested - skipping cache checks.");
             }
 
+            // Per-header parse results. Under --force every header is
+            // re-parsed, but the fresh results are still written back so the
+            // next incremental run can use them.
+            if (_config.Global.IncrementalBuild)
+            {
+                var headerCachePath = Path.Combine(projectPath, _config.Global.HeaderCachePath);
+                _headerCache = new HeaderParseCache(headerCachePath, _verbose, readEnabled: !_forceRebuild);
+            }
+
+            var parallelOptions = new ParallelOptions { MaxDegreeOfParallelism = _maxDegreeOfParallelism };
+            var outcomes = new GemOutcome[sortedGems.Count];
+
+            // Phase 1: prepare
+            var phaseSw = Stopwatch.StartNew();
+            var work = new GemWork?[sortedGems.Count];
+            Parallel.For(0, sortedGems.Count, parallelOptions, i =>
+            {
+                try
+                {
+                    work[i] = PrepareGem(sortedGems[i], gems);
+                    outcomes[i] = work[i] != null ? GemOutcome.Generated : GemOutcome.Skipped;
+                }
+                catch (Exception ex)
+                {
+                    ReportGemError(sortedGems[i], ex);
+                    outcomes[i] = GemOutcome.Failed;
+                }
+            });
+            var stale = work.Where(w => w != null).Select(w => w!).ToList();
+            LogPhase("prepare", phaseSw, $"{sortedGems.Count} gems, {stale.Count} need regeneration");
+
+            // Phase 2: parse
+            phaseSw.Restart();
+            var headerJobs = stale
+                .SelectMany(w => w.HeaderFiles.Select((_, headerIndex) => (Work: w, HeaderIndex: headerIndex)))
+                .ToList();
+            foreach (var w in stale)
+            {
+                // Unconditional header-count log so the editor's progress
+                // view shows the upcoming work size for each gem.
+                Console.WriteLine($"  [{w.Gem.GemName}] Parsing {w.HeaderFiles.Count} header files...");
+            }
+            // One CXIndex per worker, never shared between threads; see
+            // O3DEHeaderParser.ParseHeaders.
+            Parallel.For(
+                0,
+                headerJobs.Count,
+                parallelOptions,
+                () => CXIndex.Create(),
+                (j, _, clangIndex) =>
+                {
+                    var (w, headerIndex) = headerJobs[j];
+                    w.PerHeader[headerIndex] = w.Parser.ParseHeader(
+                        w.HeaderFiles[headerIndex], w.ClangArgs, clangIndex, w.Gem.GemName, w.HeaderFiles.Count);
+                    return clangIndex;
+                },
+                clangIndex => clangIndex.Dispose());
+            LogPhase("parse", phaseSw, _headerCache != null
+                ? $"{headerJobs.Count} headers, {_headerCache.Hits} from the header cache"
+                : $"{headerJobs.Count} headers");
+
+            // Phase 3: generate. Gems normally write to their own
+            // {GemName}-templated directories; if the config points two gems
+            // at the same directory, run this phase serially so the later gem
+            // still overwrites the earlier one's shared files, as before.
+            phaseSw.Restart();
+            var coreAssemblyPath = ResolveCorePath(projectPath);
             var csharpGenerator = new CSharpCodeGenerator(_config.Global.CSharpNamespace, _verbose);
-            var cppGenerator = new CppRegistrationGenerator(_verbose);
+            var cppGenerator = new CppRegistrationGenerator(_config.Global.CSharpNamespace, _verbose);
             var projectGenerator = new CSharpProjectGenerator(_verbose);
             var metadataGenerator = new MetadataGenerator(_verbose);
             var extensionGenerator = new ExtensionMethodGenerator(_config.Global.CSharpNamespace, _verbose);
 
-            foreach (var gem in sortedGems)
+            var sharedOutputDirectory = stale
+                .SelectMany(w => new[] { w.CSharpOutputPath, w.CppOutputPath }.Distinct().Select(d => (Dir: Path.GetFullPath(d), w.Gem.GemName)))
+                .GroupBy(x => x.Dir, StringComparer.OrdinalIgnoreCase)
+                .Any(g => g.Select(x => x.GemName).Distinct().Count() > 1);
+            if (sharedOutputDirectory)
+            {
+                Log("  Gems share an output directory - generating serially.");
+            }
+
+            Parallel.For(0, sortedGems.Count, sharedOutputDirectory ? new ParallelOptions { MaxDegreeOfParallelism = 1 } : parallelOptions, i =>
             {
+                var w = work[i];
+                if (w == null)
+                {
+                    return;
+                }
                 try
                 {
-                    var (generated, classCount, fileCount) = GenerateGemBindings(gem, gems, projectPath, csharpGenerator, cppGenerator, projectGenerator, metadataGenerator, extensionGenerator);
-                    if (generated)
-                    {
-                        result.GemsProcessed++;
-                        result.ClassesGenerated += classCount;
-                        result.FilesWritten += fileCount;
-                        result.ProcessedGemNames.Add(gem.GemName);
-                    }
-                    else
+                    if (!GenerateGemBindings(w, gems, coreAssemblyPath, csharpGenerator, cppGenerator, projectGenerator, metadataGenerator, extensionGenerator))
                     {
-                        result.GemsSkipped++;
+                        outcomes[i] = GemOutcome.Skipped;
                     }
                 }
                 catch (Exception ex)
                 {
-                    Console.WriteLine($"Error generating bindings for gem '{gem.GemName}': {ex.Message}");
-                    if (_verbose)
+                    ReportGemError(w.Gem, ex);
+                    outcomes[i] = GemOutcome.Failed;
+                }
+            });
+            LogPhase("generate", phaseSw, $"{outcomes.Count(o => o == GemOutcome.Generated)} gems");
+
+            // Phase 4: cache. Record both the direct headers we were asked to
+            // parse and every transitively-#included header libclang touched,
+            // so a change in an upstream AzCore header invalidates a gem's
+            // cache on the next run even though its own headers are
+            // byte-identical. BuildCache serializes the dictionary writes;
+            // the hashing runs in parallel.
+            if (_buildCache != null)
+            {
+                phaseSw.Restart();
+                var cache = _buildCache;
+                Parallel.For(0, sortedGems.Count, parallelOptions, i =>
+                {
+                    var w = work[i];
+                    if (w == null || outcomes[i] != GemOutcome.Generated)
                     {
-                        Console.WriteLine(ex.StackTrace);
+                        return;
                     }
-                }
+                    cache.UpdateEntry(w.Gem.GemName, w.HeaderFiles, w.SourceFiles, w.ConfigHash, w.OutputFiles);
+                });
+                cache.Save();
+                LogPhase("cache", phaseSw, $"{outcomes.Count(o => o == GemOutcome.Generated)} entries updated");
             }
 
-            // Save the cache
-            _buildCache?.Save();
+            // Tally in dependency order so ProcessedGemNames reads the same
+            // as it did when gems were generated one after another.
+            for (int i = 0; i < sortedGems.Count; i++)
+            {
+                switch (outcomes[i])
+                {
+                    case GemOutcome.Generated:
+                        var w = work[i]!;
+                        result.GemsProcessed++;
+                        result.ClassesGenerated += w.ClassCount;
+                        result.FilesWritten += w.OutputFiles.Count;
+                        result.ProcessedGemNames.Add(w.Gem.GemName);
+                        break;
+                    case GemOutcome.Skipped:
+                        result.GemsSkipped++;
+                        break;
+                }
+            }
 
+            totalSw.Stop();
             Log($"Binding generation complete! Generated: {result.GemsProcessed}, Skipped (cached): {result.GemsSkipped}");
+            Log($"  Total: {totalSw.ElapsedMilliseconds} ms on up to {(_maxDegreeOfParallelism > 0 ? _maxDegreeOfParallelism : Environment.ProcessorCount)} threads");
 
             // Output machine-readable summary for orchestrator scripts
             Console.WriteLine($"Generated {result.ClassesGenerated} classes in {result.FilesWritten} files");
@@ -134,18 +271,53 @@ namespace O3DESharp.BindingGenerator.Generation
         }
 
         /// <summary>
-        /// Generate bindings for a single gem
+        /// Where a gem ended up after GenerateAll's phases.
         /// </summary>
-        /// <returns>Tuple of (generated, classCount, fileCount)</returns>
-        private (bool generated, int classCount, int fileCount) GenerateGemBindings(
-            GemDescriptor gem,
-            Dictionary<string, GemDescriptor> allGems,
-            string projectPath,
-            CSharpCodeGenerator csharpGenerator,
-            CppRegistrationGenerator cppGenerator,
-            CSharpProjectGenerator projectGenerator,
-            MetadataGenerator metadataGenerator,
-            ExtensionMethodGenerator extensionGenerator)
+        private enum GemOutcome
+        {
+            Skipped,
+            Generated,
+            Failed,
+        }
+
+        /// <summary>
+        /// Per-gem state carried from one GenerateAll phase to the next.
+        /// Each instance is only ever written by one thread at a time, except
+        /// PerHeader, whose slots are each written by exactly one parse job.
+        /// </summary>
+        private sealed class GemWork
+        {
+            public GemWork(GemDescriptor gem, List<string> headerFiles, string configHash, O3DEHeaderParser parser, string[] clangArgs, string csharpOutputPath, string cppOutputPath)
+            {
+                Gem = gem;
+                HeaderFiles = headerFiles;
+                ConfigHash = configHash;
+                Parser = parser;
+                ClangArgs = clangArgs;
+                CSharpOutputPath = csharpOutputPath;
+                CppOutputPath = cppOutputPath;
+                PerHeader = new ParsedBindings?[headerFiles.Count];
+            }
+
+            public GemDescriptor Gem { get; }
+            public List<string> HeaderFiles { get; }
+            public string ConfigHash { get; }
+            public O3DEHeaderParser Parser { get; }
+            public string[] ClangArgs { get; }
+            public string CSharpOutputPath { get; }
+            public string CppOutputPath { get; }
+            public ParsedBindings?[] PerHeader { get; }
+
+            public IEnumerable<string> SourceFiles { get; set; } = Array.Empty<string>();
+            public List<string> OutputFiles { get; set; } = new List<string>();
+            public int ClassCount { get; set; }
+        }
+
+        /// <summary>
+        /// Prepare phase for a single gem
+        /// </summary>
+        /// <returns>The gem's work item, or null if it is disabled, has no headers or is up to date</returns>
+        private GemWork? PrepareGem(GemDescriptor gem, Dictionary<string, GemDescriptor> allGems)
         {
             Log($"\nProcessing gem: {gem.GemName}");
 
@@ -156,27 +328,24 @@ namespace O3DESharp.BindingGenerator.Generation
 
             if (!gemSettings.Enabled)
             {
-                Log($"  Skipped (disabled in config)");
-                return (false, 0, 0);
+                Log($"  [{gem.GemName}] Skipped (disabled in config)");
+                return null;
             }
 
             // Find header files to parse
             var headerFiles = FindHeaderFiles(gem, gemSettings);
             if (headerFiles.Count == 0)
             {
-                Log($"  No header files found");
-                return (false, 0, 0);
+                Log($"  [{gem.GemName}] No header files found");
+                return null;
             }
 
             // Check cache for incremental build
-            if (_buildCache != null)
+            var configHash = ComputeConfigHash(gemSettings);
+            if (_buildCache != null && !_buildCache.NeedsRegeneration(gem.GemName, headerFiles, configHash))
             {
-                var configHash = ComputeConfigHash(gemSettings);
-                if (!_buildCache.NeedsRegeneration(gem.GemName, headerFiles, configHash))
-                {
-                    Console.WriteLine($"  [{gem.GemName}] Up to date (cached)");
-                    return (false, 0, 0);
-                }
+                Console.WriteLine($"  [{gem.GemName}] Up to date (cached)");
+                return null;
             }
 
             // Build include paths
@@ -188,9 +357,38 @@ namespace O3DESharp.BindingGenerator.Generation
             // Determine if we require export attribute
             var requireExportAttribute = gemSettings.RequireExportAttribute ?? _config.Global.RequireExportAttribute;
 
-            // Parse headers
-            var parser = new O3DEHeaderParser(requireExportAttribute, _verbose);
-            var bindings = parser.ParseHeaders(headerFiles, includePaths, defines, gem.GemName);
+            return new GemWork(
+                gem,
+                headerFiles,
+                configHash,
+                new O3DEHeaderParser(requireExportAttribute, _verbose, _headerCache),
+                O3DEHeaderParser.BuildClangArgs(includePaths, defines),
+                ResolvePath(_config.Global.CSharpOutputPath, gem),
+                ResolvePath(_config.Global.CppOutputPath, gem));
+        }
+
+        /// <summary>
+        /// Generate phase for a single gem whose headers have been parsed
+        /// </summary>
+        /// <returns>True if bindings were written</returns>
+        private bool GenerateGemBindings(
+            GemWork work,
+            Dictionary<string, GemDescriptor> allGems,
+            string coreAssemblyPath,
+            CSharpCodeGenerator csharpGenerator,
+            CppRegistrationGenerator cppGenerator,
+            CSharpProjectGenerator projectGenerator,
+            MetadataGenerator metadataGenerator,
+            ExtensionMethodGenerator extensionGenerator)
+        {
+            var gem = work.Gem;
+
+            // PerHeader is in FindHeaderFiles order regardless of which
+            // worker finished first, so the merge matches a serial parse.
+            var bindings = O3DEHeaderParser.MergeHeaderResults(gem.GemName, work.PerHeader);
+            Console.WriteLine(
+                $"  [{gem.GemName}] Parsed {bindings.Classes.Count} classes, " +
+                $"{bindings.Functions.Count} functions, {bindings.Enums.Count} enums");
 
             // Sort every parsed collection by qualified name right here, before
             // any downstream consumer sees them. FindHeaderFiles (above) already
@@ -224,13 +422,13 @@ namespace O3DESharp.BindingGenerator.Generation
                 // instead of making the user re-run with --verbose to find
                 // out why nothing was generated.
                 var reasonParts = new List<string>();
-                if (parser.SkippedNoBindableMembersCount > 0)
+                if (work.Parser.SkippedNoBindableMembersCount > 0)
                 {
-                    reasonParts.Add($"{parser.SkippedNoBindableMembersCount} had no bindable public members");
+                    reasonParts.Add($"{work.Parser.SkippedNoBindableMembersCount} had no bindable public members");
                 }
-                if (parser.SkippedFilteredClassCount > 0)
+                if (work.Parser.SkippedFilteredClassCount > 0)
                 {
-                    reasonParts.Add($"{parser.SkippedFilteredClassCount} were filtered by name (template specializations, internal/editor-only types)");
+                    reasonParts.Add($"{work.Parser.SkippedFilteredClassCount} were filtered by name (template specializations, internal/editor-only types)");
                 }
 
                 if (reasonParts.Count > 0)
@@ -241,15 +439,15 @@ namespace O3DESharp.BindingGenerator.Generation
                 {
                     Console.WriteLine($"  No bindings found to generate for '{gem.GemName}'. No classes, functions, or enums were even discovered under the configured header patterns - check headerPatterns/includePaths in binding_config.json.");
                 }
-                return (false, 0, 0);
+                return false;
             }
 
             // Generate C# code
-            var csharpOutputPath = ResolvePath(_config.Global.CSharpOutputPath, gem);
+            var csharpOutputPath = work.CSharpOutputPath;
             csharpGenerator.Generate(bindings, csharpOutputPath);
 
             // Generate C++ code
-            var cppOutputPath = ResolvePath(_config.Global.CppOutputPath, gem);
+            var cppOutputPath = work.CppOutputPath;
             cppGenerator.Generate(bindings, cppOutputPath);
 
             // Generate metadata for runtime reflection and hot reload
@@ -265,30 +463,31 @@ namespace O3DESharp.BindingGenerator.Generation
             }
 
             // Generate .csproj
-            var coreAssemblyPath = ResolveCorePath(projectPath);
             projectGenerator.Generate(gem, csharpOutputPath, allGems, coreAssemblyPath);
 
-            // Update cache. Record both the direct headers we were asked to
-            // parse and every transitively-#included header libclang touched,
-            // so a change in an upstream AzCore header invalidates this gem's
-            // cache on the next run even though the gem's own headers are
-            // byte-identical.
-            if (_buildCache != null)
+            work.SourceFiles = bindings.SourceFiles;
+            work.OutputFiles = CollectOutputFiles(csharpOutputPath, cppOutputPath);
+            work.ClassCount = bindings.Classes.Count;
+
+            Console.WriteLine($"  [{gem.GemName}] Generated bindings");
+            return true;
+        }
+
+        private void ReportGemError(GemDescriptor gem, Exception ex)
+        {
+            Console.WriteLine($"Error generating bindings for gem '{gem.GemName}': {ex.Message}");
+            if (_verbose)
             {
-                var configHash = ComputeConfigHash(gemSettings);
-                var outputFiles = CollectOutputFiles(csharpOutputPath, cppOutputPath);
-                _buildCache.UpdateEntry(
-                    gem.GemName,
-                    headerFiles,
-                    bindings.SourceFiles,
-                    configHash,
-                    outputFiles);
+                Console.WriteLine(ex.StackTrace);
             }
+        }
 
-            Console.WriteLine($"  [{gem.GemName}] Generated bindings");
-            var classCount = bindings.Classes.Count;
-            var fileCount = CollectOutputFiles(csharpOutputPath, cppOutputPath).Count;
-            return (true, classCount, fileCount);
+        private void LogPhase(string phase, Stopwatch stopwatch, string detail)
+        {
+            if (_verbose)
+            {
+                Log($"Phase '{phase}': {stopwatch.ElapsedMilliseconds} ms ({detail})");
+            }
         }
 
         /// <summary>
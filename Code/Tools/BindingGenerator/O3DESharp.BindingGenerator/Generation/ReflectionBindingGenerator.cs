@@ -40,6 +40,14 @@ namespace O3DESharp.BindingGenerator.Generation
     ///     / BroadcastEBusEvent / GetProperty, which use the same
     ///     BehaviorContext we generated from.
     ///
+    /// Methods and properties whose arguments and result all fit an
+    /// O3DE.Reflection.NativeArgument slot (primitives, EntityId,
+    /// Vector2/3, Quaternion) skip the JSON dispatch entirely: each gets
+    /// a static NativeMethod resolved on first call, and the wrapper
+    /// passes its arguments in a stackalloc'd span - no boxing, no
+    /// params array, no name lookup per call. Everything else (strings,
+    /// objects, transforms) keeps the NativeReflection path.
+    ///
     /// The single trade-off is that the JSON has to be produced
     /// first - which the gem already does automatically via
     /// AutoExportReflectionData on editor startup.
@@ -409,6 +417,7 @@ namespace O3DESharp.BindingGenerator.Generation
             sb.AppendLine($"        public const string TypeName = \"{cls.Name}\";");
 
             // Methods
+            var typedFields = new HashSet<string>(StringComparer.Ordinal);
             foreach (var m in cls.Methods)
             {
                 if (string.IsNullOrEmpty(m.Name)) continue;
@@ -423,8 +432,14 @@ namespace O3DESharp.BindingGenerator.Generation
                 var paramList = string.Join(", ", m.Parameters.Select((p, i) =>
                     $"{MapMarshalToCSharp(new ReflectionTypeInfo { MarshalType = p.MarshalType, TypeName = p.TypeName })} {SafeParamName(p.TypeName, i)}"));
                 var argList = string.Join(", ", m.Parameters.Select((p, i) => SafeParamName(p.TypeName, i)));
+                var typedField = TypedMethodField(m.Name, m.ReturnType, m.Parameters, typedFields);
 
                 sb.AppendLine();
+                if (typedField != null)
+                {
+                    sb.AppendLine($"        private static readonly NativeMethod {typedField} = NativeMethod.Method(TypeName, \"{m.Name}\", {m.Parameters.Count});");
+                    sb.AppendLine();
+                }
                 sb.AppendLine($"        /// <summary>{XmlEscape(m.Description)}</summary>");
                 if (m.IsDeprecated)
                 {
@@ -433,8 +448,13 @@ namespace O3DESharp.BindingGenerator.Generation
 
                 if (m.IsStatic)
                 {
-                    // Static method - no instance needed; dispatch via InvokeStaticMethod.
-                    if (returnType == "void")
+                    // Static method - no instance needed; dispatch via the typed NativeMethod or InvokeStaticMethod.
+                    if (typedField != null)
+                    {
+                        sb.AppendLine($"        public static {returnType} {methodName}({paramList})");
+                        EmitTypedBody(sb, typedField, null, m.Parameters, m.ReturnType);
+                    }
+                    else if (returnType == "void")
                     {
                         sb.AppendLine($"        public static void {methodName}({paramList})");
                         sb.AppendLine("        {");
@@ -454,7 +474,12 @@ namespace O3DESharp.BindingGenerator.Generation
                 {
                     // Instance method - first param is the NativeObject handle.
                     var firstParamSep = string.IsNullOrEmpty(paramList) ? "" : ", ";
-                    if (returnType == "void")
+                    if (typedField != null)
+                    {
+                        sb.AppendLine($"        public static {returnType} {methodName}(NativeObject __instance{firstParamSep}{paramList})");
+                        EmitTypedBody(sb, typedField, "__instance", m.Parameters, m.ReturnType);
+                    }
+                    else if (returnType == "void")
                     {
                         sb.AppendLine($"        public static void {methodName}(NativeObject __instance{firstParamSep}{paramList})");
                         sb.AppendLine("        {");
@@ -487,19 +512,36 @@ namespace O3DESharp.BindingGenerator.Generation
                 // prefix guarantees the result starts with a letter so
                 // we don't need the @ escape.
                 var propName = IdentifierSuffix(p.Name);
+                var propSlot = TypedSlotField(p.Type.MarshalType);
 
                 sb.AppendLine();
+                if (propSlot != null)
+                {
+                    sb.AppendLine($"        private static readonly NativeMethod __get_{propName} = NativeMethod.Getter(TypeName, \"{p.Name}\");");
+                    if (!p.IsReadOnly)
+                    {
+                        sb.AppendLine($"        private static readonly NativeMethod __set_{propName} = NativeMethod.Setter(TypeName, \"{p.Name}\");");
+                    }
+                    sb.AppendLine();
+                }
                 sb.AppendLine($"        /// <summary>Get {XmlEscape(p.Name)} - {XmlEscape(p.Description)}</summary>");
                 sb.AppendLine($"        public static {propType} Get{propName}(NativeObject __instance)");
                 sb.AppendLine("        {");
-                // Null-forgiving (!) instead of ?? default: GetProperty<T>
-                // returns T? which is just T for value types, so ?? would
-                // be CS0019 "operator ?? cannot be applied to T and T".
-                // ! collapses cleanly for both T (no-op) and T? (strips
-                // nullability) - dispatcher's contract is that a missing
-                // property returns default(T), which scripts can detect
-                // via comparison if they care.
-                sb.AppendLine($"            return NativeReflection.GetProperty<{propType}>(__instance, \"{p.Name}\")!;");
+                if (propSlot != null)
+                {
+                    sb.AppendLine($"            return __get_{propName}.Invoke(__instance, default).{propSlot};");
+                }
+                else
+                {
+                    // Null-forgiving (!) instead of ?? default: GetProperty<T>
+                    // returns T? which is just T for value types, so ?? would
+                    // be CS0019 "operator ?? cannot be applied to T and T".
+                    // ! collapses cleanly for both T (no-op) and T? (strips
+                    // nullability) - dispatcher's contract is that a missing
+                    // property returns default(T), which scripts can detect
+                    // via comparison if they care.
+                    sb.AppendLine($"            return NativeReflection.GetProperty<{propType}>(__instance, \"{p.Name}\")!;");
+                }
                 sb.AppendLine("        }");
 
                 if (!p.IsReadOnly)
@@ -508,7 +550,16 @@ namespace O3DESharp.BindingGenerator.Generation
                     sb.AppendLine($"        /// <summary>Set {XmlEscape(p.Name)}</summary>");
                     sb.AppendLine($"        public static void Set{propName}(NativeObject __instance, {propType} value)");
                     sb.AppendLine("        {");
-                    sb.AppendLine($"            NativeReflection.SetProperty(__instance, \"{p.Name}\", value!);");
+                    if (propSlot != null)
+                    {
+                        sb.AppendLine($"            System.Span<NativeArgument> __args = stackalloc NativeArgument[1];");
+                        sb.AppendLine($"            __args[0].{propSlot} = value;");
+                        sb.AppendLine($"            __set_{propName}.Invoke(__instance, __args);");
+                    }
+                    else
+                    {
+                        sb.AppendLine($"            NativeReflection.SetProperty(__instance, \"{p.Name}\", value!);");
+                    }
                     sb.AppendLine("        }");
                 }
             }
@@ -653,6 +704,8 @@ namespace O3DESharp.BindingGenerator.Generation
             sb.AppendLine("    public static class Globals");
             sb.AppendLine("    {");
 
+            var typedFields = new HashSet<string>(StringComparer.Ordinal);
+
             foreach (var m in methods)
             {
                 if (string.IsNullOrEmpty(m.Name) || IsGeneratorUnsafeName(m.Name)) continue;
@@ -662,14 +715,25 @@ namespace O3DESharp.BindingGenerator.Generation
                 var paramList = string.Join(", ", m.Parameters.Select((p, i) =>
                     $"{MapMarshalToCSharp(new ReflectionTypeInfo { MarshalType = p.MarshalType, TypeName = p.TypeName })} {SafeParamName(p.TypeName, i)}"));
                 var argList = string.Join(", ", m.Parameters.Select((p, i) => SafeParamName(p.TypeName, i)));
+                var typedField = TypedMethodField(m.Name, m.ReturnType, m.Parameters, typedFields);
 
                 sb.AppendLine();
+                if (typedField != null)
+                {
+                    sb.AppendLine($"        private static readonly NativeMethod {typedField} = NativeMethod.Method(null, \"{m.Name}\", {m.Parameters.Count});");
+                    sb.AppendLine();
+                }
                 sb.AppendLine($"        /// <summary>{XmlEscape(m.Description)}</summary>");
                 if (m.IsDeprecated)
                 {
                     sb.AppendLine($"        [System.Obsolete(\"{XmlEscape(m.DeprecationMessage)}\")]");
                 }
-                if (returnType == "void")
+                if (typedField != null)
+                {
+                    sb.AppendLine($"        public static {returnType} {methodName}({paramList})");
+                    EmitTypedBody(sb, typedField, null, m.Parameters, m.ReturnType);
+                }
+                else if (returnType == "void")
                 {
                     sb.AppendLine($"        public static void {methodName}({paramList})");
                     sb.AppendLine("        {");
@@ -691,8 +755,35 @@ namespace O3DESharp.BindingGenerator.Generation
                 if (string.IsNullOrEmpty(p.Name) || IsGeneratorUnsafeName(p.Name)) continue;
                 var propType = MapMarshalToCSharp(p.Type);
                 var propName = SafeIdentifier(p.Name);
+                var propSlot = TypedSlotField(p.Type.MarshalType);
 
                 sb.AppendLine();
+                if (propSlot != null)
+                {
+                    var fieldSuffix = IdentifierSuffix(p.Name);
+                    sb.AppendLine($"        private static readonly NativeMethod __get_{fieldSuffix} = NativeMethod.Getter(null, \"{p.Name}\");");
+                    if (!p.IsReadOnly)
+                    {
+                        sb.AppendLine($"        private static readonly NativeMethod __set_{fieldSuffix} = NativeMethod.Setter(null, \"{p.Name}\");");
+                    }
+                    sb.AppendLine();
+                    sb.AppendLine($"        /// <summary>{XmlEscape(p.Description)}</summary>");
+                    sb.AppendLine($"        public static {propType} {propName}");
+                    sb.AppendLine("        {");
+                    sb.AppendLine($"            get => __get_{fieldSuffix}.Invoke(default).{propSlot};");
+                    if (!p.IsReadOnly)
+                    {
+                        sb.AppendLine("            set");
+                        sb.AppendLine("            {");
+                        sb.AppendLine("                System.Span<NativeArgument> __args = stackalloc NativeArgument[1];");
+                        sb.AppendLine($"                __args[0].{propSlot} = value;");
+                        sb.AppendLine($"                __set_{fieldSuffix}.Invoke(__args);");
+                        sb.AppendLine("            }");
+                    }
+                    sb.AppendLine("        }");
+                    continue;
+                }
+
                 sb.AppendLine($"        /// <summary>{XmlEscape(p.Description)}</summary>");
                 sb.AppendLine($"        public static {propType} {propName}");
                 sb.AppendLine("        {");
@@ -761,6 +852,88 @@ namespace O3DESharp.BindingGenerator.Generation
             };
         }
 
+        /// <summary>
+        /// The O3DE.Reflection.NativeArgument field a marshal_type travels
+        /// in on the typed dispatch path, or null if it has none (strings,
+        /// objects, transforms, unknowns - those stay on the JSON path).
+        /// Must agree with ClassifyTypedSlot in GenericDispatcher.cpp.
+        /// </summary>
+        private static string? TypedSlotField(string marshalType)
+        {
+            return marshalType switch
+            {
+                "Bool"          => "Bool",
+                "Int8"          => "Int8",
+                "Int16"         => "Int16",
+                "Int32"         => "Int32",
+                "Int64"         => "Int64",
+                "UInt8"         => "UInt8",
+                "UInt16"        => "UInt16",
+                "UInt32"        => "UInt32",
+                "UInt64"        => "UInt64",
+                "Float"         => "Float",
+                "Double"        => "Double",
+                "EntityId"      => "UInt64",
+                "Vector2"       => "Vector2",
+                "Vector3"       => "Vector3",
+                "Quaternion"    => "Quaternion",
+                _               => null,
+            };
+        }
+
+        /// <summary>
+        /// Name of the static NativeMethod field for a method, or null if
+        /// the method takes the JSON path: some argument or the result has
+        /// no NativeArgument slot, there are more than the native side's
+        /// eight typed arguments, or an overload with the same arity
+        /// already claimed the field (the native resolve picks overloads
+        /// by argument count alone, so only the first one can be typed).
+        /// </summary>
+        private static string? TypedMethodField(
+            string methodName,
+            ReflectionTypeInfo returnType,
+            List<ReflectionParameter> parameters,
+            HashSet<string> usedFields)
+        {
+            const int MaxTypedArguments = 8;
+            if (parameters.Count > MaxTypedArguments) return null;
+            if (returnType.MarshalType != "Void" && TypedSlotField(returnType.MarshalType) == null) return null;
+            if (parameters.Any(p => TypedSlotField(p.MarshalType) == null)) return null;
+
+            var field = $"__{IdentifierSuffix(methodName)}_{parameters.Count}";
+            return usedFields.Add(field) ? field : null;
+        }
+
+        /// <summary>
+        /// Body of a typed wrapper: arguments into a stackalloc'd span,
+        /// one call through the cached NativeMethod, result read straight
+        /// out of its slot.
+        /// </summary>
+        private static void EmitTypedBody(
+            StringBuilder sb,
+            string field,
+            string? instance,
+            List<ReflectionParameter> parameters,
+            ReflectionTypeInfo returnType)
+        {
+            sb.AppendLine("        {");
+            var arguments = "default";
+            if (parameters.Count > 0)
+            {
+                sb.AppendLine($"            System.Span<NativeArgument> __args = stackalloc NativeArgument[{parameters.Count}];");
+                for (int i = 0; i < parameters.Count; i++)
+                {
+                    sb.AppendLine($"            __args[{i}].{TypedSlotField(parameters[i].MarshalType)} = {SafeParamName(parameters[i].TypeName, i)};");
+                }
+                arguments = "__args";
+            }
+
+            var call = $"{field}.Invoke({(instance == null ? "" : instance + ", ")}{arguments})";
+            var resultField = TypedSlotField(returnType.MarshalType);
+            sb.AppendLine(resultField == null ? $"            {call};" : $"            return {call}.{resultField};");
+            sb.AppendLine("        }");
+        }
+
         /// <summary>
         /// Last "::"-delimited segment of a fully-qualified C++ name.
         /// For "AZ::Render::DirectionalLightFeatureProcessor" returns
@@ -10,8 +10,12 @@ using System;
 using System.Collections.Generic;
 using System.IO;
 using System.Linq;
+using System.Runtime.CompilerServices;
+using System.Threading;
+using System.Threading.Tasks;
 using ClangSharp;
 using ClangSharp.Interop;
+using O3DESharp.BindingGenerator.Caching;
 
 namespace O3DESharp.BindingGenerator.Parsing
 {
@@ -33,7 +37,7 @@ namespace O3DESharp.BindingGenerator.Parsing
         /// produces zero bindings instead of leaving the user to re-run
         /// with --verbose to find out why.
         /// </summary>
-        public int SkippedFilteredClassCount { get; private set; }
+        public int SkippedFilteredClassCount => _skippedFilteredClassCount;
 
         /// <summary>
         /// Number of classes skipped because, after member filtering
@@ -42,7 +46,23 @@ namespace O3DESharp.BindingGenerator.Parsing
         /// methods or properties left. See the "no bindable members" log
         /// site in ProcessClass.
         /// </summary>
-        public int SkippedNoBindableMembersCount { get; private set; }
+        public int SkippedNoBindableMembersCount => _skippedNoBindableMembersCount;
+
+        // Both counters are bumped from whichever worker thread parses the
+        // header, so they're plain fields updated with Interlocked.
+        private int _skippedFilteredClassCount;
+        private int _skippedNoBindableMembersCount;
+
+        // Headers finished so far for the gem this parser is serving; drives
+        // the (N/M) progress lines, which print in completion order once
+        // headers parse concurrently.
+        private int _headersParsed;
+
+        // Optional per-header result cache, and the args hash it is keyed
+        // by for each clang command line this parser has been handed (one
+        // array per gem, so this is normally a single entry).
+        private readonly HeaderParseCache? _headerCache;
+        private readonly ConditionalWeakTable<string[], string> _argsHashes = new ConditionalWeakTable<string[], string>();
 
         /// <summary>
         /// AzCore headers that libclang -include's before every parse, so
@@ -98,31 +118,37 @@ namespace O3DESharp.BindingGenerator.Parsing
             "AzCore/Outcome/Outcome.h",
         };
 
-        public O3DEHeaderParser(bool requireExportAttribute = false, bool verbose = false)
+        /// <param name="requireExportAttribute">Only export declarations marked O3DE_EXPORT_CSHARP</param>
+        /// <param name="verbose">Log per-class and per-diagnostic detail</param>
+        /// <param name="headerCache">Reuse unchanged headers' results across runs; null parses everything</param>
+        public O3DEHeaderParser(bool requireExportAttribute = false, bool verbose = false, HeaderParseCache? headerCache = null)
         {
             _typeMapper = new TypeMapper();
             _verbose = verbose;
             _requireExportAttribute = requireExportAttribute;
+            _headerCache = headerCache;
         }
 
         /// <summary>
-        /// Parse C++ headers to extract binding declarations
+        /// Parse C++ headers to extract binding declarations. Each header is
+        /// its own translation unit, so they parse concurrently; the
+        /// per-header results are merged back in <paramref name="headerFiles"/>
+        /// order, which keeps the output identical to a serial parse.
         /// </summary>
         /// <param name="headerFiles">List of header files to parse</param>
         /// <param name="includePaths">Include directories for compilation</param>
         /// <param name="defines">Preprocessor defines</param>
         /// <param name="gemName">Name of the gem being parsed</param>
+        /// <param name="maxDegreeOfParallelism">Headers parsed at once; -1 for one per core</param>
         /// <returns>Parsed binding declarations</returns>
-        public ParsedBindings ParseHeaders(List<string> headerFiles, List<string> includePaths, List<string> defines, string gemName)
+        public ParsedBindings ParseHeaders(List<string> headerFiles, List<string> includePaths, List<string> defines, string gemName, int maxDegreeOfParallelism = -1)
         {
-            var bindings = new ParsedBindings { GemName = gemName };
-
             if (headerFiles.Count == 0)
             {
                 // Unconditional - "no headers" is the kind of empty-output
                 // case where silence makes the run look stuck.
                 Console.WriteLine($"  [{gemName}] No header files to parse");
-                return bindings;
+                return new ParsedBindings { GemName = gemName };
             }
 
             // Unconditional header-count log so the editor's progress
@@ -131,7 +157,50 @@ namespace O3DESharp.BindingGenerator.Parsing
             // user deserves to know that BEFORE they wait 3 minutes).
             Console.WriteLine($"  [{gemName}] Parsing {headerFiles.Count} header files...");
 
-            // Build clang command line arguments
+            var clangArgs = BuildClangArgs(includePaths, defines);
+            var gemSw = System.Diagnostics.Stopwatch.StartNew();
+            _headersParsed = 0;
+
+            // One CXIndex per worker rather than per header: a CXIndex is
+            // just a libclang session handle, so reusing it is the standard
+            // clang_createIndex-once / clang_parseTranslationUnit-many-times
+            // pattern. It is never shared between threads - each worker
+            // creates its own in localInit and disposes it in localFinally.
+            var perHeader = new ParsedBindings[headerFiles.Count];
+            Parallel.For(
+                0,
+                headerFiles.Count,
+                new ParallelOptions { MaxDegreeOfParallelism = maxDegreeOfParallelism },
+                () => CXIndex.Create(),
+                (i, _, clangIndex) =>
+                {
+                    perHeader[i] = ParseHeader(headerFiles[i], clangArgs, clangIndex, gemName, headerFiles.Count);
+                    return clangIndex;
+                },
+                clangIndex => clangIndex.Dispose());
+
+            var bindings = MergeHeaderResults(gemName, perHeader);
+            gemSw.Stop();
+
+            // Unconditional summary line - tells the user this gem's
+            // parse step finished and how long it took. Code-gen is
+            // typically fast after this, so "summary then Generated
+            // bindings 1 sec later" is the normal cadence.
+            Console.WriteLine(
+                $"  [{gemName}] Parsed {bindings.Classes.Count} classes, " +
+                $"{bindings.Functions.Count} functions, {bindings.Enums.Count} enums " +
+                $"in {gemSw.Elapsed.TotalSeconds:F1}s");
+
+            return bindings;
+        }
+
+        /// <summary>
+        /// Build the libclang command line shared by every header of a gem.
+        /// </summary>
+        /// <param name="includePaths">Include directories for compilation</param>
+        /// <param name="defines">Preprocessor defines</param>
+        public static string[] BuildClangArgs(IEnumerable<string> includePaths, IEnumerable<string> defines)
+        {
             var args = new List<string>();
 
             // Add include paths
@@ -213,83 +282,110 @@ namespace O3DESharp.BindingGenerator.Parsing
                 args.Add(pre);
             }
 
-            // Parse each header file. Unconditional [N/M] progress lines
-            // (and elapsed timing per file) so the editor log shows a
-            // moving cursor even with --verbose off. Without this, a
-            // single slow header inside a 200-file gem looks like the
-            // generator is wedged: there's no output between gem start
-            // and gem complete, sometimes for minutes.
-            var clangArgs = args.ToArray();
-            int total = headerFiles.Count;
-            int index = 0;
-            var gemSw = System.Diagnostics.Stopwatch.StartNew();
+            return args.ToArray();
+        }
 
-            // Share one CXIndex across every header file in this gem
-            // instead of creating/disposing a new one per file. A CXIndex
-            // is just a libclang session handle - reusing it is the
-            // standard clang_createIndex-once / clang_parseTranslationUnit-
-            // many-times pattern. Scoped to the gem (not the whole
-            // multi-gem run) because each gem can have a different
-            // include-path/define set, and CXIndex doesn't carry
-            // per-parse state that would make cross-gem sharing meaningful.
-            using var clangIndex = CXIndex.Create();
-
-            foreach (var headerFile in headerFiles)
-            {
-                index++;
-                var sw = System.Diagnostics.Stopwatch.StartNew();
-                // Trim the path to just the filename for the progress
-                // line so it's readable; verbose mode (gated below)
-                // still prints the full path inside ParseHeaderFile.
-                var shortName = System.IO.Path.GetFileName(headerFile);
-                Console.WriteLine($"  [{gemName}] ({index}/{total}) {shortName}");
-                try
-                {
-                    ParseHeaderFile(headerFile, clangArgs, bindings, clangIndex);
-                }
-                catch (Exception ex)
+        /// <summary>
+        /// Parse a single header into its own ParsedBindings. Safe to call
+        /// from several threads at once on the same parser as long as each
+        /// thread passes its own <paramref name="index"/>; combine the
+        /// results with <see cref="MergeHeaderResults"/>. With a
+        /// HeaderParseCache, an unchanged header is served from the cache
+        /// and libclang is not invoked for it at all.
+        /// </summary>
+        /// <param name="headerFile">Header to parse</param>
+        /// <param name="clangArgs">Arguments from <see cref="BuildClangArgs"/></param>
+        /// <param name="index">libclang index owned by the calling thread</param>
+        /// <param name="gemName">Name of the gem being parsed</param>
+        /// <param name="headerCount">Total headers in the gem, for the progress line</param>
+        public ParsedBindings ParseHeader(string headerFile, string[] clangArgs, CXIndex index, string gemName, int headerCount)
+        {
+            var sw = System.Diagnostics.Stopwatch.StartNew();
+            var argsHash = _headerCache != null
+                ? _argsHashes.GetValue(clangArgs, a => HeaderParseCache.ComputeArgsHash(a, _requireExportAttribute))
+                : string.Empty;
+            if (_headerCache != null && _headerCache.TryGet(headerFile, argsHash, gemName, out var cached))
+            {
+                Interlocked.Add(ref _skippedFilteredClassCount, cached.SkippedFilteredClassCount);
+                Interlocked.Add(ref _skippedNoBindableMembersCount, cached.SkippedNoBindableMembersCount);
+                var cachedDone = Interlocked.Increment(ref _headersParsed);
+                Console.WriteLine($"  [{gemName}] ({cachedDone}/{headerCount}) {Path.GetFileName(headerFile)} (cached)");
+                return cached;
+            }
+
+            var bindings = new ParsedBindings { GemName = gemName };
+            try
+            {
+                // Only a parse that ran to completion is worth caching; a
+                // missing file or libclang failure should be retried next run.
+                if (ParseHeaderFile(headerFile, clangArgs, bindings, index))
                 {
-                    Console.WriteLine($"  [{gemName}] Error parsing {headerFile}: {ex.Message}");
-                    if (_verbose)
-                    {
-                        Console.WriteLine(ex.StackTrace);
-                    }
+                    _headerCache?.Store(headerFile, argsHash, bindings);
                 }
-                sw.Stop();
-                // Only print the timing line when a file was actually
-                // slow (>500ms). Per-file noise for the common case
-                // (<50ms libclang parses) would drown out the signal.
-                if (sw.ElapsedMilliseconds > 500)
+            }
+            catch (Exception ex)
+            {
+                Console.WriteLine($"  [{gemName}] Error parsing {headerFile}: {ex.Message}");
+                if (_verbose)
                 {
-                    Console.WriteLine($"  [{gemName}]   ^^ {sw.ElapsedMilliseconds} ms");
+                    Console.WriteLine(ex.StackTrace);
                 }
             }
-            gemSw.Stop();
-
-            // Unconditional summary line - tells the user this gem's
-            // parse step finished and how long it took. Code-gen is
-            // typically fast after this, so "summary then Generated
-            // bindings 1 sec later" is the normal cadence.
-            Console.WriteLine(
-                $"  [{gemName}] Parsed {bindings.Classes.Count} classes, " +
-                $"{bindings.Functions.Count} functions, {bindings.Enums.Count} enums " +
-                $"in {gemSw.Elapsed.TotalSeconds:F1}s");
+            sw.Stop();
+
+            // Unconditional [N/M] progress lines so the editor log shows a
+            // moving cursor even with --verbose off. Printed on completion:
+            // with several headers in flight, a "starting X" line no longer
+            // tells you which one is slow, but the elapsed time does. Only
+            // slow files (>500ms) get the timing, so the common <50ms
+            // parse doesn't drown out the signal.
+            var done = Interlocked.Increment(ref _headersParsed);
+            var shortName = Path.GetFileName(headerFile);
+            Console.WriteLine(sw.ElapsedMilliseconds > 500
+                ? $"  [{gemName}] ({done}/{headerCount}) {shortName} ({sw.ElapsedMilliseconds} ms)"
+                : $"  [{gemName}] ({done}/{headerCount}) {shortName}");
 
             return bindings;
         }
 
-        private unsafe void ParseHeaderFile(string headerFile, string[] clangArgs, ParsedBindings bindings, CXIndex index)
+        /// <summary>
+        /// Concatenate per-header results in the order given. Callers pass
+        /// them in header-file order so the merged lists come out exactly as
+        /// a serial parse would have produced them.
+        /// </summary>
+        public static ParsedBindings MergeHeaderResults(string gemName, IEnumerable<ParsedBindings?> perHeader)
+        {
+            var merged = new ParsedBindings { GemName = gemName };
+            foreach (var part in perHeader)
+            {
+                if (part == null)
+                {
+                    continue;
+                }
+                merged.Classes.AddRange(part.Classes);
+                merged.Functions.AddRange(part.Functions);
+                merged.Enums.AddRange(part.Enums);
+                merged.SourceFiles.UnionWith(part.SourceFiles);
+                merged.SkippedFilteredClassCount += part.SkippedFilteredClassCount;
+                merged.SkippedNoBindableMembersCount += part.SkippedNoBindableMembersCount;
+            }
+            return merged;
+        }
+
+        /// <returns>False if the header is missing or libclang could not parse it</returns>
+        private unsafe bool ParseHeaderFile(string headerFile, string[] clangArgs, ParsedBindings bindings, CXIndex index)
         {
             if (!File.Exists(headerFile))
             {
                 Console.WriteLine($"Warning: Header file not found: {headerFile}");
-                return;
+                return false;
             }
 
             Log($"Parsing: {headerFile}");
 
-            // index is shared across every header file in this gem (see
-            // ParseHeaders) - we do NOT create or dispose it here anymore.
+            // index is owned by the calling worker and reused for every
+            // header it parses (see ParseHeaders) - we do NOT create or
+            // dispose it here.
 
             // Parse the translation unit
             var translationUnitError = CXTranslationUnit.TryParse(
@@ -303,7 +399,7 @@ namespace O3DESharp.BindingGenerator.Parsing
             if (translationUnitError != CXErrorCode.CXError_Success)
             {
                 Console.WriteLine($"Failed to parse {headerFile}: {translationUnitError}");
-                return;
+                return false;
             }
 
             using (translationUnit)
@@ -445,6 +541,8 @@ namespace O3DESharp.BindingGenerator.Parsing
                     return CXChildVisitResult.CXChildVisit_Continue;
                 }, default(CXClientData));
             }
+
+            return true;
         }
 
         private unsafe bool HasExportAttribute(CXCursor cursor)
@@ -575,7 +673,8 @@ namespace O3DESharp.BindingGenerator.Parsing
             // Skip classes with invalid/un-bindable names
             if (ShouldSkipClass(className))
             {
-                SkippedFilteredClassCount++;
+                Interlocked.Increment(ref _skippedFilteredClassCount);
+                bindings.SkippedFilteredClassCount++;
                 Log($"  Skipping class: {className} (filtered)");
                 return;
             }
@@ -687,7 +786,8 @@ namespace O3DESharp.BindingGenerator.Parsing
             }
             else
             {
-                SkippedNoBindableMembersCount++;
+                Interlocked.Increment(ref _skippedNoBindableMembersCount);
+                bindings.SkippedNoBindableMembersCount++;
                 Log($"  Skipping class: {parsedClass.QualifiedName} (no bindable members)");
             }
         }
@@ -731,6 +831,10 @@ namespace O3DESharp.BindingGenerator.Parsing
             if (string.IsNullOrEmpty(csType))
                 return false;
 
+            // Array parameters mapped to ReadOnlySpan<T> by TypeMapper
+            if (type.ArrayElementType != null)
+                return true;
+
             // These are C++ types with no sensible C# mapping
             var unbindableTypes = new HashSet<string>(StringComparer.Ordinal)
             {
@@ -766,7 +870,7 @@ namespace O3DESharp.BindingGenerator.Parsing
                 var parameter = new ParsedParameter
                 {
                     Name = paramCursor.Spelling.ToString(),
-                    Type = _typeMapper.MapType(paramCursor.Type.Spelling.ToString())
+                    Type = _typeMapper.MapParameterType(paramCursor.Type.Spelling.ToString())
                 };
 
                 method.Parameters.Add(parameter);
@@ -805,7 +909,7 @@ namespace O3DESharp.BindingGenerator.Parsing
                 var parameter = new ParsedParameter
                 {
                     Name = paramCursor.Spelling.ToString(),
-                    Type = _typeMapper.MapType(paramCursor.Type.Spelling.ToString())
+                    Type = _typeMapper.MapParameterType(paramCursor.Type.Spelling.ToString())
                 };
 
                 function.Parameters.Add(parameter);
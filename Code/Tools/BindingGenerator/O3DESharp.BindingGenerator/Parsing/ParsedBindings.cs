@@ -44,6 +44,18 @@ namespace O3DESharp.BindingGenerator.Parsing
         /// Populated by O3DEHeaderParser. Excludes system headers.
         /// </summary>
         public HashSet<string> SourceFiles { get; } = new HashSet<string>(System.StringComparer.OrdinalIgnoreCase);
+
+        /// <summary>
+        /// Classes dropped because their name matched a filtered pattern.
+        /// Kept per result (not just on the parser) so a header served from
+        /// HeaderParseCache still counts towards the gem's skip summary.
+        /// </summary>
+        public int SkippedFilteredClassCount { get; set; }
+
+        /// <summary>
+        /// Classes dropped because no bindable public members were left.
+        /// </summary>
+        public int SkippedNoBindableMembersCount { get; set; }
     }
 
     /// <summary>
@@ -312,5 +324,19 @@ namespace O3DESharp.BindingGenerator.Parsing
         /// Whether this type requires marshaling
         /// </summary>
         public bool RequiresMarshaling { get; set; }
+
+        /// <summary>
+        /// For an array parameter passed as a span (AZStd::vector / AZStd::span
+        /// of a primitive), the C# element type; null otherwise. Such a
+        /// parameter crosses the interop boundary as a pointer plus a count.
+        /// </summary>
+        public string? ArrayElementType { get; set; }
+
+        /// <summary>
+        /// C++ element type as written in the template argument (e.g.
+        /// "const float" for AZStd::span&lt;const float&gt;). Set together
+        /// with <see cref="ArrayElementType"/>.
+        /// </summary>
+        public string? ArrayElementCppType { get; set; }
     }
 }
@@ -34,6 +34,20 @@ namespace O3DESharp.BindingGenerator.Parsing
             "Vector2", "Vector3", "Quaternion",
         };
 
+        /// <summary>
+        /// C# element types an array parameter may have to be passed as a
+        /// span. Primitives only: their C# and C++ layouts are identical, so
+        /// the native side can read the managed buffer in place.
+        /// </summary>
+        private static readonly HashSet<string> SpanElementTypes = new HashSet<string>(System.StringComparer.Ordinal)
+        {
+            "byte", "sbyte", "short", "ushort", "int", "uint",
+            "long", "ulong", "float", "double",
+        };
+
+        private static readonly System.Text.RegularExpressions.Regex ArrayTypeRegex =
+            new System.Text.RegularExpressions.Regex(@"^AZStd::(vector|span)\s*<\s*(.+?)\s*>$", System.Text.RegularExpressions.RegexOptions.Compiled);
+
         public TypeMapper()
         {
             _typeMap = new Dictionary<string, string>
@@ -241,6 +255,49 @@ namespace O3DESharp.BindingGenerator.Parsing
             return parsedType;
         }
 
+        /// <summary>
+        /// Map a C++ parameter type. Same as <see cref="MapType"/>, except
+        /// that an AZStd::vector or AZStd::span of a primitive, taken by value
+        /// or const reference, becomes a <c>ReadOnlySpan&lt;T&gt;</c> (see
+        /// <see cref="ParsedType.ArrayElementType"/>) instead of an opaque
+        /// IntPtr. Return types and fields keep using MapType - a span can't
+        /// outlive the call that produced it.
+        /// </summary>
+        public ParsedType MapParameterType(string cppType)
+        {
+            var parsedType = MapType(cppType);
+            if (parsedType.IsPointer || (parsedType.IsReference && !parsedType.IsConst))
+            {
+                return parsedType;
+            }
+
+            var baseType = NormalizeType(cppType);
+            if (baseType.StartsWith("const "))
+            {
+                baseType = baseType.Substring(6).Trim();
+            }
+            baseType = baseType.TrimEnd('&').Trim();
+
+            var match = ArrayTypeRegex.Match(baseType);
+            if (!match.Success)
+            {
+                return parsedType;
+            }
+
+            var elementCpp = match.Groups[2].Value;
+            var element = MapType(elementCpp);
+            if (element.IsPointer || element.IsReference || !SpanElementTypes.Contains(element.CSharpTypeName))
+            {
+                return parsedType;
+            }
+
+            parsedType.CSharpTypeName = $"ReadOnlySpan<{element.CSharpTypeName}>";
+            parsedType.ArrayElementType = element.CSharpTypeName;
+            parsedType.ArrayElementCppType = elementCpp;
+            parsedType.RequiresMarshaling = false;
+            return parsedType;
+        }
+
         /// <summary>
         /// Check if a C# type name is a known blittable value type.
         /// </summary>
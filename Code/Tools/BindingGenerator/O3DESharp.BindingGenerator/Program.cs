@@ -110,6 +110,14 @@ namespace O3DESharp.BindingGenerator
                 getDefaultValue: () => false,
                 description: "ClangSharp only. Add every discovered gem's include surface to the parse path, not just declared dependencies. Fixes cross-gem 'file not found' errors when gem.json doesn't declare every transitive include.");
 
+            // Gems and headers are prepared, parsed and generated on all
+            // cores by default. -j 1 gets the old serial run back, which
+            // is handy when reading a --verbose log top to bottom.
+            var jobsOption = new Option<int>(
+                aliases: new[] { "--jobs", "-j" },
+                getDefaultValue: () => 0,
+                description: "ClangSharp only. Maximum gems/headers processed at once (0 = one per core).");
+
             // Generator backend selector: "reflection" (default) uses
             // ReflectionDataExporter's JSON output (the BehaviorContext
             // public-API surface; same data Lua / ScriptCanvas / Python
@@ -157,6 +165,7 @@ namespace O3DESharp.BindingGenerator
             generateCommand.AddOption(requireAttributeOption);
             generateCommand.AddOption(csharpOutputOption);
             generateCommand.AddOption(allGemsIncludeOption);
+            generateCommand.AddOption(jobsOption);
             generateCommand.AddOption(sourceOption);
             generateCommand.AddOption(reflectionDataOption);
             generateCommand.SetHandler((context) =>
@@ -171,6 +180,7 @@ namespace O3DESharp.BindingGenerator
                 var requireAttribute = context.ParseResult.GetValueForOption(requireAttributeOption);
                 var csharpOutput = context.ParseResult.GetValueForOption(csharpOutputOption);
                 var allGemsInclude = context.ParseResult.GetValueForOption(allGemsIncludeOption);
+                var jobs = context.ParseResult.GetValueForOption(jobsOption);
                 var source = context.ParseResult.GetValueForOption(sourceOption) ?? "reflection";
                 var reflectionData = context.ParseResult.GetValueForOption(reflectionDataOption);
                 if (string.Equals(source, "reflection", StringComparison.OrdinalIgnoreCase))
@@ -179,7 +189,7 @@ namespace O3DESharp.BindingGenerator
                 }
                 else
                 {
-                    context.ExitCode = GenerateBindings(project, engine, config, gems, verbose, incremental, force, requireAttribute, csharpOutput, allGemsInclude);
+                    context.ExitCode = GenerateBindings(project, engine, config, gems, verbose, incremental, force, requireAttribute, csharpOutput, allGemsInclude, jobs);
                 }
             });
 
@@ -213,6 +223,7 @@ namespace O3DESharp.BindingGenerator
             rootCommand.AddOption(requireAttributeOption);
             rootCommand.AddOption(csharpOutputOption);
             rootCommand.AddOption(allGemsIncludeOption);
+            rootCommand.AddOption(jobsOption);
             rootCommand.AddOption(sourceOption);
             rootCommand.AddOption(reflectionDataOption);
 
@@ -228,6 +239,7 @@ namespace O3DESharp.BindingGenerator
                 var requireAttribute = context.ParseResult.GetValueForOption(requireAttributeOption);
                 var csharpOutput = context.ParseResult.GetValueForOption(csharpOutputOption);
                 var allGemsInclude = context.ParseResult.GetValueForOption(allGemsIncludeOption);
+                var jobs = context.ParseResult.GetValueForOption(jobsOption);
                 var source = context.ParseResult.GetValueForOption(sourceOption) ?? "reflection";
                 var reflectionData = context.ParseResult.GetValueForOption(reflectionDataOption);
                 if (string.Equals(source, "reflection", StringComparison.OrdinalIgnoreCase))
@@ -236,7 +248,7 @@ namespace O3DESharp.BindingGenerator
                 }
                 else
                 {
-                    context.ExitCode = GenerateBindings(project, engine, config, gems, verbose, incremental, force, requireAttribute, csharpOutput, allGemsInclude);
+                    context.ExitCode = GenerateBindings(project, engine, config, gems, verbose, incremental, force, requireAttribute, csharpOutput, allGemsInclude, jobs);
                 }
             });
 
@@ -368,7 +380,7 @@ namespace O3DESharp.BindingGenerator
             }
         }
 
-        static int GenerateBindings(string projectPath, string? enginePath, string configPath, string[] specificGems, bool verbose, bool incremental, bool force, bool requireAttribute, string? csharpOutputDir, bool allGemsIncludePath = false)
+        static int GenerateBindings(string projectPath, string? enginePath, string configPath, string[] specificGems, bool verbose, bool incremental, bool force, bool requireAttribute, string? csharpOutputDir, bool allGemsIncludePath = false, int jobs = 0)
         {
             try
             {
@@ -415,7 +427,8 @@ namespace O3DESharp.BindingGenerator
                 Console.WriteLine($"Verbose: {verbose}");
                 Console.WriteLine($"Incremental: {incremental}");
                 Console.WriteLine($"Force rebuild: {force}");
-                Console.WriteLine($"All-gems-include: {allGemsIncludePath}\n");
+                Console.WriteLine($"All-gems-include: {allGemsIncludePath}");
+                Console.WriteLine($"Jobs: {(jobs > 0 ? jobs.ToString() : $"{Environment.ProcessorCount} (all cores)")}\n");
 
                 // Discover gems
                 var discoveryService = new GemDiscoveryService(verbose, enginePath);
@@ -467,7 +480,7 @@ namespace O3DESharp.BindingGenerator
                 Console.WriteLine();
 
                 // Generate bindings
-                var generator = new MultiGemBindingGenerator(config, verbose, force, discoveryService.ResolvedEnginePath, allGemsIncludePath);
+                var generator = new MultiGemBindingGenerator(config, verbose, force, discoveryService.ResolvedEnginePath, allGemsIncludePath, jobs);
                 var projectDir = Path.GetDirectoryName(Path.GetFullPath(projectPath)) ?? projectPath;
                 generator.GenerateAll(allGems, sortedGems, projectDir);
 
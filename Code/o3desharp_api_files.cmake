@@ -10,6 +10,8 @@ set(FILES
     Include/O3DESharp/O3DESharpBus.h
     Include/O3DESharp/O3DESharpHotReloadBus.h
     Include/O3DESharp/O3DESharpExposedPropertyBus.h
+    Include/O3DESharp/O3DESharpScriptBus.h
+    Include/O3DESharp/O3DESharpStatsBus.h
     Include/O3DESharp/O3DESharpTypeIds.h
     Include/O3DESharp/O3DESharpFeatureProcessorInterface.h
 )
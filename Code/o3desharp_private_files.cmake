@@ -25,12 +25,36 @@ set(FILES
     Source/Scripting/ScriptBindings.cpp
     Source/Scripting/CSharpScriptComponent.h
     Source/Scripting/CSharpScriptComponent.cpp
+    Source/Scripting/ExposedPropertyBlock.h
+    Source/Scripting/ExposedPropertyBlock.cpp
+    Source/Scripting/FrameSnapshot.h
+    Source/Scripting/FrameSnapshot.cpp
+    Source/Scripting/ScriptLogQueue.h
+    Source/Scripting/ScriptLogQueue.cpp
+    Source/Scripting/ScriptActivationQueue.h
+    Source/Scripting/ScriptActivationQueue.cpp
+    Source/Scripting/ParallelScriptUpdater.h
+    Source/Scripting/ParallelScriptUpdater.cpp
+    Source/Scripting/InteropProfiler.h
+    Source/Scripting/InteropProfiler.cpp
+    Source/Scripting/InternalCallGuard.h
+    Source/Scripting/InternalCallGuard.cpp
+    Source/Scripting/InteropTracer.h
+    Source/Scripting/InteropTracer.cpp
+    Source/Scripting/ScriptProfiler.h
+    Source/Scripting/ScriptProfiler.cpp
+    Source/Scripting/ScriptTickScheduler.h
+    Source/Scripting/ScriptTickScheduler.cpp
 
     # BehaviorContext Reflection System
     Source/Scripting/Reflection/BehaviorContextReflector.h
     Source/Scripting/Reflection/BehaviorContextReflector.cpp
     Source/Scripting/Reflection/GenericDispatcher.h
     Source/Scripting/Reflection/GenericDispatcher.cpp
+    Source/Scripting/Reflection/InteropRecorder.h
+    Source/Scripting/Reflection/InteropRecorder.cpp
+    Source/Scripting/Reflection/InteropReplayer.h
+    Source/Scripting/Reflection/InteropReplayer.cpp
 
     # Phase 18-A: BehaviorContext <-> JSON marshaling. Shared utility
     # used by GenericDispatcher's EBus dispatch path and the upcoming